@@ -38,10 +38,12 @@ The following flags enable optional features (disable with --no-<option name>).
   --statistics             include statistics
   --assertions             turn on assertions
   --tracing                include tracing code
+  --threadsafe-nodes       allow constructing nodes from multiple threads
   --dumping                include dumping code
   --muzzle                 complete silence (no non-result output)
   --coverage               support for gcov coverage testing
   --profiling              support for gprof profiling
+  --small-numbers          store small integers and rationals inline (GMP only)
   --unit-testing           support for unit testing
   --python2                prefer using Python 2 (also for Python bindings)
   --python3                prefer using Python 3 (also for Python bindings)
@@ -142,9 +144,11 @@ python_bindings=default
 java_bindings=default
 editline=default
 shared=default
+small_numbers=default
 static_binary=default
 statistics=default
 symfpu=default
+threadsafe_nodes=default
 tracing=default
 tsan=default
 ubsan=default
@@ -275,6 +279,9 @@ do
     --symfpu) symfpu=ON;;
     --no-symfpu) symfpu=OFF;;
 
+    --threadsafe-nodes) threadsafe_nodes=ON;;
+    --no-threadsafe-nodes) threadsafe_nodes=OFF;;
+
     --tracing) tracing=ON;;
     --no-tracing) tracing=OFF;;
 
@@ -301,6 +308,9 @@ do
     --profiling) profiling=ON;;
     --no-profiling) profiling=OFF;;
 
+    --small-numbers) small_numbers=ON;;
+    --no-small-numbers) small_numbers=OFF;;
+
     --editline) editline=ON;;
     --no-editline) editline=OFF;;
 
@@ -401,6 +411,8 @@ cmake_opts=""
   && cmake_opts="$cmake_opts -DENABLE_STATIC_BINARY=$static_binary"
 [ $statistics != default ] \
   && cmake_opts="$cmake_opts -DENABLE_STATISTICS=$statistics"
+[ $threadsafe_nodes != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_THREADSAFE_NODES=$threadsafe_nodes"
 [ $tracing != default ] \
   && cmake_opts="$cmake_opts -DENABLE_TRACING=$tracing"
 [ $unit_testing != default ] \
@@ -417,6 +429,8 @@ cmake_opts=""
   && cmake_opts="$cmake_opts -DENABLE_VALGRIND=$valgrind"
 [ $profiling != default ] \
   && cmake_opts="$cmake_opts -DENABLE_PROFILING=$profiling"
+[ $small_numbers != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_SMALL_NUMBERS=$small_numbers"
 [ $editline != default ] \
   && cmake_opts="$cmake_opts -DUSE_EDITLINE=$editline"
 [ $abc != default ] \
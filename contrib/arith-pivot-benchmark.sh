@@ -0,0 +1,84 @@
+#!/bin/bash
+# Micro-benchmark of the simplex pivot and update throughput.
+#
+# ./contrib/arith-pivot-benchmark.sh <cvc4 command> [<cvc4 command>*] [-- <additional cvc4 options>*]
+#
+# Runs each given cvc4 command on the QF_LRA benchmarks of the regression
+# tests (test/regress, or the directory in $BENCHMARK_DIR) and reports the
+# total number of pivots and updates of the simplex procedures, the time spent
+# in pivots (theory::arith::pivotTime) and the resulting throughput.  A command
+# is the path to a cvc4 binary, optionally followed by options, e.g.
+#
+#   ./contrib/arith-pivot-benchmark.sh "build/bin/cvc4 --tableau-storage=linked" \
+#                                      "build/bin/cvc4 --tableau-storage=rows"
+#
+# compares the memory layouts of the tableau, and two binaries compare a build
+# with small integers and rationals stored inline (the default) against one
+# configured with --no-small-numbers.  If perf is installed, the number of
+# cache misses is reported as well.
+
+if [[ "$#" < 1 || ! -x "${1%% *}" ]]; then
+  echo "Usage: $0 <cvc4 command> [<cvc4 command>*] [-- <additional cvc4 options>*]"
+  exit 1
+fi
+
+commands=()
+while [[ "$#" -gt 0 && "$1" != "--" ]]; do
+  commands+=("$1")
+  shift
+done
+[[ "$1" == "--" ]] && shift
+
+perf=""
+if command -v perf > /dev/null && perf stat -e cache-misses true > /dev/null 2>&1; then
+  perf="perf stat -x , -e cache-misses"
+fi
+
+dir=${BENCHMARK_DIR:-test/regress}
+benchmarks=$(grep -rl '^(set-logic QF_LRA)' "$dir" --include='*.smt2' \
+  | xargs grep -L '^; \(EXPECT-ERROR\|COMMAND-LINE\|REQUIRES\|DISABLE-TESTER\)' \
+  | sort)
+
+# print the value of statistic $1 in the statistics output $2
+stat()
+{
+  echo "$2" | sed -n "s/^$1, \([0-9.]*\).*/\1/p" | head -n 1
+}
+
+for cvc4 in "${commands[@]}"; do
+  pivots=0
+  updates=0
+  pivot_time=0
+  total_time=0
+  cache_misses=0
+  count=0
+  for f in $benchmarks; do
+    start=$(date +%s.%N)
+    out=$(timeout 60 $perf $cvc4 --stats --tlimit=60000 "$@" "$f" 2>&1 >/dev/null)
+    end=$(date +%s.%N)
+    p=$(stat theory::arith::pivots "$out")
+    u=$(stat theory::arith::updates "$out")
+    t=$(stat theory::arith::pivotTime "$out")
+    m=$(echo "$out" | sed -n 's/^\([0-9]*\),.*cache-misses.*/\1/p' | head -n 1)
+    pivots=$((pivots + ${p:-0}))
+    updates=$((updates + ${u:-0}))
+    cache_misses=$((cache_misses + ${m:-0}))
+    pivot_time=$(awk "BEGIN { print $pivot_time + ${t:-0} }")
+    total_time=$(awk "BEGIN { print $total_time + $end - $start }")
+    count=$((count + 1))
+  done
+
+  echo "$cvc4"
+  echo "  benchmarks:          $count"
+  echo "  pivots:              $pivots"
+  echo "  updates:             $updates"
+  echo "  pivot time:          ${pivot_time}s"
+  echo "  total time:          ${total_time}s"
+  awk "BEGIN { if ($pivot_time > 0) \
+    printf \"  pivots per second:   %d\\n\", $pivots / $pivot_time }"
+  awk "BEGIN { if ($total_time > 0) \
+    printf \"  updates per second:  %d\\n\", $updates / $total_time }"
+  if [[ -n "$perf" ]]; then
+    echo "  cache misses:        $cache_misses"
+  fi
+done
@@ -0,0 +1,71 @@
+#!/bin/bash
+# Benchmark for the multiplier and divider encodings of the bit-blaster.
+#
+# ./contrib/bv-mult-benchmark.sh <path to cvc4> [<cvc4 options>*] [-- <cvc4 options>*]*
+#
+# Runs cvc4 on the QF_BV benchmarks of the regression tests (test/regress, or
+# the directory in $BENCHMARK_DIR) that multiply, divide or take remainders,
+# once for each group of options separated by --, and reports the total
+# number of clauses added to the bit-vector SAT solvers (bvminisat::clauses)
+# and the total solving time of each configuration, e.g.
+#
+#   ./contrib/bv-mult-benchmark.sh build/bin/cvc4 \
+#       -- --bv-multiplier=wallace \
+#       -- --bv-multiplier=dadda --bv-divider=non-restoring \
+#       -- --bv-multiplier=dadda --bv-karatsuba-width=16
+#
+# compares the default shift-add multiplier and restoring divider with the
+# tree multipliers, the non-restoring divider and Karatsuba splitting.  The
+# clause counts are only reported with the default --bv-sat-solver=minisat.
+
+if [[ "$#" < 1 || ! -x "$1" ]]; then
+  echo "Usage: $0 <path to cvc4> [<cvc4 options>*] [-- <cvc4 options>*]*"
+  exit 1
+fi
+
+cvc4=$1
+shift
+
+configs=()
+current=""
+for arg in "$@"; do
+  if [[ "$arg" == "--" ]]; then
+    configs+=("$current")
+    current=""
+  else
+    current="$current $arg"
+  fi
+done
+configs+=("$current")
+
+dir=${BENCHMARK_DIR:-test/regress}
+benchmarks=$(grep -rl '^(set-logic QF_BV)' "$dir" --include='*.smt2' \
+  | xargs grep -l 'bvmul\|bvudiv\|bvurem\|bvsdiv\|bvsrem\|bvsmod' \
+  | xargs grep -L '^; \(EXPECT-ERROR\|COMMAND-LINE\|REQUIRES\|DISABLE-TESTER\)' \
+  | sort)
+
+for options in "${configs[@]}"; do
+  clauses=0
+  total_time=0
+  count=0
+  timeouts=0
+  for f in $benchmarks; do
+    start=$(date +%s.%N)
+    out=$(timeout 60 $cvc4 --stats --tlimit=60000 $options "$f" 2>&1 >/dev/null)
+    status=$?
+    end=$(date +%s.%N)
+    # the lazy solver reports one statistic per bit-blaster
+    c=$(echo "$out" | sed -n 's/^.*bvminisat::clauses, \([0-9]*\).*/\1/p' \
+      | awk '{ s += $1 } END { print s + 0 }')
+    clauses=$((clauses + c))
+    total_time=$(awk "BEGIN { print $total_time + $end - $start }")
+    count=$((count + 1))
+    [[ "$status" -ne 0 ]] && timeouts=$((timeouts + 1))
+  done
+
+  echo "$cvc4$options"
+  echo "  benchmarks:          $count"
+  echo "  timeouts or errors:  $timeouts"
+  echo "  clauses:             $clauses"
+  echo "  total time:          ${total_time}s"
+done
@@ -0,0 +1,62 @@
+#!/bin/bash
+# Benchmark for the persistent rewrite cache (--rewrite-cache-file).
+#
+# ./contrib/rewrite-cache-benchmark.sh <path to cvc4> [<benchmark dir>] [<additional cvc4 options>*]
+#
+# Runs cvc4 on each .smt2 benchmark in the given directory (default:
+# test/regress/regress0) three times: without the cache, with a cold cache and
+# with the cache warmed up by the previous run.  Reports the total preprocessing
+# time (smt::SmtEngine::processAssertionsTime) of each configuration and the
+# hit rate of the warm cache.
+
+if [[ "$#" < 1 || ! -x "$1" ]]; then
+  echo "Usage: $0 <path to cvc4> [<benchmark dir>] [<additional cvc4 options>*]"
+  exit 1
+fi
+
+cvc4=$1
+dir=${2:-test/regress/regress0}
+cache=$(mktemp -d)
+trap 'rm -rf "$cache"' EXIT
+
+# print the value of statistic $1 in the statistics output $2
+stat()
+{
+  echo "$2" | sed -n "s/^$1, \([0-9.]*\).*/\1/p" | head -n 1
+}
+
+declare -A time
+hits=0
+misses=0
+count=0
+for f in $(find "$dir" -name '*.smt2' | sort); do
+  # skip benchmarks expecting errors or requiring special options
+  grep -q '^; \(EXPECT-ERROR\|COMMAND-LINE\|REQUIRES\|DISABLE-TESTER\)' "$f" \
+    && continue
+  name=$(echo "$f" | tr '/' '_')
+  for run in none cold warm; do
+    opts=()
+    if [[ "$run" != none ]]; then
+      opts=(--rewrite-cache-file="$cache/$name.rwc")
+    fi
+    out=$(timeout 10 "$cvc4" --stats --tlimit=10000 "${opts[@]}" "${@:3}" \
+      "$f" 2>&1 >/dev/null)
+    t=$(stat smt::SmtEngine::processAssertionsTime "$out")
+    time[$run]=$(echo "${time[$run]:-0} + ${t:-0}" | bc)
+    if [[ "$run" == warm ]]; then
+      h=$(stat theory::Rewriter::persistentCache::hits "$out")
+      m=$(stat theory::Rewriter::persistentCache::misses "$out")
+      hits=$((hits + ${h:-0}))
+      misses=$((misses + ${m:-0}))
+    fi
+  done
+  count=$((count + 1))
+done
+
+echo "benchmarks:                  $count"
+echo "preprocessing (no cache):    ${time[none]}s"
+echo "preprocessing (cold cache):  ${time[cold]}s"
+echo "preprocessing (warm cache):  ${time[warm]}s"
+if [[ $((hits + misses)) -gt 0 ]]; then
+  echo "warm cache hit rate:         $(echo "scale=3; $hits / ($hits + $misses)" | bc)"
+fi
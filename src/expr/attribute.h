@@ -24,6 +24,7 @@
 #ifndef CVC4__EXPR__ATTRIBUTE_H
 #define CVC4__EXPR__ATTRIBUTE_H
 
+#include <mutex>
 #include <string>
 #include <stdint.h>
 #include "expr/attribute_unique_id.h"
@@ -510,12 +511,14 @@ void AttributeManager::reconstructTable(AttrHash<T>& table){
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(expr::NodeValue* nv, const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool NodeManager::hasAttribute(expr::NodeValue* nv,
                                       const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->hasAttribute(nv, AttrKind());
 }
 
@@ -523,6 +526,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(expr::NodeValue* nv, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(nv, AttrKind(), ret);
 }
 
@@ -530,18 +534,21 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(expr::NodeValue* nv, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   d_attrManager->setAttribute(nv, AttrKind(), value);
 }
 
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(TNode n, const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool
 NodeManager::hasAttribute(TNode n, const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -549,6 +556,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(TNode n, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -556,18 +564,21 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(TNode n, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
 template <class AttrKind>
 inline typename AttrKind::value_type
 NodeManager::getAttribute(TypeNode n, const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(n.d_nv, AttrKind());
 }
 
 template <class AttrKind>
 inline bool
 NodeManager::hasAttribute(TypeNode n, const AttrKind&) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->hasAttribute(n.d_nv, AttrKind());
 }
 
@@ -575,6 +586,7 @@ template <class AttrKind>
 inline bool
 NodeManager::getAttribute(TypeNode n, const AttrKind&,
                           typename AttrKind::value_type& ret) const {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   return d_attrManager->getAttribute(n.d_nv, AttrKind(), ret);
 }
 
@@ -582,6 +594,7 @@ template <class AttrKind>
 inline void
 NodeManager::setAttribute(TypeNode n, const AttrKind&,
                           const typename AttrKind::value_type& value) {
+  std::lock_guard<AttributeMutex> guard(d_attrMutex);
   d_attrManager->setAttribute(n.d_nv, AttrKind(), value);
 }
 
@@ -934,16 +934,12 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv = (expr::NodeValue*)
-      std::malloc(sizeof(expr::NodeValue));
-    if(nv == NULL) {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nodeValueAllocator->allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
     nv->d_kind = d_nv->d_kind;
-    nv->d_id = d_nm->next_id++;// FIXME multithreading
+    nv->d_id = d_nm->next_id++;
     nv->d_rc = 0;
     setUsed();
     if(Debug.isOn("gc")) {
@@ -1012,15 +1008,11 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
        * reference count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nodeValueAllocator->allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
-      nv->d_id = d_nm->next_id++;// FIXME multithreading
+      nv->d_id = d_nm->next_id++;
       nv->d_rc = 0;
 
       std::copy(d_inlineNv.d_children,
@@ -1030,8 +1022,13 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
       d_inlineNv.d_nchildren = 0;
       setUsed();
 
-      //poolNv = nv;
-      d_nm->poolInsert(nv);
+      poolNv = d_nm->poolInsert(nv);
+      if (__builtin_expect((poolNv != nv), false))
+      {
+        // another thread constructed the same node in the meantime
+        d_nm->discardNodeValue(nv);
+        return poolNv;
+      }
       if(Debug.isOn("gc")) {
         Debug("gc") << "creating node value " << nv
                     << " [" << nv->d_id << "]: ";
@@ -1073,14 +1070,19 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
        * a Node wrapper. */
 
       crop();
-      expr::NodeValue* nv = d_nv;
-      nv->d_id = d_nm->next_id++;// FIXME multithreading
+      expr::NodeValue* nv = d_nm->d_nodeValueAllocator->adopt(d_nv);
+      nv->d_id = d_nm->next_id++;
       d_nv = &d_inlineNv;
       d_nvMaxChildren = nchild_thresh;
       setUsed();
 
-      //poolNv = nv;
-      d_nm->poolInsert(nv);
+      poolNv = d_nm->poolInsert(nv);
+      if (__builtin_expect((poolNv != nv), false))
+      {
+        // another thread constructed the same node in the meantime
+        d_nm->discardNodeValue(nv);
+        return poolNv;
+      }
       Debug("gc") << "creating node value " << nv
                   << " [" << nv->d_id << "]: " << *nv << "\n";
       return nv;
@@ -1114,16 +1116,12 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv = (expr::NodeValue*)
-      std::malloc(sizeof(expr::NodeValue));
-    if(nv == NULL) {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nodeValueAllocator->allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
     nv->d_kind = d_nv->d_kind;
-    nv->d_id = d_nm->next_id++;// FIXME multithreading
+    nv->d_id = d_nm->next_id++;
     nv->d_rc = 0;
     Debug("gc") << "creating node value " << nv
                 << " [" << nv->d_id << "]: " << *nv << "\n";
@@ -1189,15 +1187,11 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
        * count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nodeValueAllocator->allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
-      nv->d_id = d_nm->next_id++;// FIXME multithreading
+      nv->d_id = d_nm->next_id++;
       nv->d_rc = 0;
 
       std::copy(d_inlineNv.d_children,
@@ -1210,8 +1204,13 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
         (*i)->inc();
       }
 
-      //poolNv = nv;
-      d_nm->poolInsert(nv);
+      poolNv = d_nm->poolInsert(nv);
+      if (__builtin_expect((poolNv != nv), false))
+      {
+        // another thread constructed the same node in the meantime
+        d_nm->discardNodeValue(nv);
+        return poolNv;
+      }
       Debug("gc") << "creating node value " << nv
                   << " [" << nv->d_id << "]: " << *nv << "\n";
       return nv;
@@ -1243,15 +1242,11 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
        * decremented to match at NodeBuilder destruction time. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_nv->d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nodeValueAllocator->allocate(d_nv->d_nchildren);
       nv->d_nchildren = d_nv->d_nchildren;
       nv->d_kind = d_nv->d_kind;
-      nv->d_id = d_nm->next_id++;// FIXME multithreading
+      nv->d_id = d_nm->next_id++;
       nv->d_rc = 0;
 
       std::copy(d_nv->d_children,
@@ -1264,8 +1259,13 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
         (*i)->inc();
       }
 
-      //poolNv = nv;
-      d_nm->poolInsert(nv);
+      poolNv = d_nm->poolInsert(nv);
+      if (__builtin_expect((poolNv != nv), false))
+      {
+        // another thread constructed the same node in the meantime
+        d_nm->discardNodeValue(nv);
+        return poolNv;
+      }
       Debug("gc") << "creating node value " << nv
                   << " [" << nv->d_id << "]: " << *nv << "\n";
       return nv;
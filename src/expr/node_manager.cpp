@@ -94,11 +94,16 @@ typedef expr::Attribute<attr::LambdaBoundVarListTag, Node> LambdaBoundVarListAtt
 NodeManager::NodeManager(ExprManager* exprManager)
     : d_statisticsRegistry(new StatisticsRegistry()),
       d_skManager(new SkolemManager),
+      d_nodeValueAllocator(
+          new expr::NodeValueAllocator(d_statisticsRegistry)),
       next_id(0),
       d_attrManager(new expr::attr::AttributeManager()),
       d_exprManager(exprManager),
       d_nodeUnderDeletion(NULL),
       d_inReclaimZombies(false),
+#ifdef CVC4_THREADSAFE_NODES
+      d_concurrentScopes(0),
+#endif /* CVC4_THREADSAFE_NODES */
       d_abstractValueCount(0),
       d_skolemCounter(0)
 {
@@ -179,19 +184,21 @@ NodeManager::~NodeManager() {
 
   if(Debug.isOn("gc:leaks")) {
     Debug("gc:leaks") << "still in pool:" << endl;
-    for(NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
-          iend = d_nodeValuePool.end();
-        i != iend;
-        ++i) {
-      Debug("gc:leaks") << "  " << *i
-                        << " id=" << (*i)->d_id
-                        << " rc=" << (*i)->d_rc
-                        << " " << **i << endl;
-    }
+    auto printLeak = [](NodeValue* nv) {
+      Debug("gc:leaks") << "  " << nv << " id=" << nv->d_id
+                        << " rc=" << nv->d_rc << " " << *nv << endl;
+    };
+#ifdef CVC4_THREADSAFE_NODES
+    d_nodeValuePool.forEach(printLeak);
+#else  /* CVC4_THREADSAFE_NODES */
+    std::for_each(d_nodeValuePool.begin(), d_nodeValuePool.end(), printLeak);
+#endif /* CVC4_THREADSAFE_NODES */
     Debug("gc:leaks") << ":end:" << endl;
   }
 
   // defensive coding, in case destruction-order issues pop up (they often do)
+  delete d_nodeValueAllocator;
+  d_nodeValueAllocator = NULL;
   delete d_statisticsRegistry;
   d_statisticsRegistry = NULL;
   delete d_attrManager;
@@ -214,8 +221,11 @@ const DType& NodeManager::getDTypeForIndex(size_t index) const
 }
 
 void NodeManager::reclaimZombies() {
-  // FIXME multithreading
   Assert(!d_attrManager->inGarbageCollection());
+#ifdef CVC4_THREADSAFE_NODES
+  Assert(d_concurrentScopes == 0)
+      << "cannot reclaim zombies while the NodeManager is used concurrently";
+#endif /* CVC4_THREADSAFE_NODES */
 
   Debug("gc") << "reclaiming " << d_zombies.size() << " zombie(s)!\n";
 
@@ -241,12 +251,17 @@ void NodeManager::reclaimZombies() {
   // iterator, causing a crash.  So we need to copy the set away.
 
   vector<NodeValue*> zombies;
-  zombies.reserve(d_zombies.size());
-  remove_copy_if(d_zombies.begin(),
-                 d_zombies.end(),
-                 back_inserter(zombies),
-                 NodeValueReferenceCountNonZero());
-  d_zombies.clear();
+  {
+#ifdef CVC4_THREADSAFE_NODES
+    std::lock_guard<std::mutex> zombiesGuard(d_zombiesMutex);
+#endif /* CVC4_THREADSAFE_NODES */
+    zombies.reserve(d_zombies.size());
+    remove_copy_if(d_zombies.begin(),
+                   d_zombies.end(),
+                   back_inserter(zombies),
+                   NodeValueReferenceCountNonZero());
+    d_zombies.clear();
+  }
 
 #ifdef _LIBCPP_VERSION
   NodeValue* last = NULL;
@@ -313,11 +328,25 @@ void NodeManager::reclaimZombies() {
         // type for a constant payload.)
         kind::metakind::deleteNodeValueConstant(nv);
       }
-      free(nv);
+      d_nodeValueAllocator->deallocate(nv);
     }
   }
 }/* NodeManager::reclaimZombies() */
 
+void NodeManager::discardNodeValue(NodeValue* nv)
+{
+  Assert(nv->d_rc == 0);
+  Assert(poolLookup(nv) != nv) << "cannot discard a NodeValue in the pool";
+  Debug("gc") << "discarding node value " << nv << " [" << nv->d_id << "]"
+              << endl;
+  nv->decrRefCounts();
+  if (nv->getMetaKind() == kind::metakind::CONSTANT)
+  {
+    kind::metakind::deleteNodeValueConstant(nv);
+  }
+  d_nodeValueAllocator->deallocate(nv);
+}
+
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots) {
   std::vector<NodeValue*> order;
@@ -946,7 +975,12 @@ Node NodeManager::mkAbstractValue(const TypeNode& type) {
 }
 
 bool NodeManager::safeToReclaimZombies() const{
-  // FIXME multithreading
+#ifdef CVC4_THREADSAFE_NODES
+  if (d_concurrentScopes > 0)
+  {
+    return false;
+  }
+#endif /* CVC4_THREADSAFE_NODES */
   return !d_inReclaimZombies && !d_attrManager->inGarbageCollection();
 }
 
@@ -32,10 +32,19 @@
 #include <string>
 #include <unordered_set>
 
+#ifdef CVC4_THREADSAFE_NODES
+#include <atomic>
+#include <mutex>
+#endif /* CVC4_THREADSAFE_NODES */
+
 #include "base/check.h"
 #include "expr/kind.h"
 #include "expr/metakind.h"
 #include "expr/node_value.h"
+#include "expr/node_value_allocator.h"
+#ifdef CVC4_THREADSAFE_NODES
+#include "expr/node_value_pool.h"
+#endif /* CVC4_THREADSAFE_NODES */
 #include "options/options.h"
 
 namespace CVC4 {
@@ -84,6 +93,9 @@ class NodeManagerListener {
 class NodeManager {
   template <unsigned nchild_thresh> friend class CVC4::NodeBuilder;
   friend class NodeManagerScope;
+#ifdef CVC4_THREADSAFE_NODES
+  friend class NodeManagerConcurrentScope;
+#endif /* CVC4_THREADSAFE_NODES */
   friend class expr::NodeValue;
   friend class expr::TypeChecker;
 
@@ -96,9 +108,26 @@ class NodeManager {
     bool operator()(expr::NodeValue* nv) { return nv->d_rc > 0; }
   };
 
+#ifdef CVC4_THREADSAFE_NODES
+  typedef expr::ShardedNodeValuePool<expr::NodeValuePoolHashFunction,
+                                     expr::NodeValuePoolEq>
+      NodeValuePool;
+  /** The type of the next node id, shared by all constructing threads */
+  typedef std::atomic<size_t> NodeId;
+  /** Mutex guarding the attribute tables */
+  typedef std::recursive_mutex AttributeMutex;
+#else  /* CVC4_THREADSAFE_NODES */
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValuePoolHashFunction,
                              expr::NodeValuePoolEq> NodeValuePool;
+  typedef size_t NodeId;
+  /** Stand-in for a mutex if nodes are not shared between threads */
+  struct AttributeMutex
+  {
+    void lock() {}
+    void unlock() {}
+  };
+#endif /* CVC4_THREADSAFE_NODES */
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValueIDHashFunction,
                              expr::NodeValueIDEquality> NodeValueIDSet;
@@ -112,10 +141,16 @@ class NodeManager {
 
   NodeValuePool d_nodeValuePool;
 
-  size_t next_id;
+  /** Allocates the memory of the NodeValues in the pool */
+  expr::NodeValueAllocator* d_nodeValueAllocator;
+
+  NodeId next_id;
 
   expr::attr::AttributeManager* d_attrManager;
 
+  /** Guards d_attrManager if nodes are shared between threads */
+  mutable AttributeMutex d_attrMutex;
+
   /** The associated ExprManager */
   ExprManager* d_exprManager;
 
@@ -150,6 +185,18 @@ class NodeManager {
    */
   std::vector<expr::NodeValue*> d_maxedOut;
 
+#ifdef CVC4_THREADSAFE_NODES
+  /** Guards d_zombies and d_maxedOut */
+  std::mutex d_zombiesMutex;
+
+  /**
+   * The number of live NodeManagerConcurrentScopes.  Zombies are not
+   * reclaimed while this is non-zero, as another thread may be about to
+   * resurrect a zombie it found in the pool.
+   */
+  std::atomic<unsigned> d_concurrentScopes;
+#endif /* CVC4_THREADSAFE_NODES */
+
   /**
    * A set of operator singletons (w.r.t.  to this NodeManager
    * instance) for operators.  Conceptually, Nodes with kind, say,
@@ -237,12 +284,22 @@ class NodeManager {
   inline expr::NodeValue* poolLookup(expr::NodeValue* nv) const;
 
   /**
-   * Insert a NodeValue into the NodeManager's pool.
+   * Insert a NodeValue into the NodeManager's pool and return the
+   * NodeValue in the pool.
    *
    * It is an error to insert a NodeValue already in the pool.
-   * Enquire first with poolLookup().
+   * Enquire first with poolLookup().  If nodes are constructed
+   * concurrently, another thread may have inserted an equal NodeValue
+   * since; in that case, that NodeValue is returned and the caller has
+   * to discardNodeValue() its own.
    */
-  inline void poolInsert(expr::NodeValue* nv);
+  inline expr::NodeValue* poolInsert(expr::NodeValue* nv);
+
+  /**
+   * Free a fully constructed NodeValue that never made it into the pool,
+   * releasing the references to its children.
+   */
+  void discardNodeValue(expr::NodeValue* nv);
 
   /**
    * Remove a NodeValue from the NodeManager's pool.
@@ -263,7 +320,13 @@ class NodeManager {
    * Register a NodeValue as a zombie.
    */
   inline void markForDeletion(expr::NodeValue* nv) {
+#ifdef CVC4_THREADSAFE_NODES
+    // another thread may have resurrected nv in the meantime, which is
+    // fine since reclaimZombies() only collects zombies with rc == 0
+    std::unique_lock<std::mutex> zombiesGuard(d_zombiesMutex);
+#else  /* CVC4_THREADSAFE_NODES */
     Assert(nv->d_rc == 0);
+#endif /* CVC4_THREADSAFE_NODES */
 
     // if d_reclaiming is set, make sure we don't call
     // reclaimZombies(), because it's already running.
@@ -285,10 +348,13 @@ class NodeManager {
     // destructor, then `markForDeletion()` will be called on n2.
     Assert(d_zombies.find(nv) == d_zombies.end() || *d_zombies.find(nv) == nv);
 
-    d_zombies.insert(nv);  // FIXME multithreading
+    d_zombies.insert(nv);
 
     if(safeToReclaimZombies()) {
       if(d_zombies.size() > 5000) {
+#ifdef CVC4_THREADSAFE_NODES
+        zombiesGuard.unlock();
+#endif /* CVC4_THREADSAFE_NODES */
         reclaimZombies();
       }
     }
@@ -304,6 +370,9 @@ class NodeManager {
       Debug("gc") << "marking node value " << nv
                   << " [" << nv->d_id << "]: as maxed out" << std::endl;
     }
+#ifdef CVC4_THREADSAFE_NODES
+    std::lock_guard<std::mutex> zombiesGuard(d_zombiesMutex);
+#endif /* CVC4_THREADSAFE_NODES */
     d_maxedOut.push_back(nv);
   }
 
@@ -1096,6 +1165,36 @@ public:
   }
 };/* class NodeManagerScope */
 
+#ifdef CVC4_THREADSAFE_NODES
+/**
+ * Like a NodeManagerScope, but announces that the NodeManager may be used
+ * by several threads at once: threads that each hold a
+ * NodeManagerConcurrentScope of the same NodeManager may construct nodes,
+ * compute their types and access their attributes concurrently.  Zombies
+ * are only reclaimed once no such scope is alive anymore.
+ *
+ * Creating variables, skolems, datatypes and tuple/record types, and
+ * NodeManagerListeners, are not thread-safe and must be confined to a
+ * single thread.
+ */
+class NodeManagerConcurrentScope
+{
+ public:
+  NodeManagerConcurrentScope(NodeManager* nm) : d_scope(nm), d_nm(nm)
+  {
+    ++d_nm->d_concurrentScopes;
+  }
+
+  ~NodeManagerConcurrentScope() { --d_nm->d_concurrentScopes; }
+
+ private:
+  /** Makes d_nm the current NodeManager of this thread */
+  NodeManagerScope d_scope;
+  /** The NodeManager shared with other threads */
+  NodeManager* d_nm;
+}; /* class NodeManagerConcurrentScope */
+#endif /* CVC4_THREADSAFE_NODES */
+
 /** Get the (singleton) type for booleans. */
 inline TypeNode NodeManager::booleanType() {
   return TypeNode(mkTypeConst<TypeConstant>(BOOLEAN_TYPE));
@@ -1212,6 +1311,23 @@ inline TypeNode NodeManager::mkTesterType(TypeNode domain) {
   return mkTypeNode(kind::TESTER_TYPE, domain );
 }
 
+#ifdef CVC4_THREADSAFE_NODES
+
+inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
+  return d_nodeValuePool.find(nv);
+}
+
+inline expr::NodeValue* NodeManager::poolInsert(expr::NodeValue* nv) {
+  return d_nodeValuePool.insert(nv);
+}
+
+inline void NodeManager::poolRemove(expr::NodeValue* nv) {
+  Assert(d_nodeValuePool.find(nv) == nv) << "NodeValue is not in the pool!";
+  d_nodeValuePool.erase(nv);
+}
+
+#else /* CVC4_THREADSAFE_NODES */
+
 inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
   NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
   if(find == d_nodeValuePool.end()) {
@@ -1221,19 +1337,22 @@ inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
   }
 }
 
-inline void NodeManager::poolInsert(expr::NodeValue* nv) {
+inline expr::NodeValue* NodeManager::poolInsert(expr::NodeValue* nv) {
   Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end())
       << "NodeValue already in the pool!";
-  d_nodeValuePool.insert(nv);// FIXME multithreading
+  d_nodeValuePool.insert(nv);
+  return nv;
 }
 
 inline void NodeManager::poolRemove(expr::NodeValue* nv) {
   Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end())
       << "NodeValue is not in the pool!";
 
-  d_nodeValuePool.erase(nv);// FIXME multithreading
+  d_nodeValuePool.erase(nv);
 }
 
+#endif /* CVC4_THREADSAFE_NODES */
+
 inline Expr NodeManager::toExpr(TNode n) {
   return Expr(d_exprManager, new Node(n));
 }
@@ -1594,21 +1713,23 @@ NodeClass NodeManager::mkConstInternal(const T& val) {
     return NodeClass(nv);
   }
 
-  nv = (expr::NodeValue*)
-    std::malloc(sizeof(expr::NodeValue) + sizeof(T));
-  if(nv == NULL) {
-    throw std::bad_alloc();
-  }
+  nv = d_nodeValueAllocator->allocateConstant(sizeof(T));
 
   nv->d_nchildren = 0;
   nv->d_kind = kind::metakind::ConstantMap<T>::kind;
-  nv->d_id = next_id++;// FIXME multithreading
+  nv->d_id = next_id++;
   nv->d_rc = 0;
 
   //OwningTheory::mkConst(val);
   new (&nv->d_children) T(val);
 
-  poolInsert(nv);
+  expr::NodeValue* pooled = poolInsert(nv);
+  if (__builtin_expect((pooled != nv), false))
+  {
+    // another thread created the same constant in the meantime
+    discardNodeValue(nv);
+    return NodeClass(pooled);
+  }
   if(Debug.isOn("gc")) {
     Debug("gc") << "creating node value " << nv
                 << " [" << nv->d_id << "]: ";
@@ -28,6 +28,10 @@
 
 #include <stdint.h>
 
+#ifdef CVC4_THREADSAFE_NODES
+#include <atomic>
+#endif /* CVC4_THREADSAFE_NODES */
+
 #include <iterator>
 #include <string>
 
@@ -334,11 +338,26 @@ class NodeValue
   /** The ID (0 is reserved for the null value) */
   uint64_t d_id : NBITS_ID;
 
+#ifdef CVC4_THREADSAFE_NODES
+  /** Kind of the expression */
+  uint32_t d_kind : NBITS_KIND;
+
+  /**
+   * The expression's reference count.  @see cvc4::Node.  If nodes may be
+   * shared between threads, it is moved out of the header bit-fields so
+   * that it can be updated atomically, and it still saturates at MAX_RC.
+   * It takes 32 instead of NBITS_REFCOUNT bits. Placing d_kind before it
+   * keeps the header at 16 bytes on LP64 platforms, where the original
+   * field order would pad it to 24 bytes.
+   */
+  std::atomic<uint32_t> d_rc;
+#else  /* CVC4_THREADSAFE_NODES */
   /** The expression's reference count.  @see cvc4::Node. */
   uint32_t d_rc : NBITS_REFCOUNT;
 
   /** Kind of the expression */
   uint32_t d_kind : NBITS_KIND;
+#endif /* CVC4_THREADSAFE_NODES */
 
   /** Number of children */
   uint32_t d_nchildren : NBITS_NCHILDREN;
@@ -407,12 +426,21 @@ inline std::ostream& operator<<(std::ostream& out, const NodeValue& nv);
 namespace CVC4 {
 namespace expr {
 
+#ifdef CVC4_THREADSAFE_NODES
+inline NodeValue::NodeValue(int) :
+  d_id(0),
+  d_kind(kind::NULL_EXPR),
+  d_rc(MAX_RC),
+  d_nchildren(0) {
+}
+#else  /* CVC4_THREADSAFE_NODES */
 inline NodeValue::NodeValue(int) :
   d_id(0),
   d_rc(MAX_RC),
   d_kind(kind::NULL_EXPR),
   d_nchildren(0) {
 }
+#endif /* CVC4_THREADSAFE_NODES */
 
 inline void NodeValue::decrRefCounts() {
   for(nv_iterator i = nv_begin(); i != nv_end(); ++i) {
@@ -424,7 +452,24 @@ inline void NodeValue::inc() {
   Assert(!isBeingDeleted())
       << "NodeValue is currently being deleted "
          "and increment is being called on it. Don't Do That!";
-  // FIXME multithreading
+#ifdef CVC4_THREADSAFE_NODES
+  uint32_t rc = d_rc.load(std::memory_order_relaxed);
+  while (__builtin_expect((rc < MAX_RC), true))
+  {
+    if (d_rc.compare_exchange_weak(rc, rc + 1, std::memory_order_relaxed))
+    {
+      if (__builtin_expect((rc == MAX_RC - 1), false))
+      {
+        Assert(NodeManager::currentNM() != NULL)
+            << "No current NodeManager on incrementing of NodeValue: "
+               "maybe a public CVC4 interface function is missing a "
+               "NodeManagerScope ?";
+        NodeManager::currentNM()->markRefCountMaxedOut(this);
+      }
+      return;
+    }
+  }
+#else  /* CVC4_THREADSAFE_NODES */
   if (__builtin_expect((d_rc < MAX_RC - 1), true)) {
     ++d_rc;
   } else if (__builtin_expect((d_rc == MAX_RC - 1), false)) {
@@ -435,10 +480,28 @@ inline void NodeValue::inc() {
            "NodeManagerScope ?";
     NodeManager::currentNM()->markRefCountMaxedOut(this);
   }
+#endif /* CVC4_THREADSAFE_NODES */
 }
 
 inline void NodeValue::dec() {
-  // FIXME multithreading
+#ifdef CVC4_THREADSAFE_NODES
+  uint32_t rc = d_rc.load(std::memory_order_relaxed);
+  while (__builtin_expect((rc < MAX_RC), true))
+  {
+    if (d_rc.compare_exchange_weak(rc, rc - 1, std::memory_order_acq_rel))
+    {
+      if (__builtin_expect((rc == 1), false))
+      {
+        Assert(NodeManager::currentNM() != NULL)
+            << "No current NodeManager on destruction of NodeValue: "
+               "maybe a public CVC4 interface function is missing a "
+               "NodeManagerScope ?";
+        NodeManager::currentNM()->markForDeletion(this);
+      }
+      return;
+    }
+  }
+#else  /* CVC4_THREADSAFE_NODES */
   if(__builtin_expect( ( d_rc < MAX_RC ), true )) {
     --d_rc;
     if(__builtin_expect( ( d_rc == 0 ), false )) {
@@ -449,6 +512,7 @@ inline void NodeValue::dec() {
       NodeManager::currentNM()->markForDeletion(this);
     }
   }
+#endif /* CVC4_THREADSAFE_NODES */
 }
 
 inline NodeValue::nv_iterator NodeValue::nv_begin() {
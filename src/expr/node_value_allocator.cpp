@@ -0,0 +1,214 @@
+/*********************                                                        */
+/*! \file node_value_allocator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A slab allocator for NodeValues
+ **
+ ** A slab allocator for NodeValues.
+ **/
+
+#include "expr/node_value_allocator.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sstream>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "expr/node_value.h"
+
+namespace CVC4 {
+namespace expr {
+
+namespace {
+
+/** The size of a slab in bytes */
+constexpr size_t SLAB_SIZE = 64 * 1024;
+
+/** The size of a NodeValue with nchildren children */
+inline size_t nodeValueSize(size_t nchildren)
+{
+  return sizeof(NodeValue) + sizeof(NodeValue*) * nchildren;
+}
+
+}  // namespace
+
+#ifdef CVC4_THREADSAFE_NODES
+#define CVC4_NODE_VALUE_ALLOCATOR_GUARD \
+  std::lock_guard<std::mutex> allocatorGuard(d_mutex)
+#else /* CVC4_THREADSAFE_NODES */
+#define CVC4_NODE_VALUE_ALLOCATOR_GUARD
+#endif /* CVC4_THREADSAFE_NODES */
+
+NodeValueAllocator::OccupancyStat::OccupancyStat(const std::string& name,
+                                                 const SizeClass& sc)
+    : ReadOnlyDataStat<double>(name), d_class(sc), d_value(0)
+{
+}
+
+double NodeValueAllocator::OccupancyStat::getData() const
+{
+  return getDataRef();
+}
+
+const double& NodeValueAllocator::OccupancyStat::getDataRef() const
+{
+  size_t slots = d_class.d_slabs.size() * d_class.d_slotsPerSlab;
+  d_value = slots == 0 ? 0 : static_cast<double>(d_class.d_live) / slots;
+  return d_value;
+}
+
+NodeValueAllocator::ClassStatistics::ClassStatistics(const std::string& prefix,
+                                                     const SizeClass& sc)
+    : d_liveNodes(prefix + "liveNodes", sc.d_live),
+      d_bytes(prefix + "bytes", sc.d_bytes),
+      d_occupancy(prefix + "occupancy", sc)
+{
+}
+
+NodeValueAllocator::NodeValueAllocator(StatisticsRegistry* registry)
+    : d_liveLarge(0),
+      d_registry(registry),
+      d_statLiveLarge("expr::nodeValueAllocator::largeNodes", d_liveLarge)
+{
+  for (size_t i = 0; i <= MAX_SLAB_CHILDREN; ++i)
+  {
+    SizeClass& sc = d_classes[i];
+    sc.d_slotSize = nodeValueSize(i);
+    sc.d_slotsPerSlab = SLAB_SIZE / sc.d_slotSize;
+    sc.d_nextSlot = sc.d_slotsPerSlab;
+    sc.d_freeList = nullptr;
+    sc.d_live = 0;
+    sc.d_bytes = 0;
+
+    std::stringstream prefix;
+    prefix << "expr::nodeValueAllocator::slab" << i << "::";
+    d_classStats.emplace_back(new ClassStatistics(prefix.str(), sc));
+    d_registry->registerStat(&d_classStats.back()->d_liveNodes);
+    d_registry->registerStat(&d_classStats.back()->d_bytes);
+    d_registry->registerStat(&d_classStats.back()->d_occupancy);
+  }
+  d_registry->registerStat(&d_statLiveLarge);
+}
+
+NodeValueAllocator::~NodeValueAllocator()
+{
+  for (std::unique_ptr<ClassStatistics>& cs : d_classStats)
+  {
+    d_registry->unregisterStat(&cs->d_liveNodes);
+    d_registry->unregisterStat(&cs->d_bytes);
+    d_registry->unregisterStat(&cs->d_occupancy);
+  }
+  d_registry->unregisterStat(&d_statLiveLarge);
+
+  // NodeValues may outlive the NodeManager (e.g., if a Node is leaked). They
+  // stayed valid when each NodeValue was malloc'ed individually, hence the
+  // slabs of a size class with live NodeValues are not freed either.
+  for (SizeClass& sc : d_classes)
+  {
+    if (sc.d_live > 0)
+    {
+      Debug("gc:leaks") << "keeping " << sc.d_slabs.size() << " slabs with "
+                        << sc.d_live << " live NodeValues of size "
+                        << sc.d_slotSize << std::endl;
+      for (std::unique_ptr<char[]>& slab : sc.d_slabs)
+      {
+        slab.release();
+      }
+    }
+  }
+}
+
+void* NodeValueAllocator::allocateSlot(SizeClass& sc)
+{
+  ++sc.d_live;
+  if (sc.d_freeList != nullptr)
+  {
+    void* slot = sc.d_freeList;
+    sc.d_freeList = *static_cast<void**>(slot);
+    return slot;
+  }
+  if (__builtin_expect((sc.d_nextSlot == sc.d_slotsPerSlab), false))
+  {
+    sc.d_slabs.emplace_back(new char[sc.d_slotsPerSlab * sc.d_slotSize]);
+    sc.d_bytes += sc.d_slotsPerSlab * sc.d_slotSize;
+    sc.d_nextSlot = 0;
+  }
+  return sc.d_slabs.back().get() + sc.d_slotSize * sc.d_nextSlot++;
+}
+
+NodeValue* NodeValueAllocator::allocate(size_t nchildren)
+{
+  CVC4_NODE_VALUE_ALLOCATOR_GUARD;
+  if (__builtin_expect((nchildren <= MAX_SLAB_CHILDREN), true))
+  {
+    return static_cast<NodeValue*>(allocateSlot(d_classes[nchildren]));
+  }
+  NodeValue* nv =
+      static_cast<NodeValue*>(std::malloc(nodeValueSize(nchildren)));
+  if (nv == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  ++d_liveLarge;
+  return nv;
+}
+
+NodeValue* NodeValueAllocator::allocateConstant(size_t payloadSize)
+{
+  CVC4_NODE_VALUE_ALLOCATOR_GUARD;
+  NodeValue* nv =
+      static_cast<NodeValue*>(std::malloc(sizeof(NodeValue) + payloadSize));
+  if (nv == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  ++d_liveLarge;
+  return nv;
+}
+
+void NodeValueAllocator::deallocate(NodeValue* nv)
+{
+  CVC4_NODE_VALUE_ALLOCATOR_GUARD;
+  size_t nchildren = nv->getNumChildren();
+  if (nv->getMetaKind() == kind::metakind::CONSTANT
+      || nchildren > MAX_SLAB_CHILDREN)
+  {
+    --d_liveLarge;
+    std::free(nv);
+    return;
+  }
+  SizeClass& sc = d_classes[nchildren];
+  Assert(sc.d_live > 0);
+  --sc.d_live;
+  *reinterpret_cast<void**>(nv) = sc.d_freeList;
+  sc.d_freeList = nv;
+}
+
+NodeValue* NodeValueAllocator::adopt(NodeValue* nv)
+{
+  size_t nchildren = nv->getNumChildren();
+  if (nchildren > MAX_SLAB_CHILDREN)
+  {
+    CVC4_NODE_VALUE_ALLOCATOR_GUARD;
+    ++d_liveLarge;
+    return nv;
+  }
+  NodeValue* slot = allocate(nchildren);
+  std::memcpy(static_cast<void*>(slot), nv, nodeValueSize(nchildren));
+  std::free(nv);
+  return slot;
+}
+
+#undef CVC4_NODE_VALUE_ALLOCATOR_GUARD
+
+}  // namespace expr
+}  // namespace CVC4
@@ -0,0 +1,150 @@
+/*********************                                                        */
+/*! \file node_value_allocator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A slab allocator for NodeValues
+ **
+ ** Allocates the NodeValues of the NodeManager.  NodeValues with few
+ ** children, which are the vast majority, are carved out of large slabs,
+ ** one size class per number of children; freed NodeValues are kept in a
+ ** free list per size class and recycled.  Other NodeValues (with many
+ ** children, or carrying a constant payload) are malloc'ed individually.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+#define CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#ifdef CVC4_THREADSAFE_NODES
+#include <mutex>
+#endif /* CVC4_THREADSAFE_NODES */
+
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace expr {
+
+class NodeValue;
+
+class NodeValueAllocator
+{
+ public:
+  /** NodeValues with at most this many children are slab-allocated */
+  static constexpr size_t MAX_SLAB_CHILDREN = 4;
+
+  NodeValueAllocator(StatisticsRegistry* registry);
+  /**
+   * Frees the slabs of the size classes without live NodeValues. The slabs
+   * of the other classes are leaked, like the NodeValues in them.
+   */
+  ~NodeValueAllocator();
+
+  /**
+   * Allocate (uninitialized) memory for a NodeValue with nchildren
+   * children.  Throws std::bad_alloc if out of memory.
+   */
+  NodeValue* allocate(size_t nchildren);
+
+  /**
+   * Allocate (uninitialized) memory for a NodeValue with a constant payload
+   * of the given size.
+   */
+  NodeValue* allocateConstant(size_t payloadSize);
+
+  /**
+   * Release the memory of nv, which must have been allocated by this
+   * allocator and whose number of children (resp. metakind) must not have
+   * changed since.
+   */
+  void deallocate(NodeValue* nv);
+
+  /**
+   * Adopt the malloc'ed NodeValue nv (e.g. a NodeBuilder's heap buffer):
+   * returns nv itself if it has too many children to be slab-allocated,
+   * otherwise moves its header and children to a slab-allocated NodeValue
+   * and frees nv.
+   */
+  NodeValue* adopt(NodeValue* nv);
+
+ private:
+  /** A size class: NodeValues with a fixed number of children. */
+  struct SizeClass
+  {
+    /** The size of a NodeValue in this class */
+    size_t d_slotSize;
+    /** The number of NodeValues per slab */
+    size_t d_slotsPerSlab;
+    /** The slabs */
+    std::vector<std::unique_ptr<char[]>> d_slabs;
+    /** The next never used slot in the last slab */
+    size_t d_nextSlot;
+    /** Free list of released slots, linked through the slots themselves */
+    void* d_freeList;
+    /** The number of allocated NodeValues of this class */
+    int64_t d_live;
+    /** The number of bytes reserved by slabs */
+    int64_t d_bytes;
+  };
+
+  /** Reports the fraction of slab slots in use of a size class. */
+  class OccupancyStat : public ReadOnlyDataStat<double>
+  {
+   public:
+    OccupancyStat(const std::string& name, const SizeClass& sc);
+    double getData() const override;
+    const double& getDataRef() const override;
+
+   private:
+    /** The size class */
+    const SizeClass& d_class;
+    /** The last computed occupancy (for getDataRef()) */
+    mutable double d_value;
+  };
+
+  /** Get the memory for a NodeValue of the given size class. */
+  void* allocateSlot(SizeClass& sc);
+
+  /** Statistics of one size class */
+  struct ClassStatistics
+  {
+    ClassStatistics(const std::string& prefix, const SizeClass& sc);
+    ReferenceStat<int64_t> d_liveNodes;
+    ReferenceStat<int64_t> d_bytes;
+    OccupancyStat d_occupancy;
+  };
+
+  /** The size classes, indexed by number of children */
+  std::array<SizeClass, MAX_SLAB_CHILDREN + 1> d_classes;
+  /** The number of individually malloc'ed NodeValues */
+  int64_t d_liveLarge;
+
+#ifdef CVC4_THREADSAFE_NODES
+  /** Guards the size classes if nodes are constructed concurrently */
+  std::mutex d_mutex;
+#endif /* CVC4_THREADSAFE_NODES */
+
+  /** The registry the statistics are registered with */
+  StatisticsRegistry* d_registry;
+  /** Statistics per size class */
+  std::vector<std::unique_ptr<ClassStatistics>> d_classStats;
+  /** Number of individually malloc'ed NodeValues */
+  ReferenceStat<int64_t> d_statLiveLarge;
+}; /* class NodeValueAllocator */
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__NODE_VALUE_ALLOCATOR_H */
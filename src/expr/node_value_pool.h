@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file node_value_pool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A sharded, thread-safe pool of NodeValues
+ **
+ ** The NodeManager hash-conses NodeValues in a pool.  If nodes may be
+ ** constructed by several threads at once (CVC4_THREADSAFE_NODES), the pool
+ ** is split into shards by pool hash, each guarded by its own mutex, such
+ ** that threads constructing unrelated nodes rarely contend.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__EXPR__NODE_VALUE_POOL_H
+#define CVC4__EXPR__NODE_VALUE_POOL_H
+
+#include <array>
+#include <mutex>
+#include <unordered_set>
+
+namespace CVC4 {
+namespace expr {
+
+class NodeValue;
+
+/**
+ * A set of NodeValues with the interface of std::unordered_set (as far as
+ * used by the NodeManager) whose operations may be called concurrently.
+ * Lookups and insertions of a NodeValue only lock the shard the NodeValue
+ * hashes to.
+ */
+template <class Hash, class Eq, size_t NSHARDS = 64>
+class ShardedNodeValuePool
+{
+  typedef std::unordered_set<NodeValue*, Hash, Eq> Set;
+
+  struct Shard
+  {
+    std::mutex d_mutex;
+    Set d_set;
+  };
+
+ public:
+  /**
+   * Look up a NodeValue equal to nv (which need not be fully constructed,
+   * see NodeManager::poolLookup()), returns nullptr if there is none.
+   */
+  NodeValue* find(NodeValue* nv) const
+  {
+    size_t h = Hash()(nv);
+    Shard& s = shardFor(h);
+    std::lock_guard<std::mutex> guard(s.d_mutex);
+    typename Set::const_iterator it = s.d_set.find(nv);
+    return it == s.d_set.end() ? nullptr : *it;
+  }
+
+  /**
+   * Insert nv unless an equal NodeValue is already in the pool.  Returns the
+   * NodeValue that is in the pool afterwards, which is not nv if another
+   * thread inserted an equal NodeValue since nv was looked up.
+   */
+  NodeValue* insert(NodeValue* nv)
+  {
+    size_t h = Hash()(nv);
+    Shard& s = shardFor(h);
+    std::lock_guard<std::mutex> guard(s.d_mutex);
+    return *s.d_set.insert(nv).first;
+  }
+
+  /** Remove nv from the pool. */
+  void erase(NodeValue* nv)
+  {
+    size_t h = Hash()(nv);
+    Shard& s = shardFor(h);
+    std::lock_guard<std::mutex> guard(s.d_mutex);
+    s.d_set.erase(nv);
+  }
+
+  /** The number of NodeValues in the pool. */
+  size_t size() const
+  {
+    size_t n = 0;
+    for (Shard& s : d_shards)
+    {
+      std::lock_guard<std::mutex> guard(s.d_mutex);
+      n += s.d_set.size();
+    }
+    return n;
+  }
+
+  /**
+   * Apply f to all NodeValues in the pool.  The pool must not be modified
+   * concurrently.
+   */
+  template <class F>
+  void forEach(F f) const
+  {
+    for (const Shard& s : d_shards)
+    {
+      for (NodeValue* nv : s.d_set)
+      {
+        f(nv);
+      }
+    }
+  }
+
+ private:
+  /** Get the shard of NodeValues with hash h. */
+  Shard& shardFor(size_t h) const
+  {
+    // the low bits of the pool hash are the most mixed ones
+    return d_shards[(h ^ (h >> 17)) % NSHARDS];
+  }
+
+  /** The shards (mutable as lookups lock them) */
+  mutable std::array<Shard, NSHARDS> d_shards;
+}; /* class ShardedNodeValuePool */
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__NODE_VALUE_POOL_H */
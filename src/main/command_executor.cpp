@@ -122,7 +122,11 @@ bool CommandExecutor::doCommandSingleton(Command* cmd)
   } else {
     status = smtEngineInvoke(d_smtEngine, cmd, nullptr);
   }
+  return processResult(cmd, status);
+}
 
+bool CommandExecutor::processResult(const Command* cmd, bool status)
+{
   Result res;
   const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(cmd);
   if(cs != nullptr) {
@@ -96,6 +96,13 @@ protected:
   /** Executes treating cmd as a singleton */
   virtual bool doCommandSingleton(CVC4::Command* cmd);
 
+  /**
+   * Records the result of the (already invoked) command cmd, whose
+   * invocation returned status, and dumps the model/proof/unsat core etc.
+   * if requested. Returns the resulting status.
+   */
+  bool processResult(const CVC4::Command* cmd, bool status);
+
 private:
   CommandExecutor();
 
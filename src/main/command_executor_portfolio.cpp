@@ -0,0 +1,465 @@
+/*********************                                                        */
+/*! \file command_executor_portfolio.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An additional layer between commands and invoking them that races
+ ** differently configured solver instances.
+ **/
+
+#include "main/command_executor_portfolio.h"
+
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "options/option_exception.h"
+#include "smt/command.h"
+#include "theory/logic_info.h"
+
+namespace CVC4 {
+namespace main {
+
+namespace {
+
+/** Get the result of the check command cmd. */
+Result getCheckResult(const Command* cmd)
+{
+  if (const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(cmd))
+  {
+    return cs->getResult();
+  }
+  if (const CheckSatAssumingCommand* csa =
+          dynamic_cast<const CheckSatAssumingCommand*>(cmd))
+  {
+    return csa->getResult();
+  }
+  if (const QueryCommand* q = dynamic_cast<const QueryCommand*>(cmd))
+  {
+    return q->getResult();
+  }
+  return Result();
+}
+
+/** Split str at each occurrence of delim, dropping empty parts. */
+std::vector<std::string> split(const std::string& str, char delim)
+{
+  std::vector<std::string> parts;
+  std::stringstream ss(str);
+  std::string part;
+  while (std::getline(ss, part, delim))
+  {
+    size_t first = part.find_first_not_of(" \t");
+    if (first == std::string::npos)
+    {
+      continue;
+    }
+    size_t last = part.find_last_not_of(" \t");
+    parts.push_back(part.substr(first, last - first + 1));
+  }
+  return parts;
+}
+
+}  // namespace
+
+CommandExecutorPortfolio::CommandExecutorPortfolio(Options& options)
+    : CommandExecutor(options),
+      d_numInstances(options.getPortfolioJobs()),
+      d_disabled(false),
+      d_lastWinner(0),
+      d_statChecks("driver::portfolio::checks", 0),
+      d_statWinner("driver::portfolio::winner")
+{
+  d_stats.registerStat(&d_statChecks);
+  d_stats.registerStat(&d_statWinner);
+}
+
+CommandExecutorPortfolio::~CommandExecutorPortfolio()
+{
+  d_stats.unregisterStat(&d_statChecks);
+  d_stats.unregisterStat(&d_statWinner);
+}
+
+std::vector<std::string> CommandExecutorPortfolio::getDefaultPortfolio(
+    const LogicInfo& logic, bool primaryDecisionInternal)
+{
+  // The primary solver always runs with the options given by the user, the
+  // configurations below are the ones that most often complement it. They
+  // must differ from the primary, hence the decision mode is the one the
+  // primary does not use.
+  std::string otherDecision =
+      primaryDecisionInternal ? "decision=justification" : "decision=internal";
+  if (logic.isPure(theory::THEORY_BV) && !logic.isQuantified())
+  {
+    return {"bitblast=eager",
+            "simplification=none",
+            "bv-eq-solver=false,bv-inequality-solver=false",
+            "random-freq=0.01,random-seed=7"};
+  }
+  if (logic.isPure(theory::THEORY_ARITH) && !logic.isQuantified())
+  {
+    if (logic.areIntegersUsed())
+    {
+      return {otherDecision,
+              "use-soi,miplib-trick",
+              "simplification=none",
+              "random-freq=0.01,random-seed=7"};
+    }
+    return {otherDecision,
+            "use-fcsimplex",
+            "simplification=none,arith-rewrite-equalities",
+            "random-freq=0.01,random-seed=7"};
+  }
+  if (logic.isQuantified())
+  {
+    return {otherDecision,
+            "full-saturate-quant",
+            "finite-model-find",
+            "random-freq=0.01,random-seed=7"};
+  }
+  return {otherDecision,
+          "simplification=none",
+          "random-freq=0.01,random-seed=7"};
+}
+
+std::vector<std::string> CommandExecutorPortfolio::parsePortfolio(
+    const std::string& config)
+{
+  return split(config, ';');
+}
+
+CommandExecutorPortfolio::CommandClass CommandExecutorPortfolio::classify(
+    const Command* cmd)
+{
+  if (dynamic_cast<const CheckSatCommand*>(cmd) != nullptr
+      || dynamic_cast<const CheckSatAssumingCommand*>(cmd) != nullptr
+      || dynamic_cast<const QueryCommand*>(cmd) != nullptr)
+  {
+    return CHECK;
+  }
+  if (dynamic_cast<const GetValueCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetAssignmentCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetModelCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetProofCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetInstantiationsCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetUnsatAssumptionsCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetUnsatCoreCommand*>(cmd) != nullptr)
+  {
+    return GETTER;
+  }
+  if (dynamic_cast<const GetAssertionsCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetInfoCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetOptionCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetQuantifierEliminationCommand*>(cmd) != nullptr
+      || dynamic_cast<const SimplifyCommand*>(cmd) != nullptr
+      || dynamic_cast<const ExpandDefinitionsCommand*>(cmd) != nullptr
+      || dynamic_cast<const EchoCommand*>(cmd) != nullptr
+      || dynamic_cast<const CommentCommand*>(cmd) != nullptr
+      || dynamic_cast<const EmptyCommand*>(cmd) != nullptr
+      || dynamic_cast<const QuitCommand*>(cmd) != nullptr)
+  {
+    return PRIMARY_ONLY;
+  }
+  // These commands either have no export implementation or depend on the
+  // model of a particular instance.
+  if (dynamic_cast<const DefineFunctionRecCommand*>(cmd) != nullptr
+      || dynamic_cast<const DeclareSygusVarCommand*>(cmd) != nullptr
+      || dynamic_cast<const SynthFunCommand*>(cmd) != nullptr
+      || dynamic_cast<const SygusConstraintCommand*>(cmd) != nullptr
+      || dynamic_cast<const SygusInvConstraintCommand*>(cmd) != nullptr
+      || dynamic_cast<const CheckSynthCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetSynthSolutionCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetInterpolCommand*>(cmd) != nullptr
+      || dynamic_cast<const GetAbductCommand*>(cmd) != nullptr
+      || dynamic_cast<const BlockModelCommand*>(cmd) != nullptr
+      || dynamic_cast<const BlockModelValuesCommand*>(cmd) != nullptr
+      || dynamic_cast<const DatatypeDeclarationCommand*>(cmd) != nullptr)
+  {
+    return UNSUPPORTED;
+  }
+  return STATE;
+}
+
+void CommandExecutorPortfolio::disable(const std::string& reason)
+{
+  if (!d_disabled)
+  {
+    Notice() << "portfolio: disabled, " << reason << std::endl;
+  }
+  d_disabled = true;
+  d_workers.clear();
+  d_pending.clear();
+  d_lastWinner = 0;
+}
+
+void CommandExecutorPortfolio::initWorkers()
+{
+  Assert(d_workers.empty());
+  // the decision mode of the primary after the defaults of its logic are set
+  bool primaryDecisionInternal =
+      d_smtEngine->getOption("decision").toString().find("INTERNAL")
+      != std::string::npos;
+  std::vector<std::string> configs =
+      d_options.getPortfolioConfig().empty()
+          ? getDefaultPortfolio(d_smtEngine->getLogicInfo(),
+                                primaryDecisionInternal)
+          : parsePortfolio(d_options.getPortfolioConfig());
+  for (unsigned i = 1; i < d_numInstances; ++i)
+  {
+    std::unique_ptr<Worker> w(new Worker);
+    w->d_options.reset(new Options);
+    w->d_options->copyValues(d_options);
+    std::vector<std::string> settings;
+    if (!configs.empty())
+    {
+      settings = split(configs[(i - 1) % configs.size()], ',');
+    }
+    // once the configurations are exhausted, diversify by random seed
+    if (configs.empty() || i > configs.size())
+    {
+      settings.push_back("random-seed=" + std::to_string(i));
+    }
+    Trace("portfolio") << "portfolio: instance " << i << " uses";
+    for (const std::string& s : settings)
+    {
+      Trace("portfolio") << " --" << s;
+      size_t eq = s.find('=');
+      std::string key = s.substr(0, eq);
+      std::string value = eq == std::string::npos ? "true" : s.substr(eq + 1);
+      w->d_options->setOption(key, value);
+    }
+    Trace("portfolio") << std::endl;
+    w->d_solver.reset(new api::Solver(w->d_options.get()));
+    d_workers.push_back(std::move(w));
+  }
+}
+
+bool CommandExecutorPortfolio::replayPending()
+{
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    ExprManager* em = w->d_solver->getExprManager();
+    SmtEngine* smt = w->d_solver->getSmtEngine();
+    for (const std::unique_ptr<Command>& cmd : d_pending)
+    {
+      std::unique_ptr<Command> exported;
+      try
+      {
+        exported.reset(cmd->exportTo(em, w->d_variableMap));
+      }
+      catch (ExportUnsupportedException& e)
+      {
+        disable(std::string("cannot replay command: ") + e.what());
+        return false;
+      }
+      exported->setMuted(true);
+      smtEngineInvoke(smt, exported.get(), nullptr);
+    }
+  }
+  d_pending.clear();
+  return true;
+}
+
+bool CommandExecutorPortfolio::race(Command* cmd)
+{
+  // Instance 0 runs a clone of cmd on the primary solver, instance i > 0 runs
+  // an export of cmd on worker i - 1. The original command is never invoked,
+  // so that it does not report the interruption of a losing instance.
+  size_t n = d_workers.size() + 1;
+  std::vector<std::unique_ptr<Command>> cmds;
+  std::vector<SmtEngine*> engines;
+  cmds.emplace_back(cmd->clone());
+  engines.push_back(d_smtEngine);
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    try
+    {
+      cmds.emplace_back(
+          cmd->exportTo(w->d_solver->getExprManager(), w->d_variableMap));
+    }
+    catch (ExportUnsupportedException& e)
+    {
+      disable(std::string("cannot export check: ") + e.what());
+      return CommandExecutor::doCommandSingleton(cmd);
+    }
+    engines.push_back(w->d_solver->getSmtEngine());
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<bool> done(n, false);
+  size_t numDone = 0;
+  size_t winner = n;
+  // An interrupt of the last race may have arrived after the instance had
+  // answered. It is forgotten here, before the instances can be interrupted
+  // again, since an instance that is interrupted before its search starts
+  // ends the search as soon as it starts.
+  for (SmtEngine* e : engines)
+  {
+    e->resetInterrupt();
+  }
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < n; ++i)
+  {
+    threads.emplace_back([&, i]() {
+      {
+        // an instance that starts after the race is decided is not run
+        std::lock_guard<std::mutex> lock(mutex);
+        if (winner != n)
+        {
+          done[i] = true;
+          ++numDone;
+          cv.notify_one();
+          return;
+        }
+      }
+      // Commands catch the exceptions raised while solving and record them
+      // as their status.
+      cmds[i]->invoke(engines[i]);
+      Result res = getCheckResult(cmds[i].get()).asSatisfiabilityResult();
+      std::lock_guard<std::mutex> lock(mutex);
+      if (winner == n && !cmds[i]->fail()
+          && res.isSat() != Result::SAT_UNKNOWN)
+      {
+        winner = i;
+      }
+      done[i] = true;
+      ++numDone;
+      cv.notify_one();
+    });
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return winner != n || numDone == n; });
+    // An instance that has not started its search yet ends it as soon as it
+    // starts, so a single interrupt suffices.
+    for (size_t i = 0; i < n; ++i)
+    {
+      if (!done[i])
+      {
+        engines[i]->interrupt();
+      }
+    }
+    cv.wait(lock, [&]() { return numDone == n; });
+  }
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+
+  // If no instance gave a definitive answer, report the primary's.
+  d_lastWinner = winner == n ? 0 : winner;
+  ++d_statChecks;
+  d_statWinner << d_lastWinner;
+  Trace("portfolio") << "portfolio: instance " << d_lastWinner << " answers "
+                     << getCheckResult(cmds[d_lastWinner].get()) << std::endl;
+
+  Command* res = cmds[d_lastWinner].get();
+  if (d_options.getVerbosity() >= -1 && !(res->isMuted() && res->ok()))
+  {
+    res->printResult(*d_options.getOut(),
+                     engines[d_lastWinner]
+                         ->getOption("command-verbosity:"
+                                     + res->getCommandName())
+                         .getIntegerValue()
+                         .toUnsignedInt());
+  }
+  bool status = !res->fail()
+                || engines[d_lastWinner]
+                           ->getOption("command-verbosity:"
+                                       + res->getCommandName())
+                           .getIntegerValue()
+                       == 0;
+  return processResult(res, status);
+}
+
+bool CommandExecutorPortfolio::invokeOnWorker(Command* cmd, size_t i)
+{
+  Worker* w = d_workers[i - 1].get();
+  std::unique_ptr<Command> exported;
+  try
+  {
+    exported.reset(
+        cmd->exportTo(w->d_solver->getExprManager(), w->d_variableMap));
+  }
+  catch (ExportUnsupportedException& e)
+  {
+    // the primary solver does not have the model of the winner
+    throw Exception(std::string("portfolio: cannot export getter: ")
+                    + e.what());
+  }
+  std::ostream* out =
+      d_options.getVerbosity() >= -1 ? d_options.getOut() : nullptr;
+  bool status =
+      smtEngineInvoke(w->d_solver->getSmtEngine(), exported.get(), out);
+  return processResult(exported.get(), status);
+}
+
+bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
+{
+  if (d_disabled || d_numInstances <= 1)
+  {
+    return CommandExecutor::doCommandSingleton(cmd);
+  }
+  if (dynamic_cast<ResetCommand*>(cmd) != nullptr)
+  {
+    d_workers.clear();
+    d_pending.clear();
+    d_lastWinner = 0;
+    return CommandExecutor::doCommandSingleton(cmd);
+  }
+
+  switch (classify(cmd))
+  {
+    case CHECK:
+      if (d_workers.empty())
+      {
+        initWorkers();
+      }
+      if (!replayPending())
+      {
+        return CommandExecutor::doCommandSingleton(cmd);
+      }
+      return race(cmd);
+
+    case GETTER:
+      if (d_lastWinner == 0)
+      {
+        return CommandExecutor::doCommandSingleton(cmd);
+      }
+      return invokeOnWorker(cmd, d_lastWinner);
+
+    case STATE:
+    {
+      // the model of the last winner is outdated from now on
+      d_lastWinner = 0;
+      bool status = CommandExecutor::doCommandSingleton(cmd);
+      if (!cmd->fail())
+      {
+        d_pending.emplace_back(cmd->clone());
+      }
+      return status;
+    }
+
+    case UNSUPPORTED:
+      disable("unsupported command " + cmd->getCommandName());
+      return CommandExecutor::doCommandSingleton(cmd);
+
+    default:
+      Assert(classify(cmd) == PRIMARY_ONLY);
+      return CommandExecutor::doCommandSingleton(cmd);
+  }
+}
+
+}  // namespace main
+}  // namespace CVC4
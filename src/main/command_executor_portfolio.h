@@ -0,0 +1,141 @@
+/*********************                                                        */
+/*! \file command_executor_portfolio.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An additional layer between commands and invoking them that races
+ ** differently configured solver instances.
+ **
+ ** The portfolio command executor owns, next to the primary solver of the
+ ** CommandExecutor, a number of additional solver instances ("workers"), each
+ ** with its own ExprManager and Options. Commands that modify the assertion
+ ** state are replayed into every worker; satisfiability checks are run on all
+ ** instances concurrently, one thread each, and the first definitive answer
+ ** wins, interrupting the remaining instances.
+ **/
+
+#ifndef CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H
+#define CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expr/variable_type_map.h"
+#include "main/command_executor.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace main {
+
+class CommandExecutorPortfolio : public CommandExecutor
+{
+ public:
+  CommandExecutorPortfolio(Options& options);
+
+  ~CommandExecutorPortfolio();
+
+  /**
+   * Get the option sets of the default portfolio for the given logic. Each
+   * option set is a list of key=value pairs separated by ','. The option sets
+   * use the decision mode that the primary solver does not use, as given by
+   * primaryDecisionInternal.
+   */
+  static std::vector<std::string> getDefaultPortfolio(
+      const LogicInfo& logic, bool primaryDecisionInternal);
+
+  /**
+   * Parse a portfolio configuration string as given to --portfolio-config,
+   * i.e., option sets separated by ';'.
+   */
+  static std::vector<std::string> parsePortfolio(const std::string& config);
+
+ protected:
+  /** Executes treating cmd as a singleton */
+  bool doCommandSingleton(CVC4::Command* cmd) override;
+
+ private:
+  /** An additional, independently configured solver instance. */
+  struct Worker
+  {
+    /** The options of this worker (kept alive for the solver) */
+    std::unique_ptr<Options> d_options;
+    /** The solver, with its own ExprManager and SmtEngine */
+    std::unique_ptr<api::Solver> d_solver;
+    /** The map from expressions of the primary solver to this worker */
+    ExprManagerMapCollection d_variableMap;
+  };
+
+  /** The kind of a command w.r.t. its treatment in portfolio mode. */
+  enum CommandClass
+  {
+    /** check-sat, check-sat-assuming and query: raced on all instances */
+    CHECK,
+    /** model, proof, unsat core getters: answered by the last winner */
+    GETTER,
+    /** commands modifying the state: replayed into all instances */
+    STATE,
+    /** commands only affecting the output: executed on the primary only */
+    PRIMARY_ONLY,
+    /** commands that cannot be replayed: portfolio mode is disabled */
+    UNSUPPORTED
+  };
+
+  /** Classify cmd. */
+  static CommandClass classify(const Command* cmd);
+
+  /** Create the workers, using the logic the primary solver was set to. */
+  void initWorkers();
+
+  /**
+   * Replay the commands recorded in d_pending into all workers. Returns false
+   * if some command could not be exported, in which case portfolio mode is
+   * disabled.
+   */
+  bool replayPending();
+
+  /** Disable portfolio mode for the rest of this session. */
+  void disable(const std::string& reason);
+
+  /**
+   * Race the check command cmd on all instances and return the status of
+   * the winning instance.
+   */
+  bool race(Command* cmd);
+
+  /** Execute the getter command cmd on worker i. */
+  bool invokeOnWorker(Command* cmd, size_t i);
+
+  /** The requested number of solver instances, including the primary */
+  unsigned d_numInstances;
+  /** True if portfolio mode was disabled for this session */
+  bool d_disabled;
+  /** The additional solver instances (created at the first check) */
+  std::vector<std::unique_ptr<Worker>> d_workers;
+  /**
+   * State-modifying commands (clones) that have been executed on the primary
+   * solver but not yet replayed into the workers.
+   */
+  std::vector<std::unique_ptr<Command>> d_pending;
+  /**
+   * The instance that produced the answer to the last check, 0 being the
+   * primary solver and i > 0 being d_workers[i - 1].
+   */
+  size_t d_lastWinner;
+
+  /** Number of raced checks */
+  IntStat d_statChecks;
+  /** Histogram of the winning instance per check */
+  HistogramStat<uint64_t> d_statWinner;
+}; /* class CommandExecutorPortfolio */
+
+}  // namespace main
+}  // namespace CVC4
+
+#endif /* CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H */
@@ -30,6 +30,7 @@
 #include "expr/expr_iomanip.h"
 #include "expr/expr_manager.h"
 #include "main/command_executor.h"
+#include "main/command_executor_portfolio.h"
 #include "main/interactive_shell.h"
 #include "main/main.h"
 #include "main/signal_handlers.h"
@@ -185,7 +186,19 @@ int runCvc4(int argc, char* argv[], Options& opts) {
   (*(opts.getOut())) << language::SetLanguage(opts.getOutputLanguage());
 
   // Create the command executor to execute the parsed commands
-  pExecutor = new CommandExecutor(opts);
+  if (opts.getPortfolioJobs() > 1)
+  {
+    if (opts.getTearDownIncremental() > 0)
+    {
+      throw OptionException(
+          "--tear-down-incremental doesn't work in portfolio mode");
+    }
+    pExecutor = new CommandExecutorPortfolio(opts);
+  }
+  else
+  {
+    pExecutor = new CommandExecutor(opts);
+  }
 
   int returnValue = 0;
   {
@@ -478,12 +491,14 @@ int runCvc4(int argc, char* argv[], Options& opts) {
     // signal while dumping statistics, we don't want to try again.
     pExecutor->flushOutputStreams();
 
+    // the persistent rewrite cache is written when the SmtEngine is destroyed
+    bool earlyExit = opts.getEarlyExit() && opts.getRewriteCacheFile().empty();
 #ifdef CVC4_DEBUG
-    if(opts.getEarlyExit() && opts.wasSetByUserEarlyExit()) {
+    if(earlyExit && opts.wasSetByUserEarlyExit()) {
       _exit(returnValue);
     }
 #else /* CVC4_DEBUG */
-    if(opts.getEarlyExit()) {
+    if(earlyExit) {
       _exit(returnValue);
     }
 #endif /* CVC4_DEBUG */
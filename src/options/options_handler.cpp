@@ -213,6 +213,26 @@ void OptionsHandler::setBitblastAig(std::string option, bool arg)
   }
 }
 
+void OptionsHandler::setBitblastNativeAig(std::string option, bool arg)
+{
+  if (arg)
+  {
+    if (options::bitblastMode.wasSetByUser())
+    {
+      if (options::bitblastMode() != options::BitblastMode::EAGER)
+      {
+        throw OptionException(
+            "bitblast-native-aig must be used with eager bitblaster");
+      }
+    }
+    else
+    {
+      options::BitblastMode mode = stringToBitblastMode("", "eager");
+      options::bitblastMode.set(mode);
+    }
+  }
+}
+
 // printer/options_handlers.h
 const std::string OptionsHandler::s_instFormatHelp = "\
 Inst format modes currently supported by the --inst-format option:\n\
@@ -73,6 +73,7 @@ public:
   void checkBitblastMode(std::string option, BitblastMode m);
 
   void setBitblastAig(std::string option, bool arg);
+  void setBitblastNativeAig(std::string option, bool arg);
 
   // printer/options_handlers.h
   InstFormatMode stringToInstFormatMode(std::string option, std::string optarg);
@@ -34,6 +34,7 @@
 #include "options/printer_options.h"
 #include "options/quantifiers_options.h"
 #include "options/smt_options.h"
+#include "options/theory_options.h"
 #include "options/uf_options.h"
 
 namespace CVC4 {
@@ -120,6 +121,10 @@ bool Options::getProduceModels() const{
   return (*this)[options::produceModels];
 }
 
+std::string Options::getRewriteCacheFile() const{
+  return (*this)[options::rewriteCacheFile];
+}
+
 bool Options::getSegvSpin() const{
   return (*this)[options::segvSpin];
 }
@@ -149,6 +154,14 @@ int Options::getTearDownIncremental() const{
   return (*this)[options::tearDownIncremental];
 }
 
+unsigned Options::getPortfolioJobs() const{
+  return (*this)[options::portfolioJobs];
+}
+
+const std::string& Options::getPortfolioConfig() const{
+  return (*this)[options::portfolioConfig];
+}
+
 unsigned long Options::getCumulativeTimeLimit() const {
   return (*this)[options::cumulativeMillisecondLimit];
 }
@@ -65,6 +65,7 @@ ClauseId BVMinisatSatSolver::addClause(SatClause& clause,
   // }
   ClauseId clause_id = ClauseIdError;
   d_minisat->addClause(minisat_clause, clause_id);
+  ++d_statistics.d_statClauses;
   return clause_id;
 }
 
@@ -140,6 +141,20 @@ SatValue BVMinisatSatSolver::solve(long unsigned int& resource){
   return result;
 }
 
+SatValue BVMinisatSatSolver::solve(const std::vector<SatLiteral>& assumptions)
+{
+  TimerStat::CodeTimer solveTimer(d_statistics.d_statSolveTime);
+  ++d_statistics.d_statCallsToSolve;
+  // the assumptions replace those of the last call
+  d_minisat->clearAssumptions();
+  BVMinisat::vec<BVMinisat::Lit> assumps;
+  for (const SatLiteral& lit : assumptions)
+  {
+    assumps.push(toMinisatLit(lit));
+  }
+  return toSatLiteralValue(d_minisat->solve(assumps));
+}
+
 bool BVMinisatSatSolver::ok() const { return d_minisat->okay(); }
 
 void BVMinisatSatSolver::getUnsatCore(SatClause& unsatCore) {
@@ -239,6 +254,7 @@ BVMinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry,
       d_statMaxLiterals(prefix + "::bvminisat::max_literals"),
       d_statTotLiterals(prefix + "::bvminisat::tot_literals"),
       d_statEliminatedVars(prefix + "::bvminisat::eliminated_vars"),
+      d_statClauses(prefix + "::bvminisat::clauses", 0),
       d_statCallsToSolve(prefix + "::bvminisat::calls_to_solve", 0),
       d_statSolveTime(prefix + "::bvminisat::solve_time"),
       d_registerStats(!prefix.empty())
@@ -258,6 +274,7 @@ BVMinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry,
   d_registry->registerStat(&d_statMaxLiterals);
   d_registry->registerStat(&d_statTotLiterals);
   d_registry->registerStat(&d_statEliminatedVars);
+  d_registry->registerStat(&d_statClauses);
   d_registry->registerStat(&d_statCallsToSolve);
   d_registry->registerStat(&d_statSolveTime);
 }
@@ -276,6 +293,7 @@ BVMinisatSatSolver::Statistics::~Statistics() {
   d_registry->unregisterStat(&d_statMaxLiterals);
   d_registry->unregisterStat(&d_statTotLiterals);
   d_registry->unregisterStat(&d_statEliminatedVars);
+  d_registry->unregisterStat(&d_statClauses);
   d_registry->unregisterStat(&d_statCallsToSolve);
   d_registry->unregisterStat(&d_statSolveTime);
 }
@@ -95,6 +95,7 @@ public:
 
   SatValue solve() override;
   SatValue solve(long unsigned int&) override;
+  SatValue solve(const std::vector<SatLiteral>& assumptions) override;
   bool ok() const override;
   void getUnsatCore(SatClause& unsatCore) override;
 
@@ -135,6 +136,7 @@ public:
     ReferenceStat<uint64_t> d_statLearntsLiterals,  d_statMaxLiterals;
     ReferenceStat<uint64_t> d_statTotLiterals;
     ReferenceStat<int> d_statEliminatedVars;
+    IntStat d_statClauses;
     IntStat d_statCallsToSolve;
     TimerStat d_statSolveTime;
     bool d_registerStats;
@@ -681,6 +681,12 @@ void Solver::popAssumption() {
     cancelUntil(assumptions.size());
 }
 
+void Solver::clearAssumptions() {
+    assumptions.clear();
+    conflict.clear();
+    cancelUntil(0);
+}
+
 lbool Solver::propagateAssumptions() {
   only_bcp = true;
   ccmin_mode = 0;
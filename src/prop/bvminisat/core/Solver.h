@@ -129,6 +129,7 @@ public:
     lbool   assertAssumption(Lit p, bool propagate);  // Assert a new assumption, start BCP if propagate = true
     lbool   propagateAssumptions();                   // Do BCP over asserted assumptions
     void    popAssumption();                          // Pop an assumption
+    void    clearAssumptions();                       // Pop all assumptions and backtrack to level 0
 
     void    toDimacs     (FILE* f, const vec<Lit>& assumps);            // Write CNF to file in DIMACS-format.
     void    toDimacs     (const char *file, const vec<Lit>& assumps);
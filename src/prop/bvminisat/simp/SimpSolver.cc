@@ -58,7 +58,8 @@ SimpSolver::SimpSolver(CVC4::context::Context* context)
       use_elim(opt_use_elim
                && CVC4::options::bitblastMode()
                       == CVC4::options::BitblastMode::EAGER
-               && !CVC4::options::produceModels()),
+               && !CVC4::options::produceModels()
+               && !CVC4::options::incrementalSolving()),
       merges(0),
       asymm_lits(0),
       eliminated_vars(0),
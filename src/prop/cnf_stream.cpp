@@ -17,6 +17,7 @@
  **/
 #include "prop/cnf_stream.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "base/check.h"
@@ -24,6 +25,7 @@
 #include "expr/expr.h"
 #include "expr/node.h"
 #include "options/bv_options.h"
+#include "options/prop_options.h"
 #include "proof/clause_id.h"
 #include "proof/cnf_proof.h"
 #include "proof/proof_manager.h"
@@ -35,6 +37,7 @@
 #include "smt/smt_engine.h"
 #include "printer/printer.h"
 #include "smt/smt_engine_scope.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/theory.h"
 #include "theory/theory_engine.h"
 
@@ -60,10 +63,43 @@ CnfStream::CnfStream(SatSolver* satSolver,
       d_registrar(registrar),
       d_name(name),
       d_cnfProof(NULL),
-      d_removable(false)
+      d_removable(false),
+      d_dedupClauses(options::cnfDedupClauses()),
+      d_assertedClauses(context),
+      d_statistics(name)
 {
 }
 
+CnfStream::Statistics::Statistics(const std::string& name)
+    : d_registered(!name.empty()),
+      d_strashHits(name + "::CnfStream::strashHits", 0),
+      d_clausesSaved(name + "::CnfStream::clausesSaved", 0),
+      d_clauseBytesSaved(name + "::CnfStream::clauseBytesSaved", 0),
+      d_partialDefinitions(name + "::CnfStream::partialDefinitions", 0),
+      d_completedDefinitions(name + "::CnfStream::completedDefinitions", 0)
+{
+  if (d_registered)
+  {
+    smtStatisticsRegistry()->registerStat(&d_strashHits);
+    smtStatisticsRegistry()->registerStat(&d_clausesSaved);
+    smtStatisticsRegistry()->registerStat(&d_clauseBytesSaved);
+    smtStatisticsRegistry()->registerStat(&d_partialDefinitions);
+    smtStatisticsRegistry()->registerStat(&d_completedDefinitions);
+  }
+}
+
+CnfStream::Statistics::~Statistics()
+{
+  if (d_registered)
+  {
+    smtStatisticsRegistry()->unregisterStat(&d_strashHits);
+    smtStatisticsRegistry()->unregisterStat(&d_clausesSaved);
+    smtStatisticsRegistry()->unregisterStat(&d_clauseBytesSaved);
+    smtStatisticsRegistry()->unregisterStat(&d_partialDefinitions);
+    smtStatisticsRegistry()->unregisterStat(&d_completedDefinitions);
+  }
+}
+
 TseitinCnfStream::TseitinCnfStream(SatSolver* satSolver,
                                    Registrar* registrar,
                                    context::Context* context,
@@ -72,11 +108,44 @@ TseitinCnfStream::TseitinCnfStream(SatSolver* satSolver,
                                    bool fullLitToNodeMap,
                                    std::string name)
     : CnfStream(satSolver, registrar, context, outMgr, fullLitToNodeMap, name),
-      d_resourceManager(rm)
+      d_resourceManager(rm),
+      d_structuralHashing(options::cnfStructuralHashing()),
+      d_gateToLiteral(context),
+      d_polarityAware(options::cnfPolarityAware()),
+      d_partialDefinitions(context)
 {}
 
+void CnfStream::notifyClausesSaved(size_t numClauses, size_t numLiterals)
+{
+  d_statistics.d_clausesSaved += numClauses;
+  // a (MiniSat) clause takes a header word and one word per literal
+  d_statistics.d_clauseBytesSaved +=
+      (numClauses + numLiterals) * sizeof(uint32_t);
+}
+
 void CnfStream::assertClause(TNode node, SatClause& c) {
   Debug("cnf") << "Inserting into stream " << c << " node = " << node << endl;
+  // Removable clauses may be deleted by the SAT solver, hence we only filter
+  // permanent ones, which are kept until the context is popped.
+  if (d_dedupClauses && !d_removable && d_cnfProof == nullptr)
+  {
+    SatClause sorted(c);
+    std::sort(sorted.begin(), sorted.end());
+    if (d_assertedClauses.contains(sorted))
+    {
+      Debug("cnf") << "Skipping duplicate clause " << c << endl;
+      notifyClausesSaved(1, c.size());
+      return;
+    }
+    d_assertedClauses.insert(sorted);
+    // the set stores the sorted clause twice, in a deque of keys and in a
+    // hash map node that also holds a next pointer and a cached hash, and
+    // takes a bucket of the hash map
+    int64_t footprint =
+        2 * (sizeof(SatClause) + sorted.size() * sizeof(SatLiteral))
+        + 3 * sizeof(void*);
+    d_statistics.d_clauseBytesSaved += -footprint;
+  }
   if (Dump.isOn("clauses") && d_outMgr != nullptr)
   {
     const Printer& printer = d_outMgr->getPrinter();
@@ -140,6 +209,11 @@ void TseitinCnfStream::ensureLiteral(TNode n, bool noPreregistration) {
   Debug("cnf") << "ensureLiteral(" << n << ")" << endl;
   if(hasLiteral(n)) {
     SatLiteral lit = getLiteral(n);
+    if (d_polarityAware)
+    {
+      // n may be a gate that was only defined in one direction so far
+      ensureDefined(lit, POL_BOTH);
+    }
     if(!d_literalToNodeMap.contains(lit)){
       // Store backward-mappings
       d_literalToNodeMap.insert(lit, n);
@@ -198,7 +272,9 @@ void TseitinCnfStream::ensureLiteral(TNode n, bool noPreregistration) {
     lit = convertAtom(n, noPreregistration);
   }
 
-  Assert(hasLiteral(n) && getNode(lit) == n);
+  // Note that the literal of n may represent an equivalent gate (see
+  // TseitinCnfStream::lookupGate()), in which case getNode(lit) != n.
+  Assert(hasLiteral(n) && getLiteral(n) == lit);
   Debug("ensureLiteral") << "CnfStream::ensureLiteral(): out lit is " << lit << std::endl;
 }
 
@@ -299,8 +375,138 @@ SatLiteral CnfStream::getLiteral(TNode node) {
   return literal;
 }
 
-SatLiteral TseitinCnfStream::handleXor(TNode xorNode) {
-  Assert(!hasLiteral(xorNode)) << "Atom already mapped!";
+bool TseitinCnfStream::normalizeGate(Gate& gate)
+{
+  SatClause& in = gate.d_inputs;
+  bool negated = false;
+  switch (gate.d_kind)
+  {
+    case AND:
+      std::sort(in.begin(), in.end());
+      in.erase(std::unique(in.begin(), in.end()), in.end());
+      break;
+    case XOR:
+      Assert(in.size() == 2);
+      // (xor ~a b) = (xor a ~b) = ~(xor a b)
+      for (SatLiteral& l : in)
+      {
+        if (l.isNegated())
+        {
+          l = ~l;
+          negated = !negated;
+        }
+      }
+      std::sort(in.begin(), in.end());
+      break;
+    default:
+      Assert(gate.d_kind == ITE && in.size() == 3);
+      // (ite ~c t e) = (ite c e t)
+      if (in[0].isNegated())
+      {
+        in[0] = ~in[0];
+        std::swap(in[1], in[2]);
+      }
+      // (ite c ~t ~e) = ~(ite c t e)
+      if (in[1].isNegated())
+      {
+        in[1] = ~in[1];
+        in[2] = ~in[2];
+        negated = true;
+      }
+      break;
+  }
+  return negated;
+}
+
+SatLiteral TseitinCnfStream::lookupGate(TNode node,
+                                        const Gate& gate,
+                                        bool negated,
+                                        size_t numClauses,
+                                        size_t numLiterals)
+{
+  Assert(!hasLiteral(node));
+  auto it = d_gateToLiteral.find(gate);
+  if (it == d_gateToLiteral.end())
+  {
+    return SatLiteral();
+  }
+  SatLiteral lit = negated ? ~(*it).second : (*it).second;
+  Debug("cnf") << "lookupGate(" << node << ") => " << lit << endl;
+  d_nodeToLiteralMap.insert(node, lit);
+  d_nodeToLiteralMap.insert(node.notNode(), ~lit);
+  if (d_fullLitToNodeMap || Dump.isOn("clauses"))
+  {
+    d_literalToNodeMap.insert_safe(lit, node);
+    d_literalToNodeMap.insert_safe(~lit, node.notNode());
+  }
+  ++d_statistics.d_strashHits;
+  notifyClausesSaved(numClauses, numLiterals);
+  return lit;
+}
+
+void TseitinCnfStream::storeGate(const Gate& gate, bool negated, SatLiteral lit)
+{
+  d_gateToLiteral.insert_safe(gate, negated ? ~lit : lit);
+}
+
+void TseitinCnfStream::notifyDefined(TNode node, SatLiteral lit, Polarity pol)
+{
+  if (pol != POL_BOTH)
+  {
+    Debug("cnf") << "notifyDefined(" << node << ", " << lit << ", " << pol
+                 << ")" << endl;
+    d_partialDefinitions.insert(lit.getSatVariable(), {node, lit, pol});
+    ++d_statistics.d_partialDefinitions;
+  }
+}
+
+void TseitinCnfStream::ensureDefined(SatLiteral lit, Polarity pol)
+{
+  auto it = d_partialDefinitions.find(lit.getSatVariable());
+  if (it == d_partialDefinitions.end())
+  {
+    return;
+  }
+  PartialDefinition def = (*it).second;
+  // the directions are relative to the literal the gate was defined with
+  Polarity missing =
+      static_cast<Polarity>((lit == def.d_lit ? pol : flip(pol)) & ~def.d_pol);
+  if (missing == POL_NONE)
+  {
+    return;
+  }
+  Debug("cnf") << "ensureDefined(): completing " << def.d_node << " with "
+               << missing << endl;
+  d_partialDefinitions.insert(
+      lit.getSatVariable(),
+      {def.d_node, def.d_lit, static_cast<Polarity>(def.d_pol | missing)});
+  ++d_statistics.d_completedDefinitions;
+
+  // The definitions of gates are permanent, even if the gate is (again)
+  // needed by a removable clause.
+  bool removable = d_removable;
+  d_removable = false;
+  TNode node = def.d_node;
+  switch (node.getKind())
+  {
+    case XOR: handleXor(node, missing, def.d_lit); break;
+    case ITE: handleIte(node, missing, def.d_lit); break;
+    case IMPLIES: handleImplies(node, missing, def.d_lit); break;
+    case OR: handleOr(node, missing, def.d_lit); break;
+    case AND: handleAnd(node, missing, def.d_lit); break;
+    default:
+      Assert(node.getKind() == EQUAL);
+      handleIff(node, missing, def.d_lit);
+      break;
+  }
+  d_removable = removable;
+}
+
+SatLiteral TseitinCnfStream::handleXor(TNode xorNode,
+                                       Polarity pol,
+                                       SatLiteral xorLit)
+{
+  Assert(xorLit.isNull() != hasLiteral(xorNode)) << "Atom already mapped!";
   Assert(xorNode.getKind() == XOR) << "Expecting an XOR expression!";
   Assert(xorNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -308,18 +514,51 @@ SatLiteral TseitinCnfStream::handleXor(TNode xorNode) {
   SatLiteral a = toCNF(xorNode[0]);
   SatLiteral b = toCNF(xorNode[1]);
 
-  SatLiteral xorLit = newLiteral(xorNode);
+  bool isNew = xorLit.isNull();
+  Gate gate{XOR, {a, b}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      negated = normalizeGate(gate);
+      SatLiteral lit = lookupGate(xorNode, gate, negated, 4, 12);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    xorLit = newLiteral(xorNode);
+  }
 
-  assertClause(xorNode.negate(), a, b, ~xorLit);
-  assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
-  assertClause(xorNode, a, ~b, xorLit);
-  assertClause(xorNode, ~a, b, xorLit);
+  if (pol & POL_POS)
+  {
+    assertClause(xorNode.negate(), a, b, ~xorLit);
+    assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
+  }
+  if (pol & POL_NEG)
+  {
+    assertClause(xorNode, a, ~b, xorLit);
+    assertClause(xorNode, ~a, b, xorLit);
+  }
 
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, xorLit);
+    }
+    notifyDefined(xorNode, xorLit, pol);
+  }
   return xorLit;
 }
 
-SatLiteral TseitinCnfStream::handleOr(TNode orNode) {
-  Assert(!hasLiteral(orNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleOr(TNode orNode,
+                                      Polarity pol,
+                                      SatLiteral orLit)
+{
+  Assert(orLit.isNull() != hasLiteral(orNode)) << "Atom already mapped!";
   Assert(orNode.getKind() == OR) << "Expecting an OR expression!";
   Assert(orNode.getNumChildren() > 1) << "Expecting more then 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -332,31 +571,73 @@ SatLiteral TseitinCnfStream::handleOr(TNode orNode) {
   TNode::const_iterator node_it_end = orNode.end();
   SatClause clause(n_children + 1);
   for(int i = 0; node_it != node_it_end; ++node_it, ++i) {
-    clause[i] = toCNF(*node_it);
+    clause[i] = toCNF(*node_it, false, pol);
   }
 
-  // Get the literal for this node
-  SatLiteral orLit = newLiteral(orNode);
+  // (a_1 | ... | a_n) is represented by the gate ~(~a_1 & ... & ~a_n)
+  bool isNew = orLit.isNull();
+  Gate gate{AND, {}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      for (unsigned i = 0; i < n_children; ++i)
+      {
+        gate.d_inputs.push_back(~clause[i]);
+      }
+      negated = !normalizeGate(gate);
+      SatLiteral lit = lookupGate(
+          orNode, gate, negated, n_children + 1, 3 * n_children + 1);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    // Get the literal for this node
+    orLit = newLiteral(orNode);
+  }
 
   // lit <- (a_1 | a_2 | a_3 | ... | a_n)
   // lit | ~(a_1 | a_2 | a_3 | ... | a_n)
   // (lit | ~a_1) & (lit | ~a_2) & (lit & ~a_3) & ... & (lit & ~a_n)
-  for(unsigned i = 0; i < n_children; ++i) {
-    assertClause(orNode, orLit, ~clause[i]);
+  if (pol & POL_NEG)
+  {
+    for (unsigned i = 0; i < n_children; ++i)
+    {
+      assertClause(orNode, orLit, ~clause[i]);
+    }
   }
 
   // lit -> (a_1 | a_2 | a_3 | ... | a_n)
   // ~lit | a_1 | a_2 | a_3 | ... | a_n
-  clause[n_children] = ~orLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(orNode.negate(), clause);
+  if (pol & POL_POS)
+  {
+    clause[n_children] = ~orLit;
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(orNode.negate(), clause);
+  }
+
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, orLit);
+    }
+    notifyDefined(orNode, orLit, pol);
+  }
 
   // Return the literal
   return orLit;
 }
 
-SatLiteral TseitinCnfStream::handleAnd(TNode andNode) {
-  Assert(!hasLiteral(andNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleAnd(TNode andNode,
+                                       Polarity pol,
+                                       SatLiteral andLit)
+{
+  Assert(andLit.isNull() != hasLiteral(andNode)) << "Atom already mapped!";
   Assert(andNode.getKind() == AND) << "Expecting an AND expression!";
   Assert(andNode.getNumChildren() > 1) << "Expecting more than 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -369,58 +650,134 @@ SatLiteral TseitinCnfStream::handleAnd(TNode andNode) {
   TNode::const_iterator node_it_end = andNode.end();
   SatClause clause(n_children + 1);
   for(int i = 0; node_it != node_it_end; ++node_it, ++i) {
-    clause[i] = ~toCNF(*node_it);
+    clause[i] = ~toCNF(*node_it, false, pol);
   }
 
-  // Get the literal for this node
-  SatLiteral andLit = newLiteral(andNode);
+  bool isNew = andLit.isNull();
+  Gate gate{AND, {}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      for (unsigned i = 0; i < n_children; ++i)
+      {
+        gate.d_inputs.push_back(~clause[i]);
+      }
+      negated = normalizeGate(gate);
+      SatLiteral lit = lookupGate(
+          andNode, gate, negated, n_children + 1, 3 * n_children + 1);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    // Get the literal for this node
+    andLit = newLiteral(andNode);
+  }
 
   // lit -> (a_1 & a_2 & a_3 & ... & a_n)
   // ~lit | (a_1 & a_2 & a_3 & ... & a_n)
   // (~lit | a_1) & (~lit | a_2) & ... & (~lit | a_n)
-  for(unsigned i = 0; i < n_children; ++i) {
-    assertClause(andNode.negate(), ~andLit, ~clause[i]);
+  if (pol & POL_POS)
+  {
+    for (unsigned i = 0; i < n_children; ++i)
+    {
+      assertClause(andNode.negate(), ~andLit, ~clause[i]);
+    }
   }
 
   // lit <- (a_1 & a_2 & a_3 & ... a_n)
   // lit | ~(a_1 & a_2 & a_3 & ... & a_n)
   // lit | ~a_1 | ~a_2 | ~a_3 | ... | ~a_n
-  clause[n_children] = andLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(andNode, clause);
+  if (pol & POL_NEG)
+  {
+    clause[n_children] = andLit;
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(andNode, clause);
+  }
+
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, andLit);
+    }
+    notifyDefined(andNode, andLit, pol);
+  }
 
   return andLit;
 }
 
-SatLiteral TseitinCnfStream::handleImplies(TNode impliesNode) {
-  Assert(!hasLiteral(impliesNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleImplies(TNode impliesNode,
+                                           Polarity pol,
+                                           SatLiteral impliesLit)
+{
+  Assert(impliesLit.isNull() != hasLiteral(impliesNode))
+      << "Atom already mapped!";
   Assert(impliesNode.getKind() == IMPLIES)
       << "Expecting an IMPLIES expression!";
   Assert(impliesNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
 
-  // Convert the children to cnf
-  SatLiteral a = toCNF(impliesNode[0]);
-  SatLiteral b = toCNF(impliesNode[1]);
+  // Convert the children to cnf, the antecedent occurs negated
+  SatLiteral a = toCNF(impliesNode[0], false, flip(pol));
+  SatLiteral b = toCNF(impliesNode[1], false, pol);
 
-  SatLiteral impliesLit = newLiteral(impliesNode);
+  // (a -> b) is represented by the gate ~(a & ~b)
+  bool isNew = impliesLit.isNull();
+  Gate gate{AND, {a, ~b}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      negated = !normalizeGate(gate);
+      SatLiteral lit = lookupGate(impliesNode, gate, negated, 3, 7);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    impliesLit = newLiteral(impliesNode);
+  }
 
   // lit -> (a->b)
   // ~lit | ~ a | b
-  assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  if (pol & POL_POS)
+  {
+    assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  }
 
   // (a->b) -> lit
   // ~(~a | b) | lit
   // (a | l) & (~b | l)
-  assertClause(impliesNode, a, impliesLit);
-  assertClause(impliesNode, ~b, impliesLit);
+  if (pol & POL_NEG)
+  {
+    assertClause(impliesNode, a, impliesLit);
+    assertClause(impliesNode, ~b, impliesLit);
+  }
 
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, impliesLit);
+    }
+    notifyDefined(impliesNode, impliesLit, pol);
+  }
   return impliesLit;
 }
 
 
-SatLiteral TseitinCnfStream::handleIff(TNode iffNode) {
-  Assert(!hasLiteral(iffNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleIff(TNode iffNode,
+                                       Polarity pol,
+                                       SatLiteral iffLit)
+{
+  Assert(iffLit.isNull() != hasLiteral(iffNode)) << "Atom already mapped!";
   Assert(iffNode.getKind() == EQUAL) << "Expecting an EQUAL expression!";
   Assert(iffNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
 
@@ -430,38 +787,73 @@ SatLiteral TseitinCnfStream::handleIff(TNode iffNode) {
   SatLiteral a = toCNF(iffNode[0]);
   SatLiteral b = toCNF(iffNode[1]);
 
-  // Get the now literal
-  SatLiteral iffLit = newLiteral(iffNode);
+  // (a <-> b) is represented by the gate ~(xor a b)
+  bool isNew = iffLit.isNull();
+  Gate gate{XOR, {a, b}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      negated = !normalizeGate(gate);
+      SatLiteral lit = lookupGate(iffNode, gate, negated, 4, 12);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    // Get the now literal
+    iffLit = newLiteral(iffNode);
+  }
 
   // lit -> ((a-> b) & (b->a))
   // ~lit | ((~a | b) & (~b | a))
   // (~a | b | ~lit) & (~b | a | ~lit)
-  assertClause(iffNode.negate(), ~a, b, ~iffLit);
-  assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  if (pol & POL_POS)
+  {
+    assertClause(iffNode.negate(), ~a, b, ~iffLit);
+    assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  }
 
   // (a<->b) -> lit
   // ~((a & b) | (~a & ~b)) | lit
   // (~(a & b)) & (~(~a & ~b)) | lit
   // ((~a | ~b) & (a | b)) | lit
   // (~a | ~b | lit) & (a | b | lit)
-  assertClause(iffNode, ~a, ~b, iffLit);
-  assertClause(iffNode, a, b, iffLit);
+  if (pol & POL_NEG)
+  {
+    assertClause(iffNode, ~a, ~b, iffLit);
+    assertClause(iffNode, a, b, iffLit);
+  }
 
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, iffLit);
+    }
+    notifyDefined(iffNode, iffLit, pol);
+  }
   return iffLit;
 }
 
 
-SatLiteral TseitinCnfStream::handleNot(TNode notNode) {
+SatLiteral TseitinCnfStream::handleNot(TNode notNode, Polarity pol)
+{
   Assert(!hasLiteral(notNode)) << "Atom already mapped!";
   Assert(notNode.getKind() == NOT) << "Expecting a NOT expression!";
   Assert(notNode.getNumChildren() == 1) << "Expecting exactly 1 child!";
 
-  SatLiteral notLit = ~toCNF(notNode[0]);
+  SatLiteral notLit = ~toCNF(notNode[0], false, flip(pol));
 
   return notLit;
 }
 
-SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
+SatLiteral TseitinCnfStream::handleIte(TNode iteNode,
+                                       Polarity pol,
+                                       SatLiteral iteLit)
+{
   Assert(iteNode.getKind() == ITE);
   Assert(iteNode.getNumChildren() == 3);
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -469,10 +861,26 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   Debug("cnf") << "handleIte(" << iteNode[0] << " " << iteNode[1] << " " << iteNode[2] << ")" << endl;
 
   SatLiteral condLit = toCNF(iteNode[0]);
-  SatLiteral thenLit = toCNF(iteNode[1]);
-  SatLiteral elseLit = toCNF(iteNode[2]);
+  SatLiteral thenLit = toCNF(iteNode[1], false, pol);
+  SatLiteral elseLit = toCNF(iteNode[2], false, pol);
 
-  SatLiteral iteLit = newLiteral(iteNode);
+  bool isNew = iteLit.isNull();
+  Gate gate{ITE, {condLit, thenLit, elseLit}};
+  bool negated = false;
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      negated = normalizeGate(gate);
+      SatLiteral lit = lookupGate(iteNode, gate, negated, 6, 18);
+      if (!lit.isNull())
+      {
+        ensureDefined(lit, pol);
+        return lit;
+      }
+    }
+    iteLit = newLiteral(iteNode);
+  }
 
   // If ITE is true then one of the branches is true and the condition
   // implies which one
@@ -480,9 +888,12 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   // lit -> (t | e) & (b -> t) & (!b -> e)
   // lit -> (t | e) & (!b | t) & (b | e)
   // (!lit | t | e) & (!lit | !b | t) & (!lit | b | e)
-  assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
-  assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
-  assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  if (pol & POL_POS)
+  {
+    assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
+    assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
+    assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  }
 
   // If ITE is false then one of the branches is false and the condition
   // implies which one
@@ -490,48 +901,66 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   // !lit -> (!t | !e) & (b -> !t) & (!b -> !e)
   // !lit -> (!t | !e) & (!b | !t) & (b | !e)
   // (lit | !t | !e) & (lit | !b | !t) & (lit | b | !e)
-  assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
-  assertClause(iteNode, iteLit, ~condLit, ~thenLit);
-  assertClause(iteNode, iteLit, condLit, ~elseLit);
+  if (pol & POL_NEG)
+  {
+    assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
+    assertClause(iteNode, iteLit, ~condLit, ~thenLit);
+    assertClause(iteNode, iteLit, condLit, ~elseLit);
+  }
 
+  if (isNew)
+  {
+    if (useStructuralHashing())
+    {
+      storeGate(gate, negated, iteLit);
+    }
+    notifyDefined(iteNode, iteLit, pol);
+  }
   return iteLit;
 }
 
 
-SatLiteral TseitinCnfStream::toCNF(TNode node, bool negated) {
+SatLiteral TseitinCnfStream::toCNF(TNode node, bool negated, Polarity pol)
+{
   Debug("cnf") << "toCNF(" << node << ", negated = " << (negated ? "true" : "false") << ")" << endl;
 
   SatLiteral nodeLit;
   Node negatedNode = node.notNode();
+  // The directions in which the literal of node must be defined
+  Polarity nodePol = required(negated ? flip(pol) : pol);
 
   // If the non-negated node has already been translated, get the translation
   if(hasLiteral(node)) {
     Debug("cnf") << "toCNF(): already translated" << endl;
     nodeLit = getLiteral(node);
+    if (d_polarityAware)
+    {
+      ensureDefined(nodeLit, nodePol);
+    }
   } else {
     // Handle each Boolean operator case
     switch(node.getKind()) {
     case NOT:
-      nodeLit = handleNot(node);
+      nodeLit = handleNot(node, nodePol);
       break;
     case XOR:
-      nodeLit = handleXor(node);
+      nodeLit = handleXor(node, nodePol);
       break;
     case ITE:
-      nodeLit = handleIte(node);
+      nodeLit = handleIte(node, nodePol);
       break;
     case IMPLIES:
-      nodeLit = handleImplies(node);
+      nodeLit = handleImplies(node, nodePol);
       break;
     case OR:
-      nodeLit = handleOr(node);
+      nodeLit = handleOr(node, nodePol);
       break;
     case AND:
-      nodeLit = handleAnd(node);
+      nodeLit = handleAnd(node, nodePol);
       break;
     case EQUAL:
       if(node[0].getType().isBoolean()) {
-        nodeLit = handleIff(node);
+        nodeLit = handleIff(node, nodePol);
       } else {
         nodeLit = convertAtom(node);
       }
@@ -568,7 +997,7 @@ void TseitinCnfStream::convertAndAssertAnd(TNode node, bool negated) {
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, true);
+      clause[i] = toCNF(*disjunct, true, POL_POS);
     }
     Assert(disjunct == node.end());
     assertClause(node.negate(), clause);
@@ -584,7 +1013,7 @@ void TseitinCnfStream::convertAndAssertOr(TNode node, bool negated) {
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, false);
+      clause[i] = toCNF(*disjunct, false, POL_POS);
     }
     Assert(disjunct == node.end());
     assertClause(node, clause);
@@ -660,8 +1089,8 @@ void TseitinCnfStream::convertAndAssertIff(TNode node, bool negated) {
 void TseitinCnfStream::convertAndAssertImplies(TNode node, bool negated) {
   if (!negated) {
     // p => q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POL_NEG);
+    SatLiteral q = toCNF(node[1], false, POL_POS);
     // Construct the clause ~p || q
     SatClause clause(2);
     clause[0] = ~p;
@@ -677,8 +1106,8 @@ void TseitinCnfStream::convertAndAssertImplies(TNode node, bool negated) {
 void TseitinCnfStream::convertAndAssertIte(TNode node, bool negated) {
   // ITE(p, q, r)
   SatLiteral p = toCNF(node[0], false);
-  SatLiteral q = toCNF(node[1], negated);
-  SatLiteral r = toCNF(node[2], negated);
+  SatLiteral q = toCNF(node[1], negated, POL_POS);
+  SatLiteral r = toCNF(node[2], negated, POL_POS);
   // Construct the clauses:
   // (p => q) and (!p => r)
   Node nnode = node;
@@ -762,7 +1191,7 @@ void TseitinCnfStream::convertAndAssert(TNode node, bool negated) {
       nnode = node.negate();
     }
     // Atoms
-    assertClause(nnode, toCNF(node, negated));
+    assertClause(nnode, toCNF(node, negated, POL_POS));
   }
     break;
   }
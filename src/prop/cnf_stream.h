@@ -25,12 +25,15 @@
 #ifndef CVC4__PROP__CNF_STREAM_H
 #define CVC4__PROP__CNF_STREAM_H
 
+#include "context/cdhashmap.h"
+#include "context/cdhashset.h"
 #include "context/cdinsert_hashmap.h"
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/proof_manager.h"
 #include "prop/registrar.h"
 #include "prop/theory_proxy.h"
+#include "util/statistics_registry.h"
 
 namespace CVC4 {
 
@@ -108,6 +111,58 @@ class CnfStream {
    */
   bool d_removable;
 
+  /** Whether duplicate permanent clauses are filtered (--cnf-dedup-clauses) */
+  const bool d_dedupClauses;
+
+  /**
+   * The (sorted) permanent clauses asserted in the current context, if
+   * d_dedupClauses is true.
+   */
+  context::CDHashSet<SatClause, SatClauseHashFunction> d_assertedClauses;
+
+  /** Statistics of the CNF conversion */
+  struct Statistics
+  {
+    /**
+     * Constructs the statistics, which are registered with the name of the
+     * CNF stream as prefix, unless the name is empty.
+     */
+    Statistics(const std::string& name);
+    ~Statistics();
+    /** Whether the statistics are registered */
+    bool d_registered;
+    /** Number of gates whose literal was found by structural hashing */
+    IntStat d_strashHits;
+    /**
+     * Number of clauses that were not asserted since they (or the definition
+     * of an equivalent gate) had already been asserted
+     */
+    IntStat d_clausesSaved;
+    /**
+     * Estimated SAT solver memory (in bytes) taken by these clauses, minus the
+     * estimated memory taken by d_assertedClauses.  May be negative if few
+     * duplicate clauses are found.
+     */
+    IntStat d_clauseBytesSaved;
+    /**
+     * Number of gates that were defined in one direction only, since they
+     * occurred in one polarity (--cnf-polarity-aware)
+     */
+    IntStat d_partialDefinitions;
+    /**
+     * Number of partially defined gates whose definition was later completed
+     * since they occurred in the other polarity as well
+     */
+    IntStat d_completedDefinitions;
+  };
+  Statistics d_statistics;
+
+  /**
+   * Records in the statistics that numClauses clauses with numLiterals
+   * literals in total did not need to be asserted.
+   */
+  void notifyClausesSaved(size_t numClauses, size_t numLiterals);
+
   /**
    * Asserts the given clause to the sat solver.
    * @param node the node giving rise to this clause
@@ -175,7 +230,9 @@ class CnfStream {
    * will not be dumped if outMgr == nullptr.
    * @param fullLitToNodeMap maintain a full SAT-literal-to-Node mapping.
    * @param name string identifier to distinguish between different instances
-   * even for non-theory literals.
+   * even for non-theory literals, and the prefix of the names of the
+   * statistics of this instance (which are only registered if the name is
+   * not empty).
    */
   CnfStream(SatSolver* satSolver,
             Registrar* registrar,
@@ -260,6 +317,21 @@ class CnfStream {
  */
 class TseitinCnfStream : public CnfStream {
  public:
+  /**
+   * The directions in which the literal l of a gate g is defined: POL_POS if
+   * l -> g is asserted, which suffices if l only occurs positively in the
+   * asserted clauses, POL_NEG if g -> l is asserted.  Unless
+   * --cnf-polarity-aware is enabled, gates are always defined in both
+   * directions.
+   */
+  enum Polarity
+  {
+    POL_NONE = 0,
+    POL_POS = 1,
+    POL_NEG = 2,
+    POL_BOTH = 3
+  };
+
   /**
    * Constructs the stream to use the given sat solver.  This does not take
    * ownership of satSolver, registrar, or context.
@@ -309,13 +381,29 @@ class TseitinCnfStream : public CnfStream {
   //   - returning l
   //
   // handleX( n ) can assume that n is not in d_translationCache
-  SatLiteral handleNot(TNode node);
-  SatLiteral handleXor(TNode node);
-  SatLiteral handleImplies(TNode node);
-  SatLiteral handleIff(TNode node);
-  SatLiteral handleIte(TNode node);
-  SatLiteral handleAnd(TNode node);
-  SatLiteral handleOr(TNode node);
+  //
+  // The clauses only define l in the directions given by pol (see Polarity).
+  // If lit is not null, n is a partially defined gate with literal lit, and
+  // only the clauses of the directions pol that are missing are added.
+  SatLiteral handleNot(TNode node, Polarity pol);
+  SatLiteral handleXor(TNode node,
+                       Polarity pol,
+                       SatLiteral xorLit = SatLiteral());
+  SatLiteral handleImplies(TNode node,
+                           Polarity pol,
+                           SatLiteral impliesLit = SatLiteral());
+  SatLiteral handleIff(TNode node,
+                       Polarity pol,
+                       SatLiteral iffLit = SatLiteral());
+  SatLiteral handleIte(TNode node,
+                       Polarity pol,
+                       SatLiteral iteLit = SatLiteral());
+  SatLiteral handleAnd(TNode node,
+                       Polarity pol,
+                       SatLiteral andLit = SatLiteral());
+  SatLiteral handleOr(TNode node,
+                      Polarity pol,
+                      SatLiteral orLit = SatLiteral());
 
   void convertAndAssertAnd(TNode node, bool negated);
   void convertAndAssertOr(TNode node, bool negated);
@@ -328,14 +416,130 @@ class TseitinCnfStream : public CnfStream {
    * Transforms the node into CNF recursively.
    * @param node the formula to transform
    * @param negated whether the literal is negated
+   * @param pol the polarity in which the returned literal is used
    * @return the literal representing the root of the formula
    */
-  SatLiteral toCNF(TNode node, bool negated = false);
+  SatLiteral toCNF(TNode node, bool negated = false, Polarity pol = POL_BOTH);
 
   void ensureLiteral(TNode n, bool noPreregistration = false) override;
 
+  /**
+   * A Boolean gate over SAT literals, the key of structural hashing.  OR and
+   * IMPLIES are represented as (negated) AND gates, EQUAL as a negated XOR
+   * gate.
+   */
+  struct Gate
+  {
+    /** AND, XOR or ITE */
+    Kind d_kind;
+    /** The inputs, the condition, then and else branch for ITE */
+    SatClause d_inputs;
+
+    bool operator==(const Gate& other) const
+    {
+      return d_kind == other.d_kind && d_inputs == other.d_inputs;
+    }
+  };
+
+  struct GateHashFunction
+  {
+    size_t operator()(const Gate& gate) const
+    {
+      return SatClauseHashFunction()(gate.d_inputs) * 3 + gate.d_kind;
+    }
+  };
+
+  /** Whether to use structural hashing for the current conversion */
+  bool useStructuralHashing() const
+  {
+    return d_structuralHashing && d_cnfProof == nullptr;
+  }
+
+  /**
+   * Normalizes the order and polarity of the inputs of gate: sorts the
+   * inputs of AND and XOR gates, and removes duplicate inputs of AND gates,
+   * makes the inputs of XOR gates and the condition and then branch of ITE
+   * gates positive.  Returns true if the output of the normalized gate is
+   * the negation of the output of the original one.
+   */
+  static bool normalizeGate(Gate& gate);
+
+  /**
+   * Looks up the normalized gate in the structural hashing table.  If it is
+   * found, maps node (which is equivalent to the gate, negated if negated is
+   * true) to its literal and returns that literal; numClauses clauses with
+   * numLiterals literals in total that would define node are saved.
+   * Otherwise, returns the null literal.
+   */
+  SatLiteral lookupGate(TNode node,
+                        const Gate& gate,
+                        bool negated,
+                        size_t numClauses,
+                        size_t numLiterals);
+
+  /**
+   * Stores lit as the literal of node, which is equivalent to the normalized
+   * gate (negated if negated is true), in the structural hashing table.
+   */
+  void storeGate(const Gate& gate, bool negated, SatLiteral lit);
+
+  /** Returns the polarity of the negation of a literal of polarity pol. */
+  static Polarity flip(Polarity pol)
+  {
+    return static_cast<Polarity>(((pol & POL_POS) << 1)
+                                 | ((pol & POL_NEG) >> 1));
+  }
+
+  /**
+   * Returns the directions in which the gates of the current conversion must
+   * be defined if they are needed in the directions pol.
+   */
+  Polarity required(Polarity pol) const
+  {
+    return d_polarityAware && d_cnfProof == nullptr ? pol : POL_BOTH;
+  }
+
+  /** The definition of a gate that is only defined in some directions */
+  struct PartialDefinition
+  {
+    /** The gate */
+    Node d_node;
+    /** The literal of the gate */
+    SatLiteral d_lit;
+    /** The directions in which d_lit is defined */
+    Polarity d_pol;
+  };
+
+  /**
+   * Records that the gate node with literal lit was defined in the
+   * directions pol only.
+   */
+  void notifyDefined(TNode node, SatLiteral lit, Polarity pol);
+
+  /**
+   * Ensures that lit (the literal of some node) is defined in the directions
+   * pol, completing its definition if it is a partially defined gate.
+   */
+  void ensureDefined(SatLiteral lit, Polarity pol);
+
   /** Pointer to resource manager for associated SmtEngine */
   ResourceManager* d_resourceManager;
+
+  /** Whether structural hashing is enabled (--cnf-strash) */
+  const bool d_structuralHashing;
+
+  /** The literals of the (normalized) gates converted in the current context */
+  context::CDInsertHashMap<Gate, SatLiteral, GateHashFunction> d_gateToLiteral;
+
+  /** Whether polarity-aware conversion is enabled (--cnf-polarity-aware) */
+  const bool d_polarityAware;
+
+  /**
+   * The definitions of the gates converted in the current context that are
+   * not defined in both directions, indexed by the variables of their
+   * literals.
+   */
+  context::CDHashMap<SatVariable, PartialDefinition> d_partialDefinitions;
 }; /* class TseitinCnfStream */
 
 } /* CVC4::prop namespace */
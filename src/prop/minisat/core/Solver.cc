@@ -124,6 +124,9 @@ static BoolOption    opt_luby_restart      (_cat, "luby",        "Use the Luby r
 static IntOption     opt_restart_first     (_cat, "rfirst",      "The base restart interval", 25, IntRange(1, INT32_MAX));
 static DoubleOption  opt_restart_inc       (_cat, "rinc",        "Restart interval increase factor", 3, DoubleRange(1, false, HUGE_VAL, false));
 static DoubleOption  opt_garbage_frac      (_cat, "gc-frac",     "The fraction of wasted memory allowed before a garbage collection is triggered",  0.20, DoubleRange(0, false, HUGE_VAL, false));
+static IntOption     opt_elim_occ_lim      (_cat, "elim-occ-lim", "Variables occurring in more clauses of one polarity are not eliminated when inprocessing", 16, IntRange(0, INT32_MAX));
+static IntOption     opt_elim_clause_lim   (_cat, "elim-cl-lim", "Variables are not eliminated when inprocessing if it produces a resolvent with a length above this limit", 20, IntRange(2, INT32_MAX));
+static DoubleOption  opt_vivify_effort     (_cat, "vivify-effort", "The propagations spent on vivification, relative to the propagations since the last round of inprocessing", 0.1, DoubleRange(0, true, HUGE_VAL, false));
 
 //=================================================================================================
 // Proof declarations
@@ -181,7 +184,18 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       //
       ,
       learntsize_adjust_start_confl(100),
-      learntsize_adjust_inc(1.5)
+      learntsize_adjust_inc(1.5),
+      reduce_tiers(options::satReduceDb() == options::SatReduceDbMode::TIERS),
+      tier_core_lbd(options::satTierCoreLbd()),
+      tier2_lbd(options::satTier2Lbd()),
+      reduce_interval(options::satReduceInterval()),
+      reduce_inc(options::satReduceIntervalInc()),
+      inprocessing(options::satInprocess() && !options::unsatCores()),
+      inprocess_elim(options::satInprocessElim()),
+      inprocess_interval(std::max(1u, options::satInprocessInterval())),
+      elim_occ_lim(opt_elim_occ_lim),
+      elim_clause_lim(opt_elim_clause_lim),
+      vivify_effort(opt_vivify_effort)
 
       // Statistics: (formerly in 'SolverStats')
       //
@@ -197,7 +211,19 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       clauses_literals(0),
       learnts_literals(0),
       max_literals(0),
-      tot_literals(0)
+      tot_literals(0),
+      inprocess_rounds(0),
+      subsumed_learnts(0),
+      vivified_clauses(0),
+      vivified_literals(0),
+      inproc_eliminated_vars(0),
+      inproc_restored_vars(0),
+      reduce_dbs(0),
+      tier_promotions(0),
+      tier2_demotions(0),
+      learnts_core(0),
+      learnts_tier2(0),
+      learnts_local(0)
 
       ,
       ok(true),
@@ -209,7 +235,12 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       simpDB_props(0),
       order_heap(VarOrderLt(activity)),
       progress_estimate(0),
-      remove_satisfied(!enable_incremental)
+      remove_satisfied(!enable_incremental),
+      inproc_n_elim(0),
+      next_inprocess(0),
+      inprocess_props(0),
+      lbd_stamp(0),
+      next_reduce(0)
 
       // Resource constraints:
       //
@@ -265,6 +296,8 @@ Var Solver::newVar(bool sign, bool dvar, bool isTheoryAtom, bool preRegister, bo
     decision .push();
     trail    .capacity(v+1);
     theory   .push(isTheoryAtom);
+    erasable .push(canErase && !isTheoryAtom);
+    inproc_elim.push(0);
 
     setDecisionVar(v, dvar);
 
@@ -296,6 +329,8 @@ void Solver::resizeVars(int newSize) {
     polarity.shrink(shrinkSize);
     decision.shrink(shrinkSize);
     theory.shrink(shrinkSize);
+    erasable.shrink(shrinkSize);
+    inproc_elim.shrink(shrinkSize);
 
   }
 
@@ -391,6 +426,10 @@ CRef Solver::reason(Var x) {
 
     // Construct the reason
     CRef real_reason = ca.alloc(explLevel, explanation, true);
+    if (reduce_tiers)
+    {
+      setTierLocal(ca[real_reason]);
+    }
     // FIXME: at some point will need more information about where this explanation
     // came from (ie. the theory/sharing)
     Debug("pf::sat") << "Minisat::Solver registering a THEORY_LEMMA (1)" << std::endl;
@@ -419,6 +458,19 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
 {
     if (!ok) return false;
 
+    // Variables eliminated by inprocessing must be restored before they are
+    // used again (during search this is done by updateLemmas())
+    if (inproc_n_elim > 0 && !minisat_busy && hasEliminated(ps))
+    {
+      for (int k = 0; k < ps.size(); k++)
+      {
+        if (inproc_elim[var(ps[k])] && restoreVar(var(ps[k])) != CRef_Undef)
+        {
+          return ok = false;
+        }
+      }
+    }
+
     // Check if clause is satisfied and remove false/duplicate literals:
     sort(ps);
     Lit p; int i, j;
@@ -713,7 +765,19 @@ Lit Solver::pickBranchLit()
     nextLit =
         MinisatSatSolver::toMinisatLit(d_proxy->getNextTheoryDecisionRequest());
     while (nextLit != lit_Undef) {
+      if (inproc_elim[var(nextLit)])
+      {
+        // The variable must be restored at level 0 before deciding on it
+        Debug("theoryDecision")
+            << "getNextTheoryDecisionRequest(): " << nextLit
+            << " was eliminated, restoring it" << std::endl;
+        erasable[var(nextLit)] = false;
+        inproc_restore.push(var(nextLit));
+        return lit_Undef;
+      }
       if(value(var(nextLit)) == l_Undef) {
+        // Theory decisions are never eliminated
+        erasable[var(nextLit)] = false;
         Debug("theoryDecision")
             << "getNextTheoryDecisionRequest(): now deciding on " << nextLit
             << std::endl;
@@ -888,7 +952,11 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
           Clause& c = ca[confl];
           max_resolution_level = std::max(max_resolution_level, c.level());
 
-          if (c.removable()) claBumpActivity(c);
+          if (c.removable())
+          {
+            claBumpActivity(c);
+            if (reduce_tiers) bumpTier(c);
+          }
         }
 
         for (int j = (p == lit_Undef) ? 0 : 1, size = ca[confl].size();
@@ -1343,6 +1411,11 @@ struct reduceDB_lt {
 };
 void Solver::reduceDB()
 {
+    if (reduce_tiers){
+        reduceDBTiers();
+        return;
+    }
+
     int     i, j;
     double  extra_lim = cla_inc / clauses_removable.size();    // Remove any clause below this activity
 
@@ -1361,6 +1434,93 @@ void Solver::reduceDB()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  reduceDBTiers : ()  ->  [void]
+|
+|  Description:
+|    Reduce the learnt clauses (and the removable theory lemmas and explanations) kept in tiers
+|    by their LBD, as in Glucose: clauses in the core tier are never removed, clauses in tier2
+|    that were not used in a conflict since the last reduction are demoted to the local tier, and
+|    the less active half of the local tier is removed. Locked and binary clauses are kept.
+|________________________________________________________________________________________________@*/
+void Solver::reduceDBTiers()
+{
+    reduce_dbs++;
+    next_reduce = conflicts + reduce_interval + reduce_inc * reduce_dbs;
+
+    vec<CRef> local;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        Clause& c = ca[clauses_removable[i]];
+        if (c.tier() == TIER_2 && !c.used()){
+            c.tier(TIER_LOCAL);
+            tier2_demotions++;
+        }
+        c.used(false);
+        if (c.tier() == TIER_LOCAL)
+            local.push(clauses_removable[i]);
+    }
+
+    sort(local, reduceDB_lt(ca));
+    for (int i = 0; i < local.size() / 2; i++){
+        Clause& c = ca[local[i]];
+        if (c.size() > 2 && !locked(c))
+            removeClause(local[i]);
+    }
+
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+    checkGarbage();
+    updateTierStats();
+}
+
+void Solver::setTier(Clause& c, int lbd)
+{
+    c.lbd(lbd);
+    c.tier(lbd <= tier_core_lbd ? TIER_CORE
+                                : lbd <= tier2_lbd ? TIER_2 : TIER_LOCAL);
+    c.used(true);
+}
+
+void Solver::setTierLocal(Clause& c)
+{
+    // The LBD of a theory explanation or lemma when it is added (all but one
+    // literal are usually false) says little about its quality, hence it only
+    // leaves the local tier once its LBD is measured in a conflict. The LBD
+    // of a clause is at most its size, so 'bumpTier()' then lowers it.
+    c.lbd(c.size() + 1);
+    c.tier(TIER_LOCAL);
+    c.used(true);
+}
+
+void Solver::bumpTier(Clause& c)
+{
+    c.used(true);
+    if (c.tier() == TIER_CORE) return;
+    int lbd = computeLbd(c);
+    if (lbd < c.lbd()){
+        uint32_t tier = c.tier();
+        setTier(c, lbd);
+        if (c.tier() < tier)
+            tier_promotions++;
+    }
+}
+
+void Solver::updateTierStats()
+{
+    learnts_core = learnts_tier2 = learnts_local = 0;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        switch (ca[clauses_removable[i]].tier()){
+            case TIER_CORE: learnts_core++; break;
+            case TIER_2: learnts_tier2++; break;
+            default: learnts_local++;
+        }
+    }
+}
+
 void Solver::removeSatisfied(vec<CRef>& cs)
 {
     int i, j;
@@ -1437,6 +1597,455 @@ bool Solver::simplify()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  inprocess : [void]  ->  [bool]
+|
+|  Description:
+|    Simplify the clause database between two restarts: remove the learnt clauses that are
+|    subsumed, shorten the learnt clauses by vivification and eliminate the variables of Boolean
+|    gates by clause distribution. Returns FALSE if a conflict at level 0 is found.
+|
+|    All three are safe for DPLL(T) and incremental solving: only Boolean propagation is used,
+|    derived clauses are given the highest user level of the clauses they were derived from,
+|    and theory atoms are never eliminated. The clauses of eliminated variables are kept and
+|    re-added (at their original level) as soon as the variable occurs in a new clause.
+|________________________________________________________________________________________________@*/
+bool Solver::inprocess()
+{
+    assert(decisionLevel() == 0);
+    Assert(lemmas.size() == 0);
+
+    if (!ok || propagateBool() != CRef_Undef)
+        return ok = false;
+
+    inprocess_rounds++;
+    Debug("minisat::inprocess") << "inprocessing round " << inprocess_rounds
+                                << ": " << nClauses() << " clauses, "
+                                << nLearnts() << " learnts" << std::endl;
+
+    subsumeLearnts();
+    vivifyLearnts();
+    if (inprocess_elim)
+        inprocessElim();
+
+    checkGarbage();
+    inprocess_props = propagations;
+    return true;
+}
+
+struct subsume_lt {
+    ClauseAllocator& ca;
+    subsume_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) { return ca[x].size() < ca[y].size(); }
+};
+void Solver::subsumeLearnts()
+{
+    // Occurrences of the literals in the (unlocked) learnt clauses
+    vec<vec<CRef> > occs;
+    occs.growTo(2 * nVars());
+    for (int i = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        if (locked(c)) continue;
+        for (int j = 0; j < c.size(); j++)
+            occs[toInt(c[j])].push(clauses_removable[i]);
+    }
+
+    // Try the short clauses first: each learnt clause and each short problem clause
+    vec<CRef> subsuming;
+    for (int i = 0; i < clauses_removable.size(); i++)
+        subsuming.push(clauses_removable[i]);
+    for (int i = 0; i < clauses_persistent.size(); i++)
+        if (ca[clauses_persistent[i]].size() <= elim_clause_lim)
+            subsuming.push(clauses_persistent[i]);
+    sort(subsuming, subsume_lt(ca));
+
+    for (int i = 0; i < subsuming.size(); i++){
+        const Clause& c = ca[subsuming[i]];
+        if (c.mark() == 1) continue;
+
+        // Mark the literals of c and find the one with the fewest occurrences
+        Lit best = c[0];
+        for (int j = 0; j < c.size(); j++){
+            seen[var(c[j])] = 1 + sign(c[j]);
+            if (occs[toInt(c[j])].size() < occs[toInt(best)].size())
+                best = c[j];
+        }
+
+        // A clause subsumes the clauses that contain all of its literals, as long as it stays
+        // in the database at least as long as they do
+        vec<CRef>& cs = occs[toInt(best)];
+        for (int j = 0; j < cs.size(); j++){
+            if (cs[j] == subsuming[i]) continue;
+            Clause& d = ca[cs[j]];
+            if (d.mark() == 1 || d.size() < c.size() || d.level() < c.level())
+                continue;
+            int found = 0;
+            for (int k = 0; k < d.size(); k++)
+                if (seen[var(d[k])] == 1 + sign(d[k]))
+                    found++;
+            if (found == c.size()){
+                removeClause(cs[j]);
+                subsumed_learnts++;
+            }
+        }
+
+        for (int j = 0; j < c.size(); j++)
+            seen[var(c[j])] = 0;
+    }
+
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+}
+
+struct vivify_lt {
+    ClauseAllocator& ca;
+    vivify_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) { return ca[x].activity() > ca[y].activity(); }
+};
+void Solver::vivifyLearnts()
+{
+    // The candidates are the unlocked learnt clauses with no literal assigned at level 0, most
+    // active first
+    vec<CRef> candidates;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        if (c.size() <= 2 || locked(c)) continue;
+        bool assigned = false;
+        for (int j = 0; j < c.size() && !assigned; j++)
+            assigned = value(c[j]) != l_Undef;
+        if (!assigned)
+            candidates.push(clauses_removable[i]);
+    }
+    sort(candidates, vivify_lt(ca));
+
+    // Probing overwrites the saved phases
+    vec<char> saved_polarity;
+    polarity.copyTo(saved_polarity);
+
+    uint64_t budget = std::max<uint64_t>(
+        10000, (propagations - inprocess_props) * vivify_effort);
+    uint64_t limit = propagations + budget;
+    vec<CRef> replaced;
+    vec<Lit> kept;
+    for (int i = 0; i < candidates.size() && propagations < limit; i++){
+        CRef cr = candidates[i];
+        if (ca[cr].mark() == 1) continue;
+
+        // The clause must not propagate itself
+        detachClause(cr, true);
+
+        // Assume the negation of the literals one by one: the clause is implied by its prefix
+        // as soon as this leads to a conflict or makes one of the remaining literals true,
+        // and literals made false can be dropped
+        kept.clear();
+        CRef confl = CRef_Undef;
+        bool implied = false;
+        int size = ca[cr].size();
+        for (int j = 0; j < size && !implied; j++){
+            Lit p = ca[cr][j];
+            if (value(p) == l_False) continue;
+            kept.push(p);
+            if (value(p) == l_True){
+                implied = true;
+            }else{
+                newDecisionLevel();
+                uncheckedEnqueue(~p);
+                confl = propagateBool();
+                implied = confl != CRef_Undef;
+            }
+        }
+
+        if (kept.size() < size && kept.size() > 1){
+            int level = std::max(ca[cr].level(), derivedLevel(confl));
+            float act = ca[cr].activity();
+            int lbd = std::min(ca[cr].lbd(), kept.size());
+            uint32_t tier = ca[cr].tier();
+            cancelUntil(0);
+            CRef ncr = ca.alloc(level, kept, true);
+            ca[ncr].activity() = act;
+            ca[ncr].lbd(lbd);
+            ca[ncr].tier(tier);
+            attachClause(ncr);
+            replaced.push(cr);
+            replaced.push(ncr);
+            vivified_clauses++;
+            vivified_literals += size - kept.size();
+        }else{
+            cancelUntil(0);
+            attachClause(cr);
+        }
+    }
+    saved_polarity.copyTo(polarity);
+
+    // Replace the vivified clauses (already detached) in the database
+    for (int i = 0; i < replaced.size(); i += 2){
+        Clause& c = ca[replaced[i]];
+        c.mark(1);
+        ca.free(replaced[i]);
+    }
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+    for (i = 1; i < replaced.size(); i += 2)
+        clauses_removable.push(replaced[i]);
+}
+
+int Solver::derivedLevel(CRef confl) const
+{
+    // The clauses used to propagate the trail above level 0, and the level 0 literals they
+    // contain, must exist at the user level of the derived clause
+    int max_level = 0;
+    vec<CRef> used;
+    if (confl != CRef_Undef)
+        used.push(confl);
+    for (int i = decisionLevel() > 0 ? trail_lim[0] : trail.size(); i < trail.size(); i++)
+        if (hasReasonClause(var(trail[i])))
+            used.push(vardata[var(trail[i])].d_reason);
+    for (int i = 0; i < used.size(); i++){
+        const Clause& c = ca[used[i]];
+        max_level = std::max(max_level, c.level());
+        for (int j = 0; j < c.size(); j++)
+            if (value(c[j]) != l_Undef && level(var(c[j])) == 0)
+                max_level = std::max(max_level, user_level(var(c[j])));
+    }
+    return max_level;
+}
+
+struct elim_lt {
+    const vec<vec<CRef> >& occs;
+    elim_lt(const vec<vec<CRef> >& occs_) : occs(occs_) {}
+    bool operator () (Var x, Var y) { return occs[x].size() < occs[y].size(); }
+};
+void Solver::inprocessElim()
+{
+    // Occurrences of the variables in the problem clauses. The level 0 assignment is ignored
+    // since it may depend on the current user level.
+    vec<vec<CRef> > occs;
+    occs.growTo(nVars());
+    for (int i = 0; i < clauses_persistent.size(); i++){
+        const Clause& c = ca[clauses_persistent[i]];
+        if (c.mark() == 1) continue;
+        for (int j = 0; j < c.size(); j++)
+            occs[var(c[j])].push(clauses_persistent[i]);
+    }
+
+    vec<Var> candidates;
+    for (Var v = 0; v < nVars(); v++)
+        if (erasable[v] && !inproc_elim[v] && decision[v] && value(v) == l_Undef
+            && (polarity[v] & 0x2) == 0 && occs[v].size() > 0)
+            candidates.push(v);
+    sort(candidates, elim_lt(occs));
+
+    int eliminated = inproc_n_elim;
+    for (int i = 0; i < candidates.size(); i++)
+        inprocessElimVar(candidates[i], occs);
+    if (inproc_n_elim == eliminated)
+        return;
+
+    // Remove the eliminated clauses and the learnt clauses with eliminated variables
+    int i, j;
+    for (i = j = 0; i < clauses_persistent.size(); i++)
+        if (ca[clauses_persistent[i]].mark() != 1)
+            clauses_persistent[j++] = clauses_persistent[i];
+    clauses_persistent.shrink(i - j);
+    for (i = j = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        bool elim = false;
+        for (int k = 0; k < c.size() && !elim; k++)
+            elim = inproc_elim[var(c[k])];
+        if (elim && !locked(c))
+            removeClause(clauses_removable[i]);
+        else
+            clauses_removable[j++] = clauses_removable[i];
+    }
+    clauses_removable.shrink(i - j);
+}
+
+void Solver::inprocessElimVar(Var v, vec<vec<CRef> >& occs)
+{
+    vec<CRef> pos, neg;
+    for (int i = 0; i < occs[v].size(); i++){
+        const Clause& c = ca[occs[v][i]];
+        if (c.mark() == 1) continue;
+        for (int j = 0; j < c.size(); j++)
+            if (var(c[j]) == v){
+                (sign(c[j]) ? neg : pos).push(occs[v][i]);
+                break;
+            }
+    }
+    if (pos.size() + neg.size() == 0 || pos.size() > elim_occ_lim || neg.size() > elim_occ_lim)
+        return;
+
+    // Check that the resolvents are no more and not too long, and that they can be watched by
+    // two unassigned literals
+    vec<Lit> resolvent;
+    int count = 0;
+    for (int i = 0; i < pos.size(); i++)
+        for (int j = 0; j < neg.size(); j++){
+            if (!resolve(ca[pos[i]], ca[neg[j]], v, resolvent))
+                continue;
+            if (++count > pos.size() + neg.size() || resolvent.size() > elim_clause_lim)
+                return;
+            int free = 0;
+            for (int k = 0; k < resolvent.size(); k++)
+                if (value(resolvent[k]) != l_False)
+                    free++;
+            if (free < 2)
+                return;
+        }
+
+    Debug("minisat::inprocess") << "eliminating " << v << ": " << pos.size()
+                                << " + " << neg.size() << " clauses, "
+                                << count << " resolvents" << std::endl;
+
+    // Add the resolvents, at the user level of their antecedents
+    lemma_lt lt(*this);
+    for (int i = 0; i < pos.size(); i++)
+        for (int j = 0; j < neg.size(); j++){
+            if (!resolve(ca[pos[i]], ca[neg[j]], v, resolvent))
+                continue;
+            int level = std::max(ca[pos[i]].level(), ca[neg[j]].level());
+            sort(resolvent, lt);
+            CRef cr = ca.alloc(level, resolvent, false);
+            clauses_persistent.push(cr);
+            attachClause(cr);
+            for (int k = 0; k < resolvent.size(); k++)
+                occs[var(resolvent[k])].push(cr);
+        }
+
+    // Remove the clauses of v, keeping them for the model and for restoring v
+    for (int s = 0; s < 2; s++){
+        vec<CRef>& cs = s == 0 ? pos : neg;
+        for (int i = 0; i < cs.size(); i++){
+            const Clause& c = ca[cs[i]];
+            inproc_elim_clauses.push_back(ElimClause(v, c.level()));
+            std::vector<Lit>& lits = inproc_elim_clauses.back().d_lits;
+            lits.push_back(mkLit(v, s == 1));
+            for (int j = 0; j < c.size(); j++)
+                if (var(c[j]) != v)
+                    lits.push_back(c[j]);
+            removeClause(cs[i]);
+        }
+    }
+
+    inproc_elim[v] = 1;
+    inproc_n_elim++;
+    inproc_eliminated_vars++;
+    setDecisionVar(v, false);
+}
+
+bool Solver::resolve(const Clause& p, const Clause& n, Var v, vec<Lit>& out)
+{
+    out.clear();
+    for (int i = 0; i < p.size(); i++)
+        if (var(p[i]) != v){
+            seen[var(p[i])] = 1 + sign(p[i]);
+            out.push(p[i]);
+        }
+    bool tautology = false;
+    for (int i = 0; i < n.size() && !tautology; i++){
+        if (var(n[i]) == v) continue;
+        char s = seen[var(n[i])];
+        if (s == 0)
+            out.push(n[i]);
+        else
+            tautology = s != 1 + sign(n[i]);
+    }
+    for (int i = 0; i < p.size(); i++)
+        seen[var(p[i])] = 0;
+    return !tautology;
+}
+
+bool Solver::hasEliminated(const vec<Lit>& ps) const
+{
+    for (int i = 0; i < ps.size(); i++)
+        if (inproc_elim[var(ps[i])])
+            return true;
+    return false;
+}
+
+CRef Solver::restoreVar(Var v)
+{
+    assert(decisionLevel() == 0);
+    Debug("minisat::inprocess") << "restoring " << v << std::endl;
+
+    inproc_elim[v] = 0;
+    inproc_n_elim--;
+    inproc_restored_vars++;
+    setDecisionVar(v, true);
+
+    std::vector<ElimClause> restored;
+    size_t i, j;
+    for (i = j = 0; i < inproc_elim_clauses.size(); i++)
+        if (inproc_elim_clauses[i].d_var == v)
+            restored.push_back(inproc_elim_clauses[i]);
+        else
+            inproc_elim_clauses[j++] = inproc_elim_clauses[i];
+    inproc_elim_clauses.erase(inproc_elim_clauses.begin() + j,
+                              inproc_elim_clauses.end());
+
+    // The clauses may contain variables eliminated later on
+    CRef conflict = CRef_Undef;
+    lemma_lt lt(*this);
+    vec<Lit> lits;
+    for (const ElimClause& ec : restored){
+        lits.clear();
+        for (Lit p : ec.d_lits){
+            if (inproc_elim[var(p)]){
+                CRef c = restoreVar(var(p));
+                if (c != CRef_Undef) conflict = c;
+            }
+            lits.push(p);
+        }
+        sort(lits, lt);
+        CRef cr = ca.alloc(ec.d_level, lits, false);
+        clauses_persistent.push(cr);
+        attachClause(cr);
+        if (value(lits[0]) == l_False)
+            conflict = cr;
+        else if (value(lits[0]) == l_Undef && value(lits[1]) == l_False)
+            uncheckedEnqueue(lits[0], cr);
+    }
+    return conflict;
+}
+
+void Solver::extendEliminated()
+{
+    // The resolvents are satisfied, hence either all clauses of v with a positive occurrence
+    // or all clauses with a negative one are satisfied by other literals: in reverse order of
+    // elimination, make v true if needed for the former
+    vec<lbool> values;
+    assigns.copyTo(values);
+    int i = inproc_elim_clauses.size() - 1;
+    while (i >= 0){
+        Var v = inproc_elim_clauses[i].d_var;
+        bool positive = false;
+        for (; i >= 0 && inproc_elim_clauses[i].d_var == v; i--){
+            const std::vector<Lit>& lits = inproc_elim_clauses[i].d_lits;
+            if (sign(lits[0])) continue;
+            bool satisfied = false;
+            for (size_t j = 1; j < lits.size() && !satisfied; j++)
+                satisfied = (values[var(lits[j])] ^ sign(lits[j])) == l_True;
+            positive = positive || !satisfied;
+        }
+        values[v] = lbool(positive);
+    }
+
+    // Assign them above level 0 so that they are undone with the trail
+    if (decisionLevel() == 0)
+        newDecisionLevel();
+    for (Var v = 0; v < nVars(); v++)
+        if (inproc_elim[v] && value(v) == l_Undef)
+            uncheckedEnqueue(mkLit(v, values[v] != l_True));
+}
+
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -1498,6 +2107,10 @@ lbool Solver::search(int nof_conflicts)
               clauses_removable.push(cr);
               attachClause(cr);
               claBumpActivity(ca[cr]);
+              if (reduce_tiers)
+              {
+                setTier(ca[cr], computeLbd(learnt_clause));
+              }
               uncheckedEnqueue(learnt_clause[0], cr);
               if (options::unsatCores())
               {
@@ -1574,7 +2187,8 @@ lbool Solver::search(int nof_conflicts)
                 return l_False;
             }
 
-            if (clauses_removable.size()-nAssigns() >= max_learnts) {
+            if (reduce_tiers ? conflicts >= next_reduce
+                             : clauses_removable.size() - nAssigns() >= max_learnts) {
                 // Reduce the set of learnt clauses:
                 reduceDB();
             }
@@ -1599,6 +2213,21 @@ lbool Solver::search(int nof_conflicts)
                 // New variable decision:
                 next = pickBranchLit();
 
+                if (inproc_restore.size() > 0) {
+                    // Restore the eliminated variables requested as theory
+                    // decisions and propagate again
+                    cancelUntil(0);
+                    for (int i = 0; i < inproc_restore.size(); i++)
+                        if (inproc_elim[inproc_restore[i]]
+                            && restoreVar(inproc_restore[i]) != CRef_Undef) {
+                            inproc_restore.clear();
+                            return l_False;
+                        }
+                    inproc_restore.clear();
+                    check_type = CHECK_WITH_THEORY;
+                    continue;
+                }
+
                 if (next == lit_Undef) {
                     // We need to do a full theory check to confirm
                   Debug("minisat::search") << "Doing a full theory check..."
@@ -1688,6 +2317,11 @@ lbool Solver::solve_()
         printf("===============================================================================\n");
     }
 
+    if (reduce_tiers && next_reduce == 0)
+        next_reduce = conflicts + reduce_interval;
+    if (inprocessing && next_inprocess == 0)
+        next_inprocess = conflicts + inprocess_interval;
+
     // Search:
     int curr_restarts = 0;
     while (status == l_Undef){
@@ -1696,6 +2330,13 @@ lbool Solver::solve_()
         if (!withinBudget(ResourceManager::Resource::SatConflictStep))
           break;  // FIXME add restart option?
         curr_restarts++;
+
+        // Inprocess between restarts, less and less often
+        if (status == l_Undef && inprocessing && conflicts >= next_inprocess){
+            if (!inprocess())
+                status = l_False;
+            next_inprocess = conflicts + inprocess_interval * (inprocess_rounds + 1);
+        }
     }
 
     if (!withinBudget(ResourceManager::Resource::SatConflictStep))
@@ -1704,9 +2345,13 @@ lbool Solver::solve_()
     if (verbosity >= 1)
         printf("===============================================================================\n");
 
+    if (reduce_tiers)
+        updateTierStats();
 
     if (status == l_True){
         // Extend & copy model:
+        if (inproc_n_elim > 0)
+            extendEliminated();
         model.growTo(nVars());
         for (int i = 0; i < nVars(); i++) {
           model[i] = value(i);
@@ -1909,6 +2554,21 @@ void Solver::pop()
   removeClausesAboveLevel(clauses_persistent, assertionLevel);
   removeClausesAboveLevel(clauses_removable, assertionLevel);
 
+  // Forget the eliminated clauses of the popped levels
+  if (!inproc_elim_clauses.empty())
+  {
+    size_t i, j;
+    for (i = j = 0; i < inproc_elim_clauses.size(); ++i)
+    {
+      if (inproc_elim_clauses[i].d_level <= assertionLevel)
+      {
+        inproc_elim_clauses[j++] = inproc_elim_clauses[i];
+      }
+    }
+    inproc_elim_clauses.erase(inproc_elim_clauses.begin() + j,
+                              inproc_elim_clauses.end());
+  }
+
   // Pop the SAT context to notify everyone
   d_context->pop();  // SAT context for CVC4
 
@@ -1916,6 +2576,11 @@ void Solver::pop()
   resizeVars(assigns_lim.last());
   assigns_lim.pop();
   variables_to_register.clear();
+  inproc_n_elim = 0;
+  for (int i = 0; i < inproc_elim.size(); ++i)
+  {
+    inproc_n_elim += inproc_elim[i];
+  }
 
   // Pop the OK
   ok = trail_ok.last();
@@ -1931,6 +2596,36 @@ CRef Solver::updateLemmas() {
 
   CRef conflict = CRef_Undef;
 
+  // Restore the variables eliminated by inprocessing that occur in the
+  // lemmas, their clauses are added back at level 0
+  if (inproc_n_elim > 0)
+  {
+    bool restore = false;
+    for (int j = 0; j < lemmas.size() && !restore; ++j)
+    {
+      restore = hasEliminated(lemmas[j]);
+    }
+    if (restore)
+    {
+      cancelUntil(0);
+      for (int j = 0; j < lemmas.size(); ++j)
+      {
+        for (int k = 0; k < lemmas[j].size(); ++k)
+        {
+          Var v = var(lemmas[j][k]);
+          if (inproc_elim[v])
+          {
+            CRef c = restoreVar(v);
+            if (c != CRef_Undef)
+            {
+              conflict = c;
+            }
+          }
+        }
+      }
+    }
+  }
+
   // Decision level to backtrack to
   int backtrackLevel = decisionLevel();
 
@@ -2009,6 +2704,10 @@ CRef Solver::updateLemmas() {
       }
 
       lemma_ref = ca.alloc(clauseLevel, lemma, removable);
+      if (removable && reduce_tiers)
+      {
+        setTierLocal(ca[lemma_ref]);
+      }
       if (options::unsatCores())
       {
         TNode cnf_assertion = lemmas_cnf_assertion[j];
@@ -2099,6 +2798,9 @@ void ClauseAllocator::reloc(CRef& cr,
   // Copy extra data-fields:
   // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
   to[cr].mark(c.mark());
+  to[cr].lbd(c.lbd());
+  to[cr].tier(c.tier());
+  to[cr].used(c.used());
   if (to[cr].removable())         to[cr].activity() = c.activity();
   else if (to[cr].has_extra()) to[cr].calcAbstraction();
 }
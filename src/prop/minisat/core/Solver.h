@@ -280,10 +280,25 @@ public:
     int       learntsize_adjust_start_confl;
     double    learntsize_adjust_inc;
 
+    bool      reduce_tiers;       // Manage the learnt clauses in tiers by LBD (see 'reduceDBTiers()').
+    int       tier_core_lbd;      // Learnt clauses with at most this LBD are never removed.
+    int       tier2_lbd;          // Learnt clauses with at most this LBD are kept while they are used.
+    int       reduce_interval;    // The number of conflicts before the first reduction of the local tier.
+    int       reduce_inc;         // The increment of the number of conflicts between two reductions.
+
+    bool      inprocessing;       // Simplify the clause database between restarts (see 'inprocess()').
+    bool      inprocess_elim;     // Eliminate variables when inprocessing.
+    int       inprocess_interval; // The number of conflicts before the first round of inprocessing (grows linearly).
+    int       elim_occ_lim;       // Variables occurring in more clauses of one polarity are not eliminated.
+    int       elim_clause_lim;    // Variables are not eliminated if it produces a resolvent longer than this.
+    double    vivify_effort;      // Propagations spent on vivification, relative to the propagations since the last round.
+
     // Statistics: (read-only member variable)
     //
     uint64_t solves, starts, decisions, rnd_decisions, propagations, conflicts, resources_consumed;
     uint64_t dec_vars, clauses_literals, learnts_literals, max_literals, tot_literals;
+    uint64_t inprocess_rounds, subsumed_learnts, vivified_clauses, vivified_literals, inproc_eliminated_vars, inproc_restored_vars;
+    uint64_t reduce_dbs, tier_promotions, tier2_demotions, learnts_core, learnts_tier2, learnts_local;
 
 protected:
 
@@ -329,6 +344,13 @@ protected:
         bool operator()(const Watcher& w) const { return ca[w.cref].mark() == 1; }
     };
 
+    // Tiers of the learnt clause database
+    enum ClauseTier {
+      TIER_CORE = 0,
+      TIER_2 = 1,
+      TIER_LOCAL = 2
+    };
+
     struct VarOrderLt {
         const vec<double>&  activity;
         bool operator () (Var x, Var y) const { return activity[x] > activity[y]; }
@@ -367,6 +389,24 @@ protected:
     // CVC4 Stuff
     vec<bool>           theory;           // Is the variable representing a theory atom
 
+    // Inprocessing:
+    //
+    // A clause removed by variable elimination, with the eliminated variable first.
+    struct ElimClause {
+      Var d_var;
+      int d_level;
+      std::vector<Lit> d_lits;
+      ElimClause(Var var, int level) : d_var(var), d_level(level) {}
+    };
+
+    vec<char>           erasable;             // Can the variable be eliminated (it is not a theory atom and was created with 'canErase').
+    vec<char>           inproc_elim;          // Has the variable been eliminated by inprocessing.
+    int                 inproc_n_elim;        // The number of variables eliminated by inprocessing.
+    std::vector<ElimClause> inproc_elim_clauses; // The clauses of the eliminated variables, in order of elimination.
+    vec<Var>            inproc_restore;       // Eliminated variables that were requested as theory decisions.
+    uint64_t            next_inprocess;       // The number of conflicts at which to inprocess next.
+    uint64_t            inprocess_props;      // The number of propagations at the end of the last round of inprocessing.
+
     enum TheoryCheckType {
       // Quick check, but don't perform theory reasoning
       CHECK_WITHOUT_THEORY,
@@ -386,6 +426,10 @@ protected:
     vec<Lit>            analyze_toclear;
     vec<Lit>            add_tmp;
 
+    vec<uint64_t>       lbd_levels;         // The stamp of the decision levels counted by 'computeLbd()'.
+    uint64_t            lbd_stamp;
+    uint64_t            next_reduce;        // The number of conflicts at which to reduce the local tier next.
+
     double              max_learnts;
     double              learntsize_adjust_confl;
     int                 learntsize_adjust_cnt;
@@ -416,8 +460,25 @@ protected:
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
+    void     reduceDBTiers    ();                                                      // Reduce the local tier and demote the unused tier2 clauses.
+    template <class C>
+    int      computeLbd       (const C& c);                                            // The number of decision levels of 'c' (unassigned literals count as one each).
+    void     setTier          (Clause& c, int lbd);                                    // Set the LBD and the matching tier of a new removable clause.
+    void     setTierLocal     (Clause& c);                                             // Put a new theory explanation or lemma in the local tier, from which 'bumpTier()' promotes it.
+    void     bumpTier         (Clause& c);                                             // Mark a removable clause used in a conflict, promoting it if its LBD decreased.
+    void     updateTierStats  ();                                                      // Count the learnt clauses per tier.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
+    bool     inprocess        ();                                                      // Simplify the clause database at level 0 (between restarts).
+    void     subsumeLearnts   ();                                                      // Remove the learnt clauses subsumed by other clauses.
+    void     vivifyLearnts    ();                                                      // Shorten learnt clauses by propagating the negation of their literals.
+    void     inprocessElim    ();                                                      // Bounded variable elimination of the erasable variables.
+    void     inprocessElimVar (Var v, vec<vec<CRef> >& occs);                          // Eliminate 'v' if this does not increase the number of clauses.
+    bool     resolve          (const Clause& p, const Clause& n, Var v, vec<Lit>& out); // Resolve 'p' and 'n' on 'v', returns FALSE if the resolvent is a tautology.
+    bool     hasEliminated    (const vec<Lit>& ps) const;                              // Does 'ps' contain a variable eliminated by inprocessing.
+    CRef     restoreVar       (Var v);                                                 // Re-add the clauses of an eliminated variable at level 0. Returns a conflicting clause if any.
+    void     extendEliminated ();                                                      // Assign the eliminated variables after a satisfiable search.
+    int      derivedLevel     (CRef confl) const;                                      // The user level of a clause derived from the current trail (and 'confl').
 
     // Maintaining Variable/Clause activity:
     //
@@ -542,6 +603,26 @@ inline void Solver::varBumpActivity(Var v, double inc) {
     if (order_heap.inHeap(v))
         order_heap.decrease(v); }
 
+template <class C>
+inline int Solver::computeLbd(const C& c)
+{
+    lbd_levels.growTo(decisionLevel() + 1, 0);
+    lbd_stamp++;
+    int lbd = 0;
+    for (int i = 0; i < c.size(); i++){
+        if (value(c[i]) == l_Undef){
+            lbd++;
+            continue;
+        }
+        int l = level(var(c[i]));
+        if (lbd_levels[l] != lbd_stamp){
+            lbd_levels[l] = lbd_stamp;
+            lbd++;
+        }
+    }
+    return lbd;
+}
+
 inline void Solver::claDecayActivity() { cla_inc *= (1 / clause_decay); }
 inline void Solver::claBumpActivity (Clause& c) {
         if ( (c.activity() += cla_inc) > 1e20 ) {
@@ -24,6 +24,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #define Minisat_SolverTypes_h
 
 #include <assert.h>
+#include "base/check.h"
 #include "base/output.h"
 #include "prop/minisat/mtl/IntTypes.h"
 #include "prop/minisat/mtl/Alg.h"
@@ -199,7 +200,10 @@ class Clause {
         unsigned has_extra : 1;
         unsigned reloced   : 1;
         unsigned size      : 27;
-        unsigned level     : 32; }                            header;
+        unsigned level     : 23;  // User level of the clause
+        unsigned lbd       : 6;   // Literal block distance (learnt clauses, capped)
+        unsigned tier      : 2;   // Tier in the learnt clause database
+        unsigned used      : 1; }                             header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -212,7 +216,11 @@ class Clause {
         header.has_extra = use_extra;
         header.reloced   = 0;
         header.size      = ps.size();
+        Assert(level >= 0 && level < (1 << 23));  // fits the level bit-field
         header.level     = level;
+        header.lbd       = 0;
+        header.tier      = 0;
+        header.used      = 0;
 
         for (int i = 0; i < ps.size(); i++) data[i].lit = ps[i];
 
@@ -242,6 +250,12 @@ public:
     uint32_t     mark        ()      const   { return header.mark; }
     void         mark        (uint32_t m)    { header.mark = m; }
     const Lit&   last        ()      const   { return data[header.size-1].lit; }
+    int          lbd         ()      const   { return header.lbd; }
+    void         lbd         (int l)         { header.lbd = l < 63 ? l : 63; }
+    uint32_t     tier        ()      const   { return header.tier; }
+    void         tier        (uint32_t t)    { header.tier = t; }
+    bool         used        ()      const   { return header.used; }
+    void         used        (bool u)        { header.used = u; }
 
     bool         reloced     ()      const   { return header.reloced; }
     CRef         relocation  ()      const   { return data[0].rel; }
@@ -193,6 +193,8 @@ void MinisatSatSolver::interrupt() {
   d_minisat->interrupt();
 }
 
+void MinisatSatSolver::clearInterrupt() { d_minisat->clearInterrupt(); }
+
 SatValue MinisatSatSolver::value(SatLiteral l) {
   return toSatLiteralValue(d_minisat->value(toMinisatLit(l)));
 }
@@ -244,7 +246,19 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
     d_statClausesLiterals("sat::clauses_literals"),
     d_statLearntsLiterals("sat::learnts_literals"),
     d_statMaxLiterals("sat::max_literals"),
-    d_statTotLiterals("sat::tot_literals")
+    d_statTotLiterals("sat::tot_literals"),
+    d_statInprocessRounds("sat::inprocess_rounds"),
+    d_statSubsumedLearnts("sat::subsumed_learnts"),
+    d_statVivifiedClauses("sat::vivified_clauses"),
+    d_statVivifiedLiterals("sat::vivified_literals"),
+    d_statEliminatedVars("sat::eliminated_vars"),
+    d_statRestoredVars("sat::restored_vars"),
+    d_statReduceDbs("sat::reduce_dbs"),
+    d_statTierPromotions("sat::tier_promotions"),
+    d_statTier2Demotions("sat::tier2_demotions"),
+    d_statLearntsCore("sat::learnts_core"),
+    d_statLearntsTier2("sat::learnts_tier2"),
+    d_statLearntsLocal("sat::learnts_local")
 {
   d_registry->registerStat(&d_statStarts);
   d_registry->registerStat(&d_statDecisions);
@@ -255,6 +269,18 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
   d_registry->registerStat(&d_statLearntsLiterals);
   d_registry->registerStat(&d_statMaxLiterals);
   d_registry->registerStat(&d_statTotLiterals);
+  d_registry->registerStat(&d_statInprocessRounds);
+  d_registry->registerStat(&d_statSubsumedLearnts);
+  d_registry->registerStat(&d_statVivifiedClauses);
+  d_registry->registerStat(&d_statVivifiedLiterals);
+  d_registry->registerStat(&d_statEliminatedVars);
+  d_registry->registerStat(&d_statRestoredVars);
+  d_registry->registerStat(&d_statReduceDbs);
+  d_registry->registerStat(&d_statTierPromotions);
+  d_registry->registerStat(&d_statTier2Demotions);
+  d_registry->registerStat(&d_statLearntsCore);
+  d_registry->registerStat(&d_statLearntsTier2);
+  d_registry->registerStat(&d_statLearntsLocal);
 }
 
 MinisatSatSolver::Statistics::~Statistics() {
@@ -267,6 +293,18 @@ MinisatSatSolver::Statistics::~Statistics() {
   d_registry->unregisterStat(&d_statLearntsLiterals);
   d_registry->unregisterStat(&d_statMaxLiterals);
   d_registry->unregisterStat(&d_statTotLiterals);
+  d_registry->unregisterStat(&d_statInprocessRounds);
+  d_registry->unregisterStat(&d_statSubsumedLearnts);
+  d_registry->unregisterStat(&d_statVivifiedClauses);
+  d_registry->unregisterStat(&d_statVivifiedLiterals);
+  d_registry->unregisterStat(&d_statEliminatedVars);
+  d_registry->unregisterStat(&d_statRestoredVars);
+  d_registry->unregisterStat(&d_statReduceDbs);
+  d_registry->unregisterStat(&d_statTierPromotions);
+  d_registry->unregisterStat(&d_statTier2Demotions);
+  d_registry->unregisterStat(&d_statLearntsCore);
+  d_registry->unregisterStat(&d_statLearntsTier2);
+  d_registry->unregisterStat(&d_statLearntsLocal);
 }
 
 void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
@@ -279,6 +317,18 @@ void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
   d_statLearntsLiterals.setData(d_minisat->learnts_literals);
   d_statMaxLiterals.setData(d_minisat->max_literals);
   d_statTotLiterals.setData(d_minisat->tot_literals);
+  d_statInprocessRounds.setData(d_minisat->inprocess_rounds);
+  d_statSubsumedLearnts.setData(d_minisat->subsumed_learnts);
+  d_statVivifiedClauses.setData(d_minisat->vivified_clauses);
+  d_statVivifiedLiterals.setData(d_minisat->vivified_literals);
+  d_statEliminatedVars.setData(d_minisat->inproc_eliminated_vars);
+  d_statRestoredVars.setData(d_minisat->inproc_restored_vars);
+  d_statReduceDbs.setData(d_minisat->reduce_dbs);
+  d_statTierPromotions.setData(d_minisat->tier_promotions);
+  d_statTier2Demotions.setData(d_minisat->tier2_demotions);
+  d_statLearntsCore.setData(d_minisat->learnts_core);
+  d_statLearntsTier2.setData(d_minisat->learnts_tier2);
+  d_statLearntsLocal.setData(d_minisat->learnts_local);
 }
 
 } /* namespace CVC4::prop */
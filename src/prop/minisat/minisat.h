@@ -59,6 +59,8 @@ public:
 
   void interrupt() override;
 
+  void clearInterrupt() override;
+
   SatValue value(SatLiteral l) override;
 
   SatValue modelValue(SatLiteral l) override;
@@ -97,6 +99,12 @@ public:
     ReferenceStat<uint64_t> d_statConflicts, d_statClausesLiterals;
     ReferenceStat<uint64_t> d_statLearntsLiterals,  d_statMaxLiterals;
     ReferenceStat<uint64_t> d_statTotLiterals;
+    ReferenceStat<uint64_t> d_statInprocessRounds, d_statSubsumedLearnts;
+    ReferenceStat<uint64_t> d_statVivifiedClauses, d_statVivifiedLiterals;
+    ReferenceStat<uint64_t> d_statEliminatedVars, d_statRestoredVars;
+    ReferenceStat<uint64_t> d_statReduceDbs, d_statTierPromotions;
+    ReferenceStat<uint64_t> d_statTier2Demotions, d_statLearntsCore;
+    ReferenceStat<uint64_t> d_statLearntsTier2, d_statLearntsLocal;
   public:
     Statistics(StatisticsRegistry* registry);
     ~Statistics();
@@ -79,6 +79,7 @@ PropEngine::PropEngine(TheoryEngine* te,
       d_registrar(NULL),
       d_cnfStream(NULL),
       d_interrupted(false),
+      d_inSearch(false),
       d_resourceManager(rm),
       d_outMgr(outMgr)
 {
@@ -92,7 +93,7 @@ PropEngine::PropEngine(TheoryEngine* te,
 
   d_registrar = new theory::TheoryRegistrar(d_theoryEngine);
   d_cnfStream = new CVC4::prop::TseitinCnfStream(
-      d_satSolver, d_registrar, userContext, &d_outMgr, rm, true);
+      d_satSolver, d_registrar, userContext, &d_outMgr, rm, true, "prop");
 
   d_theoryProxy = new TheoryProxy(
       this, d_theoryEngine, d_decisionEngine.get(), d_context, d_cnfStream);
@@ -192,12 +193,29 @@ Result PropEngine::checkSat() {
     return Result(Result::SAT_UNKNOWN, Result::REQUIRES_FULL_CHECK);
   }
 
-  // Reset the interrupted flag
-  d_interrupted = false;
+  {
+    std::lock_guard<std::mutex> lock(d_interruptMutex);
+    if (d_interrupted)
+    {
+      // an interrupt that arrived before the search ends this check only
+      d_interrupted = false;
+      return Result(Result::SAT_UNKNOWN, Result::INTERRUPTED);
+    }
+    d_inSearch = true;
+  }
 
   // Check the problem
   SatValue result = d_satSolver->solve();
 
+  {
+    std::lock_guard<std::mutex> lock(d_interruptMutex);
+    d_inSearch = false;
+    // An interrupt that arrived too late to end the search must not end the
+    // search of the next check.
+    d_interrupted = false;
+    d_satSolver->clearInterrupt();
+  }
+
   if( result == SAT_VALUE_UNKNOWN ) {
 
     Result::UnknownExplanation why = Result::INTERRUPTED;
@@ -295,15 +313,26 @@ bool PropEngine::isRunning() const {
 }
 void PropEngine::interrupt()
 {
-  if(! d_inCheckSat) {
+  std::lock_guard<std::mutex> lock(d_interruptMutex);
+  d_interrupted = true;
+  if (!d_inSearch)
+  {
     return;
   }
 
-  d_interrupted = true;
   d_satSolver->interrupt();
   Debug("prop") << "interrupt()" << endl;
 }
 
+void PropEngine::resetInterrupt()
+{
+  std::lock_guard<std::mutex> lock(d_interruptMutex);
+  d_interrupted = false;
+  // the last search may have ended by an exception
+  d_inSearch = false;
+  d_satSolver->clearInterrupt();
+}
+
 void PropEngine::spendResource(ResourceManager::Resource r)
 {
   d_resourceManager->spendResource(r);
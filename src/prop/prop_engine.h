@@ -23,6 +23,8 @@
 
 #include <sys/time.h>
 
+#include <mutex>
+
 #include "base/modal_exception.h"
 #include "expr/node.h"
 #include "options/options.h"
@@ -195,12 +197,22 @@ class PropEngine
   bool isRunning() const;
 
   /**
-   * Interrupt a running solver (cause a timeout).
+   * Interrupt a running solver (cause a timeout). An interrupt that arrives
+   * before the search starts, e.g., while the assertions are preprocessed,
+   * ends the next search as soon as it starts. Each interrupt ends at most
+   * one search.
    *
    * Can potentially throw a ModalException.
    */
   void interrupt();
 
+  /**
+   * Forget an interrupt that has not ended a search yet. Must not be called
+   * while another thread may interrupt the current check, since that
+   * interrupt would be lost.
+   */
+  void resetInterrupt();
+
   /**
    * Informs the ResourceManager that a resource has been spent.  If out of
    * resources, can throw an UnsafeInterruptException exception.
@@ -252,8 +264,15 @@ class PropEngine
   /** The CNF converter in use */
   CnfStream* d_cnfStream;
 
-  /** Whether we were just interrupted (or not) */
+  /** Whether there is an interrupt that has not ended a search yet */
   bool d_interrupted;
+  /** Whether the SAT solver is searching, i.e., can be interrupted */
+  bool d_inSearch;
+  /**
+   * Protects d_interrupted, d_inSearch and the interruption of the SAT solver
+   * against the start and the end of the search in another thread.
+   */
+  std::mutex d_interruptMutex;
   /** Pointer to resource manager for associated SmtEngine */
   ResourceManager* d_resourceManager;
 
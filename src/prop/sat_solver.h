@@ -147,6 +147,12 @@ class DPLLSatSolverInterface : public SatSolver
   virtual void requirePhase(SatLiteral lit) = 0;
 
   virtual bool isDecision(SatVariable decn) const = 0;
+
+  /**
+   * Forget an interrupt that arrived too late to end the last search, such
+   * that it does not end the next one.
+   */
+  virtual void clearInterrupt() = 0;
 }; /* class DPLLSatSolverInterface */
 
 inline std::ostream& operator <<(std::ostream& out, prop::SatLiteral lit) {
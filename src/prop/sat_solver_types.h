@@ -193,6 +193,23 @@ struct SatClauseSetHashFunction
   }
 };
 
+/**
+ * Hashes a clause as a sequence of literals (i.e., the hash depends on the
+ * order of the literals).
+ */
+struct SatClauseHashFunction
+{
+  inline size_t operator()(const SatClause& clause) const
+  {
+    size_t acc = clause.size();
+    for (const SatLiteral& l : clause)
+    {
+      acc = acc * 31 + l.hash();
+    }
+    return acc;
+  }
+};
+
 struct SatClauseLessThan
 {
   bool operator()(const SatClause& l, const SatClause& r) const;
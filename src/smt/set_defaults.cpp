@@ -81,6 +81,17 @@ void setDefaults(LogicInfo& logic, bool isInternalSubsolver)
     Notice() << "SmtEngine: setting bitvectorAlgebraicSolver" << std::endl;
     options::bitvectorAlgebraicSolver.set(true);
   }
+  if (options::bitvectorPropagationBudget.wasSetByUser())
+  {
+    Notice() << "SmtEngine: setting bitvectorPropagationSolver" << std::endl;
+    options::bitvectorPropagationSolver.set(true);
+  }
+  if (options::bvSlsTimeLimit.wasSetByUser()
+      || options::bvSlsMoves.wasSetByUser())
+  {
+    Notice() << "SmtEngine: setting bvSls" << std::endl;
+    options::bvSls.set(true);
+  }
 
   // Language-based defaults
   if (!options::bitvectorDivByZeroConst.wasSetByUser())
@@ -122,6 +133,13 @@ void setDefaults(LogicInfo& logic, bool isInternalSubsolver)
           "Incremental eager bit-blasting is currently "
           "only supported for QF_BV. Try --bitblast=lazy.");
     }
+    if (options::incrementalSolving()
+        && options::bvSatSolver() == options::SatSolverMode::KISSAT)
+    {
+      throw OptionException(
+          "Incremental eager bit-blasting is not supported with Kissat. Try "
+          "--bv-sat-solver=cadical or --bv-sat-solver=minisat.");
+    }
   }
 
   if (options::solveIntAsBV() > 0)
@@ -802,6 +820,47 @@ void setDefaults(LogicInfo& logic, bool isInternalSubsolver)
     options::decisionMode.set(decMode);
     options::decisionStopOnly.set(stoponly);
   }
+  // The justification heuristic relies on the SAT values of the literals of
+  // Boolean gates, which are only equivalent to the gates if they are defined
+  // in both directions.
+  if (options::cnfPolarityAware()
+      && options::decisionMode() != options::DecisionMode::INTERNAL)
+  {
+    if (options::cnfPolarityAware.wasSetByUser()
+        && !options::decisionMode.wasSetByUser())
+    {
+      Notice() << "SmtEngine: setting decision mode to internal to support "
+                  "polarity-aware CNF conversion"
+               << std::endl;
+      options::decisionMode.set(options::DecisionMode::INTERNAL);
+    }
+    else
+    {
+      Notice() << "SmtEngine: turning off polarity-aware CNF conversion to "
+                  "support decision mode "
+               << options::decisionMode() << std::endl;
+      options::cnfPolarityAware.set(false);
+    }
+  }
+  // Inprocessing in Minisat does not log the clauses it derives in the
+  // resolution proof, and variable elimination removes the values of Boolean
+  // gates that the decision engine relies on.
+  if (options::satInprocess())
+  {
+    if (options::unsatCores())
+    {
+      throw OptionException(
+          "--sat-inprocess not supported with unsat cores/proofs");
+    }
+    if (options::satInprocessElim()
+        && options::decisionMode() != options::DecisionMode::INTERNAL)
+    {
+      Notice() << "SmtEngine: turning off variable elimination when "
+                  "inprocessing to support decision mode "
+               << options::decisionMode() << std::endl;
+      options::satInprocessElim.set(false);
+    }
+  }
   if (options::incrementalSolving())
   {
     // disable modes not supported by incremental
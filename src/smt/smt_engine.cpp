@@ -141,7 +141,7 @@ SmtEngine::SmtEngine(ExprManager* em, Options* optr)
       d_smtSolver(nullptr),
       d_proofManager(nullptr),
       d_pfManager(nullptr),
-      d_rewriter(new theory::Rewriter()),
+      d_rewriter(new theory::Rewriter(d_nodeManager)),
       d_definedFunctions(nullptr),
       d_sygusSolver(nullptr),
       d_abductSolver(nullptr),
@@ -267,6 +267,10 @@ void SmtEngine::finishInit()
   // based on our heuristics.
   d_optm->finishInit(d_logic, d_isInternalSubsolver);
 
+  // bound the rewrite caches and load the persistent rewrite cache according
+  // to the options
+  d_rewriter->finishInit(d_logic, d_isInternalSubsolver);
+
   ProofNodeManager* pnm = nullptr;
   if (options::proofNew())
   {
@@ -384,8 +388,10 @@ SmtEngine::~SmtEngine()
     d_routListener.reset(nullptr);
     d_optm.reset(nullptr);
     d_pp.reset(nullptr);
-    // d_resourceManager must be destroyed before d_statisticsRegistry
+    // d_resourceManager and d_rewriter must be destroyed before
+    // d_statisticsRegistry
     d_resourceManager.reset(nullptr);
+    d_rewriter.reset(nullptr);
     d_statisticsRegistry.reset(nullptr);
     // destroy the state
     d_state.reset(nullptr);
@@ -1042,6 +1048,8 @@ Result SmtEngine::checkSatInternal(const vector<Node>& assumptions,
     return r;
   } catch (UnsafeInterruptException& e) {
     AlwaysAssert(d_resourceManager->out());
+    // the interrupt of the resource manager must not end the next query
+    d_smtSolver->resetInterrupt();
     // Notice that we do not notify the state of this result. If we wanted to
     // make the solver resume a working state after an interupt, then we would
     // implement a different callback and use it here, e.g.
@@ -2045,6 +2053,15 @@ void SmtEngine::interrupt()
   d_smtSolver->interrupt();
 }
 
+void SmtEngine::resetInterrupt()
+{
+  if (!d_state->isFullyInited())
+  {
+    return;
+  }
+  d_smtSolver->resetInterrupt();
+}
+
 void SmtEngine::setResourceLimit(unsigned long units, bool cumulative) {
   d_resourceManager->setResourceLimit(units, cumulative);
 }
@@ -738,6 +738,14 @@ class CVC4_PUBLIC SmtEngine
    */
   void interrupt();
 
+  /**
+   * Forget an interrupt that has not ended a query yet, e.g., one that
+   * arrived after the last query was answered. An interrupt ends at most one
+   * query, but is kept until a query starts. This must not be called while
+   * another thread may interrupt the next query.
+   */
+  void resetInterrupt();
+
   /**
    * Set a resource limit for SmtEngine operations.  This is like a time
    * limit, but it's deterministic so that reproducible results can be
@@ -110,6 +110,14 @@ void SmtSolver::interrupt()
   }
 }
 
+void SmtSolver::resetInterrupt()
+{
+  if (d_propEngine != nullptr)
+  {
+    d_propEngine->resetInterrupt();
+  }
+}
+
 void SmtSolver::shutdown()
 {
   if (d_propEngine != nullptr)
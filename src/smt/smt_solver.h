@@ -76,6 +76,11 @@ class SmtSolver
    * isn't currently in a query.
    */
   void interrupt();
+  /**
+   * Forget an interrupt that has not ended a query yet. Must not be called
+   * while another thread may interrupt the query.
+   */
+  void resetInterrupt();
   /**
    * This is called by the destructor of SmtEngine, just before destroying the
    * PropEngine, TheoryEngine, and DecisionEngine (in that order).  It
@@ -69,16 +69,16 @@ ConstraintType Constraint::constraintTypeOfComparison(const Comparison& cmp){
 Constraint::Constraint(ArithVar x,  ConstraintType t, const DeltaRational& v)
   : d_variable(x),
     d_type(t),
+    d_canBePropagated(false),
+    d_split(false),
     d_value(v),
     d_database(NULL),
     d_literal(Node::null()),
     d_negation(NullConstraint),
-    d_canBePropagated(false),
     d_assertionOrder(AssertionOrderSentinel),
     d_witness(TNode::null()),
     d_crid(ConstraintRuleIdSentinel),
-    d_split(false),
-    d_variablePosition()
+    d_valueCollection(NULL)
 {
   Assert(!initialized());
 }
@@ -385,10 +385,10 @@ const ConstraintDatabase& Constraint::getDatabase() const{
   return *d_database;
 }
 
-void Constraint::initialize(ConstraintDatabase* db, SortedConstraintMapIterator v, ConstraintP negation){
+void Constraint::initialize(ConstraintDatabase* db, ValueCollection* vc, ConstraintP negation){
   Assert(!initialized());
   d_database = db;
-  d_variablePosition = v;
+  d_valueCollection = vc;
   d_negation = negation;
 }
 
@@ -397,16 +397,7 @@ Constraint::~Constraint() {
   Assert(!contextDependentDataIsSet());
 
   if(initialized()){
-    ValueCollection& vc =  d_variablePosition->second;
-    Debug("arith::constraint") << "removing" << vc << endl;
-
-    vc.remove(getType());
-
-    if(vc.empty()){
-      Debug("arith::constraint") << "erasing" << vc << endl;
-      SortedConstraintMap& perVariable = d_database->getVariableSCM(getVariable());
-      perVariable.erase(d_variablePosition);
-    }
+    d_database->removeFromValueCollection(this);
 
     if(hasLiteral()){
       d_database->d_nodetoConstraintMap.erase(getLiteral());
@@ -420,7 +411,51 @@ const ConstraintRule& Constraint::getConstraintRule() const {
 }
 
 const ValueCollection& Constraint::getValueCollection() const{
-  return d_variablePosition->second;
+  return *d_valueCollection;
+}
+
+SortedConstraintMapConstIterator SortedConstraintMap::lower_bound(
+    const DeltaRational& r) const
+{
+  return std::lower_bound(
+      d_values.begin(),
+      d_values.end(),
+      r,
+      [](const ValueCollection* vc, const DeltaRational& value) {
+        return vc->getValue() < value;
+      });
+}
+
+SortedConstraintMapConstIterator SortedConstraintMap::find(
+    const ValueCollection* vc) const
+{
+  const_iterator i = lower_bound(vc->getValue());
+  Assert(i != end() && *i == vc);
+  return i;
+}
+
+ValueCollection* SortedConstraintMap::lookup(const DeltaRational& r) const
+{
+  const_iterator i = lower_bound(r);
+  if (i != end() && (*i)->getValue() == r)
+  {
+    return *i;
+  }
+  return NULL;
+}
+
+void SortedConstraintMap::insert(ValueCollection* vc)
+{
+  Assert(!vc->empty());
+  const_iterator i = lower_bound(vc->getValue());
+  Assert(i == end() || (*i)->getValue() != vc->getValue());
+  d_values.insert(d_values.begin() + (i - d_values.begin()), vc);
+}
+
+void SortedConstraintMap::erase(const ValueCollection* vc)
+{
+  const_iterator i = find(vc);
+  d_values.erase(d_values.begin() + (i - d_values.begin()));
 }
 
 
@@ -805,7 +840,7 @@ bool Constraint::wellFormedFarkasProof() const {
          && rhs.sgn() < 0;
 }
 
-ConstraintP Constraint::makeNegation(ArithVar v, ConstraintType t, const DeltaRational& r){
+ConstraintP ConstraintDatabase::makeNegation(ArithVar v, ConstraintType t, const DeltaRational& r){
   switch(t){
   case LowerBound:
     {
@@ -814,12 +849,12 @@ ConstraintP Constraint::makeNegation(ArithVar v, ConstraintType t, const DeltaRa
         Assert(r.getInfinitesimalPart() == 1);
         // make (not (v > r)), which is (v <= r)
         DeltaRational dropInf(r.getNoninfinitesimalPart(), 0);
-        return new Constraint(v, UpperBound, dropInf);
+        return makeConstraint(v, UpperBound, dropInf);
       }else{
         Assert(r.infinitesimalSgn() == 0);
         // make (not (v >= r)), which is (v < r)
         DeltaRational addInf(r.getNoninfinitesimalPart(), -1);
-        return new Constraint(v, UpperBound, addInf);
+        return makeConstraint(v, UpperBound, addInf);
       }
     }
   case UpperBound:
@@ -829,18 +864,18 @@ ConstraintP Constraint::makeNegation(ArithVar v, ConstraintType t, const DeltaRa
         Assert(r.getInfinitesimalPart() == -1);
         // make (not (v < r)), which is (v >= r)
         DeltaRational dropInf(r.getNoninfinitesimalPart(), 0);
-        return new Constraint(v, LowerBound, dropInf);
+        return makeConstraint(v, LowerBound, dropInf);
       }else{
         Assert(r.infinitesimalSgn() == 0);
         // make (not (v <= r)), which is (v > r)
         DeltaRational addInf(r.getNoninfinitesimalPart(), 1);
-        return new Constraint(v, LowerBound, addInf);
+        return makeConstraint(v, LowerBound, addInf);
       }
     }
   case Equality:
-    return new Constraint(v, Disequality, r);
+    return makeConstraint(v, Disequality, r);
   case Disequality:
-    return new Constraint(v, Equality, r);
+    return makeConstraint(v, Equality, r);
   default:
     Unreachable();
     return NullConstraint;
@@ -849,6 +884,7 @@ ConstraintP Constraint::makeNegation(ArithVar v, ConstraintType t, const DeltaRa
 
 ConstraintDatabase::ConstraintDatabase(context::Context* satContext, context::Context* userContext, const ArithVariables& avars, ArithCongruenceManager& cm, RaiseConflict raiseConflict)
   : d_varDatabases()
+  , d_sortedBytes(0)
   , d_toPropagate(satContext)
   , d_antecedents(satContext, false)
   , d_watches(new Watches(satContext, userContext))
@@ -866,6 +902,74 @@ SortedConstraintMap& ConstraintDatabase::getVariableSCM(ArithVar v) const{
   return d_varDatabases[v]->d_constraints;
 }
 
+ConstraintP ConstraintDatabase::makeConstraint(ArithVar v,
+                                               ConstraintType t,
+                                               const DeltaRational& r)
+{
+  ConstraintP c = d_constraintArena.make(v, t, r);
+  updateMemoryStatistics();
+  return c;
+}
+
+void ConstraintDatabase::destroyConstraint(ConstraintP c)
+{
+  d_constraintArena.destroy(c);
+  updateMemoryStatistics();
+}
+
+ValueCollection* ConstraintDatabase::addToValueCollection(ConstraintP c)
+{
+  SortedConstraintMap& scm = getVariableSCM(c->getVariable());
+  ValueCollection* vc = scm.lookup(c->getValue());
+  if (vc == NULL)
+  {
+    vc = d_valueCollectionArena.make();
+    vc->add(c);
+    size_t bytes = scm.getBytes();
+    scm.insert(vc);
+    d_sortedBytes += scm.getBytes() - bytes;
+    updateMemoryStatistics();
+  }
+  else
+  {
+    vc->add(c);
+  }
+  return vc;
+}
+
+void ConstraintDatabase::removeFromValueCollection(ConstraintP c)
+{
+  ValueCollection* vc = c->d_valueCollection;
+  Debug("arith::constraint") << "removing" << *vc << endl;
+
+  // The map is searched by the values of its ValueCollections, so vc is
+  // erased while it still has a value.
+  ValueCollection rest = *vc;
+  rest.remove(c->getType());
+  if (rest.empty())
+  {
+    Debug("arith::constraint") << "erasing" << *vc << endl;
+    getVariableSCM(c->getVariable()).erase(vc);
+    d_valueCollectionArena.destroy(vc);
+    updateMemoryStatistics();
+  }
+  else
+  {
+    vc->remove(c->getType());
+  }
+}
+
+void ConstraintDatabase::updateMemoryStatistics()
+{
+  size_t constraints = d_constraintArena.getLive();
+  size_t bytes = d_constraintArena.getBytes()
+                 + d_valueCollectionArena.getBytes() + d_sortedBytes;
+  d_statistics.d_constraints.setData(constraints);
+  d_statistics.d_bytes.setData(bytes);
+  d_statistics.d_bytesPerConstraint.setData(
+      constraints == 0 ? 0 : static_cast<double>(bytes) / constraints);
+}
+
 void ConstraintDatabase::pushSplitWatch(ConstraintP c){
   Assert(!c->d_split);
   c->d_split = true;
@@ -899,35 +1003,20 @@ ConstraintP ConstraintDatabase::getConstraint(ArithVar v, ConstraintType t, cons
   //This must always return a constraint.
 
   SortedConstraintMap& scm = getVariableSCM(v);
-  pair<SortedConstraintMapIterator, bool> insertAttempt;
-  insertAttempt = scm.insert(make_pair(r, ValueCollection()));
-
-  SortedConstraintMapIterator pos = insertAttempt.first;
-  ValueCollection& vc = pos->second;
-  if(vc.hasConstraintOfType(t)){
-    return vc.getConstraintOfType(t);
+  ValueCollection* vc = scm.lookup(r);
+  if(vc != NULL && vc->hasConstraintOfType(t)){
+    return vc->getConstraintOfType(t);
   }else{
-    ConstraintP c = new Constraint(v, t, r);
-    ConstraintP negC = Constraint::makeNegation(v, t, r);
+    ConstraintP c = makeConstraint(v, t, r);
+    ConstraintP negC = makeNegation(v, t, r);
 
-    SortedConstraintMapIterator negPos;
-    if(t == Equality || t == Disequality){
-      negPos = pos;
-    }else{
-      pair<SortedConstraintMapIterator, bool> negInsertAttempt;
-      negInsertAttempt = scm.insert(make_pair(negC->getValue(), ValueCollection()));
-      Assert(negInsertAttempt.second
-             || !negInsertAttempt.first->second.hasConstraintOfType(
-                 negC->getType()));
-      negPos = negInsertAttempt.first;
-    }
+    ValueCollection* pos = addToValueCollection(c);
+    ValueCollection* negPos = addToValueCollection(negC);
+    Assert(t == LowerBound || t == UpperBound || pos == negPos);
 
     c->initialize(this, pos, negC);
     negC->initialize(this, negPos, c);
 
-    vc.add(c);
-    negPos->second.add(negC);
-
     return c;
   }
 }
@@ -955,14 +1044,14 @@ ConstraintDatabase::~ConstraintDatabase(){
     PerVariableDatabase* back = d_varDatabases.back();
 
     SortedConstraintMap& scm = back->d_constraints;
-    SortedConstraintMapIterator i = scm.begin(), i_end = scm.end();
+    SortedConstraintMapConstIterator i = scm.begin(), i_end = scm.end();
     for(; i != i_end; ++i){
-      (i->second).push_into(constraintList);
+      (*i)->push_into(constraintList);
     }
     while(!constraintList.empty()){
       ConstraintP c = constraintList.back();
       constraintList.pop_back();
-      delete c;
+      destroyConstraint(c);
     }
     Assert(scm.empty());
     d_varDatabases.pop_back();
@@ -974,24 +1063,33 @@ ConstraintDatabase::~ConstraintDatabase(){
 
 ConstraintDatabase::Statistics::Statistics():
   d_unatePropagateCalls("theory::arith::cd::unatePropagateCalls", 0),
-  d_unatePropagateImplications("theory::arith::cd::unatePropagateImplications", 0)
+  d_unatePropagateImplications("theory::arith::cd::unatePropagateImplications", 0),
+  d_constraints("theory::arith::cd::constraints", 0),
+  d_bytes("theory::arith::cd::bytes", 0),
+  d_bytesPerConstraint("theory::arith::cd::bytesPerConstraint", 0)
 {
   smtStatisticsRegistry()->registerStat(&d_unatePropagateCalls);
   smtStatisticsRegistry()->registerStat(&d_unatePropagateImplications);
+  smtStatisticsRegistry()->registerStat(&d_constraints);
+  smtStatisticsRegistry()->registerStat(&d_bytes);
+  smtStatisticsRegistry()->registerStat(&d_bytesPerConstraint);
 
 }
 
 ConstraintDatabase::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_unatePropagateCalls);
   smtStatisticsRegistry()->unregisterStat(&d_unatePropagateImplications);
+  smtStatisticsRegistry()->unregisterStat(&d_constraints);
+  smtStatisticsRegistry()->unregisterStat(&d_bytes);
+  smtStatisticsRegistry()->unregisterStat(&d_bytesPerConstraint);
 }
 
 void ConstraintDatabase::deleteConstraintAndNegation(ConstraintP c){
   Assert(c->safeToGarbageCollect());
   ConstraintP neg = c->getNegation();
   Assert(neg->safeToGarbageCollect());
-  delete c;
-  delete neg;
+  destroyConstraint(c);
+  destroyConstraint(neg);
 }
 
 void ConstraintDatabase::addVariable(ArithVar v){
@@ -1000,14 +1098,14 @@ void ConstraintDatabase::addVariable(ArithVar v){
 
     std::vector<ConstraintP> constraintList;
 
-    for(SortedConstraintMapIterator i = scm.begin(), end = scm.end(); i != end; ++i){
-      (i->second).push_into(constraintList);
+    for(SortedConstraintMapConstIterator i = scm.begin(), end = scm.end(); i != end; ++i){
+      (*i)->push_into(constraintList);
     }
     while(!constraintList.empty()){
       ConstraintP c = constraintList.back();
       constraintList.pop_back();
       Assert(c->safeToGarbageCollect());
-      delete c;
+      destroyConstraint(c);
     }
     Assert(scm.empty());
 
@@ -1080,27 +1178,22 @@ ConstraintP ConstraintDatabase::addLiteral(TNode literal){
 
   DeltaRational posDR = posCmp.normalizedDeltaRational();
 
-  ConstraintP posC = new Constraint(v, posType, posDR);
+  ConstraintP posC = makeConstraint(v, posType, posDR);
 
   Debug("arith::constraint") << "addliteral( literal ->" << literal << ")" << endl;
   Debug("arith::constraint") << "addliteral( posC ->" << posC << ")" << endl;
 
   SortedConstraintMap& scm = getVariableSCM(posC->getVariable());
-  pair<SortedConstraintMapIterator, bool> insertAttempt;
-  insertAttempt = scm.insert(make_pair(posC->getValue(), ValueCollection()));
+  ValueCollection* posVC = scm.lookup(posC->getValue());
 
-  SortedConstraintMapIterator posI = insertAttempt.first;
-  // If the attempt succeeds, i points to a new empty ValueCollection
-  // If the attempt fails, i points to a pre-existing ValueCollection
-
-  if(posI->second.hasConstraintOfType(posC->getType())){
+  if(posVC != NULL && posVC->hasConstraintOfType(posC->getType())){
     //This is the situation where the ConstraintP exists, but
     //the literal has not been  associated with it.
-    ConstraintP hit = posI->second.getConstraintOfType(posC->getType());
+    ConstraintP hit = posVC->getConstraintOfType(posC->getType());
     Debug("arith::constraint") << "hit " << hit << endl;
     Debug("arith::constraint") << "posC " << posC << endl;
 
-    delete posC;
+    destroyConstraint(posC);
 
     hit->setLiteral(atomNode);
     hit->getNegation()->setLiteral(negationNode);
@@ -1111,33 +1204,16 @@ ConstraintP ConstraintDatabase::addLiteral(TNode literal){
     ConstraintType negType = Constraint::constraintTypeOfComparison(negCmp);
     DeltaRational negDR = negCmp.normalizedDeltaRational();
 
-    ConstraintP negC = new Constraint(v, negType, negDR);
-
-    SortedConstraintMapIterator negI;
+    ConstraintP negC = makeConstraint(v, negType, negDR);
 
-    if(posC->isEquality()){
-      negI = posI;
-    }else{
-      Assert(posC->isLowerBound() || posC->isUpperBound());
-
-      pair<SortedConstraintMapIterator, bool> negInsertAttempt;
-      negInsertAttempt = scm.insert(make_pair(negC->getValue(), ValueCollection()));
-
-      Debug("nf::tmp") << "sdhjfgdhjkldfgljkhdfg" << endl;
-      Debug("nf::tmp") << negC << endl;
-      Debug("nf::tmp") << negC->getValue() << endl;
-
-      //This should always succeed as the DeltaRational for the negation is unique!
-      Assert(negInsertAttempt.second);
+    //This should always hold as the DeltaRational for the negation is unique!
+    Assert(posC->isEquality() || scm.lookup(negC->getValue()) == NULL);
 
-      negI = negInsertAttempt.first;
-    }
-
-    (posI->second).add(posC);
-    (negI->second).add(negC);
+    posVC = addToValueCollection(posC);
+    ValueCollection* negVC = addToValueCollection(negC);
 
-    posC->initialize(this, posI, negC);
-    negC->initialize(this, negI, posC);
+    posC->initialize(this, posVC, negC);
+    negC->initialize(this, negVC, posC);
 
     posC->setLiteral(atomNode);
     negC->setLiteral(negationNode);
@@ -1420,6 +1496,10 @@ void Constraint::setEqualityEngineProof(){
 }
 
 
+SortedConstraintMapConstIterator Constraint::getPosition() const{
+  return constraintSet().find(d_valueCollection);
+}
+
 SortedConstraintMap& Constraint::constraintSet() const{
   Assert(d_database->variableDatabaseIsSetup(d_variable));
   return (d_database->d_varDatabases[d_variable])->d_constraints;
@@ -1597,12 +1677,12 @@ ConstraintP Constraint::getStrictlyWeakerLowerBound(bool hasLiteral, bool assert
   Assert(initialized());
   Assert(!asserted || hasLiteral);
 
-  SortedConstraintMapConstIterator i = d_variablePosition;
+  SortedConstraintMapConstIterator i = getPosition();
   const SortedConstraintMap& scm = constraintSet();
   SortedConstraintMapConstIterator i_begin = scm.begin();
   while(i != i_begin){
     --i;
-    const ValueCollection& vc = i->second;
+    const ValueCollection& vc = **i;
     if(vc.hasLowerBound()){
       ConstraintP weaker = vc.getLowerBound();
 
@@ -1619,13 +1699,13 @@ ConstraintP Constraint::getStrictlyWeakerLowerBound(bool hasLiteral, bool assert
 }
 
 ConstraintP Constraint::getStrictlyWeakerUpperBound(bool hasLiteral, bool asserted) const {
-  SortedConstraintMapConstIterator i = d_variablePosition;
+  SortedConstraintMapConstIterator i = getPosition();
   const SortedConstraintMap& scm = constraintSet();
   SortedConstraintMapConstIterator i_end = scm.end();
 
   ++i;
   for(; i != i_end; ++i){
-    const ValueCollection& vc = i->second;
+    const ValueCollection& vc = **i;
     if(vc.hasUpperBound()){
       ConstraintP weaker = vc.getUpperBound();
       if((!hasLiteral || (weaker->hasLiteral())) &&
@@ -1646,10 +1726,10 @@ ConstraintP ConstraintDatabase::getBestImpliedBound(ArithVar v, ConstraintType t
   if(t == UpperBound){
     SortedConstraintMapConstIterator i = scm.lower_bound(r);
     SortedConstraintMapConstIterator i_end = scm.end();
-    Assert(i == i_end || r <= i->first);
+    Assert(i == i_end || r <= (*i)->getValue());
     for(; i != i_end; i++){
-      Assert(r <= i->first);
-      const ValueCollection& vc = i->second;
+      Assert(r <= (*i)->getValue());
+      const ValueCollection& vc = **i;
       if(vc.hasUpperBound()){
         return vc.getUpperBound();
       }
@@ -1663,26 +1743,26 @@ ConstraintP ConstraintDatabase::getBestImpliedBound(ArithVar v, ConstraintType t
       SortedConstraintMapConstIterator i = scm.lower_bound(r);
       SortedConstraintMapConstIterator i_begin = scm.begin();
       SortedConstraintMapConstIterator i_end = scm.end();
-      Assert(i == i_end || r <= i->first);
+      Assert(i == i_end || r <= (*i)->getValue());
 
       int fdj = 0;
 
       if(i == i_end){
         --i;
-        Debug("getBestImpliedBound") << fdj++ << " " << r << " " << i->first << endl;
-      }else if( (i->first) > r){
+        Debug("getBestImpliedBound") << fdj++ << " " << r << " " << (*i)->getValue() << endl;
+      }else if( (*i)->getValue() > r){
         if(i == i_begin){
           return NullConstraint;
         }else{
           --i;
-          Debug("getBestImpliedBound") << fdj++ << " " << r << " " << i->first << endl;
+          Debug("getBestImpliedBound") << fdj++ << " " << r << " " << (*i)->getValue() << endl;
         }
       }
 
       do{
-        Debug("getBestImpliedBound") << fdj++ << " " << r << " " << i->first << endl;
-        Assert(r >= i->first);
-        const ValueCollection& vc = i->second;
+        Debug("getBestImpliedBound") << fdj++ << " " << r << " " << (*i)->getValue() << endl;
+        Assert(r >= (*i)->getValue());
+        const ValueCollection& vc = **i;
 
         if(vc.hasLowerBound()){
           return vc.getLowerBound();
@@ -1761,7 +1841,7 @@ void ConstraintDatabase::outputUnateInequalityLemmas(std::vector<Node>& out, Ari
   //get transitive unates
   //Only lower bounds or upperbounds should be done.
   for(; scm_iter != scm_end; ++scm_iter){
-    const ValueCollection& vc = scm_iter->second;
+    const ValueCollection& vc = **scm_iter;
     if(vc.hasUpperBound()){
       ConstraintP ub = vc.getUpperBound();
       if(ub->hasLiteral()){
@@ -1783,7 +1863,7 @@ void ConstraintDatabase::outputUnateEqualityLemmas(std::vector<Node>& out, Arith
   SortedConstraintMapConstIterator scm_end = scm.end();
 
   for(; scm_iter != scm_end; ++scm_iter){
-    const ValueCollection& vc = scm_iter->second;
+    const ValueCollection& vc = **scm_iter;
     if(vc.hasEquality()){
       ConstraintP eq = vc.getEquality();
       if(eq->hasLiteral()){
@@ -1867,7 +1947,7 @@ void ConstraintDatabase::unatePropLowerBound(ConstraintP curr, ConstraintP prev)
 
   const SortedConstraintMap& scm = curr->constraintSet();
   const SortedConstraintMapConstIterator scm_begin = scm.begin();
-  SortedConstraintMapConstIterator scm_i = curr->d_variablePosition;
+  SortedConstraintMapConstIterator scm_i = curr->getPosition();
 
   //Ignore the first ValueCollection
   // NOPE: (>= p c) then (= p c) NOPE
@@ -1876,7 +1956,7 @@ void ConstraintDatabase::unatePropLowerBound(ConstraintP curr, ConstraintP prev)
   while(scm_i != scm_begin){
     --scm_i; // move the iterator back
 
-    const ValueCollection& vc = scm_i->second;
+    const ValueCollection& vc = **scm_i;
 
     //If it has the previous element, do nothing and stop!
     if(hasPrev &&
@@ -1909,10 +1989,10 @@ void ConstraintDatabase::unatePropUpperBound(ConstraintP curr, ConstraintP prev)
 
   const SortedConstraintMap& scm = curr->constraintSet();
   const SortedConstraintMapConstIterator scm_end = scm.end();
-  SortedConstraintMapConstIterator scm_i = curr->d_variablePosition;
+  SortedConstraintMapConstIterator scm_i = curr->getPosition();
   ++scm_i;
   for(; scm_i != scm_end; ++scm_i){
-    const ValueCollection& vc = scm_i->second;
+    const ValueCollection& vc = **scm_i;
 
     //If it has the previous element, do nothing and stop!
     if(hasPrev &&
@@ -1946,11 +2026,11 @@ void ConstraintDatabase::unatePropEquality(ConstraintP curr, ConstraintP prevLB,
   ++d_statistics.d_unatePropagateCalls;
 
   const SortedConstraintMap& scm = curr->constraintSet();
-  SortedConstraintMapConstIterator scm_curr = curr->d_variablePosition;
-  SortedConstraintMapConstIterator scm_last = hasPrevUB ? prevUB->d_variablePosition : scm.end();
+  SortedConstraintMapConstIterator scm_curr = curr->getPosition();
+  SortedConstraintMapConstIterator scm_last = hasPrevUB ? prevUB->getPosition() : scm.end();
   SortedConstraintMapConstIterator scm_i;
   if(hasPrevLB){
-    scm_i = prevLB->d_variablePosition;
+    scm_i = prevLB->getPosition();
     if(scm_i != scm_curr){ // If this does not move this past scm_curr, move it one forward
       ++scm_i;
     }
@@ -1960,7 +2040,7 @@ void ConstraintDatabase::unatePropEquality(ConstraintP curr, ConstraintP prevLB,
 
   for(; scm_i != scm_curr; ++scm_i){
     // between the previous LB and the curr
-    const ValueCollection& vc = scm_i->second;
+    const ValueCollection& vc = **scm_i;
 
     //Don't worry about implying the negation of upperbound.
     //These should all be handled by propagating the LowerBounds!
@@ -1980,7 +2060,7 @@ void ConstraintDatabase::unatePropEquality(ConstraintP curr, ConstraintP prevLB,
 
   for(; scm_i != scm_last; ++scm_i){
     // between the curr and the previous UB imply the upperbounds and disequalities.
-    const ValueCollection& vc = scm_i->second;
+    const ValueCollection& vc = **scm_i;
 
     //Don't worry about implying the negation of upperbound.
     //These should all be handled by propagating the UpperBounds!
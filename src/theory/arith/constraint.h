@@ -27,8 +27,8 @@
  **
  ** In addition, Constraints keep track of the following:
  **  - A Constraint that is the negation of the Constraint.
- **  - An iterator into a set of Constraints for the ArithVar sorted by
- **    DeltaRational value.
+ **  - A pointer to the ValueCollection of the Constraint in the set of
+ **    Constraints for the ArithVar sorted by DeltaRational value.
  **  - A context dependent internal proof of the node that can be used for
  **    explanations.
  **  - Whether an equality/disequality has been split in the user context via a
@@ -46,18 +46,20 @@
  **  - A unate implication is an implication based purely on the ArithVar matching
  **    and the DeltaRational value.
  **    (implies (<= x c) (<= x d)) given c <= d
- **  - This is done using the iterator into the sorted set of constraints.
+ **  - This is done by a binary search in the sorted set of constraints.
  **  - Given a tight constraint and previous tightest constraint, this will
  **    efficiently propagate internally.
  **
  ** Additing and Removing Constraints
- **  - Adding Constraints takes O(log n) time where n is the number of
- **    constraints associated with the ArithVar.
- **  - Removing Constraints takes O(1) time.
+ **  - Adding and removing Constraints takes O(log n) comparisons where n is
+ **    the number of constraints associated with the ArithVar, and moves
+ **    O(n) pointers in the sorted array of the ArithVar.
  **
  ** Internals:
  **  - Constraints are pointers to ConstraintValues.
  **  - Undefined Constraints are NullConstraint.
+ **  - Constraints and ValueCollections are allocated in arenas owned by the
+ **    ConstraintDatabase.
 
  **
  ** Assumption vs. Assertion:
@@ -88,6 +90,7 @@
 #include "theory/arith/arithvar.h"
 #include "theory/arith/callbacks.h"
 #include "theory/arith/congruence_manager.h"
+#include "theory/arith/constraint_arena.h"
 #include "theory/arith/constraint_forward.h"
 #include "theory/arith/delta_rational.h"
 #include "theory/arith/proof_macros.h"
@@ -217,19 +220,52 @@ public:
 };
 
 /**
- * A Map of ValueCollections sorted by the associated DeltaRational values.
+ * The non-empty ValueCollections of a variable sorted by their DeltaRational
+ * values.
  *
- * Discussion:
- * While it is more natural to consider this a set, this cannot be a set as in
- * sets the type of both iterator and const_iterator in sets are
- * "constant iterators".  We require iterators that dereference to
- * ValueCollection&.
- *
- * See:
- * http://gcc.gnu.org/onlinedocs/libstdc++/ext/lwg-defects.html#103
+ * This is a flat array of pointers that is searched by bisection. The
+ * ValueCollections themselves are allocated by the ConstraintDatabase and do
+ * not move when the array changes, so Constraints keep pointers to them.
+ * Iterators are invalidated by insert() and erase().
  */
-typedef std::map<DeltaRational, ValueCollection> SortedConstraintMap;
-typedef SortedConstraintMap::iterator SortedConstraintMapIterator;
+class SortedConstraintMap
+{
+ public:
+  typedef std::vector<ValueCollection*>::const_iterator const_iterator;
+
+  bool empty() const { return d_values.empty(); }
+  size_t size() const { return d_values.size(); }
+  /** Returns the number of bytes reserved by the array. */
+  size_t getBytes() const
+  {
+    return d_values.capacity() * sizeof(ValueCollection*);
+  }
+
+  const_iterator begin() const { return d_values.begin(); }
+  const_iterator end() const { return d_values.end(); }
+
+  /** Returns the first ValueCollection whose value is >= r, or end(). */
+  const_iterator lower_bound(const DeltaRational& r) const;
+
+  /** Returns the position of vc, which must be in the map. */
+  const_iterator find(const ValueCollection* vc) const;
+
+  /** Returns the ValueCollection with the value r, or nullptr. */
+  ValueCollection* lookup(const DeltaRational& r) const;
+
+  /**
+   * Inserts vc, which must be non-empty. There must be no ValueCollection
+   * with the value of vc in the map.
+   */
+  void insert(ValueCollection* vc);
+
+  /** Removes vc, which must be non-empty and in the map. */
+  void erase(const ValueCollection* vc);
+
+ private:
+  std::vector<ValueCollection*> d_values;
+}; /* class SortedConstraintMap */
+
 typedef SortedConstraintMap::const_iterator SortedConstraintMapConstIterator;
 
 /** A Pair associating a variables and a Sorted ConstraintSet. */
@@ -642,8 +678,6 @@ class Constraint {
    */
   ConstraintP getFloor();
 
-  static ConstraintP makeNegation(ArithVar v, ConstraintType t, const DeltaRational& r);
-
   const ValueCollection& getValueCollection() const;
 
 
@@ -767,7 +801,7 @@ class Constraint {
    * circular dependencies.
    */
   void initialize(ConstraintDatabase* db,
-                  SortedConstraintMapIterator v,
+                  ValueCollection* vc,
                   ConstraintP negation);
 
   class ConstraintRuleCleanup
@@ -843,6 +877,9 @@ class Constraint {
   /** Returns a reference to the map for d_variable. */
   SortedConstraintMap& constraintSet() const;
 
+  /** Returns the position of the ValueCollection in constraintSet(). */
+  SortedConstraintMapConstIterator getPosition() const;
+
   /** Returns coefficients for the proofs for farkas cancellation. */
   static std::pair<int, int> unateFarkasSigns(ConstraintCP a, ConstraintCP b);
 
@@ -901,6 +938,25 @@ class Constraint {
   /** The type of the Constraint. */
   const ConstraintType d_type;
 
+  /**
+   * This is true if the associated node can be propagated.
+   *
+   * This should be enabled if the node has been preregistered.
+   *
+   * Sat Context Dependent.
+   * This is initially false.
+   */
+  bool d_canBePropagated;
+
+  /**
+   * True if the equality has been split.
+   * Only meaningful if ConstraintType == Equality.
+   *
+   * User Context Dependent.
+   * This is initially false.
+   */
+  bool d_split;
+
   /** The DeltaRational value with the constraint. */
   const DeltaRational d_value;
 
@@ -921,16 +977,6 @@ class Constraint {
   /** Pointer to the negation of the Constraint. */
   ConstraintP d_negation;
 
-  /**
-   * This is true if the associated node can be propagated.
-   *
-   * This should be enabled if the node has been preregistered.
-   *
-   * Sat Context Dependent.
-   * This is initially false.
-   */
-  bool d_canBePropagated;
-
   /**
    * This is the order the constraint was asserted to the theory.
    * If this has been set, the node can be used in conflicts.
@@ -958,20 +1004,8 @@ class Constraint {
    */
   ConstraintRuleID d_crid;
 
-  /**
-   * True if the equality has been split.
-   * Only meaningful if ConstraintType == Equality.
-   *
-   * User Context Dependent.
-   * This is initially false.
-   */
-  bool d_split;
-
-  /**
-   * Position in sorted constraint set for the variable.
-   * Unset if d_type is Disequality.
-   */
-  SortedConstraintMapIterator d_variablePosition;
+  /** The ValueCollection of the Constraint in the map for d_variable. */
+  ValueCollection* d_valueCollection;
 
 }; /* class ConstraintValue */
 
@@ -995,6 +1029,38 @@ private:
 
   SortedConstraintMap& getVariableSCM(ArithVar v) const;
 
+  /** The memory of the Constraints and of the ValueCollections. */
+  ConstraintArena<Constraint> d_constraintArena;
+  ConstraintArena<ValueCollection> d_valueCollectionArena;
+  /** The bytes reserved by the sorted arrays of the variables. */
+  size_t d_sortedBytes;
+
+  /** Makes an uninitialized Constraint in the arena. */
+  ConstraintP makeConstraint(ArithVar v,
+                             ConstraintType t,
+                             const DeltaRational& r);
+
+  /** Makes the uninitialized negation of the constraint (v, t, r). */
+  ConstraintP makeNegation(ArithVar v, ConstraintType t, const DeltaRational& r);
+
+  /** Destroys the Constraint c and returns its memory to the arena. */
+  void destroyConstraint(ConstraintP c);
+
+  /**
+   * Adds c to the ValueCollection of its variable and value, which is made
+   * if there is none, and returns the ValueCollection.
+   */
+  ValueCollection* addToValueCollection(ConstraintP c);
+
+  /**
+   * Removes c from its ValueCollection, and the ValueCollection from the
+   * map if it becomes empty.
+   */
+  void removeFromValueCollection(ConstraintP c);
+
+  /** Updates the statistics on the memory used by the constraints. */
+  void updateMemoryStatistics();
+
   /** Maps literals to constraints.*/
   NodetoConstraintMap d_nodetoConstraintMap;
 
@@ -1212,6 +1278,14 @@ private:
   public:
     IntStat d_unatePropagateCalls;
     IntStat d_unatePropagateImplications;
+    /** The number of Constraints in the database. */
+    IntStat d_constraints;
+    /**
+     * The bytes reserved for the Constraints, the ValueCollections and the
+     * sorted arrays, not counting the numbers of the values.
+     */
+    IntStat d_bytes;
+    BackedStat<double> d_bytesPerConstraint;
 
     Statistics();
     ~Statistics();
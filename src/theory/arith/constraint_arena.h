@@ -0,0 +1,121 @@
+/*********************                                                        */
+/*! \file constraint_arena.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An arena for the objects of the ConstraintDatabase
+ **
+ ** ConstraintArena<T> carves objects of type T out of slabs of a fixed
+ ** number of slots. Destroyed objects are kept on a free list, linked
+ ** through their slots, and reused. The objects do not move, so pointers to
+ ** them stay valid until they are destroyed.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__ARITH__CONSTRAINT_ARENA_H
+#define CVC4__THEORY__ARITH__CONSTRAINT_ARENA_H
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+template <class T>
+class ConstraintArena
+{
+ public:
+  /** The number of objects per slab */
+  static const size_t SLOTS_PER_SLAB = 1024;
+
+  ConstraintArena() : d_nextSlot(SLOTS_PER_SLAB), d_freeList(nullptr), d_live(0)
+  {
+  }
+
+  /**
+   * Frees the slabs. The objects must have been destroyed before, their
+   * destructors are not called.
+   */
+  ~ConstraintArena() {}
+
+  /** Constructs a T from args in a free slot. */
+  template <class... Args>
+  T* make(Args&&... args)
+  {
+    Slot* slot;
+    if (d_freeList != nullptr)
+    {
+      slot = d_freeList;
+      d_freeList = slot->d_next;
+    }
+    else
+    {
+      if (d_nextSlot == SLOTS_PER_SLAB)
+      {
+        d_slabs.emplace_back(new Slot[SLOTS_PER_SLAB]);
+        d_nextSlot = 0;
+      }
+      slot = &d_slabs.back()[d_nextSlot++];
+    }
+    T* t = new (&slot->d_storage) T(std::forward<Args>(args)...);
+    ++d_live;
+    return t;
+  }
+
+  /** Destroys t, which must have been made by this arena. */
+  void destroy(T* t)
+  {
+    Assert(d_live > 0);
+    t->~T();
+    Slot* slot = reinterpret_cast<Slot*>(t);
+    slot->d_next = d_freeList;
+    d_freeList = slot;
+    --d_live;
+  }
+
+  /** Returns the number of objects that were made and not destroyed. */
+  size_t getLive() const { return d_live; }
+
+  /** Returns the number of bytes reserved by the slabs. */
+  size_t getBytes() const
+  {
+    return d_slabs.size() * SLOTS_PER_SLAB * sizeof(Slot);
+  }
+
+ private:
+  /** The memory of one object, or the link to the next free slot. */
+  union Slot
+  {
+    Slot* d_next;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type d_storage;
+  };
+
+  /** The slabs */
+  std::vector<std::unique_ptr<Slot[]>> d_slabs;
+  /** The next never used slot in the last slab */
+  size_t d_nextSlot;
+  /** The free list of destroyed objects */
+  Slot* d_freeList;
+  /** The number of objects in use */
+  size_t d_live;
+}; /* class ConstraintArena */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__ARITH__CONSTRAINT_ARENA_H */
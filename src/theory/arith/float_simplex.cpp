@@ -0,0 +1,258 @@
+/*********************                                                        */
+/*! \file float_simplex.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A double precision simplex used to find a candidate basis for the
+ ** exact simplex search.
+ **/
+#include "theory/arith/float_simplex.h"
+
+#include <cmath>
+#include <limits>
+
+#include "base/output.h"
+#include "theory/arith/partial_model.h"
+#include "theory/arith/tableau.h"
+
+using namespace std;
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+namespace {
+
+/** Coefficients and violations below this are treated as zero. */
+const double s_epsilon = 1e-9;
+
+}  // namespace
+
+FloatSimplex::FloatSimplex(const ArithVariables& vars, const Tableau& tableau)
+    : d_vars(vars),
+      d_copy(tableau, vars.getNumberOfVariables()),
+      d_pivotLimit(0),
+      d_pivots(0)
+{
+  const double inf = numeric_limits<double>::infinity();
+  ArithVar numVars = d_vars.getNumberOfVariables();
+  d_value.resize(numVars, 0.0);
+  d_lower.resize(numVars, -inf);
+  d_upper.resize(numVars, inf);
+  d_position.resize(numVars, Position::UNCHANGED);
+
+  for (ArithVariables::var_iterator i = d_vars.var_begin(),
+                                    i_end = d_vars.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    d_value[v] = d_vars.getAssignment(v).approx(
+        ApproximateSimplex::SMALL_FIXED_DELTA);
+    if (d_vars.hasLowerBound(v))
+    {
+      d_lower[v] = d_vars.getLowerBound(v).approx(
+          ApproximateSimplex::SMALL_FIXED_DELTA);
+    }
+    if (d_vars.hasUpperBound(v))
+    {
+      d_upper[v] = d_vars.getUpperBound(v).approx(
+          ApproximateSimplex::SMALL_FIXED_DELTA);
+    }
+  }
+}
+
+double FloatSimplex::violation(ArithVar x) const
+{
+  double v = d_value[x];
+  if (v < d_lower[x] - s_epsilon * (1 + std::fabs(d_lower[x])))
+  {
+    return d_lower[x] - v;
+  }
+  if (v > d_upper[x] + s_epsilon * (1 + std::fabs(d_upper[x])))
+  {
+    return v - d_upper[x];
+  }
+  return 0;
+}
+
+ArithVar FloatSimplex::selectBasic(bool bland) const
+{
+  ArithVar best = ARITHVAR_SENTINEL;
+  double bestViolation = 0;
+  for (uint32_t r = 0, r_end = d_copy.getNumRows(); r < r_end; ++r)
+  {
+    ArithVar basic = d_copy.getBasic(r);
+    if (basic == ARITHVAR_SENTINEL)
+    {
+      continue;
+    }
+    double viol = violation(basic);
+    if (viol == 0)
+    {
+      continue;
+    }
+    if (bland ? (best == ARITHVAR_SENTINEL || basic < best)
+              : viol > bestViolation)
+    {
+      best = basic;
+      bestViolation = viol;
+    }
+  }
+  return best;
+}
+
+ArithVar FloatSimplex::selectNonbasic(ArithVar basic, int sgn, bool bland)
+{
+  ArithVar best = ARITHVAR_SENTINEL;
+  double bestCoeff = 0;
+  for (const std::pair<const ArithVar, double>& entry : d_copy.getRow(basic))
+  {
+    ArithVar x = entry.first;
+    double c = entry.second;
+    if (TableauCopy<double>::isZero(c))
+    {
+      continue;
+    }
+    // x moves in direction dir to move basic in direction sgn
+    int dir = (c > 0) == (sgn > 0) ? 1 : -1;
+    bool canMove = dir > 0 ? d_value[x] < d_upper[x] - s_epsilon
+                           : d_value[x] > d_lower[x] + s_epsilon;
+    if (!canMove)
+    {
+      continue;
+    }
+    if (bland ? (best == ARITHVAR_SENTINEL || x < best)
+              : std::fabs(c) > bestCoeff)
+    {
+      best = x;
+      bestCoeff = std::fabs(c);
+    }
+  }
+  return best;
+}
+
+void FloatSimplex::pivotAndUpdate(ArithVar basic,
+                                  ArithVar nonbasic,
+                                  double value)
+{
+  double a = d_copy.getRow(basic).at(nonbasic);
+  Assert(!TableauCopy<double>::isZero(a));
+
+  // update the assignment
+  double theta = (value - d_value[basic]) / a;
+  d_value[nonbasic] += theta;
+  for (uint32_t r : d_copy.getColumn(nonbasic))
+  {
+    d_value[d_copy.getBasic(r)] += d_copy.getCoefficient(r, nonbasic) * theta;
+  }
+  d_value[basic] = value;
+  d_position[basic] = value == d_lower[basic] ? Position::AT_LOWER
+                                              : Position::AT_UPPER;
+  d_position[nonbasic] = Position::UNCHANGED;
+
+  d_copy.pivot(basic, nonbasic);
+  ++d_pivots;
+}
+
+LinResult FloatSimplex::solve()
+{
+  while (true)
+  {
+    // use the largest violations and coefficients first and switch to
+    // Bland's rule, which cannot cycle, for the second half of the pivots
+    bool bland = d_pivots >= d_pivotLimit / 2;
+    ArithVar basic = selectBasic(bland);
+    if (basic == ARITHVAR_SENTINEL)
+    {
+      Debug("arith::float") << "FloatSimplex: feasible after " << d_pivots
+                            << " pivots" << endl;
+      return LinFeasible;
+    }
+    if (d_pivots >= d_pivotLimit)
+    {
+      Debug("arith::float") << "FloatSimplex: exhausted" << endl;
+      return LinExhausted;
+    }
+    bool belowLower = d_value[basic] < d_lower[basic];
+    ArithVar nonbasic = selectNonbasic(basic, belowLower ? 1 : -1, bland);
+    if (nonbasic == ARITHVAR_SENTINEL)
+    {
+      Debug("arith::float") << "FloatSimplex: row of " << basic
+                            << " is infeasible after " << d_pivots
+                            << " pivots" << endl;
+      return LinInfeasible;
+    }
+    pivotAndUpdate(
+        basic, nonbasic, belowLower ? d_lower[basic] : d_upper[basic]);
+  }
+}
+
+ApproximateSimplex::Solution FloatSimplex::extractSolution() const
+{
+  ApproximateSimplex::Solution sol;
+  DenseSet& newBasis = sol.newBasis;
+  DenseMap<DeltaRational>& newValues = sol.newValues;
+
+  for (ArithVariables::var_iterator i = d_vars.var_begin(),
+                                    i_end = d_vars.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    if (d_copy.isBasic(v))
+    {
+      newBasis.add(v);
+    }
+    // Non-basic variables either kept their exact assignment or were moved
+    // to an exact bound when they left the basis. Only the values of the
+    // basic variables are estimates; they are recomputed by the exact
+    // simplex.
+    switch (d_position[v])
+    {
+      case Position::AT_LOWER:
+        newValues.set(v, d_vars.getLowerBound(v));
+        break;
+      case Position::AT_UPPER:
+        newValues.set(v, d_vars.getUpperBound(v));
+        break;
+      case Position::UNCHANGED:
+      {
+        const DeltaRational& oldValue = d_vars.getAssignment(v);
+        DeltaRational proposal = oldValue;
+        if (d_copy.isBasic(v)
+            && !ApproximateSimplex::roughlyEqual(
+                   d_value[v],
+                   oldValue.approx(ApproximateSimplex::SMALL_FIXED_DELTA)))
+        {
+          if (Maybe<Rational> estimate =
+                  ApproximateSimplex::estimateWithCFE(d_value[v]))
+          {
+            proposal = estimate.value();
+          }
+          if (d_vars.strictlyLessThanLowerBound(v, proposal))
+          {
+            proposal = d_vars.getLowerBound(v);
+          }
+          else if (d_vars.strictlyGreaterThanUpperBound(v, proposal))
+          {
+            proposal = d_vars.getUpperBound(v);
+          }
+        }
+        newValues.set(v, proposal);
+        break;
+      }
+    }
+  }
+  return sol;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,125 @@
+/*********************                                                        */
+/*! \file float_simplex.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A double precision simplex used to find a candidate basis for the
+ ** exact simplex search.
+ **
+ ** FloatSimplex copies the bounds of the ArithVariables into double precision
+ ** and runs the pivoting strategy of
+ ** DualSimplexDecisionProcedure on the copy: the basic variable violating its
+ ** bounds the most (later the smallest one) is pivoted with a non-basic
+ ** variable of its row that can move in the right direction, and is set to
+ ** the violated bound. The rows of the Tableau are copied into a
+ ** TableauCopy when the search first touches them.
+ **
+ ** The result is only a guess. extractSolution() returns the final basis and
+ ** assignment in the format of ApproximateSimplex, which
+ ** AttemptSolutionSDP imports into the exact Tableau. The exact simplex then
+ ** verifies the assignment and repairs what the rounding errors broke.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <vector>
+
+#include "theory/arith/approx_simplex.h"
+#include "theory/arith/arithvar.h"
+#include "theory/arith/tableau_copy.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+class ArithVariables;
+
+class FloatSimplex
+{
+ public:
+  FloatSimplex(const ArithVariables& vars, const Tableau& tableau);
+
+  /** Sets the maximum number of pivots of solve(). */
+  void setPivotLimit(uint32_t limit) { d_pivotLimit = limit; }
+
+  /**
+   * Searches for an assignment that satisfies the bounds of all variables.
+   * Returns LinFeasible if one was found, LinInfeasible if a row was found
+   * whose basic variable cannot be moved within its bounds, and
+   * LinExhausted if the pivot limit was reached.
+   */
+  LinResult solve();
+
+  /**
+   * Returns the current basis, the exact bounds for the non-basic variables
+   * that were moved to a bound and estimates for the basic variables.
+   */
+  ApproximateSimplex::Solution extractSolution() const;
+
+  /** Returns the number of pivots performed by solve(). */
+  uint32_t getPivots() const { return d_pivots; }
+
+  /** Returns the number of rows of the Tableau copied by solve(). */
+  uint32_t getRowsCopied() const { return d_copy.getRowsCopied(); }
+
+ private:
+  /** The position of a variable relative to its bounds. */
+  enum class Position
+  {
+    /** The variable is basic or still has its original assignment. */
+    UNCHANGED,
+    /** The variable is non-basic and at its lower bound. */
+    AT_LOWER,
+    /** The variable is non-basic and at its upper bound. */
+    AT_UPPER
+  };
+
+  /** Returns the amount by which x violates its bounds, or 0. */
+  double violation(ArithVar x) const;
+
+  /**
+   * Returns the basic variable to repair next, or ARITHVAR_SENTINEL if the
+   * assignment is feasible. Uses Bland's rule if bland is true.
+   */
+  ArithVar selectBasic(bool bland) const;
+
+  /**
+   * Returns the non-basic variable in the row of basic that can change
+   * basic in direction sgn, or ARITHVAR_SENTINEL if there is none. Uses
+   * Bland's rule if bland is true, and picks the largest coefficient
+   * otherwise.
+   */
+  ArithVar selectNonbasic(ArithVar basic, int sgn, bool bland);
+
+  /**
+   * Pivots basic with nonbasic and updates the assignment such that basic
+   * is at value afterwards.
+   */
+  void pivotAndUpdate(ArithVar basic, ArithVar nonbasic, double value);
+
+  const ArithVariables& d_vars;
+
+  /** The copy of the tableau. */
+  TableauCopy<double> d_copy;
+
+  /** The assignment and the bounds in double precision. */
+  std::vector<double> d_value;
+  std::vector<double> d_lower;
+  std::vector<double> d_upper;
+  std::vector<Position> d_position;
+
+  uint32_t d_pivotLimit;
+  uint32_t d_pivots;
+}; /* class FloatSimplex */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
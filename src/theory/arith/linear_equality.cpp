@@ -110,6 +110,7 @@ void LinearEqualityModule::includeBoundUpdate(ArithVar v, const BoundsInfo& prev
   BoundsInfo curr = d_variables.boundsInfo(v);
 
   Assert(prev != curr);
+  bool hasBoundsChanged = prev.hasBounds() != curr.hasBounds();
   Tableau::ColIterator basicIter = d_tableau.colIterator(v);
   for(; !basicIter.atEnd(); ++basicIter){
     const Tableau::Entry& entry = *basicIter;
@@ -121,6 +122,16 @@ void LinearEqualityModule::includeBoundUpdate(ArithVar v, const BoundsInfo& prev
     Debug("includeBoundUpdate") << d_tableau.rowIndexToBasic(ridx) << " " << counts << " to " ;
     counts.addInChange(a_ijSgn, prev, curr);
     Debug("includeBoundUpdate") << counts << " " << a_ijSgn << std::endl;
+
+    if(hasBoundsChanged){
+      // at most one variable of the row lacks a lower (upper) bound
+      BoundCounts hasCount = counts.hasBounds();
+      uint32_t length = d_tableau.getRowLength(ridx);
+      if(hasCount.lowerBoundCount() + 1 >= length ||
+         hasCount.upperBoundCount() + 1 >= length){
+        d_propagationRows.softAdd(ridx);
+      }
+    }
   }
 }
 
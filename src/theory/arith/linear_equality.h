@@ -412,6 +412,13 @@ private:
   BoundInfoMap& d_btracking;
   bool d_areTracking;
 
+  /**
+   * The rows whose counts of variables with an upper or a lower bound were
+   * changed by includeBoundUpdate() and afterwards leave at most one
+   * variable of the row without such a bound (mod sgns).
+   */
+  DenseSet d_propagationRows;
+
 public:
   /**
    * The constraint on a basic variable b is implied by the constraints
@@ -533,8 +540,20 @@ public:
   void stopTrackingRowIndex(RowIndex ridx){
     Assert(rowIndexIsTracked(ridx));
     d_btracking.remove(ridx);
+    if(d_propagationRows.isMember(ridx)){
+      d_propagationRows.remove(ridx);
+    }
   }
 
+  /**
+   * The rows on which a row propagation may have become possible since
+   * the set was last cleared. A row is added when a bound update changes
+   * its count of bounded variables such that all but at most one variable
+   * of the row have a lower bound or all but at most one have an upper
+   * bound (mod sgns). The caller is responsible for clearing the set.
+   */
+  DenseSet& getPropagationRows() { return d_propagationRows; }
+
   /**
    * If the pivot described in u were performed,
    * then the row would qualify as being either at the minimum/maximum
@@ -699,6 +718,10 @@ private:
   void clearSpeculative();
   Rational updateCoefficient(BorderVec::const_iterator startBlock, BorderVec::const_iterator endBlock);
 
+public:
+  /** Returns the number of pivots performed so far. */
+  uint32_t getPivotCount() const { return d_statistics.d_statPivots.getData(); }
+
 private:
   /** These fields are designed to be accessible to TheoryArith methods. */
   class Statistics {
@@ -159,10 +159,11 @@ public:
 
 template<class T>
 class MatrixEntryVector {
-private:
+public:
   typedef MatrixEntry<T> EntryType;
   typedef std::vector<EntryType> EntryArray;
 
+private:
   EntryArray d_entries;
   std::queue<EntryID> d_freedEntries;
 
@@ -207,6 +208,13 @@ public:
   uint32_t size() const{ return d_size; }
   uint32_t capacity() const{ return d_entries.capacity(); }
 
+  /** Replaces all entries by entries, which all have to be in use. */
+  void assign(EntryArray& entries){
+    d_entries.swap(entries);
+    std::queue<EntryID>().swap(d_freedEntries);
+    d_size = d_entries.size();
+  }
+
 
 private:
   bool inBounds(EntryID id) const{
@@ -284,6 +292,12 @@ public:
 
   uint32_t getSize() const { return d_size; }
 
+  /** Sets the head and size after the entries were relinked. */
+  void reset(EntryID head, uint32_t size){
+    d_head = head;
+    d_size = size;
+  }
+
   void insert(EntryID newId){
     if(isRow){
       d_entries->get(newId).setNextRowEntryID(d_head);
@@ -399,6 +413,18 @@ protected:
 
   T d_zero;
 
+  /**
+   * If true, the entries are periodically moved such that the entries of
+   * each row are contiguous in memory, see compactRows().
+   */
+  bool d_compactRows;
+
+  /** The number of entries added since the last call to compactRows(). */
+  uint32_t d_entriesAddedSinceCompaction;
+
+  /** The number of calls to compactRows(). */
+  uint32_t d_compactions;
+
 public:
   /**
    * Constructs an empty Matrix.
@@ -410,7 +436,10 @@ public:
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
-    d_zero(0)
+    d_zero(0),
+    d_compactRows(false),
+    d_entriesAddedSinceCompaction(0),
+    d_compactions(0)
   {}
 
   Matrix(const T& zero)
@@ -420,7 +449,10 @@ public:
     d_rowInMergeBuffer(ROW_INDEX_SENTINEL),
     d_entriesInUse(0),
     d_entries(),
-    d_zero(zero)
+    d_zero(zero),
+    d_compactRows(false),
+    d_entriesAddedSinceCompaction(0),
+    d_compactions(0)
   {}
 
   Matrix(const Matrix& m)
@@ -430,7 +462,10 @@ public:
     d_rowInMergeBuffer(m.d_rowInMergeBuffer),
     d_entriesInUse(m.d_entriesInUse),
     d_entries(m.d_entries),
-    d_zero(m.d_zero)
+    d_zero(m.d_zero),
+    d_compactRows(m.d_compactRows),
+    d_entriesAddedSinceCompaction(m.d_entriesAddedSinceCompaction),
+    d_compactions(m.d_compactions)
   {
     d_columns.clear();
     for(typename ColumnTable::const_iterator c=m.d_columns.begin(), cend = m.d_columns.end(); c!=cend; ++c){
@@ -450,6 +485,9 @@ public:
     d_entriesInUse = (m.d_entriesInUse);
     d_entries = (m.d_entries);
     d_zero = (m.d_zero);
+    d_compactRows = m.d_compactRows;
+    d_entriesAddedSinceCompaction = m.d_entriesAddedSinceCompaction;
+    d_compactions = m.d_compactions;
     d_columns.clear();
     for(typename ColumnTable::const_iterator c=m.d_columns.begin(), cend = m.d_columns.end(); c!=cend; ++c){
       const ColumnVector<T>& col = *c;
@@ -479,6 +517,7 @@ protected:
     Assert(newEntry.getCoefficient() != 0);
 
     ++d_entriesInUse;
+    ++d_entriesAddedSinceCompaction;
 
     d_rows[row].insert(newId);
     d_columns[col].insert(newId);
@@ -892,6 +931,76 @@ public:
     }
   }
 
+  /**
+   * If set, the entries are stored in contiguous row segments: the entries
+   * are reordered such that each row occupies a consecutive range of entry
+   * ids, in the order of the rows, and the column lists are rebuilt in row
+   * order. Traversing a row then walks memory sequentially. The layout
+   * degrades as entries are added and is restored by maybeCompactRows().
+   */
+  void setCompactRows(bool compact){
+    d_compactRows = compact;
+  }
+
+  bool getCompactRows() const { return d_compactRows; }
+
+  uint32_t getCompactions() const { return d_compactions; }
+
+  /**
+   * Calls compactRows() if compacting is enabled and more entries were added
+   * since the last compaction than half of the entries in use, so the cost of
+   * compacting is linear in the number of added entries.
+   * Invalidates all EntryIDs, and must not be called while the merge buffer
+   * is in use.
+   */
+  void maybeCompactRows(){
+    if(d_compactRows && 2 * d_entriesAddedSinceCompaction > d_entriesInUse){
+      compactRows();
+    }
+  }
+
+  /**
+   * Moves the entries into contiguous row segments and rebuilds the column
+   * lists. Invalidates all EntryIDs.
+   */
+  void compactRows(){
+    Assert(d_rowInMergeBuffer == ROW_INDEX_SENTINEL);
+
+    typename MatrixEntryVector<T>::EntryArray entries;
+    entries.reserve(d_entriesInUse);
+    for(RowIndex rid = 0, N = d_rows.size(); rid < N; ++rid){
+      RowVectorT& row = d_rows[rid];
+      EntryID head = entries.size();
+      for(RowIterator i = row.begin(); !i.atEnd(); ++i){
+        EntryID id = entries.size();
+        // only the coefficient is moved, the links stay valid for ++i
+        entries.push_back(std::move(d_entries.get(i.getID())));
+        Entry& entry = entries.back();
+        entry.setPrevRowEntryID(id == head ? ENTRYID_SENTINEL : id - 1);
+        entry.setNextRowEntryID(ENTRYID_SENTINEL);
+        entry.setPrevColEntryID(ENTRYID_SENTINEL);
+        entry.setNextColEntryID(ENTRYID_SENTINEL);
+        if(id != head){
+          entries[id - 1].setNextRowEntryID(id);
+        }
+      }
+      row.reset(row.getSize() == 0 ? ENTRYID_SENTINEL : head, row.getSize());
+    }
+    Assert(entries.size() == d_entriesInUse);
+
+    d_entries.assign(entries);
+    for(typename ColumnTable::iterator c = d_columns.begin(), cend = d_columns.end(); c != cend; ++c){
+      (*c).reset(ENTRYID_SENTINEL, 0);
+    }
+    // insert backwards such that each column lists its entries in row order
+    for(EntryID id = d_entries.size(); id > 0; --id){
+      d_columns[d_entries[id - 1].getColVar()].insert(id - 1);
+    }
+
+    d_entriesAddedSinceCompaction = 0;
+    ++d_compactions;
+  }
+
   void removeRow(RowIndex rid){
     RowIterator i = getRow(rid).begin();
     RowIterator i_end = getRow(rid).end();
@@ -0,0 +1,448 @@
+/*********************                                                        */
+/*! \file parallel_branch_and_bound.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Branch and bound on a snapshot of the tableau, run by worker
+ ** threads.
+ **/
+#include "theory/arith/parallel_branch_and_bound.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include "base/check.h"
+#include "base/configuration.h"
+#include "theory/arith/partial_model.h"
+#include "theory/arith/tableau_copy.h"
+
+using namespace std;
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * Searches one subtree on a copy of the snapshot. Workers must not use
+ * anything that depends on the main thread, such as the options, the
+ * statistics or the output streams.
+ */
+class ParallelBranchAndBound::Worker
+{
+ public:
+  Worker(const ParallelBranchAndBound& problem,
+         uint32_t id,
+         uint32_t prefixDepth);
+
+  /** Searches the subtree of the worker and stores the result. */
+  void search();
+
+  const Result& getResult() const { return d_result; }
+
+ private:
+  /** The old bound of a variable, restored on backtracking. */
+  struct TrailEntry
+  {
+    ArithVar d_var;
+    bool d_upper;
+    bool d_had;
+    bool d_wasBranch;
+    DeltaRational d_old;
+  };
+
+  /** Searches the subtree at the current node. */
+  Status searchNode(uint32_t depth);
+
+  /**
+   * Runs the simplex. Returns true if the assignment satisfies the rows and
+   * the bounds. Otherwise, either d_exhausted is set or the row in conflict
+   * has been added to the explanation.
+   */
+  bool findModel();
+
+  /** Adds the bounds that make the row of basic infeasible. */
+  void explainConflict(ArithVar basic, bool belowLower);
+
+  /** Adds the bound of x to the explanation unless it is a branch. */
+  void explainBound(ArithVar x, bool upper);
+
+  /** Tightens the bound of x to the branch. */
+  void applyBranch(ArithVar x, const Integer& value, bool up);
+
+  /** Restores the bounds of the trail down to size mark. */
+  void backtrack(size_t mark);
+
+  /** Sets the non-basic variable x to v and updates the basic ones. */
+  void update(ArithVar x, const DeltaRational& v);
+
+  /** Pivots basic with nonbasic such that basic is at value afterwards. */
+  void pivotAndUpdate(ArithVar basic,
+                      ArithVar nonbasic,
+                      const DeltaRational& value);
+
+  /** Returns true if x is below its lower bound. */
+  bool belowLower(ArithVar x) const
+  {
+    return d_hasLower[x] && d_value[x] < d_lower[x];
+  }
+
+  /** Returns true if x is above its upper bound. */
+  bool aboveUpper(ArithVar x) const
+  {
+    return d_hasUpper[x] && d_value[x] > d_upper[x];
+  }
+
+  uint32_t d_id;
+  uint32_t d_prefixDepth;
+  uint32_t d_nodeLimit;
+  uint32_t d_pivotLimit;
+  const std::vector<bool>& d_integer;
+
+  TableauCopy<Rational> d_copy;
+  std::vector<DeltaRational> d_value;
+  std::vector<DeltaRational> d_lower;
+  std::vector<DeltaRational> d_upper;
+  std::vector<bool> d_hasLower;
+  std::vector<bool> d_hasUpper;
+  /** Whether the lower resp. upper bound of a variable is a branch. */
+  std::vector<bool> d_lowerIsBranch;
+  std::vector<bool> d_upperIsBranch;
+
+  std::vector<TrailEntry> d_trail;
+  /** Whether the pivot limit was reached. */
+  bool d_exhausted;
+  Result d_result;
+}; /* class ParallelBranchAndBound::Worker */
+
+ParallelBranchAndBound::ParallelBranchAndBound(const ArithVariables& vars,
+                                               const Tableau& tableau)
+    : d_tableau(tableau), d_nodeLimit(0), d_pivotLimit(0)
+{
+  ArithVar numVars = vars.getNumberOfVariables();
+  d_value.resize(numVars);
+  d_lower.resize(numVars);
+  d_upper.resize(numVars);
+  d_hasLower.resize(numVars, false);
+  d_hasUpper.resize(numVars, false);
+  d_integer.resize(numVars, false);
+
+  for (ArithVariables::var_iterator i = vars.var_begin(),
+                                    i_end = vars.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    d_value[v] = vars.getAssignment(v);
+    if (vars.hasLowerBound(v))
+    {
+      d_hasLower[v] = true;
+      d_lower[v] = vars.getLowerBound(v);
+    }
+    if (vars.hasUpperBound(v))
+    {
+      d_hasUpper[v] = true;
+      d_upper[v] = vars.getUpperBound(v);
+    }
+    d_integer[v] = vars.isIntegerInput(v);
+  }
+}
+
+std::vector<ParallelBranchAndBound::Result> ParallelBranchAndBound::run(
+    uint32_t threads) const
+{
+  uint32_t prefixDepth = 0;
+  while ((2u << prefixDepth) <= threads)
+  {
+    ++prefixDepth;
+  }
+  uint32_t numWorkers = 1u << prefixDepth;
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (uint32_t i = 0; i < numWorkers; ++i)
+  {
+    workers.emplace_back(new Worker(*this, i, prefixDepth));
+  }
+  if (Configuration::isBuiltWithCln())
+  {
+    // CLN numbers share reference counted representations, which must not
+    // be copied concurrently
+    for (const std::unique_ptr<Worker>& w : workers)
+    {
+      w->search();
+    }
+  }
+  else
+  {
+    std::vector<std::thread> running;
+    for (const std::unique_ptr<Worker>& w : workers)
+    {
+      running.emplace_back(&Worker::search, w.get());
+    }
+    for (std::thread& t : running)
+    {
+      t.join();
+    }
+  }
+
+  std::vector<Result> results;
+  for (const std::unique_ptr<Worker>& w : workers)
+  {
+    results.push_back(w->getResult());
+  }
+  return results;
+}
+
+ParallelBranchAndBound::Worker::Worker(const ParallelBranchAndBound& problem,
+                                       uint32_t id,
+                                       uint32_t prefixDepth)
+    : d_id(id),
+      d_prefixDepth(prefixDepth),
+      d_nodeLimit(problem.d_nodeLimit),
+      d_pivotLimit(problem.d_pivotLimit),
+      d_integer(problem.d_integer),
+      d_copy(problem.d_tableau, problem.d_value.size()),
+      d_value(problem.d_value),
+      d_lower(problem.d_lower),
+      d_upper(problem.d_upper),
+      d_hasLower(problem.d_hasLower),
+      d_hasUpper(problem.d_hasUpper),
+      d_lowerIsBranch(problem.d_value.size(), false),
+      d_upperIsBranch(problem.d_value.size(), false),
+      d_exhausted(false)
+{
+  d_result.d_status = Status::UNKNOWN;
+  d_result.d_nodes = 0;
+  d_result.d_pivots = 0;
+}
+
+void ParallelBranchAndBound::Worker::search()
+{
+  d_result.d_status = searchNode(0);
+  if (d_result.d_status == Status::INFEASIBLE)
+  {
+    std::vector<BoundRef>& expl = d_result.d_explanation;
+    std::sort(expl.begin(), expl.end());
+    expl.erase(std::unique(expl.begin(), expl.end()), expl.end());
+  }
+  else
+  {
+    d_result.d_explanation.clear();
+  }
+}
+
+ParallelBranchAndBound::Status ParallelBranchAndBound::Worker::searchNode(
+    uint32_t depth)
+{
+  if (d_result.d_nodes >= d_nodeLimit)
+  {
+    return Status::UNKNOWN;
+  }
+  ++d_result.d_nodes;
+  if (!findModel())
+  {
+    return d_exhausted ? Status::UNKNOWN : Status::INFEASIBLE;
+  }
+
+  ArithVar x = ARITHVAR_SENTINEL;
+  for (ArithVar v = 0; v < d_value.size(); ++v)
+  {
+    if (d_integer[v] && !d_value[v].isIntegral())
+    {
+      x = v;
+      break;
+    }
+  }
+  if (x == ARITHVAR_SENTINEL)
+  {
+    d_result.d_solution = d_value;
+    return Status::SOLUTION;
+  }
+
+  Integer floor = d_value[x].floor();
+  if (depth < d_prefixDepth)
+  {
+    // the branches above the subtree of this worker are kept
+    bool up = ((d_id >> depth) & 1) != 0;
+    d_result.d_path.push_back(Branch{x, floor, up});
+    applyBranch(x, floor, up);
+    return searchNode(depth + 1);
+  }
+  for (bool up : {false, true})
+  {
+    size_t mark = d_trail.size();
+    applyBranch(x, floor, up);
+    Status status = searchNode(depth + 1);
+    backtrack(mark);
+    if (status != Status::INFEASIBLE)
+    {
+      return status;
+    }
+  }
+  return Status::INFEASIBLE;
+}
+
+bool ParallelBranchAndBound::Worker::findModel()
+{
+  while (true)
+  {
+    // Bland's rule: the smallest violated basic variable and the smallest
+    // non-basic variable that can repair it
+    ArithVar basic = ARITHVAR_SENTINEL;
+    for (uint32_t r = 0, r_end = d_copy.getNumRows(); r < r_end; ++r)
+    {
+      ArithVar b = d_copy.getBasic(r);
+      if (b != ARITHVAR_SENTINEL && (belowLower(b) || aboveUpper(b))
+          && (basic == ARITHVAR_SENTINEL || b < basic))
+      {
+        basic = b;
+      }
+    }
+    if (basic == ARITHVAR_SENTINEL)
+    {
+      return true;
+    }
+    if (d_result.d_pivots >= d_pivotLimit)
+    {
+      d_exhausted = true;
+      return false;
+    }
+
+    bool below = belowLower(basic);
+    ArithVar nonbasic = ARITHVAR_SENTINEL;
+    for (const std::pair<const ArithVar, Rational>& entry :
+         d_copy.getRow(basic))
+    {
+      ArithVar x = entry.first;
+      // x increases to move basic in direction of the violated bound
+      bool increase = (entry.second.sgn() > 0) == below;
+      bool canMove = increase ? !d_hasUpper[x] || d_value[x] < d_upper[x]
+                              : !d_hasLower[x] || d_value[x] > d_lower[x];
+      if (canMove && (nonbasic == ARITHVAR_SENTINEL || x < nonbasic))
+      {
+        nonbasic = x;
+      }
+    }
+    if (nonbasic == ARITHVAR_SENTINEL)
+    {
+      explainConflict(basic, below);
+      return false;
+    }
+    pivotAndUpdate(basic, nonbasic, below ? d_lower[basic] : d_upper[basic]);
+  }
+}
+
+void ParallelBranchAndBound::Worker::explainConflict(ArithVar basic,
+                                                     bool belowLower)
+{
+  // basic is below its lower bound and all non-basic variables are at the
+  // bound that maximizes basic, or the other way around
+  explainBound(basic, !belowLower);
+  for (const std::pair<const ArithVar, Rational>& entry :
+       d_copy.getRow(basic))
+  {
+    explainBound(entry.first, (entry.second.sgn() > 0) == belowLower);
+  }
+}
+
+void ParallelBranchAndBound::Worker::explainBound(ArithVar x, bool upper)
+{
+  // Branches inside the subtree are resolved by the search of both
+  // children, and the branches above it are in the path.
+  if (!(upper ? d_upperIsBranch[x] : d_lowerIsBranch[x]))
+  {
+    d_result.d_explanation.push_back(BoundRef(x, upper));
+  }
+}
+
+void ParallelBranchAndBound::Worker::applyBranch(ArithVar x,
+                                                 const Integer& value,
+                                                 bool up)
+{
+  DeltaRational bound(up ? Rational(value + Integer(1)) : Rational(value));
+  if (up)
+  {
+    if (d_hasLower[x] && bound <= d_lower[x])
+    {
+      return;
+    }
+    d_trail.push_back(
+        TrailEntry{x, false, d_hasLower[x], d_lowerIsBranch[x], d_lower[x]});
+    d_hasLower[x] = true;
+    d_lower[x] = bound;
+    d_lowerIsBranch[x] = true;
+  }
+  else
+  {
+    if (d_hasUpper[x] && bound >= d_upper[x])
+    {
+      return;
+    }
+    d_trail.push_back(
+        TrailEntry{x, true, d_hasUpper[x], d_upperIsBranch[x], d_upper[x]});
+    d_hasUpper[x] = true;
+    d_upper[x] = bound;
+    d_upperIsBranch[x] = true;
+  }
+  if (!d_copy.isBasic(x) && (belowLower(x) || aboveUpper(x)))
+  {
+    update(x, bound);
+  }
+}
+
+void ParallelBranchAndBound::Worker::backtrack(size_t mark)
+{
+  // the assignment is kept, it satisfies the weaker bounds
+  while (d_trail.size() > mark)
+  {
+    const TrailEntry& entry = d_trail.back();
+    if (entry.d_upper)
+    {
+      d_hasUpper[entry.d_var] = entry.d_had;
+      d_upper[entry.d_var] = entry.d_old;
+      d_upperIsBranch[entry.d_var] = entry.d_wasBranch;
+    }
+    else
+    {
+      d_hasLower[entry.d_var] = entry.d_had;
+      d_lower[entry.d_var] = entry.d_old;
+      d_lowerIsBranch[entry.d_var] = entry.d_wasBranch;
+    }
+    d_trail.pop_back();
+  }
+}
+
+void ParallelBranchAndBound::Worker::update(ArithVar x, const DeltaRational& v)
+{
+  DeltaRational diff = v - d_value[x];
+  for (uint32_t r : d_copy.getColumn(x))
+  {
+    d_value[d_copy.getBasic(r)] += diff * d_copy.getCoefficient(r, x);
+  }
+  d_value[x] = v;
+}
+
+void ParallelBranchAndBound::Worker::pivotAndUpdate(ArithVar basic,
+                                                    ArithVar nonbasic,
+                                                    const DeltaRational& value)
+{
+  Rational a = d_copy.getRow(basic).at(nonbasic);
+  Assert(!a.isZero());
+
+  // update the assignment
+  update(nonbasic, d_value[nonbasic] + (value - d_value[basic]) / a);
+  Assert(d_value[basic] == value);
+
+  d_copy.pivot(basic, nonbasic);
+  ++d_result.d_pivots;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
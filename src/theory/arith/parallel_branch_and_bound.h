@@ -0,0 +1,134 @@
+/*********************                                                        */
+/*! \file parallel_branch_and_bound.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Branch and bound on a snapshot of the tableau, run by worker
+ ** threads.
+ **
+ ** ParallelBranchAndBound copies the bounds and the assignment of the
+ ** ArithVariables into a snapshot that does not depend on the context or the
+ ** NodeManager, so that it can be searched outside of the main thread. Each
+ ** worker pivots its own TableauCopy, which reads the rows of the Tableau
+ ** when it first touches them; the Tableau does not change until run()
+ ** returns. The first levels of the branch and bound tree are split among the
+ ** workers: worker i follows the branches given by the bits of i and then
+ ** searches the subtree below depth first, using an exact simplex with
+ ** Bland's rule.
+ **
+ ** A worker either finds an assignment that satisfies the rows, the bounds
+ ** and the integrality of all integer input variables, proves that its
+ ** subtree has no such assignment, or gives up after a number of nodes. An
+ ** infeasible subtree comes with the bounds of the snapshot that the proof
+ ** depends on. Together with the branches leading to the subtree, these give
+ ** a lemma for the DPLL(T) search.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <vector>
+
+#include "theory/arith/arithvar.h"
+#include "theory/arith/delta_rational.h"
+#include "util/integer.h"
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+class ArithVariables;
+class Tableau;
+
+class ParallelBranchAndBound
+{
+ public:
+  /** The branch x <= d_value if d_up is false and x >= d_value + 1 else. */
+  struct Branch
+  {
+    ArithVar d_var;
+    Integer d_value;
+    bool d_up;
+  };
+
+  /** The upper bound of the variable if second is true, and the lower one
+   * else. */
+  typedef std::pair<ArithVar, bool> BoundRef;
+
+  /** The outcome of the search of a subtree. */
+  enum class Status
+  {
+    /** The subtree has no integer solution. */
+    INFEASIBLE,
+    /** An integer solution was found. */
+    SOLUTION,
+    /** The node limit was reached. */
+    UNKNOWN
+  };
+
+  struct Result
+  {
+    Status d_status;
+    /** The branches from the root to the subtree of the worker. */
+    std::vector<Branch> d_path;
+    /**
+     * If the status is INFEASIBLE, bounds of the snapshot that, together
+     * with d_path, the rows and the integrality of the variables, imply that
+     * the subtree is infeasible.
+     */
+    std::vector<BoundRef> d_explanation;
+    /** If the status is SOLUTION, the assignment of all variables. */
+    std::vector<DeltaRational> d_solution;
+    /** The number of nodes and pivots of the search. */
+    uint32_t d_nodes;
+    uint32_t d_pivots;
+  };
+
+  /**
+   * Takes a snapshot of the variables. The assignment of vars is assumed to
+   * be consistent with the tableau and the bounds. The tableau must not
+   * change while the snapshot is in use.
+   */
+  ParallelBranchAndBound(const ArithVariables& vars, const Tableau& tableau);
+
+  /** Sets the maximum number of nodes searched by each worker. */
+  void setNodeLimit(uint32_t limit) { d_nodeLimit = limit; }
+
+  /** Sets the maximum number of pivots of each worker. */
+  void setPivotLimit(uint32_t limit) { d_pivotLimit = limit; }
+
+  /**
+   * Searches the snapshot with the largest power of two of workers that is
+   * at most threads, each in its own thread, and returns their results.
+   */
+  std::vector<Result> run(uint32_t threads) const;
+
+ private:
+  class Worker;
+
+  const Tableau& d_tableau;
+
+  /** The assignment and the bounds of the variables. */
+  std::vector<DeltaRational> d_value;
+  std::vector<DeltaRational> d_lower;
+  std::vector<DeltaRational> d_upper;
+  std::vector<bool> d_hasLower;
+  std::vector<bool> d_hasUpper;
+  /** The integer input variables, which are the ones branched on. */
+  std::vector<bool> d_integer;
+
+  uint32_t d_nodeLimit;
+  uint32_t d_pivotLimit;
+}; /* class ParallelBranchAndBound */
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
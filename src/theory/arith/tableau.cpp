@@ -31,6 +31,9 @@ void Tableau::pivot(ArithVar oldBasic, ArithVar newBasic, CoefficientChangeCallb
 
   Debug("tableau") << "Tableau::pivot(" <<  oldBasic <<", " << newBasic <<")"  << endl;
 
+  // restore the row segments before the rows are traversed
+  maybeCompactRows();
+
   RowIndex ridx = basicToRowIndex(oldBasic);
 
   rowPivot(oldBasic, newBasic, cb);
@@ -0,0 +1,306 @@
+/*********************                                                        */
+/*! \file tableau_copy.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A copy of the rows of a Tableau that is pivoted without changing
+ ** the Tableau.
+ **
+ ** TableauCopy holds the rows of a Tableau with coefficients of type T
+ ** (double or Rational). A row is only copied when it is first used, i.e.,
+ ** when its basic variable is repaired or when a variable of the row is
+ ** updated or pivoted. Rows that are never touched keep their values in the
+ ** Tableau, hence a search that pivots a few times only copies a few rows.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "base/check.h"
+#include "theory/arith/arithvar.h"
+#include "theory/arith/tableau.h"
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+template <class T>
+class TableauCopy
+{
+ public:
+  /** The coefficients of the non-basic variables of a row. */
+  typedef std::unordered_map<ArithVar, T> Row;
+
+  /**
+   * Creates a copy of tableau with numVars variables. The rows are read from
+   * tableau when they are first used, hence tableau must not change while
+   * the copy is in use.
+   */
+  TableauCopy(const Tableau& tableau, ArithVar numVars)
+      : d_tableau(tableau),
+        d_rows(tableau.getNumRows()),
+        d_basic(tableau.getNumRows(), ARITHVAR_SENTINEL),
+        d_copied(tableau.getNumRows(), false),
+        d_rowOf(numVars, -1),
+        d_cols(numVars),
+        d_colCopied(numVars, false),
+        d_rowsCopied(0)
+  {
+    for (Tableau::BasicIterator i = tableau.beginBasic(),
+                                i_end = tableau.endBasic();
+         i != i_end;
+         ++i)
+    {
+      RowIndex r = tableau.basicToRowIndex(*i);
+      d_basic[r] = *i;
+      d_rowOf[*i] = r;
+    }
+  }
+
+  /** Returns true if x is basic in the copy. */
+  bool isBasic(ArithVar x) const { return d_rowOf[x] >= 0; }
+
+  /**
+   * Returns the number of row indices, which includes indices of removed
+   * rows whose basic variable is ARITHVAR_SENTINEL.
+   */
+  uint32_t getNumRows() const { return d_basic.size(); }
+
+  /** Returns the basic variable of row r. */
+  ArithVar getBasic(uint32_t r) const { return d_basic[r]; }
+
+  /** Returns the row of the basic variable basic. */
+  const Row& getRow(ArithVar basic)
+  {
+    Assert(isBasic(basic));
+    uint32_t r = d_rowOf[basic];
+    copyRow(r);
+    return d_rows[r];
+  }
+
+  /** Returns the rows that the non-basic variable x occurs in. */
+  const std::vector<uint32_t>& getColumn(ArithVar x)
+  {
+    copyColumn(x);
+    return d_cols[x];
+  }
+
+  /**
+   * Returns the coefficient of the non-basic variable x in row r, which
+   * must be one of the rows returned by getColumn(x).
+   */
+  const T& getCoefficient(uint32_t r, ArithVar x) const
+  {
+    Assert(d_copied[r]);
+    typename Row::const_iterator it = d_rows[r].find(x);
+    Assert(it != d_rows[r].end());
+    return it->second;
+  }
+
+  /** Pivots the basic variable basic with the non-basic variable nonbasic. */
+  void pivot(ArithVar basic, ArithVar nonbasic);
+
+  /** Returns the number of rows copied from the Tableau. */
+  uint32_t getRowsCopied() const { return d_rowsCopied; }
+
+  /** Returns true if the coefficient c is zero (up to rounding for double). */
+  static bool isZero(const T& c);
+
+ private:
+  /** Converts a coefficient of the Tableau. */
+  static T fromRational(const Rational& c);
+
+  /** Copies row r from the Tableau unless it was already copied. */
+  void copyRow(uint32_t r);
+
+  /** Copies all rows of the Tableau that x occurs in. */
+  void copyColumn(ArithVar x);
+
+  /** Adds c to the coefficient of x in row r, dropping zeros. */
+  void addToCoefficient(uint32_t r, ArithVar x, const T& c);
+
+  const Tableau& d_tableau;
+
+  std::vector<Row> d_rows;
+  /** Maps a row to its basic variable. */
+  std::vector<ArithVar> d_basic;
+  /** Whether a row was copied from the Tableau. */
+  std::vector<bool> d_copied;
+  /** Maps a basic variable to its row, and a non-basic one to -1. */
+  std::vector<int32_t> d_rowOf;
+  /**
+   * Maps a variable to the copied rows it occurs in as a non-basic
+   * variable, which are all rows it occurs in if d_colCopied is set.
+   */
+  std::vector<std::vector<uint32_t>> d_cols;
+  std::vector<bool> d_colCopied;
+
+  uint32_t d_rowsCopied;
+}; /* class TableauCopy */
+
+template <>
+inline bool TableauCopy<double>::isZero(const double& c)
+{
+  return c < 1e-9 && c > -1e-9;
+}
+
+template <>
+inline bool TableauCopy<Rational>::isZero(const Rational& c)
+{
+  return c.isZero();
+}
+
+template <>
+inline double TableauCopy<double>::fromRational(const Rational& c)
+{
+  return c.getDouble();
+}
+
+template <>
+inline Rational TableauCopy<Rational>::fromRational(const Rational& c)
+{
+  return c;
+}
+
+template <class T>
+void TableauCopy<T>::copyRow(uint32_t r)
+{
+  if (d_copied[r])
+  {
+    return;
+  }
+  d_copied[r] = true;
+  ++d_rowsCopied;
+  // A row that was not copied was not pivoted either. The Tableau stores it
+  // as sum_j a_j x_j = 0 with a_basic = -1.
+  ArithVar basic = d_basic[r];
+  for (Tableau::RowIterator ri = d_tableau.ridRowIterator(r); !ri.atEnd();
+       ++ri)
+  {
+    const Tableau::Entry& entry = *ri;
+    ArithVar x = entry.getColVar();
+    if (x != basic)
+    {
+      d_rows[r][x] = fromRational(entry.getCoefficient());
+      d_cols[x].push_back(r);
+    }
+  }
+}
+
+template <class T>
+void TableauCopy<T>::copyColumn(ArithVar x)
+{
+  if (d_colCopied[x])
+  {
+    return;
+  }
+  d_colCopied[x] = true;
+  if (x >= d_tableau.getNumColumns())
+  {
+    return;
+  }
+  for (Tableau::ColIterator ci = d_tableau.colIterator(x); !ci.atEnd(); ++ci)
+  {
+    copyRow((*ci).getRowIndex());
+  }
+}
+
+template <class T>
+void TableauCopy<T>::addToCoefficient(uint32_t r, ArithVar x, const T& c)
+{
+  Row& row = d_rows[r];
+  typename Row::iterator it = row.find(x);
+  if (it == row.end())
+  {
+    if (!isZero(c))
+    {
+      row[x] = c;
+      d_cols[x].push_back(r);
+    }
+    return;
+  }
+  it->second += c;
+  if (isZero(it->second))
+  {
+    row.erase(it);
+    std::vector<uint32_t>& col = d_cols[x];
+    for (uint32_t k = 0; k < col.size(); ++k)
+    {
+      if (col[k] == r)
+      {
+        col[k] = col.back();
+        col.pop_back();
+        break;
+      }
+    }
+  }
+}
+
+template <class T>
+void TableauCopy<T>::pivot(ArithVar basic, ArithVar nonbasic)
+{
+  Assert(isBasic(basic) && !isBasic(nonbasic));
+  uint32_t r = d_rowOf[basic];
+  copyRow(r);
+  copyColumn(nonbasic);
+
+  // solve row r for nonbasic:
+  //   x_nonbasic = (1/a) x_basic - sum_{j != nonbasic} (c_j/a) x_j
+  Row& row = d_rows[r];
+  typename Row::iterator it = row.find(nonbasic);
+  Assert(it != row.end() && !isZero(it->second));
+  T inv = T(1) / it->second;
+  row.erase(it);
+  for (std::pair<const ArithVar, T>& entry : row)
+  {
+    entry.second = -entry.second * inv;
+  }
+  row[basic] = inv;
+  d_basic[r] = nonbasic;
+  d_rowOf[nonbasic] = r;
+  d_rowOf[basic] = -1;
+
+  // substitute the new row into all other rows with nonbasic; afterwards
+  // basic occurs exactly in the rows nonbasic occurred in
+  std::vector<uint32_t> rows;
+  rows.swap(d_cols[nonbasic]);
+  for (uint32_t s : rows)
+  {
+    if (s == r)
+    {
+      continue;
+    }
+    typename Row::iterator sit = d_rows[s].find(nonbasic);
+    T d = sit->second;
+    d_rows[s].erase(sit);
+    for (const std::pair<const ArithVar, T>& entry : d_rows[r])
+    {
+      if (entry.first == basic)
+      {
+        d_rows[s][basic] = d * entry.second;
+      }
+      else
+      {
+        addToCoefficient(s, entry.first, d * entry.second);
+      }
+    }
+  }
+  d_cols[basic].swap(rows);
+  // the Tableau has basic only in row r
+  d_colCopied[basic] = true;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace CVC4
@@ -21,6 +21,7 @@
 
 #include <map>
 #include <queue>
+#include <set>
 #include <vector>
 
 #include "base/output.h"
@@ -53,10 +54,12 @@
 #include "theory/arith/cut_log.h"
 #include "theory/arith/delta_rational.h"
 #include "theory/arith/dio_solver.h"
+#include "theory/arith/float_simplex.h"
 #include "theory/arith/linear_equality.h"
 #include "theory/arith/matrix.h"
 #include "theory/arith/nl/nonlinear_extension.h"
 #include "theory/arith/normal_form.h"
+#include "theory/arith/parallel_branch_and_bound.h"
 #include "theory/arith/partial_model.h"
 #include "theory/arith/simplex.h"
 #include "theory/arith/theory_arith.h"
@@ -156,9 +159,16 @@ TheoryArithPrivate::TheoryArithPrivate(TheoryArith& containing,
       d_dioSolveResources(0),
       d_solveIntMaybeHelp(0u),
       d_solveIntAttempts(0u),
+      d_warmStartAssignment(),
+      d_warmStartPending(false),
+      d_queryWarmStarted(false),
+      d_queryCount(0),
+      d_queryPivotsStart(0),
       d_statistics(),
       d_opElim(pnm, logicInfo)
 {
+  d_tableau.setCompactRows(options::arithTableauStorage()
+                           == options::TableauStorageMode::ROWS);
 }
 
 TheoryArithPrivate::~TheoryArithPrivate(){
@@ -260,6 +270,8 @@ TheoryArithPrivate::Statistics::Statistics()
   , d_boundComputationTime("theory::arith::bound::time")
   , d_boundComputations("theory::arith::bound::boundComputations",0)
   , d_boundPropagations("theory::arith::bound::boundPropagations",0)
+  , d_propRowsQueued("theory::arith::bound::rowsQueued", 0)
+  , d_propRowsCarried("theory::arith::bound::rowsCarried", 0)
   , d_unknownChecks("theory::arith::status::unknowns", 0)
   , d_maxUnknownsInARow("theory::arith::status::maxUnknownsInARow", 0)
   , d_avgUnknownsInARow("theory::arith::status::avgUnknownsInARow")
@@ -310,6 +322,27 @@ TheoryArithPrivate::Statistics::Statistics()
   , d_unknownPivots("theory::arith::pivots::unknown")
   , d_solveIntModelsAttempts("theory::arith::z::solveInt::models::attempts", 0)
   , d_solveIntModelsSuccessful("theory::arith::zzz::solveInt::models::successful", 0)
+  , d_floatCalls("theory::arith::float::calls", 0)
+  , d_floatPivots("theory::arith::float::pivots", 0)
+  , d_floatRowsCopied("theory::arith::float::rowsCopied", 0)
+  , d_floatFeasible("theory::arith::float::feasible", 0)
+  , d_floatInfeasible("theory::arith::float::infeasible", 0)
+  , d_floatExhausted("theory::arith::float::exhausted", 0)
+  , d_floatSolved("theory::arith::float::solved", 0)
+  , d_floatTimer("theory::arith::float::timer")
+  , d_parallelBBCalls("theory::arith::parallelBB::calls", 0)
+  , d_parallelBBNodes("theory::arith::parallelBB::nodes", 0)
+  , d_parallelBBPivots("theory::arith::parallelBB::pivots", 0)
+  , d_parallelBBInfeasible("theory::arith::parallelBB::infeasible", 0)
+  , d_parallelBBSolutions("theory::arith::parallelBB::solutions", 0)
+  , d_parallelBBUnknown("theory::arith::parallelBB::unknown", 0)
+  , d_parallelBBLemmas("theory::arith::parallelBB::lemmas", 0)
+  , d_parallelBBTimer("theory::arith::parallelBB::timer")
+  , d_warmStarts("theory::arith::warmStart::restores", 0)
+  , d_warmStartRestoredVars("theory::arith::warmStart::restoredVars", 0)
+  , d_warmStartViolatingVars("theory::arith::warmStart::violatingVars", 0)
+  , d_warmQueryPivots("theory::arith::warmStart::pivotsPerWarmQuery")
+  , d_coldQueryPivots("theory::arith::warmStart::pivotsPerColdQuery")
   , d_mipTimer("theory::arith::z::approx::mip::timer")
   , d_lpTimer("theory::arith::z::approx::lp::timer")
   , d_mipProofsAttempted("theory::arith::z::mip::proofs::attempted", 0)
@@ -339,6 +372,8 @@ TheoryArithPrivate::Statistics::Statistics()
   smtStatisticsRegistry()->registerStat(&d_boundComputationTime);
   smtStatisticsRegistry()->registerStat(&d_boundComputations);
   smtStatisticsRegistry()->registerStat(&d_boundPropagations);
+  smtStatisticsRegistry()->registerStat(&d_propRowsQueued);
+  smtStatisticsRegistry()->registerStat(&d_propRowsCarried);
 
   smtStatisticsRegistry()->registerStat(&d_unknownChecks);
   smtStatisticsRegistry()->registerStat(&d_maxUnknownsInARow);
@@ -401,6 +436,27 @@ TheoryArithPrivate::Statistics::Statistics()
 
   smtStatisticsRegistry()->registerStat(&d_solveIntModelsAttempts);
   smtStatisticsRegistry()->registerStat(&d_solveIntModelsSuccessful);
+  smtStatisticsRegistry()->registerStat(&d_floatCalls);
+  smtStatisticsRegistry()->registerStat(&d_floatPivots);
+  smtStatisticsRegistry()->registerStat(&d_floatRowsCopied);
+  smtStatisticsRegistry()->registerStat(&d_floatFeasible);
+  smtStatisticsRegistry()->registerStat(&d_floatInfeasible);
+  smtStatisticsRegistry()->registerStat(&d_floatExhausted);
+  smtStatisticsRegistry()->registerStat(&d_floatSolved);
+  smtStatisticsRegistry()->registerStat(&d_floatTimer);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBCalls);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBNodes);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBPivots);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBInfeasible);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBSolutions);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBUnknown);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBLemmas);
+  smtStatisticsRegistry()->registerStat(&d_parallelBBTimer);
+  smtStatisticsRegistry()->registerStat(&d_warmStarts);
+  smtStatisticsRegistry()->registerStat(&d_warmStartRestoredVars);
+  smtStatisticsRegistry()->registerStat(&d_warmStartViolatingVars);
+  smtStatisticsRegistry()->registerStat(&d_warmQueryPivots);
+  smtStatisticsRegistry()->registerStat(&d_coldQueryPivots);
   smtStatisticsRegistry()->registerStat(&d_mipTimer);
   smtStatisticsRegistry()->registerStat(&d_lpTimer);
   smtStatisticsRegistry()->registerStat(&d_mipProofsAttempted);
@@ -432,6 +488,8 @@ TheoryArithPrivate::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_boundComputationTime);
   smtStatisticsRegistry()->unregisterStat(&d_boundComputations);
   smtStatisticsRegistry()->unregisterStat(&d_boundPropagations);
+  smtStatisticsRegistry()->unregisterStat(&d_propRowsQueued);
+  smtStatisticsRegistry()->unregisterStat(&d_propRowsCarried);
 
   smtStatisticsRegistry()->unregisterStat(&d_unknownChecks);
   smtStatisticsRegistry()->unregisterStat(&d_maxUnknownsInARow);
@@ -495,6 +553,27 @@ TheoryArithPrivate::Statistics::~Statistics(){
 
   smtStatisticsRegistry()->unregisterStat(&d_solveIntModelsAttempts);
   smtStatisticsRegistry()->unregisterStat(&d_solveIntModelsSuccessful);
+  smtStatisticsRegistry()->unregisterStat(&d_floatCalls);
+  smtStatisticsRegistry()->unregisterStat(&d_floatPivots);
+  smtStatisticsRegistry()->unregisterStat(&d_floatRowsCopied);
+  smtStatisticsRegistry()->unregisterStat(&d_floatFeasible);
+  smtStatisticsRegistry()->unregisterStat(&d_floatInfeasible);
+  smtStatisticsRegistry()->unregisterStat(&d_floatExhausted);
+  smtStatisticsRegistry()->unregisterStat(&d_floatSolved);
+  smtStatisticsRegistry()->unregisterStat(&d_floatTimer);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBCalls);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBNodes);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBPivots);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBInfeasible);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBSolutions);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBUnknown);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBLemmas);
+  smtStatisticsRegistry()->unregisterStat(&d_parallelBBTimer);
+  smtStatisticsRegistry()->unregisterStat(&d_warmStarts);
+  smtStatisticsRegistry()->unregisterStat(&d_warmStartRestoredVars);
+  smtStatisticsRegistry()->unregisterStat(&d_warmStartViolatingVars);
+  smtStatisticsRegistry()->unregisterStat(&d_warmQueryPivots);
+  smtStatisticsRegistry()->unregisterStat(&d_coldQueryPivots);
   smtStatisticsRegistry()->unregisterStat(&d_mipTimer);
   smtStatisticsRegistry()->unregisterStat(&d_lpTimer);
   smtStatisticsRegistry()->unregisterStat(&d_mipProofsAttempted);
@@ -533,6 +612,7 @@ void TheoryArithPrivate::revertOutOfConflict(){
 
 void TheoryArithPrivate::clearUpdates(){
   d_updatedBounds.purge();
+  d_tightenedBounds.purge();
 }
 
 // void TheoryArithPrivate::raiseConflict(ConstraintCP a, ConstraintCP b){
@@ -691,6 +771,9 @@ bool TheoryArithPrivate::AssertLower(ConstraintP constraint){
   d_currentPropagationList.push_back(constraint);
   d_currentPropagationList.push_back(d_partialModel.getLowerBoundConstraint(x_i));
 
+  if(d_partialModel.hasLowerBound(x_i)){
+    d_tightenedBounds.softAdd(x_i);
+  }
   d_partialModel.setLowerBoundConstraint(constraint);
 
   if(d_cmEnabled){
@@ -831,6 +914,9 @@ bool TheoryArithPrivate::AssertUpper(ConstraintP constraint){
   d_currentPropagationList.push_back(d_partialModel.getUpperBoundConstraint(x_i));
   //It is fine if this is NullConstraint
 
+  if(d_partialModel.hasUpperBound(x_i)){
+    d_tightenedBounds.softAdd(x_i);
+  }
   d_partialModel.setUpperBoundConstraint(constraint);
 
   if(d_cmEnabled){
@@ -919,6 +1005,9 @@ bool TheoryArithPrivate::AssertEquality(ConstraintP constraint){
   d_currentPropagationList.push_back(d_partialModel.getLowerBoundConstraint(x_i));
   d_currentPropagationList.push_back(d_partialModel.getUpperBoundConstraint(x_i));
 
+  if(d_partialModel.hasLowerBound(x_i) || d_partialModel.hasUpperBound(x_i)){
+    d_tightenedBounds.softAdd(x_i);
+  }
   d_partialModel.setUpperBoundConstraint(constraint);
   d_partialModel.setLowerBoundConstraint(constraint);
 
@@ -1484,6 +1573,11 @@ void TheoryArithPrivate::releaseArithVar(ArithVar v){
 
   d_constraintDatabase.removeVariable(v);
   d_partialModel.releaseArithVar(v);
+  // v may be reclaimed for a different term
+  if (d_warmStartAssignment.isKey(v))
+  {
+    d_warmStartAssignment.remove(v);
+  }
 }
 
 ArithVar TheoryArithPrivate::requestArithVar(TNode x, bool aux, bool internal){
@@ -3044,6 +3138,95 @@ bool TheoryArithPrivate::solveRelaxationOrPanic(Theory::Effort effortLevel){
   return false;
 }
 
+Result::Sat TheoryArithPrivate::solveFloatRelaxation()
+{
+  if (d_errorSet.errorEmpty()
+      || d_tableau.getNumRows() < options::floatSimplexMinRows())
+  {
+    return Result::SAT_UNKNOWN;
+  }
+  TimerStat::CodeTimer codeTimer(d_statistics.d_floatTimer);
+  ++d_statistics.d_floatCalls;
+
+  FloatSimplex floatSimplex(d_partialModel, d_tableau);
+  floatSimplex.setPivotLimit(options::floatSimplexPivots());
+  LinResult res = floatSimplex.solve();
+  d_statistics.d_floatPivots += floatSimplex.getPivots();
+  d_statistics.d_floatRowsCopied += floatSimplex.getRowsCopied();
+  switch (res)
+  {
+    case LinFeasible: ++d_statistics.d_floatFeasible; break;
+    case LinInfeasible: ++d_statistics.d_floatInfeasible; break;
+    default: ++d_statistics.d_floatExhausted; break;
+  }
+  if (floatSimplex.getPivots() == 0)
+  {
+    return Result::SAT_UNKNOWN;
+  }
+
+  // the exact simplex verifies and repairs the basis of the float simplex
+  Result::Sat status =
+      d_attemptSolSimplex.attempt(floatSimplex.extractSolution());
+  if (status != Result::SAT_UNKNOWN)
+  {
+    ++d_statistics.d_floatSolved;
+  }
+  return status;
+}
+
+void TheoryArithPrivate::saveWarmStartAssignment()
+{
+  for (ArithVariables::var_iterator i = d_partialModel.var_begin(),
+                                    i_end = d_partialModel.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    d_warmStartAssignment.set(v, d_partialModel.getAssignment(v));
+  }
+}
+
+void TheoryArithPrivate::warmStart()
+{
+  // The tableau is not backtracked and pivoting does not change the linear
+  // equalities it encodes, so the saved assignment satisfies all rows that
+  // existed when it was saved. It suffices to restore the non-basic
+  // variables and let update() compute the basic ones. Variables whose saved
+  // value violates a current bound keep their current value and are left to
+  // the simplex to repair.
+  DenseMap<DeltaRational> restore;
+  uint32_t violating = 0;
+  for (DenseMap<DeltaRational>::const_iterator
+           i = d_warmStartAssignment.begin(),
+           i_end = d_warmStartAssignment.end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar v = *i;
+    if (d_tableau.isBasic(v))
+    {
+      continue;
+    }
+    const DeltaRational& value = d_warmStartAssignment[v];
+    if (d_partialModel.strictlyLessThanLowerBound(v, value)
+        || d_partialModel.strictlyGreaterThanUpperBound(v, value))
+    {
+      ++violating;
+    }
+    else if (value != d_partialModel.getAssignment(v))
+    {
+      restore.set(v, value);
+    }
+  }
+  Debug("arith::warmStart") << "warmStart: restoring " << restore.size()
+                            << " variables, " << violating
+                            << " violate the current bounds" << endl;
+  ++d_statistics.d_warmStarts;
+  d_statistics.d_warmStartRestoredVars += restore.size();
+  d_statistics.d_warmStartViolatingVars += violating;
+  d_linEq.updateMany(restore);
+}
+
 bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   TimerStat::CodeTimer codeTimer0(d_statistics.d_solveRealRelaxTimer);
   Assert(d_qflraStatus != Result::SAT);
@@ -3053,6 +3236,12 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   d_partialModel.processBoundsQueue(utcb);
   d_linEq.startTrackingBoundCounts();
 
+  if (d_warmStartPending)
+  {
+    d_warmStartPending = false;
+    warmStart();
+  }
+
   bool noPivotLimit = Theory::fullEffort(effortLevel) ||
     !options::restrictedPivots();
 
@@ -3069,7 +3258,15 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
     << endl;
 
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
-  d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  d_qflraStatus = Result::SAT_UNKNOWN;
+  if (options::floatSimplex())
+  {
+    d_qflraStatus = solveFloatRelaxation();
+  }
+  if (d_qflraStatus == Result::SAT_UNKNOWN)
+  {
+    d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  }
 
   Debug("TheoryArithPrivate::solveRealRelaxation")
     << "solveRealRelaxation()" << " pass1 " << d_qflraStatus << endl;
@@ -3419,6 +3616,10 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
     if(Debug.isOn("arith::consistency")){
       Assert(entireStateIsConsistent("sat comit"));
     }
+    if (options::arithWarmStart() && Theory::fullEffort(effortLevel))
+    {
+      saveWarmStartAssignment();
+    }
     if(useSimplex && options::collectPivots()){
       if(options::useFC()){
         d_statistics.d_satPivots << d_fcSimplex.getPivots();
@@ -3601,6 +3802,11 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
       }
     }
 
+    if (!emmittedConflictOrSplit && options::arithParallelBranching() > 0)
+    {
+      emmittedConflictOrSplit = parallelBranchAndBound();
+    }
+
     if(!emmittedConflictOrSplit) {
       Node possibleLemma = roundRobinBranch();
       if(!possibleLemma.isNull()){
@@ -3747,6 +3953,104 @@ Node TheoryArithPrivate::roundRobinBranch(){
   }
 }
 
+bool TheoryArithPrivate::parallelBranchAndBound()
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_parallelBBTimer);
+  ++d_statistics.d_parallelBBCalls;
+
+  // bounds the simplex of each node, which cannot cycle with Bland's rule
+  static const uint32_t pivotsPerNode = 100;
+  ParallelBranchAndBound bb(d_partialModel, d_tableau);
+  bb.setNodeLimit(options::arithParallelBranchingNodes());
+  bb.setPivotLimit(pivotsPerNode * options::arithParallelBranchingNodes());
+  std::vector<ParallelBranchAndBound::Result> results =
+      bb.run(options::arithParallelBranching());
+
+  const ParallelBranchAndBound::Result* solution = nullptr;
+  for (const ParallelBranchAndBound::Result& r : results)
+  {
+    d_statistics.d_parallelBBNodes += r.d_nodes;
+    d_statistics.d_parallelBBPivots += r.d_pivots;
+    switch (r.d_status)
+    {
+      case ParallelBranchAndBound::Status::INFEASIBLE:
+        ++d_statistics.d_parallelBBInfeasible;
+        break;
+      case ParallelBranchAndBound::Status::SOLUTION:
+        ++d_statistics.d_parallelBBSolutions;
+        solution = &r;
+        break;
+      case ParallelBranchAndBound::Status::UNKNOWN:
+        ++d_statistics.d_parallelBBUnknown;
+        break;
+    }
+  }
+
+  if (solution != nullptr)
+  {
+    // The solution satisfies the rows, so the non-basic variables determine
+    // it. The simplex only confirms that the error set is empty.
+    d_partialModel.stopQueueingBoundCounts();
+    UpdateTrackingCallback utcb(&d_linEq);
+    d_partialModel.processBoundsQueue(utcb);
+    d_linEq.startTrackingBoundCounts();
+
+    DenseMap<DeltaRational> values;
+    for (var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi)
+    {
+      ArithVar v = *vi;
+      if (!d_tableau.isBasic(v)
+          && solution->d_solution[v] != d_partialModel.getAssignment(v))
+      {
+        values.set(v, solution->d_solution[v]);
+      }
+    }
+    d_linEq.updateMany(values);
+    d_qflraStatus = selectSimplex(false).findModel(false);
+    Assert(d_qflraStatus == Result::SAT);
+
+    d_linEq.stopTrackingBoundCounts();
+    d_partialModel.startQueueingBoundCounts();
+    d_partialModel.commitAssignmentChanges();
+    // the disequalities were only checked against the old assignment
+    return splitDisequalities();
+  }
+
+  // workers that share a prefix may prove the same subtree infeasible
+  std::set<Node> lemmas;
+  NodeManager* nm = NodeManager::currentNM();
+  for (const ParallelBranchAndBound::Result& r : results)
+  {
+    if (r.d_status != ParallelBranchAndBound::Status::INFEASIBLE)
+    {
+      continue;
+    }
+    NodeBuilder<> nb(kind::AND);
+    for (const ParallelBranchAndBound::BoundRef& bound : r.d_explanation)
+    {
+      ConstraintP c = bound.second
+                          ? d_partialModel.getUpperBoundConstraint(bound.first)
+                          : d_partialModel.getLowerBoundConstraint(bound.first);
+      c->externalExplainByAssertions(nb);
+    }
+    for (const ParallelBranchAndBound::Branch& branch : r.d_path)
+    {
+      Node ub = Rewriter::rewrite(nm->mkNode(kind::LEQ,
+                                             d_partialModel.asNode(branch.d_var),
+                                             mkRationalNode(branch.d_value)));
+      nb << (branch.d_up ? ub.negate() : ub);
+    }
+    lemmas.insert(safeConstructNary(nb).negate());
+  }
+  for (const Node& lem : lemmas)
+  {
+    Debug("arith::lemma") << "parallel branch and bound lemma " << lem << endl;
+    ++d_statistics.d_parallelBBLemmas;
+    outputLemma(lem);
+  }
+  return !lemmas.empty();
+}
+
 bool TheoryArithPrivate::splitDisequalities(){
   bool splitSomething = false;
 
@@ -4201,6 +4505,21 @@ void TheoryArithPrivate::presolve(){
 
   d_statistics.d_initialTableauSize.setData(d_tableau.size());
 
+  // a new query starts
+  uint32_t pivots = d_linEq.getPivotCount();
+  if (d_queryCount > 0)
+  {
+    AverageStat& queryPivots = d_queryWarmStarted
+                                   ? d_statistics.d_warmQueryPivots
+                                   : d_statistics.d_coldQueryPivots;
+    queryPivots.addEntry(pivots - d_queryPivotsStart);
+  }
+  ++d_queryCount;
+  d_queryPivotsStart = pivots;
+  d_warmStartPending =
+      options::arithWarmStart() && !d_warmStartAssignment.empty();
+  d_queryWarmStarted = d_warmStartPending;
+
   if(Debug.isOn("paranoid:check_tableau")){ d_linEq.debugCheckTableau(); }
 
   static thread_local unsigned callCount = 0;
@@ -4423,18 +4742,33 @@ void TheoryArithPrivate::propagateCandidatesNew(){
   Debug("arith::prop") << "propagateCandidatesNew begin" << endl;
 
   Assert(d_qflraStatus == Result::SAT);
-  if(d_updatedBounds.empty()){ return; }
+  if(d_updatedBounds.empty() && d_candidateRows.empty()){ return; }
+
+  // Bringing the bound counts up to date queues the rows on which a
+  // propagation may have become possible.
+  UpdateTrackingCallback utcb(&d_linEq);
+  d_partialModel.processBoundsQueue(utcb);
+
   dumpUpdatedBoundsToRows();
   Assert(d_updatedBounds.empty());
 
-  if(!d_candidateRows.empty()){
-    UpdateTrackingCallback utcb(&d_linEq);
-    d_partialModel.processBoundsQueue(utcb);
-  }
-
+  // the rows that do not fit into the work limit are kept for the next round
+  uint32_t work = 0;
+  uint32_t workLimit = options::arithPropagateWorkLimit();
   while(!d_candidateRows.empty()){
+    if (workLimit > 0 && work >= workLimit)
+    {
+      d_statistics.d_propRowsCarried += d_candidateRows.size();
+      break;
+    }
     RowIndex candidate = d_candidateRows.back();
     d_candidateRows.pop_back();
+    if (!d_linEq.rowIndexIsTracked(candidate))
+    {
+      // the row has been removed since it was queued
+      continue;
+    }
+    work += d_tableau.getRowLength(candidate);
     propagateCandidateRow(candidate);
   }
   Debug("arith::prop") << "propagateCandidatesNew end" << endl << endl << endl;
@@ -4664,9 +4998,19 @@ bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx){
 }
 
 void TheoryArithPrivate::dumpUpdatedBoundsToRows(){
-  Assert(d_candidateRows.empty());
-  DenseSet::const_iterator i = d_updatedBounds.begin();
-  DenseSet::const_iterator end = d_updatedBounds.end();
+  // The rows whose bound counts reached the threshold were queued when the
+  // counts were updated. A bound that replaces a weaker one of the same kind
+  // leaves the counts unchanged, so the rows of such variables are added
+  // here.
+  DenseSet& queued = d_linEq.getPropagationRows();
+  d_statistics.d_propRowsQueued += queued.size();
+  for(DenseSet::const_iterator i = queued.begin(), end = queued.end(); i != end; ++i){
+    d_candidateRows.softAdd(*i);
+  }
+  queued.purge();
+
+  DenseSet::const_iterator i = d_tightenedBounds.begin();
+  DenseSet::const_iterator end = d_tightenedBounds.end();
   for(; i != end; ++i){
     ArithVar var = *i;
     if(d_tableau.isBasic(var)){
@@ -4681,6 +5025,7 @@ void TheoryArithPrivate::dumpUpdatedBoundsToRows(){
       }
     }
   }
+  d_tightenedBounds.purge();
   d_updatedBounds.purge();
 }
 
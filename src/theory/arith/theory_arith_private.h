@@ -377,6 +377,13 @@ public:
 
   bool solveRealRelaxation(Theory::Effort effortLevel);
 
+  /**
+   * Runs the floating-point simplex (see FloatSimplex) and imports its basis
+   * and assignment into the tableau. Returns UNSAT or SAT if this already
+   * decided the relaxation, and SAT_UNKNOWN otherwise.
+   */
+  Result::Sat solveFloatRelaxation();
+
   /* Returns true if this is heuristically a good time to try
    * to solve the integers.
    */
@@ -542,6 +549,14 @@ private:
    */
   Node roundRobinBranch();
 
+  /**
+   * Runs ParallelBranchAndBound on the current bounds. If a worker finds an
+   * integer solution, it becomes the assignment. Each subtree that a worker
+   * proves infeasible is excluded by a lemma. Returns true if a lemma or a
+   * disequality split was issued.
+   */
+  bool parallelBranchAndBound();
+
 public:
   /**
    * This requests a new unique ArithVar value for x.
@@ -588,6 +603,12 @@ private:
   /** Tracks the bounds that were updated in the current round. */
   DenseSet d_updatedBounds;
 
+  /**
+   * The variables in d_updatedBounds whose new bound replaced one of the
+   * same kind, which leaves the bound counts of their rows unchanged.
+   */
+  DenseSet d_tightenedBounds;
+
   /** Tracks the basic variables where propagation might be possible. */
   DenseSet d_candidateBasics;
   DenseSet d_candidateRows;
@@ -750,6 +771,30 @@ private:
 
   RationalVector d_farkasBuffer;
 
+  /**
+   * Saves the assignment of all variables into d_warmStartAssignment. This
+   * is called after each full effort check that is sat.
+   */
+  void saveWarmStartAssignment();
+
+  /**
+   * Restores the non-basic variables to the values of
+   * d_warmStartAssignment that are within their current bounds. This is
+   * called at the first simplex search of a query.
+   */
+  void warmStart();
+
+  /** The assignment of the last full effort check that was sat. */
+  DenseMap<DeltaRational> d_warmStartAssignment;
+  /** Whether the current query still needs to call warmStart(). */
+  bool d_warmStartPending;
+  /** Whether the current query was warm started. */
+  bool d_queryWarmStarted;
+  /** The number of queries so far, i.e., calls to presolve(). */
+  uint32_t d_queryCount;
+  /** The number of pivots at the start of the current query. */
+  uint32_t d_queryPivotsStart;
+
   /** These fields are designed to be accessible to TheoryArith methods. */
   class Statistics {
   public:
@@ -774,6 +819,7 @@ private:
 
     TimerStat d_boundComputationTime;
     IntStat d_boundComputations, d_boundPropagations;
+    IntStat d_propRowsQueued, d_propRowsCarried;
 
     IntStat d_unknownChecks;
     IntStat d_maxUnknownsInARow;
@@ -836,6 +882,34 @@ private:
 
     IntStat d_solveIntModelsAttempts;
     IntStat d_solveIntModelsSuccessful;
+
+    /** Statistics of the floating-point simplex. */
+    IntStat d_floatCalls;
+    IntStat d_floatPivots;
+    IntStat d_floatRowsCopied;
+    IntStat d_floatFeasible;
+    IntStat d_floatInfeasible;
+    IntStat d_floatExhausted;
+    IntStat d_floatSolved;
+    TimerStat d_floatTimer;
+
+    /** Statistics of the parallel branch and bound. */
+    IntStat d_parallelBBCalls;
+    IntStat d_parallelBBNodes;
+    IntStat d_parallelBBPivots;
+    IntStat d_parallelBBInfeasible;
+    IntStat d_parallelBBSolutions;
+    IntStat d_parallelBBUnknown;
+    IntStat d_parallelBBLemmas;
+    TimerStat d_parallelBBTimer;
+
+    /** Statistics of warm starting the simplex across queries. */
+    IntStat d_warmStarts;
+    IntStat d_warmStartRestoredVars;
+    IntStat d_warmStartViolatingVars;
+    AverageStat d_warmQueryPivots;
+    AverageStat d_coldQueryPivots;
+
     TimerStat d_mipTimer;
     TimerStat d_lpTimer;
 
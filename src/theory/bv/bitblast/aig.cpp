@@ -0,0 +1,237 @@
+/*********************                                                        */
+/*! \file aig.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief And-inverter graphs for bit-blasting
+ **
+ ** And-inverter graphs for bit-blasting.
+ **/
+
+#include "theory/bv/bitblast/aig.h"
+
+#include <ostream>
+#include <utility>
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+std::ostream& operator<<(std::ostream& out, AigEdge e)
+{
+  if (e.isConst())
+  {
+    return out << (e.isComplemented() ? "true" : "false");
+  }
+  return out << (e.isComplemented() ? "~a" : "a") << e.getNode();
+}
+
+AigManager::AigManager()
+    : d_nodes(),
+      d_strash(),
+      d_numAnds(0),
+      d_numHashHits(0),
+      d_numConstFolds(0),
+      d_numRewrites(0)
+{
+  // the constant false
+  d_nodes.emplace_back(s_noChild, s_noChild);
+}
+
+AigEdge AigManager::mkInput()
+{
+  uint32_t node = d_nodes.size();
+  d_nodes.emplace_back(s_noChild, s_noChild);
+  return AigEdge(node, false);
+}
+
+AigEdge AigManager::mkAnd(AigEdge a, AigEdge b)
+{
+  // one-level rules
+  if (a == b)
+  {
+    ++d_numConstFolds;
+    return a;
+  }
+  if (a == ~b || a == AigEdge::mkFalse() || b == AigEdge::mkFalse())
+  {
+    ++d_numConstFolds;
+    return AigEdge::mkFalse();
+  }
+  if (a == AigEdge::mkTrue())
+  {
+    ++d_numConstFolds;
+    return b;
+  }
+  if (b == AigEdge::mkTrue())
+  {
+    ++d_numConstFolds;
+    return a;
+  }
+
+  // two-level rules
+  AigEdge result;
+  bool aIsAnd = isAnd(a.getNode());
+  bool bIsAnd = isAnd(b.getNode());
+  if ((aIsAnd && rewriteAsymmetric(a, b, result))
+      || (bIsAnd && rewriteAsymmetric(b, a, result))
+      || (aIsAnd && bIsAnd && rewriteSymmetric(a, b, result)))
+  {
+    ++d_numRewrites;
+    return result;
+  }
+
+  // structural hashing
+  if (b < a)
+  {
+    std::swap(a, b);
+  }
+  uint64_t key = static_cast<uint64_t>(a.getLiteral()) << 32 | b.getLiteral();
+  std::unordered_map<uint64_t, uint32_t>::const_iterator it =
+      d_strash.find(key);
+  if (it != d_strash.end())
+  {
+    ++d_numHashHits;
+    return AigEdge(it->second, false);
+  }
+  uint32_t node = d_nodes.size();
+  d_nodes.emplace_back(a.getLiteral(), b.getLiteral());
+  d_strash.emplace(key, node);
+  ++d_numAnds;
+  return AigEdge(node, false);
+}
+
+bool AigManager::rewriteAsymmetric(AigEdge a, AigEdge b, AigEdge& result)
+{
+  AigEdge a0 = getChild0(a.getNode());
+  AigEdge a1 = getChild1(a.getNode());
+  if (!a.isComplemented())
+  {
+    // contradiction: (a0 & a1) & ~a0 = false
+    if (a0 == ~b || a1 == ~b)
+    {
+      result = AigEdge::mkFalse();
+      return true;
+    }
+    // idempotence: (a0 & a1) & a0 = a0 & a1
+    if (a0 == b || a1 == b)
+    {
+      result = a;
+      return true;
+    }
+    return false;
+  }
+  // subsumption: ~(a0 & a1) & ~a0 = ~a0
+  if (a0 == ~b || a1 == ~b)
+  {
+    result = b;
+    return true;
+  }
+  // substitution: ~(a0 & a1) & a0 = ~a1 & a0
+  if (a0 == b)
+  {
+    result = mkAnd(~a1, b);
+    return true;
+  }
+  if (a1 == b)
+  {
+    result = mkAnd(~a0, b);
+    return true;
+  }
+  return false;
+}
+
+bool AigManager::rewriteSymmetric(AigEdge a, AigEdge b, AigEdge& result)
+{
+  AigEdge a0 = getChild0(a.getNode());
+  AigEdge a1 = getChild1(a.getNode());
+  AigEdge b0 = getChild0(b.getNode());
+  AigEdge b1 = getChild1(b.getNode());
+  if (!a.isComplemented() && !b.isComplemented())
+  {
+    // contradiction: (a0 & a1) & (~a0 & b1) = false
+    if (a0 == ~b0 || a0 == ~b1 || a1 == ~b0 || a1 == ~b1)
+    {
+      result = AigEdge::mkFalse();
+      return true;
+    }
+    return false;
+  }
+  if (a.isComplemented() && b.isComplemented())
+  {
+    // resolution: ~(a0 & a1) & ~(a0 & ~a1) = ~a0
+    if ((a0 == b0 && a1 == ~b1) || (a0 == b1 && a1 == ~b0))
+    {
+      result = ~a0;
+      return true;
+    }
+    if ((a1 == b0 && a0 == ~b1) || (a1 == b1 && a0 == ~b0))
+    {
+      result = ~a1;
+      return true;
+    }
+    return false;
+  }
+  if (b.isComplemented())
+  {
+    std::swap(a, b);
+    std::swap(a0, b0);
+    std::swap(a1, b1);
+  }
+  // subsumption: ~(a0 & a1) & (~a0 & b1) = ~a0 & b1
+  if (a0 == ~b0 || a0 == ~b1 || a1 == ~b0 || a1 == ~b1)
+  {
+    result = b;
+    return true;
+  }
+  // substitution: ~(a0 & a1) & (a0 & b1) = ~a1 & (a0 & b1)
+  if (a0 == b0 || a0 == b1)
+  {
+    result = mkAnd(~a1, b);
+    return true;
+  }
+  if (a1 == b0 || a1 == b1)
+  {
+    result = mkAnd(~a0, b);
+    return true;
+  }
+  return false;
+}
+
+AigEdge AigManager::mkXor(AigEdge a, AigEdge b)
+{
+  return mkOr(mkAnd(a, ~b), mkAnd(~a, b));
+}
+
+AigEdge AigManager::mkIte(AigEdge c, AigEdge a, AigEdge b)
+{
+  if (a == b)
+  {
+    return a;
+  }
+  return mkOr(mkAnd(c, a), mkAnd(~c, b));
+}
+
+void AigManager::evaluate(std::vector<bool>& values) const
+{
+  Assert(values.size() == d_nodes.size());
+  values[0] = false;
+  for (uint32_t node = 1, n = d_nodes.size(); node < n; ++node)
+  {
+    if (isAnd(node))
+    {
+      values[node] = getValue(values, getChild0(node))
+                     && getValue(values, getChild1(node));
+    }
+  }
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
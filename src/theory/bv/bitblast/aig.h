@@ -0,0 +1,179 @@
+/*********************                                                        */
+/*! \file aig.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief And-inverter graphs for bit-blasting
+ **
+ ** An AigManager stores an and-inverter graph as an array of two-input AND
+ ** gates and inputs. Edges are literals, i.e. a node index and a complement
+ ** bit, so negation is free. New gates are structurally hashed, and the
+ ** constant and two-level rewriting rules of Brummayer and Biere ("Local
+ ** Two-Level And-Inverter Graph Minimization without Blowup", MEMICS 2006)
+ ** are applied before a gate is created.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__BV__BITBLAST__AIG_H
+#define CVC4__THEORY__BV__BITBLAST__AIG_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+#include "base/check.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+/**
+ * An edge of an and-inverter graph: the index of its target node and whether
+ * the edge is complemented. Node 0 is the constant false.
+ */
+class AigEdge
+{
+ public:
+  AigEdge() : d_literal(0) {}
+  AigEdge(uint32_t node, bool complemented)
+      : d_literal(node << 1 | (complemented ? 1 : 0))
+  {
+  }
+
+  /** The index of the node of this edge */
+  uint32_t getNode() const { return d_literal >> 1; }
+  /** Whether this edge negates its node */
+  bool isComplemented() const { return d_literal & 1; }
+  /** Returns the node index times 2 plus the complement bit. */
+  uint32_t getLiteral() const { return d_literal; }
+  /** Whether this is the edge to the constant node */
+  bool isConst() const { return getNode() == 0; }
+
+  /** Returns the negation of this edge. */
+  AigEdge operator~() const { return fromLiteral(d_literal ^ 1); }
+
+  bool operator==(AigEdge e) const { return d_literal == e.d_literal; }
+  bool operator!=(AigEdge e) const { return d_literal != e.d_literal; }
+  bool operator<(AigEdge e) const { return d_literal < e.d_literal; }
+
+  static AigEdge mkFalse() { return AigEdge(); }
+  static AigEdge mkTrue() { return fromLiteral(1); }
+  static AigEdge fromLiteral(uint32_t literal)
+  {
+    AigEdge e;
+    e.d_literal = literal;
+    return e;
+  }
+
+ private:
+  uint32_t d_literal;
+}; /* class AigEdge */
+
+std::ostream& operator<<(std::ostream& out, AigEdge e);
+
+class AigManager
+{
+ public:
+  AigManager();
+
+  /** Creates a new input. */
+  AigEdge mkInput();
+  /** Returns an edge equivalent to a and b, creating a gate if needed. */
+  AigEdge mkAnd(AigEdge a, AigEdge b);
+  AigEdge mkOr(AigEdge a, AigEdge b) { return ~mkAnd(~a, ~b); }
+  AigEdge mkXor(AigEdge a, AigEdge b);
+  AigEdge mkIte(AigEdge c, AigEdge a, AigEdge b);
+
+  /** The number of nodes, including the constant and the inputs */
+  size_t getNumNodes() const { return d_nodes.size(); }
+  /** Whether node is an AND gate */
+  bool isAnd(uint32_t node) const
+  {
+    Assert(node < d_nodes.size());
+    return d_nodes[node].d_child0 != s_noChild;
+  }
+  /** Whether node is an input */
+  bool isInput(uint32_t node) const { return node != 0 && !isAnd(node); }
+  /** The children of the AND gate node */
+  AigEdge getChild0(uint32_t node) const
+  {
+    Assert(isAnd(node));
+    return AigEdge::fromLiteral(d_nodes[node].d_child0);
+  }
+  AigEdge getChild1(uint32_t node) const
+  {
+    Assert(isAnd(node));
+    return AigEdge::fromLiteral(d_nodes[node].d_child1);
+  }
+
+  /**
+   * Computes the values of the gates from the values of the inputs. The
+   * children of a gate are created before it, so one pass in index order
+   * suffices.
+   *
+   * @param values the values of the nodes indexed by node, of which only the
+   * entries of the inputs are read
+   */
+  void evaluate(std::vector<bool>& values) const;
+  /** Returns the value of e under the node values computed by evaluate. */
+  static bool getValue(const std::vector<bool>& values, AigEdge e)
+  {
+    return values[e.getNode()] != e.isComplemented();
+  }
+
+  /** The number of gates that were created */
+  size_t getNumAnds() const { return d_numAnds; }
+  /** The number of gates that were found in the structural hash table */
+  size_t getNumHashHits() const { return d_numHashHits; }
+  /** The number of gates folded by the one-level (constant) rules */
+  size_t getNumConstFolds() const { return d_numConstFolds; }
+  /** The number of gates simplified by the two-level rules */
+  size_t getNumRewrites() const { return d_numRewrites; }
+
+ private:
+  /** The child of the constant and of the inputs */
+  static const uint32_t s_noChild = UINT32_MAX;
+
+  struct AigNode
+  {
+    AigNode(uint32_t child0, uint32_t child1)
+        : d_child0(child0), d_child1(child1)
+    {
+    }
+    /** The literals of the children with d_child0 < d_child1 */
+    uint32_t d_child0;
+    uint32_t d_child1;
+  };
+
+  /**
+   * Applies the two-level rules to a and b where a is an edge to an AND
+   * gate. Returns true and sets result if one of the rules applies.
+   */
+  bool rewriteAsymmetric(AigEdge a, AigEdge b, AigEdge& result);
+  /** Same as above where a and b are both edges to AND gates. */
+  bool rewriteSymmetric(AigEdge a, AigEdge b, AigEdge& result);
+
+  /** The nodes, the constant false at index 0 */
+  std::vector<AigNode> d_nodes;
+  /** The structural hash table from the pair of children to the gate */
+  std::unordered_map<uint64_t, uint32_t> d_strash;
+
+  size_t d_numAnds;
+  size_t d_numHashHits;
+  size_t d_numConstFolds;
+  size_t d_numRewrites;
+}; /* class AigManager */
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__BV__BITBLAST__AIG_H */
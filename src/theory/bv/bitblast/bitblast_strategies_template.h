@@ -23,6 +23,7 @@
 #include <ostream>
 
 #include "expr/node.h"
+#include "options/bv_options.h"
 #include "theory/bv/bitblast/bitblast_utils.h"
 #include "theory/bv/theory_bv_utils.h"
 #include "theory/rewriter.h"
@@ -378,15 +379,21 @@ void DefaultMultBB (TNode node, std::vector<T>& res, TBitblaster<T>* bb) {
     
   // }
   
+  // the encoding is chosen by the width of the node
+  options::BvMultiplierMode mode = options::bvMultiplier();
+  if (utils::getSize(node) < options::bvMultiplierMinWidth()) {
+    mode = options::BvMultiplierMode::SHIFT_ADD;
+  }
+  unsigned karatsuba_width = options::bvKaratsubaWidth();
+
   std::vector<T> newres; 
   bb->bbTerm(node[0], res); 
   for(unsigned i = 1; i < node.getNumChildren(); ++i) {
     std::vector<T> current;
     bb->bbTerm(node[i], current);
     newres.clear(); 
-    // constructs a simple shift and add multiplier building the result
-    // in res
-    shiftAddMultiplier(res, current, newres);
+    // constructs a multiplier building the result in res
+    multiplier(res, current, res.size(), mode, karatsuba_width, newres);
     res = newres;
   }
   if(Debug.isOn("bitvector-bb")) {
@@ -512,19 +519,64 @@ void uDivModRec(const std::vector<T>& a, const std::vector<T>& b, std::vector<T>
 
 }
 
+/**
+ * Constructs a non-restoring divider. The partial remainder is kept in two's
+ * complement with one bit more than the operands, and each step adds or
+ * subtracts b with one adder, depending on the sign of the previous partial
+ * remainder, instead of subtracting b and selecting the old or the new
+ * remainder. For b = 0 every step subtracts 0, which yields the quotient
+ * 11..11 and the remainder a without a special case.
+ */
 template <class T>
-void DefaultUdivBB(TNode node, std::vector<T>& q, TBitblaster<T>* bb)
-{
-  Debug("bitvector-bb") << "theory::bv::DefaultUdivBB bitblasting " << node
-                        << "\n";
-  Assert(node.getKind() == kind::BITVECTOR_UDIV_TOTAL && q.size() == 0);
+void nonRestoringDivider(const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& q, std::vector<T>& r) {
+  Assert(q.size() == 0 && r.size() == 0 && a.size() == b.size());
+  unsigned n = a.size();
+
+  std::vector<T> b_ext;
+  resizeBits(b, n + 1, b_ext);
+  std::vector<T> rem;
+  makeZero(rem, n + 1);
+  T negative = mkFalse<T>();
+  q.resize(n);
+  for (int i = n - 1; i >= 0; --i) {
+    // rem = 2 * rem + a[i] - b if rem >= 0 and 2 * rem + a[i] + b otherwise
+    std::vector<T> shifted;
+    shifted.push_back(a[i]);
+    shifted.insert(shifted.end(), rem.begin(), rem.end() - 1);
+    T subtract = mkNot(negative);
+    std::vector<T> addend;
+    for (unsigned j = 0; j <= n; ++j) {
+      addend.push_back(mkXor(b_ext[j], subtract));
+    }
+    rem.clear();
+    rippleCarryAdder(shifted, addend, rem, subtract);
+    negative = rem[n];
+    q[i] = mkNot(negative);
+  }
 
-  std::vector<T> a, b;
-  bb->bbTerm(node[0], a);
-  bb->bbTerm(node[1], b);
+  // a negative remainder is corrected by adding b
+  std::vector<T> rem_low, correction;
+  extractBits(rem, rem_low, 0, n - 1);
+  for (unsigned j = 0; j < n; ++j) {
+    correction.push_back(mkAnd(b[j], negative));
+  }
+  rippleCarryAdder(rem_low, correction, r, mkFalse<T>());
+}
 
-  std::vector<T> r;
-  uDivModRec(a, b, q, r, utils::getSize(node));
+/**
+ * Constructs the quotient q and the remainder r of a and b with the divider
+ * chosen by the width of a, where a udiv 0 is 11..11 and a urem 0 is a.
+ */
+template <class T>
+void uDivModBB(const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& q, std::vector<T>& r) {
+  if (options::bvDivider() == options::BvDividerMode::NON_RESTORING
+      && a.size() >= options::bvDividerMinWidth())
+  {
+    nonRestoringDivider(a, b, q, r);
+    return;
+  }
+
+  uDivModRec(a, b, q, r, a.size());
   // adding a special case for division by 0
   std::vector<T> iszero;
   for (unsigned i = 0; i < b.size(); ++i)
@@ -538,6 +590,21 @@ void DefaultUdivBB(TNode node, std::vector<T>& q, TBitblaster<T>* bb)
     q[i] = mkIte(b_is_0, mkTrue<T>(), q[i]);  // a udiv 0 is 11..11
     r[i] = mkIte(b_is_0, a[i], r[i]);         // a urem 0 is a
   }
+}
+
+template <class T>
+void DefaultUdivBB(TNode node, std::vector<T>& q, TBitblaster<T>* bb)
+{
+  Debug("bitvector-bb") << "theory::bv::DefaultUdivBB bitblasting " << node
+                        << "\n";
+  Assert(node.getKind() == kind::BITVECTOR_UDIV_TOTAL && q.size() == 0);
+
+  std::vector<T> a, b;
+  bb->bbTerm(node[0], a);
+  bb->bbTerm(node[1], b);
+
+  std::vector<T> r;
+  uDivModBB(a, b, q, r);
 
   // cache the remainder in case we need it later
   Node remainder = Rewriter::rewrite(NodeManager::currentNM()->mkNode(
@@ -557,20 +624,7 @@ void DefaultUremBB(TNode node, std::vector<T>& rem, TBitblaster<T>* bb)
   bb->bbTerm(node[1], b);
 
   std::vector<T> q;
-  uDivModRec(a, b, q, rem, utils::getSize(node));
-  // adding a special case for division by 0
-  std::vector<T> iszero;
-  for (unsigned i = 0; i < b.size(); ++i)
-  {
-    iszero.push_back(mkIff(b[i], mkFalse<T>()));
-  }
-  T b_is_0 = mkAnd(iszero);
-
-  for (unsigned i = 0; i < q.size(); ++i)
-  {
-    q[i] = mkIte(b_is_0, mkTrue<T>(), q[i]);  // a udiv 0 is 11..11
-    rem[i] = mkIte(b_is_0, a[i], rem[i]);     // a urem 0 is a
-  }
+  uDivModBB(a, b, q, rem);
 
   // cache the quotient in case we need it later
   Node quotient = Rewriter::rewrite(NodeManager::currentNM()->mkNode(
@@ -20,8 +20,10 @@
 #define CVC4__THEORY__BV__BITBLAST__BITBLAST_UTILS_H
 
 
+#include <algorithm>
 #include <ostream>
 #include "expr/node.h"
+#include "options/bv_options.h"
 
 namespace CVC4 {
 namespace theory {
@@ -220,6 +222,227 @@ inline void shiftAddMultiplier(const std::vector<T>&a, const std::vector<T>&b, s
   }
 }
 
+/**
+ * Adds the bits a, b and c.
+ *
+ * @param sum the sum bit
+ *
+ * @return the carry bit
+ */
+template <class T>
+T inline fullAdder(T a, T b, T c, T& sum) {
+  T a_xor_b = mkXor(a, b);
+  sum = mkXor(a_xor_b, c);
+  return mkOr(mkAnd(a, b), mkAnd(a_xor_b, c));
+}
+
+/**
+ * Adds the bits a and b.
+ *
+ * @param sum the sum bit
+ *
+ * @return the carry bit
+ */
+template <class T>
+T inline halfAdder(T a, T b, T& sum) {
+  sum = mkXor(a, b);
+  return mkAnd(a, b);
+}
+
+/**
+ * Truncates or zero-extends bits to width bits.
+ */
+template <class T>
+void inline resizeBits(const std::vector<T>& bits, unsigned width, std::vector<T>& res) {
+  Assert(res.size() == 0);
+  for (unsigned i = 0; i < width; ++i) {
+    res.push_back(i < bits.size() ? bits[i] : mkFalse<T>());
+  }
+}
+
+/**
+ * Adds (or subtracts) a and b modulo 2^width, zero-extending both.
+ */
+template <class T>
+void inline addBits(const std::vector<T>& a, const std::vector<T>& b, unsigned width, std::vector<T>& res, bool subtract = false) {
+  std::vector<T> a_ext, b_ext;
+  resizeBits(a, width, a_ext);
+  resizeBits(b, width, b_ext);
+  if (subtract) {
+    std::vector<T> not_b;
+    negateBits(b_ext, not_b);
+    rippleCarryAdder(a_ext, not_b, res, mkTrue<T>());
+  } else {
+    rippleCarryAdder(a_ext, b_ext, res, mkFalse<T>());
+  }
+}
+
+/**
+ * Constructs a multiplier that sums the partial products column by column
+ * with full and half adders and adds the two remaining rows with a ripple
+ * carry adder. A Wallace tree reduces every column as much as possible in
+ * each stage, a Dadda tree only as much as needed to reach the height of the
+ * next stage, which saves half adders. Partial products with a constant
+ * false factor are left out.
+ *
+ * @param a first factor
+ * @param b second factor
+ * @param width the number of bits of the product that are computed
+ * @param dadda whether to build a Dadda tree instead of a Wallace tree
+ * @param res the lowest width bits of the product
+ */
+template <class T>
+inline void treeMultiplier(const std::vector<T>& a, const std::vector<T>& b, unsigned width, bool dadda, std::vector<T>& res) {
+  Assert(res.size() == 0);
+  std::vector<std::vector<T> > columns(width);
+  for (unsigned i = 0; i < a.size() && i < width; ++i) {
+    if (a[i] == mkFalse<T>()) {
+      continue;
+    }
+    for (unsigned j = 0; j < b.size() && i + j < width; ++j) {
+      if (b[j] != mkFalse<T>()) {
+        columns[i + j].push_back(mkAnd(a[i], b[j]));
+      }
+    }
+  }
+
+  size_t height = 0;
+  for (const std::vector<T>& column : columns) {
+    height = std::max(height, column.size());
+  }
+  // the heights of the stages of a Dadda tree: 2, 3, 4, 6, 9, 13, ...
+  std::vector<size_t> stages(1, 2);
+  while (stages.back() < height) {
+    stages.push_back(stages.back() * 3 / 2);
+  }
+
+  while (height > 2) {
+    while (stages.back() >= height) {
+      stages.pop_back();
+    }
+    size_t target = stages.back();
+    // the columns of the next stage, starting with the carries of this stage
+    std::vector<std::vector<T> > next(width);
+    for (unsigned i = 0; i < width; ++i) {
+      const std::vector<T>& column = columns[i];
+      size_t k = 0;
+      size_t h = column.size() + next[i].size();
+      while (column.size() - k >= 2) {
+        T sum, carry;
+        if (dadda ? h >= target + 2 && column.size() - k >= 3
+                  : column.size() - k >= 3) {
+          carry = fullAdder(column[k], column[k + 1], column[k + 2], sum);
+          k += 3;
+          h -= 2;
+        } else if (!dadda || h > target) {
+          carry = halfAdder(column[k], column[k + 1], sum);
+          k += 2;
+          h -= 1;
+        } else {
+          break;
+        }
+        next[i].push_back(sum);
+        if (i + 1 < width) {
+          next[i + 1].push_back(carry);
+        }
+      }
+      next[i].insert(next[i].end(), column.begin() + k, column.end());
+    }
+    columns.swap(next);
+    size_t new_height = 0;
+    for (const std::vector<T>& column : columns) {
+      new_height = std::max(new_height, column.size());
+    }
+    Assert(new_height < height);
+    height = new_height;
+  }
+
+  std::vector<T> row0, row1;
+  for (const std::vector<T>& column : columns) {
+    row0.push_back(column.size() > 0 ? column[0] : mkFalse<T>());
+    row1.push_back(column.size() > 1 ? column[1] : mkFalse<T>());
+  }
+  rippleCarryAdder(row0, row1, res, mkFalse<T>());
+}
+
+/**
+ * Constructs a multiplier of a and b with the given encoding. Factors of at
+ * least karatsuba_width bits (if not 0) are split into halves a = a1 a0 and
+ * b = b1 b0. The low half of the product only needs a0 * b0 and the cross
+ * products a1 * b0 + a0 * b1 truncated, while the full products of the
+ * halves are computed from the three products a0 * b0, a1 * b1 and
+ * (a0 + a1) * (b0 + b1) (Karatsuba).
+ *
+ * @param a first factor
+ * @param b second factor
+ * @param width the number of bits of the product that are computed
+ * @param mode the encoding of the products that are not split
+ * @param karatsuba_width the width of the factors from which on they are split
+ * @param res the lowest width bits of the product
+ */
+template <class T>
+inline void multiplier(const std::vector<T>& a, const std::vector<T>& b, unsigned width, options::BvMultiplierMode mode, unsigned karatsuba_width, std::vector<T>& res) {
+  Assert(res.size() == 0);
+  unsigned n = std::max(a.size(), b.size());
+  unsigned h = n / 2;
+  // the sums of the halves of factors narrower than 4 bits are not narrower
+  // than the factors
+  if (karatsuba_width == 0 || n < karatsuba_width || n < 4) {
+    if (mode == options::BvMultiplierMode::SHIFT_ADD) {
+      std::vector<T> a_ext, b_ext;
+      resizeBits(a, width, a_ext);
+      resizeBits(b, width, b_ext);
+      shiftAddMultiplier(a_ext, b_ext, res);
+    } else {
+      treeMultiplier(a, b, width, mode == options::BvMultiplierMode::DADDA, res);
+    }
+    return;
+  }
+
+  std::vector<T> a_ext, b_ext, a0, a1, b0, b1;
+  resizeBits(a, n, a_ext);
+  resizeBits(b, n, b_ext);
+  extractBits(a_ext, a0, 0, h - 1);
+  extractBits(a_ext, a1, h, n - 1);
+  extractBits(b_ext, b0, 0, h - 1);
+  extractBits(b_ext, b1, h, n - 1);
+
+  std::vector<T> z0;
+  multiplier(a0, b0, std::min(width, 2 * h), mode, karatsuba_width, z0);
+  if (width <= h) {
+    res = z0;
+    return;
+  }
+
+  // the bits h..width-1 of a1 * b0 + a0 * b1 + a1 * b1 * 2^h
+  std::vector<T> z1;
+  if (width <= 2 * h) {
+    std::vector<T> a1b0, a0b1;
+    multiplier(a1, b0, width - h, mode, karatsuba_width, a1b0);
+    multiplier(a0, b1, width - h, mode, karatsuba_width, a0b1);
+    addBits(a1b0, a0b1, width - h, z1);
+  } else {
+    std::vector<T> z2, sum_a, sum_b, z, z_minus_z0;
+    multiplier(a1, b1, width - h, mode, karatsuba_width, z2);
+    addBits(a0, a1, n - h + 1, sum_a);
+    addBits(b0, b1, n - h + 1, sum_b);
+    multiplier(sum_a, sum_b, width - h, mode, karatsuba_width, z);
+    addBits(z, z0, width - h, z_minus_z0, true);
+    // a1 * b0 + a0 * b1 + a1 * b1 * 2^h = z - z0 - z2 + z2 * 2^h
+    std::vector<T> z2_shifted, cross;
+    makeZero(z2_shifted, h);
+    z2_shifted.insert(z2_shifted.end(), z2.begin(), z2.end());
+    addBits(z_minus_z0, z2, width - h, cross, true);
+    addBits(cross, z2_shifted, width - h, z1);
+  }
+
+  // res = z0 + z1 * 2^h
+  std::vector<T> z1_shifted;
+  makeZero(z1_shifted, h);
+  z1_shifted.insert(z1_shifted.end(), z1.begin(), z1.end());
+  addBits(z0, z1_shifted, width, res);
+}
+
 template <class T>
 T inline uLessThanBB(const std::vector<T>&a, const std::vector<T>& b, bool orEqual) {
   Assert(a.size() && b.size());
@@ -23,6 +23,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "context/cdo.h"
 #include "expr/node.h"
 #include "prop/bv_sat_solver_notify.h"
 #include "prop/sat_solver.h"
@@ -115,6 +116,69 @@ class MinisatEmptyNotify : public prop::BVSatSolverNotify
   void safePoint(ResourceManager::Resource r) override {}
 };
 
+/**
+ * The activation literals of the context levels for incremental eager
+ * bit-blasting. A formula asserted at a context level > 1 is added to the SAT
+ * solver as a clause guarded by the activation literal of its level, and the
+ * literals of all levels that are still active are assumed in each call to
+ * solve. When a level is popped, its activation literal is permanently
+ * disabled by a unit clause, such that the SAT solver keeps its variables and
+ * learned clauses across push and pop.
+ */
+class ActivationLiterals
+{
+ public:
+  ActivationLiterals(context::Context* c, prop::SatSolver* solver)
+      : d_context(c), d_satSolver(solver), d_numActive(c, 0)
+  {
+  }
+
+  /** Returns the activation literal of the current context level. */
+  prop::SatLiteral get()
+  {
+    disablePopped();
+    unsigned level = d_context->getLevel();
+    if (d_literals.empty() || d_literals.back().first < level)
+    {
+      prop::SatLiteral lit(d_satSolver->newVar(false, false, false));
+      d_literals.emplace_back(level, lit);
+      d_numActive = d_literals.size();
+    }
+    return d_literals.back().second;
+  }
+
+  /** Returns the activation literals of the levels that are still active. */
+  std::vector<prop::SatLiteral> getAssumptions()
+  {
+    disablePopped();
+    std::vector<prop::SatLiteral> assumptions;
+    for (const std::pair<unsigned, prop::SatLiteral>& p : d_literals)
+    {
+      assumptions.push_back(p.second);
+    }
+    return assumptions;
+  }
+
+ private:
+  /** Disables the activation literals of the levels that were popped. */
+  void disablePopped()
+  {
+    while (d_literals.size() > d_numActive.get())
+    {
+      prop::SatClause clause = {~d_literals.back().second};
+      d_satSolver->addClause(clause, false);
+      d_literals.pop_back();
+    }
+  }
+
+  context::Context* d_context;
+  prop::SatSolver* d_satSolver;
+  /** The context levels and their activation literals, by increasing level */
+  std::vector<std::pair<unsigned, prop::SatLiteral>> d_literals;
+  /** The number of literals in d_literals of levels that were not popped */
+  context::CDO<size_t> d_numActive;
+};
+
 // Bitblaster implementation
 
 template <class T>
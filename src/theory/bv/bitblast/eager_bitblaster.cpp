@@ -38,7 +38,8 @@ EagerBitblaster::EagerBitblaster(BVSolverLazy* theory_bv, context::Context* c)
       d_bv(theory_bv),
       d_bbAtoms(),
       d_variables(),
-      d_notify()
+      d_notify(),
+      d_activationLits()
 {
   prop::SatSolver *solver = nullptr;
   switch (options::bvSatSolver())
@@ -68,6 +69,7 @@ EagerBitblaster::EagerBitblaster(BVSolverLazy* theory_bv, context::Context* c)
     default: Unreachable() << "Unknown SAT solver type";
   }
   d_satSolver.reset(solver);
+  d_activationLits.reset(new ActivationLiterals(c, d_satSolver.get()));
   ResourceManager* rm = smt::currentResourceManager();
   d_cnfStream.reset(new prop::TseitinCnfStream(d_satSolver.get(),
                                                d_bitblastingRegistrar.get(),
@@ -82,10 +84,14 @@ EagerBitblaster::~EagerBitblaster() {}
 
 void EagerBitblaster::bbFormula(TNode node)
 {
-  /* For incremental eager solving we assume formulas at context levels > 1. */
+  /* For incremental eager solving, formulas at context levels > 1 are only
+   * asserted under the activation literal of their level. */
   if (options::incrementalSolving() && d_context->getLevel() > 1)
   {
     d_cnfStream->ensureLiteral(node);
+    prop::SatClause clause = {~d_activationLits->get(),
+                              d_cnfStream->getLiteral(node)};
+    d_satSolver->addClause(clause, false);
   }
   else
   {
@@ -185,18 +191,13 @@ bool EagerBitblaster::solve() {
   //   Rewriter::garbageCollect();
   //   nm->reclaimZombiesUntil(options::zombieHuntThreshold());
   // }
-  return prop::SAT_VALUE_TRUE == d_satSolver->solve();
-}
-
-bool EagerBitblaster::solve(const std::vector<Node>& assumptions)
-{
-  std::vector<prop::SatLiteral> assumpts;
-  for (const Node& assumption : assumptions)
+  if (options::incrementalSolving())
   {
-    Assert(d_cnfStream->hasLiteral(assumption));
-    assumpts.push_back(d_cnfStream->getLiteral(assumption));
+    std::vector<prop::SatLiteral> assumptions =
+        d_activationLits->getAssumptions();
+    return prop::SAT_VALUE_TRUE == d_satSolver->solve(assumptions);
   }
-  return prop::SAT_VALUE_TRUE == d_satSolver->solve(assumpts);
+  return prop::SAT_VALUE_TRUE == d_satSolver->solve();
 }
 
 /**
@@ -50,8 +50,12 @@ class EagerBitblaster : public TBitblaster<Node>
   void storeBBTerm(TNode node, const Bits& bits) override;
 
   bool assertToSat(TNode node, bool propagate = true);
+  /**
+   * Calls the SAT solver. With incremental solving, the formulas asserted at
+   * context levels > 1 that were not popped are enabled by assuming the
+   * activation literals of their levels.
+   */
   bool solve();
-  bool solve(const std::vector<Node>& assumptions);
   bool collectModelInfo(TheoryModel* m, bool fullModel);
 
  private:
@@ -67,6 +71,8 @@ class EagerBitblaster : public TBitblaster<Node>
 
   // This is either an MinisatEmptyNotify or NULL.
   std::unique_ptr<MinisatEmptyNotify> d_notify;
+  /** The activation literals of the context levels for incremental solving */
+  std::unique_ptr<ActivationLiterals> d_activationLits;
 
   Node getModelFromSatSolver(TNode a, bool fullModel) override;
   prop::SatSolver* getSatSolver() override { return d_satSolver.get(); }
@@ -86,7 +86,7 @@ TLazyBitblaster::TLazyBitblaster(context::Context* c,
                                                nullptr,
                                                rm,
                                                false,
-                                               "LazyBitblaster"));
+                                               d_name));
 
   d_satSolverNotify.reset(
       d_emptyNotify
@@ -575,11 +575,15 @@ void TLazyBitblaster::clearSolver() {
   d_satSolver.reset(
       prop::SatSolverFactory::createMinisat(d_ctx, smtStatisticsRegistry()));
   ResourceManager* rm = smt::currentResourceManager();
+  // destroy the old CNF stream first, which unregisters its statistics
+  d_cnfStream.reset();
   d_cnfStream.reset(new prop::TseitinCnfStream(d_satSolver.get(),
                                                d_nullRegistrar.get(),
                                                d_nullContext.get(),
                                                nullptr,
-                                               rm));
+                                               rm,
+                                               false,
+                                               d_name));
   d_satSolverNotify.reset(
       d_emptyNotify
           ? (prop::BVSatSolverNotify*)new MinisatEmptyNotify()
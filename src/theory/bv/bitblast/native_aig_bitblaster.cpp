@@ -0,0 +1,588 @@
+/*********************                                                        */
+/*! \file native_aig_bitblaster.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Bitblaster to the in-tree and-inverter graphs
+ **
+ ** Bitblaster to the in-tree and-inverter graphs.
+ **/
+
+#include "theory/bv/bitblast/native_aig_bitblaster.h"
+
+#include "base/check.h"
+#include "cvc4_private.h"
+#include "options/bv_options.h"
+#include "options/smt_options.h"
+#include "prop/cnf_stream.h"
+#include "prop/sat_solver_factory.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/bv/bv_solver_lazy.h"
+#include "theory/theory_model.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+template <> inline
+std::string toString<AigEdge>(const std::vector<AigEdge>& bits) {
+  std::ostringstream os;
+  for (int i = bits.size() - 1; i >= 0; --i) {
+    os << bits[i] << " ";
+  }
+  os << "\n";
+  return os.str();
+}
+
+template <> inline
+AigEdge mkTrue<AigEdge>() {
+  return AigEdge::mkTrue();
+}
+
+template <> inline
+AigEdge mkFalse<AigEdge>() {
+  return AigEdge::mkFalse();
+}
+
+template <> inline
+AigEdge mkNot<AigEdge>(AigEdge a) {
+  return ~a;
+}
+
+template <> inline
+AigEdge mkOr<AigEdge>(AigEdge a, AigEdge b) {
+  return NativeAigBitblaster::currentAigM()->mkOr(a, b);
+}
+
+template <> inline
+AigEdge mkOr<AigEdge>(const std::vector<AigEdge>& children) {
+  Assert(children.size());
+  AigEdge result = children[0];
+  for (unsigned i = 1; i < children.size(); ++i) {
+    result = NativeAigBitblaster::currentAigM()->mkOr(result, children[i]);
+  }
+  return result;
+}
+
+template <> inline
+AigEdge mkAnd<AigEdge>(AigEdge a, AigEdge b) {
+  return NativeAigBitblaster::currentAigM()->mkAnd(a, b);
+}
+
+template <> inline
+AigEdge mkAnd<AigEdge>(const std::vector<AigEdge>& children) {
+  Assert(children.size());
+  AigEdge result = children[0];
+  for (unsigned i = 1; i < children.size(); ++i) {
+    result = NativeAigBitblaster::currentAigM()->mkAnd(result, children[i]);
+  }
+  return result;
+}
+
+template <> inline
+AigEdge mkXor<AigEdge>(AigEdge a, AigEdge b) {
+  return NativeAigBitblaster::currentAigM()->mkXor(a, b);
+}
+
+template <> inline
+AigEdge mkIff<AigEdge>(AigEdge a, AigEdge b) {
+  return ~NativeAigBitblaster::currentAigM()->mkXor(a, b);
+}
+
+template <> inline
+AigEdge mkIte<AigEdge>(AigEdge cond, AigEdge a, AigEdge b) {
+  return NativeAigBitblaster::currentAigM()->mkIte(cond, a, b);
+}
+
+thread_local AigManager* NativeAigBitblaster::s_currentAigManager = nullptr;
+
+AigManager* NativeAigBitblaster::currentAigM()
+{
+  Assert(s_currentAigManager != nullptr);
+  return s_currentAigManager;
+}
+
+NativeAigBitblaster::NativeAigBitblaster(BVSolverLazy* theory_bv,
+                                         context::Context* c)
+    : TBitblaster<AigEdge>(),
+      d_context(c),
+      d_aigManager(),
+      d_satSolver(),
+      d_notify(),
+      d_bv(theory_bv),
+      d_aigCache(),
+      d_bbAtoms(),
+      d_inputs(),
+      d_variables(),
+      d_booleanVariables(),
+      d_satVariables(),
+      d_inconsistent(false),
+      d_modelValues(),
+      d_modelValid(false),
+      d_activationLits()
+{
+  prop::SatSolver* solver = nullptr;
+  switch (options::bvSatSolver())
+  {
+    case options::SatSolverMode::MINISAT:
+    {
+      prop::BVSatSolverInterface* minisat =
+          prop::SatSolverFactory::createMinisat(d_nullContext.get(),
+                                                smtStatisticsRegistry(),
+                                                "NativeAigBitblaster");
+      d_notify.reset(new MinisatEmptyNotify());
+      minisat->setNotify(d_notify.get());
+      solver = minisat;
+      break;
+    }
+    case options::SatSolverMode::CADICAL:
+      solver = prop::SatSolverFactory::createCadical(smtStatisticsRegistry(),
+                                                     "NativeAigBitblaster");
+      break;
+    case options::SatSolverMode::CRYPTOMINISAT:
+      solver = prop::SatSolverFactory::createCryptoMinisat(
+          smtStatisticsRegistry(), "NativeAigBitblaster");
+      break;
+    case options::SatSolverMode::KISSAT:
+      solver = prop::SatSolverFactory::createKissat(smtStatisticsRegistry(),
+                                                    "NativeAigBitblaster");
+      break;
+    default: Unreachable() << "Unknown SAT solver type";
+  }
+  d_satSolver.reset(solver);
+  d_activationLits.reset(new ActivationLiterals(c, d_satSolver.get()));
+}
+
+NativeAigBitblaster::~NativeAigBitblaster()
+{
+  if (s_currentAigManager == &d_aigManager)
+  {
+    s_currentAigManager = nullptr;
+  }
+}
+
+void NativeAigBitblaster::bbFormula(TNode formula)
+{
+  AigEdge aig = convertToAig(formula);
+  /* For incremental eager solving, formulas at context levels > 1 are only
+   * asserted under the activation literal of their level. */
+  if (options::incrementalSolving() && d_context->getLevel() > 1)
+  {
+    if (aig != AigEdge::mkTrue())
+    {
+      prop::SatClause clause = {~d_activationLits->get()};
+      if (aig != AigEdge::mkFalse())
+      {
+        clause.push_back(toSatLiteral(aig));
+      }
+      d_satSolver->addClause(clause, false);
+      ++d_statistics.d_numClauses;
+    }
+    return;
+  }
+  if (aig == AigEdge::mkFalse())
+  {
+    d_inconsistent = true;
+  }
+  else if (aig != AigEdge::mkTrue())
+  {
+    prop::SatClause clause = {toSatLiteral(aig)};
+    d_satSolver->addClause(clause, false);
+    ++d_statistics.d_numClauses;
+  }
+}
+
+AigEdge NativeAigBitblaster::convertToAig(TNode node)
+{
+  Assert(node.getType().isBoolean());
+  NodeAigMap::const_iterator it = d_aigCache.find(node);
+  if (it != d_aigCache.end())
+  {
+    return it->second;
+  }
+
+  s_currentAigManager = &d_aigManager;
+  AigEdge result;
+  switch (node.getKind())
+  {
+    case kind::AND:
+    {
+      result = convertToAig(node[0]);
+      for (unsigned i = 1; i < node.getNumChildren(); ++i)
+      {
+        result = d_aigManager.mkAnd(result, convertToAig(node[i]));
+      }
+      break;
+    }
+    case kind::OR:
+    {
+      result = convertToAig(node[0]);
+      for (unsigned i = 1; i < node.getNumChildren(); ++i)
+      {
+        result = d_aigManager.mkOr(result, convertToAig(node[i]));
+      }
+      break;
+    }
+    case kind::XOR:
+    {
+      result = convertToAig(node[0]);
+      for (unsigned i = 1; i < node.getNumChildren(); ++i)
+      {
+        result = d_aigManager.mkXor(result, convertToAig(node[i]));
+      }
+      break;
+    }
+    case kind::IMPLIES:
+    {
+      Assert(node.getNumChildren() == 2);
+      result = d_aigManager.mkOr(~convertToAig(node[0]),
+                                 convertToAig(node[1]));
+      break;
+    }
+    case kind::ITE:
+    {
+      Assert(node.getNumChildren() == 3);
+      result = d_aigManager.mkIte(convertToAig(node[0]),
+                                  convertToAig(node[1]),
+                                  convertToAig(node[2]));
+      break;
+    }
+    case kind::NOT:
+    {
+      result = ~convertToAig(node[0]);
+      break;
+    }
+    case kind::CONST_BOOLEAN:
+    {
+      result = node.getConst<bool>() ? AigEdge::mkTrue() : AigEdge::mkFalse();
+      break;
+    }
+    case kind::BITVECTOR_BITOF:
+    {
+      Bits bits;
+      bbTerm(node[0], bits);
+      result = bits[node.getOperator().getConst<BitVectorBitOf>().d_bitIndex];
+      break;
+    }
+    case kind::EQUAL:
+    {
+      if (node[0].getType().isBoolean())
+      {
+        Assert(node.getNumChildren() == 2);
+        result = ~d_aigManager.mkXor(convertToAig(node[0]),
+                                     convertToAig(node[1]));
+        break;
+      }
+      // else, continue...
+    }
+    CVC4_FALLTHROUGH;
+    default:
+      if (node.isVar())
+      {
+        result = mkInput(node);
+        d_booleanVariables.push_back(node);
+      }
+      else
+      {
+        bbAtom(node);
+        result = getBBAtom(node);
+      }
+  }
+
+  d_aigCache.emplace(node, result);
+  Debug("bitvector-aig") << "NativeAigBitblaster::convertToAig " << node
+                         << " => " << result << "\n";
+  return result;
+}
+
+void NativeAigBitblaster::bbAtom(TNode node)
+{
+  if (hasBBAtom(node))
+  {
+    return;
+  }
+
+  Debug("bitvector-bitblast") << "Bitblasting atom " << node << "\n";
+  s_currentAigManager = &d_aigManager;
+
+  // the bitblasted definition of the atom
+  Node normalized = Rewriter::rewrite(node);
+  AigEdge atom_bb;
+  if (normalized.getKind() == kind::CONST_BOOLEAN)
+  {
+    atom_bb = normalized.getConst<bool>() ? AigEdge::mkTrue()
+                                          : AigEdge::mkFalse();
+  }
+  else
+  {
+    atom_bb = d_atomBBStrategies[normalized.getKind()](normalized, this);
+  }
+  storeBBAtom(node, atom_bb);
+  Debug("bitvector-bitblast") << "Done bitblasting atom " << node << "\n";
+}
+
+void NativeAigBitblaster::bbTerm(TNode node, Bits& bits)
+{
+  Assert(node.getType().isBitVector());
+
+  if (hasBBTerm(node))
+  {
+    getBBTerm(node, bits);
+    return;
+  }
+
+  d_bv->spendResource(ResourceManager::Resource::BitblastStep);
+  Debug("bitvector-bitblast") << "Bitblasting term " << node << "\n";
+  s_currentAigManager = &d_aigManager;
+
+  d_termBBStrategies[node.getKind()](node, bits, this);
+
+  Assert(bits.size() == utils::getSize(node));
+  storeBBTerm(node, bits);
+}
+
+void NativeAigBitblaster::makeVariable(TNode var, Bits& bits)
+{
+  Assert(bits.size() == 0);
+  for (unsigned i = 0; i < utils::getSize(var); ++i)
+  {
+    bits.push_back(mkInput(utils::mkBitOf(var, i)));
+  }
+  d_variables.insert(var);
+}
+
+AigEdge NativeAigBitblaster::mkInput(TNode input)
+{
+  Assert(d_inputs.find(input) == d_inputs.end());
+  Assert(input.getKind() == kind::BITVECTOR_BITOF
+         || (input.getType().isBoolean() && input.isVar()));
+  AigEdge aig = d_aigManager.mkInput();
+  d_inputs.emplace(input, aig);
+  return aig;
+}
+
+bool NativeAigBitblaster::hasBBAtom(TNode atom) const
+{
+  return d_bbAtoms.find(atom) != d_bbAtoms.end();
+}
+
+void NativeAigBitblaster::storeBBAtom(TNode atom, AigEdge atom_bb)
+{
+  d_bbAtoms.emplace(atom, atom_bb);
+}
+
+AigEdge NativeAigBitblaster::getBBAtom(TNode atom) const
+{
+  Assert(hasBBAtom(atom));
+  return d_bbAtoms.find(atom)->second;
+}
+
+prop::SatLiteral NativeAigBitblaster::toSatLiteral(AigEdge e)
+{
+  Assert(!e.isConst());
+  if (d_satVariables.size() < d_aigManager.getNumNodes())
+  {
+    d_satVariables.resize(d_aigManager.getNumNodes(), prop::undefSatVariable);
+  }
+  if (d_satVariables[e.getNode()] != prop::undefSatVariable)
+  {
+    return prop::SatLiteral(d_satVariables[e.getNode()], e.isComplemented());
+  }
+
+  TimerStat::CodeTimer cnfConversionTimer(d_statistics.d_cnfConversionTime);
+  // the gates whose variables were created but not defined yet
+  std::vector<uint32_t> toConvert;
+  prop::SatLiteral result = mkSatLiteral(e, toConvert);
+  while (!toConvert.empty())
+  {
+    uint32_t node = toConvert.back();
+    toConvert.pop_back();
+    prop::SatLiteral lit(d_satVariables[node]);
+    prop::SatLiteral lit0 = mkSatLiteral(d_aigManager.getChild0(node), toConvert);
+    prop::SatLiteral lit1 = mkSatLiteral(d_aigManager.getChild1(node), toConvert);
+    prop::SatClause clause0 = {~lit, lit0};
+    prop::SatClause clause1 = {~lit, lit1};
+    prop::SatClause clause2 = {lit, ~lit0, ~lit1};
+    d_satSolver->addClause(clause0, false);
+    d_satSolver->addClause(clause1, false);
+    d_satSolver->addClause(clause2, false);
+    d_statistics.d_numClauses += 3;
+  }
+  return result;
+}
+
+prop::SatLiteral NativeAigBitblaster::mkSatLiteral(
+    AigEdge e, std::vector<uint32_t>& toConvert)
+{
+  // the children of the gates are never constant
+  Assert(!e.isConst());
+  uint32_t node = e.getNode();
+  if (d_satVariables[node] == prop::undefSatVariable)
+  {
+    d_satVariables[node] = d_satSolver->newVar(false, false, false);
+    ++d_statistics.d_numVariables;
+    if (d_aigManager.isAnd(node))
+    {
+      toConvert.push_back(node);
+    }
+  }
+  return prop::SatLiteral(d_satVariables[node], e.isComplemented());
+}
+
+bool NativeAigBitblaster::solve()
+{
+  Debug("bitvector") << "NativeAigBitblaster::solve(). \n";
+  updateStatistics();
+  d_modelValid = false;
+  if (d_inconsistent)
+  {
+    return false;
+  }
+  TimerStat::CodeTimer solveTimer(d_statistics.d_solveTime);
+  if (options::incrementalSolving())
+  {
+    std::vector<prop::SatLiteral> assumptions =
+        d_activationLits->getAssumptions();
+    return prop::SAT_VALUE_TRUE == d_satSolver->solve(assumptions);
+  }
+  return prop::SAT_VALUE_TRUE == d_satSolver->solve();
+}
+
+void NativeAigBitblaster::updateStatistics()
+{
+  d_statistics.d_numAnds.setData(d_aigManager.getNumAnds());
+  d_statistics.d_numHashHits.setData(d_aigManager.getNumHashHits());
+  d_statistics.d_numConstFolds.setData(d_aigManager.getNumConstFolds());
+  d_statistics.d_numRewrites.setData(d_aigManager.getNumRewrites());
+}
+
+void NativeAigBitblaster::computeModel()
+{
+  // inputs that are not converted to CNF are unconstrained and false
+  d_modelValues.assign(d_aigManager.getNumNodes(), false);
+  for (const std::pair<const Node, AigEdge>& input : d_inputs)
+  {
+    uint32_t node = input.second.getNode();
+    if (node < d_satVariables.size()
+        && d_satVariables[node] != prop::undefSatVariable)
+    {
+      prop::SatValue value =
+          d_satSolver->value(prop::SatLiteral(d_satVariables[node]));
+      Assert(value != prop::SAT_VALUE_UNKNOWN);
+      d_modelValues[node] = value == prop::SAT_VALUE_TRUE;
+    }
+  }
+  d_aigManager.evaluate(d_modelValues);
+  d_modelValid = true;
+}
+
+/**
+ * Returns the value a is assigned to in the last model, or null if a was not
+ * bit-blasted and fullModel is false. Unconstrained bits are false.
+ */
+Node NativeAigBitblaster::getModelFromSatSolver(TNode a, bool fullModel)
+{
+  if (!hasBBTerm(a))
+  {
+    return fullModel ? utils::mkConst(utils::getSize(a), 0u) : Node();
+  }
+  if (!d_modelValid)
+  {
+    computeModel();
+  }
+
+  Bits bits;
+  getBBTerm(a, bits);
+  Integer value(0);
+  for (int i = bits.size() - 1; i >= 0; --i)
+  {
+    Integer bit_int = AigManager::getValue(d_modelValues, bits[i]) ? Integer(1)
+                                                                   : Integer(0);
+    value = value * 2 + bit_int;
+  }
+  return utils::mkConst(bits.size(), value);
+}
+
+bool NativeAigBitblaster::collectModelInfo(TheoryModel* m, bool fullModel)
+{
+  NodeManager* nm = NodeManager::currentNM();
+
+  // Collect the values for the bit-vector variables
+  for (TNode var : d_variables)
+  {
+    if (d_bv->isLeaf(var) || isSharedTerm(var))
+    {
+      Node const_value = getModelFromSatSolver(var, true);
+      Debug("bitvector-model")
+          << "NativeAigBitblaster::collectModelInfo (assert (= " << var << " "
+          << const_value << "))\n";
+      if (!m->assertEquality(var, const_value, true))
+      {
+        return false;
+      }
+    }
+  }
+
+  // Collect the values for the Boolean variables
+  if (!d_modelValid)
+  {
+    computeModel();
+  }
+  for (const Node& var : d_booleanVariables)
+  {
+    bool value = AigManager::getValue(d_modelValues, d_inputs[var]);
+    if (!m->assertEquality(var, nm->mkConst(value), true))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool NativeAigBitblaster::isSharedTerm(TNode node)
+{
+  return d_bv->d_sharedTermsSet.find(node) != d_bv->d_sharedTermsSet.end();
+}
+
+NativeAigBitblaster::Statistics::Statistics()
+    : d_numAnds("theory::bv::NativeAigBitblaster::numAnds", 0),
+      d_numHashHits("theory::bv::NativeAigBitblaster::numHashHits", 0),
+      d_numConstFolds("theory::bv::NativeAigBitblaster::numConstFolds", 0),
+      d_numRewrites("theory::bv::NativeAigBitblaster::numRewrites", 0),
+      d_numClauses("theory::bv::NativeAigBitblaster::numClauses", 0),
+      d_numVariables("theory::bv::NativeAigBitblaster::numVariables", 0),
+      d_cnfConversionTime(
+          "theory::bv::NativeAigBitblaster::cnfConversionTime"),
+      d_solveTime("theory::bv::NativeAigBitblaster::solveTime")
+{
+  smtStatisticsRegistry()->registerStat(&d_numAnds);
+  smtStatisticsRegistry()->registerStat(&d_numHashHits);
+  smtStatisticsRegistry()->registerStat(&d_numConstFolds);
+  smtStatisticsRegistry()->registerStat(&d_numRewrites);
+  smtStatisticsRegistry()->registerStat(&d_numClauses);
+  smtStatisticsRegistry()->registerStat(&d_numVariables);
+  smtStatisticsRegistry()->registerStat(&d_cnfConversionTime);
+  smtStatisticsRegistry()->registerStat(&d_solveTime);
+}
+
+NativeAigBitblaster::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_numAnds);
+  smtStatisticsRegistry()->unregisterStat(&d_numHashHits);
+  smtStatisticsRegistry()->unregisterStat(&d_numConstFolds);
+  smtStatisticsRegistry()->unregisterStat(&d_numRewrites);
+  smtStatisticsRegistry()->unregisterStat(&d_numClauses);
+  smtStatisticsRegistry()->unregisterStat(&d_numVariables);
+  smtStatisticsRegistry()->unregisterStat(&d_cnfConversionTime);
+  smtStatisticsRegistry()->unregisterStat(&d_solveTime);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
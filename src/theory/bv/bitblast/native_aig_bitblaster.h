@@ -0,0 +1,143 @@
+/*********************                                                        */
+/*! \file native_aig_bitblaster.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Bitblaster to the in-tree and-inverter graphs
+ **
+ ** Eager bitblaster that bit-blasts to an AigManager, so that duplicated and
+ ** trivially simplifiable gates are removed before the CNF conversion. Unlike
+ ** the AigBitblaster it does not need ABC, and supports incremental solving
+ ** and models.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__BV__BITBLAST__NATIVE_AIG_BITBLASTER_H
+#define CVC4__THEORY__BV__BITBLAST__NATIVE_AIG_BITBLASTER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "prop/sat_solver.h"
+#include "theory/bv/bitblast/aig.h"
+#include "theory/bv/bitblast/bitblaster.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+class BVSolverLazy;
+
+class NativeAigBitblaster : public TBitblaster<AigEdge>
+{
+ public:
+  NativeAigBitblaster(BVSolverLazy* theory_bv, context::Context* c);
+  ~NativeAigBitblaster();
+
+  void makeVariable(TNode node, Bits& bits) override;
+  void bbTerm(TNode node, Bits& bits) override;
+  void bbAtom(TNode node) override;
+  AigEdge getBBAtom(TNode atom) const override;
+  bool hasBBAtom(TNode atom) const override;
+  void storeBBAtom(TNode atom, AigEdge atom_bb) override;
+
+  /**
+   * Converts formula to the AIG and asserts it to the SAT solver. With
+   * incremental solving, formulas at context levels > 1 are asserted under
+   * the activation literal of their level.
+   */
+  void bbFormula(TNode formula);
+  /**
+   * Calls the SAT solver, assuming the activation literals of the levels that
+   * were not popped with incremental solving.
+   */
+  bool solve();
+  bool collectModelInfo(TheoryModel* m, bool fullModel);
+
+  /** The AIG manager of the bitblaster that is bit-blasting */
+  static AigManager* currentAigM();
+
+ private:
+  typedef std::unordered_map<Node, AigEdge, NodeHashFunction> NodeAigMap;
+
+  /** Returns the AIG of the Boolean formula node. */
+  AigEdge convertToAig(TNode node);
+  /** Creates the input for the bit or Boolean variable input. */
+  AigEdge mkInput(TNode input);
+  /**
+   * Returns the SAT literal of the non-constant edge e, converting the gates
+   * it depends on to CNF first if needed.
+   */
+  prop::SatLiteral toSatLiteral(AigEdge e);
+  /** Returns the SAT literal of e, creating its variable if needed. */
+  prop::SatLiteral mkSatLiteral(AigEdge e, std::vector<uint32_t>& toConvert);
+  /** Computes the values of all nodes from the model of the SAT solver. */
+  void computeModel();
+  /** Updates the statistics of the AIG manager. */
+  void updateStatistics();
+
+  Node getModelFromSatSolver(TNode a, bool fullModel) override;
+  prop::SatSolver* getSatSolver() override { return d_satSolver.get(); }
+  bool isSharedTerm(TNode node);
+
+  static thread_local AigManager* s_currentAigManager;
+
+  context::Context* d_context;
+  AigManager d_aigManager;
+  std::unique_ptr<prop::SatSolver> d_satSolver;
+  // This is either an MinisatEmptyNotify or NULL.
+  std::unique_ptr<MinisatEmptyNotify> d_notify;
+  BVSolverLazy* d_bv;
+
+  /** The AIGs of the Boolean formulas */
+  NodeAigMap d_aigCache;
+  /** The AIGs of the bit-blasted atoms */
+  NodeAigMap d_bbAtoms;
+  /** The inputs of the bits of the variables and of the Boolean variables */
+  NodeAigMap d_inputs;
+  /** The bit-vector variables */
+  TNodeSet d_variables;
+  /** The Boolean variables */
+  std::vector<Node> d_booleanVariables;
+  /** The SAT variables of the nodes, indexed by node */
+  std::vector<prop::SatVariable> d_satVariables;
+  /** Whether a formula that simplified to false was asserted */
+  bool d_inconsistent;
+  /** The values of the nodes in the last model, indexed by node */
+  std::vector<bool> d_modelValues;
+  /** Whether d_modelValues holds the last model */
+  bool d_modelValid;
+  /** The activation literals of the context levels for incremental solving */
+  std::unique_ptr<ActivationLiterals> d_activationLits;
+
+  class Statistics
+  {
+   public:
+    IntStat d_numAnds;
+    IntStat d_numHashHits;
+    IntStat d_numConstFolds;
+    IntStat d_numRewrites;
+    IntStat d_numClauses;
+    IntStat d_numVariables;
+    TimerStat d_cnfConversionTime;
+    TimerStat d_solveTime;
+    Statistics();
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+};
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif  //  CVC4__THEORY__BV__BITBLAST__NATIVE_AIG_BITBLASTER_H
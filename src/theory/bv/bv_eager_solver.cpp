@@ -19,6 +19,8 @@
 #include "options/bv_options.h"
 #include "theory/bv/bitblast/aig_bitblaster.h"
 #include "theory/bv/bitblast/eager_bitblaster.h"
+#include "theory/bv/bitblast/native_aig_bitblaster.h"
+#include "theory/bv/bv_sls.h"
 
 using namespace std;
 
@@ -28,11 +30,14 @@ namespace bv {
 
 EagerBitblastSolver::EagerBitblastSolver(context::Context* c, BVSolverLazy* bv)
     : d_assertionSet(c),
-      d_assumptionSet(c),
       d_context(c),
       d_bitblaster(),
       d_aigBitblaster(),
+      d_nativeAigBitblaster(),
       d_useAig(options::bitvectorAig()),
+      d_useNativeAig(options::bitvectorNativeAig() && !d_useAig),
+      d_slsSolver(options::bvSls() ? new SlsSolver(bv) : nullptr),
+      d_slsModel(false),
       d_bv(bv)
 {
 }
@@ -40,8 +45,10 @@ EagerBitblastSolver::EagerBitblastSolver(context::Context* c, BVSolverLazy* bv)
 EagerBitblastSolver::~EagerBitblastSolver() {}
 
 void EagerBitblastSolver::turnOffAig() {
-  Assert(d_aigBitblaster == nullptr && d_bitblaster == nullptr);
+  Assert(d_aigBitblaster == nullptr && d_nativeAigBitblaster == nullptr
+         && d_bitblaster == nullptr);
   d_useAig = false;
+  d_useNativeAig = false;
 }
 
 void EagerBitblastSolver::initialize() {
@@ -52,15 +59,24 @@ void EagerBitblastSolver::initialize() {
 #else
     Unreachable();
 #endif
-  } else {
+  }
+  else if (d_useNativeAig)
+  {
+    d_nativeAigBitblaster.reset(new NativeAigBitblaster(d_bv, d_context));
+  }
+  else
+  {
     d_bitblaster.reset(new EagerBitblaster(d_bv, d_context));
   }
 }
 
 bool EagerBitblastSolver::isInitialized() {
-  const bool init = d_aigBitblaster != nullptr || d_bitblaster != nullptr;
+  const bool init = d_aigBitblaster != nullptr
+                    || d_nativeAigBitblaster != nullptr
+                    || d_bitblaster != nullptr;
   Assert(!init || !d_useAig || d_aigBitblaster);
-  Assert(!init || d_useAig || d_bitblaster);
+  Assert(!init || !d_useNativeAig || d_nativeAigBitblaster);
+  Assert(!init || d_useAig || d_useNativeAig || d_bitblaster);
   return init;
 }
 
@@ -69,9 +85,10 @@ void EagerBitblastSolver::assertFormula(TNode formula) {
   Assert(isInitialized());
   Debug("bitvector-eager") << "EagerBitblastSolver::assertFormula " << formula
                            << "\n";
-  if (options::incrementalSolving() && d_context->getLevel() > 1)
+  if (d_assertionSet.contains(formula))
   {
-    d_assumptionSet.insert(formula);
+    // already asserted at this or a lower context level
+    return;
   }
   d_assertionSet.insert(formula);
   // ensures all atoms are bit-blasted and converted to AIG
@@ -82,6 +99,10 @@ void EagerBitblastSolver::assertFormula(TNode formula) {
     Unreachable();
 #endif
   }
+  else if (d_useNativeAig)
+  {
+    d_nativeAigBitblaster->bbFormula(formula);
+  }
   else
   {
     d_bitblaster->bbFormula(formula);
@@ -90,10 +111,23 @@ void EagerBitblastSolver::assertFormula(TNode formula) {
 
 bool EagerBitblastSolver::checkSat() {
   Assert(isInitialized());
+  d_slsModel = false;
   if (d_assertionSet.empty()) {
     return true;
   }
 
+  if (d_slsSolver && !d_useAig)
+  {
+    // a model found by the local search saves the call to the SAT solver
+    const std::vector<Node> assertions = {d_assertionSet.key_begin(),
+                                          d_assertionSet.key_end()};
+    if (d_slsSolver->solve(assertions))
+    {
+      d_slsModel = true;
+      return true;
+    }
+  }
+
   if (d_useAig) {
 #ifdef CVC4_USE_ABC
     const std::vector<Node> assertions = {d_assertionSet.key_begin(),
@@ -107,17 +141,20 @@ bool EagerBitblastSolver::checkSat() {
 #endif
   }
 
-  if (options::incrementalSolving())
-  {
-    const std::vector<Node> assumptions = {d_assumptionSet.key_begin(),
-                                           d_assumptionSet.key_end()};
-    return d_bitblaster->solve(assumptions);
-  }
-  return d_bitblaster->solve();
+  return d_useNativeAig ? d_nativeAigBitblaster->solve()
+                        : d_bitblaster->solve();
 }
 
 bool EagerBitblastSolver::collectModelInfo(TheoryModel* m, bool fullModel)
 {
+  if (d_slsModel)
+  {
+    return d_slsSolver->collectModelInfo(m);
+  }
+  if (d_useNativeAig)
+  {
+    return d_nativeAigBitblaster->collectModelInfo(m, fullModel);
+  }
   AlwaysAssert(!d_useAig && d_bitblaster);
   return d_bitblaster->collectModelInfo(m, fullModel);
 }
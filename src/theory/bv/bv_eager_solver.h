@@ -32,6 +32,8 @@ namespace bv {
 
 class EagerBitblaster;
 class AigBitblaster;
+class NativeAigBitblaster;
+class SlsSolver;
 
 /**
  * BitblastSolver
@@ -50,13 +52,19 @@ class EagerBitblastSolver {
 
  private:
   context::CDHashSet<Node, NodeHashFunction> d_assertionSet;
-  context::CDHashSet<Node, NodeHashFunction> d_assumptionSet;
   context::Context* d_context;
 
   /** Bitblasters */
   std::unique_ptr<EagerBitblaster> d_bitblaster;
   std::unique_ptr<AigBitblaster> d_aigBitblaster;
+  std::unique_ptr<NativeAigBitblaster> d_nativeAigBitblaster;
   bool d_useAig;
+  bool d_useNativeAig;
+
+  /** Local search run before the SAT solver, if enabled */
+  std::unique_ptr<SlsSolver> d_slsSolver;
+  /** Whether the last call to checkSat was answered by the local search */
+  bool d_slsModel;
 
   BVSolverLazy* d_bv;
 };  // class EagerBitblastSolver
@@ -0,0 +1,432 @@
+/*********************                                                        */
+/*! \file bv_inverse_value.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Inverse values of bit-vector operators
+ **
+ ** Inverse values of bit-vector operators.
+ **/
+
+#include "theory/bv/bv_inverse_value.h"
+
+#include "theory/bv/theory_bv_utils.h"
+#include "util/random.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+namespace inverse {
+
+namespace {
+
+unsigned countTrailingZeros(const BitVector& value)
+{
+  unsigned i = 0;
+  while (i < value.getSize() && !value.isBitSet(i))
+  {
+    ++i;
+  }
+  return i;
+}
+
+/** Flips the sign bit, which maps signed to unsigned comparisons. */
+BitVector flipSign(const BitVector& value)
+{
+  return value ^ BitVector::mkMinSigned(value.getSize());
+}
+
+/**
+ * Computes a value x such that (x < s) = lt (if !swapped) or (s < x) = lt (if
+ * swapped), where < is unsigned and strict if strict, and <= otherwise.
+ */
+bool inverseLessThan(
+    const BitVector& s, bool swapped, bool strict, bool lt, BitVector& x)
+{
+  unsigned size = s.getSize();
+  BitVector zero(size);
+  BitVector ones = BitVector::mkOnes(size);
+  // express the constraint as x <= bound or x >= bound
+  bool upper = swapped != lt;
+  bool isStrict = lt ? strict : !strict;
+  if (upper)
+  {
+    // x <= s, or x < s
+    if (isStrict && s == zero)
+    {
+      return false;
+    }
+    x = randomValue(zero, isStrict ? s - BitVector(size, 1u) : s);
+  }
+  else
+  {
+    // x >= s, or x > s
+    if (isStrict && s == ones)
+    {
+      return false;
+    }
+    x = randomValue(isStrict ? s + BitVector(size, 1u) : s, ones);
+  }
+  return true;
+}
+
+}  // namespace
+
+BitVector randomValue(unsigned size)
+{
+  Random& rnd = Random::getRandom();
+  BitVector res(64u, static_cast<uint64_t>(rnd.rand()));
+  while (res.getSize() < size)
+  {
+    res = res.concat(BitVector(64u, static_cast<uint64_t>(rnd.rand())));
+  }
+  return res.extract(size - 1, 0);
+}
+
+BitVector randomValue(const BitVector& min, const BitVector& max)
+{
+  Assert(min <= max);
+  unsigned size = min.getSize();
+  BitVector range = max - min;
+  if (range == BitVector::mkOnes(size))
+  {
+    return randomValue(size);
+  }
+  Integer r = randomValue(size).getValue().floorDivideRemainder(
+      range.getValue() + Integer(1));
+  return BitVector(size, min.getValue() + r);
+}
+
+bool isSupported(Kind k)
+{
+  switch (k)
+  {
+    case kind::EQUAL:
+    case kind::BITVECTOR_ULT:
+    case kind::BITVECTOR_ULE:
+    case kind::BITVECTOR_UGT:
+    case kind::BITVECTOR_UGE:
+    case kind::BITVECTOR_SLT:
+    case kind::BITVECTOR_SLE:
+    case kind::BITVECTOR_SGT:
+    case kind::BITVECTOR_SGE:
+    case kind::BITVECTOR_COMP:
+    case kind::BITVECTOR_NOT:
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_OR:
+    case kind::BITVECTOR_XOR:
+    case kind::BITVECTOR_NAND:
+    case kind::BITVECTOR_NOR:
+    case kind::BITVECTOR_XNOR:
+    case kind::BITVECTOR_NEG:
+    case kind::BITVECTOR_PLUS:
+    case kind::BITVECTOR_SUB:
+    case kind::BITVECTOR_MULT:
+    case kind::BITVECTOR_UDIV_TOTAL:
+    case kind::BITVECTOR_UREM_TOTAL:
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    case kind::BITVECTOR_ASHR:
+    case kind::BITVECTOR_CONCAT:
+    case kind::BITVECTOR_EXTRACT:
+    case kind::BITVECTOR_ZERO_EXTEND:
+    case kind::BITVECTOR_SIGN_EXTEND: return true;
+    default: return false;
+  }
+}
+
+bool getInverseValue(TNode node,
+                     unsigned i,
+                     const std::vector<BitVector>& values,
+                     const BitVector& target,
+                     BitVector& x)
+{
+  Kind k = node.getKind();
+  unsigned size = values[i].getSize();
+  BitVector zero(size);
+  BitVector ones = BitVector::mkOnes(size);
+  // the value of the other child of binary operators
+  BitVector s;
+  if (values.size() == 2)
+  {
+    s = values[1 - i];
+  }
+  bool isTrue = target.getSize() == 1 && target.isBitSet(0);
+
+  switch (k)
+  {
+    case kind::EQUAL:
+    case kind::BITVECTOR_COMP:
+      if (isTrue)
+      {
+        x = s;
+      }
+      else
+      {
+        BitVector diff = randomValue(size);
+        x = s ^ (diff == zero ? BitVector(size, 1u) : diff);
+      }
+      return true;
+    case kind::BITVECTOR_ULT:
+    case kind::BITVECTOR_ULE:
+    case kind::BITVECTOR_UGT:
+    case kind::BITVECTOR_UGE:
+    {
+      bool swapped = (i == 1) != (k == kind::BITVECTOR_UGT
+                                  || k == kind::BITVECTOR_UGE);
+      bool strict = k == kind::BITVECTOR_ULT || k == kind::BITVECTOR_UGT;
+      return inverseLessThan(s, swapped, strict, isTrue, x);
+    }
+    case kind::BITVECTOR_SLT:
+    case kind::BITVECTOR_SLE:
+    case kind::BITVECTOR_SGT:
+    case kind::BITVECTOR_SGE:
+    {
+      bool swapped = (i == 1) != (k == kind::BITVECTOR_SGT
+                                  || k == kind::BITVECTOR_SGE);
+      bool strict = k == kind::BITVECTOR_SLT || k == kind::BITVECTOR_SGT;
+      if (!inverseLessThan(flipSign(s), swapped, strict, isTrue, x))
+      {
+        return false;
+      }
+      x = flipSign(x);
+      return true;
+    }
+    case kind::BITVECTOR_NOT: x = ~target; return true;
+    case kind::BITVECTOR_NEG: x = -target; return true;
+    case kind::BITVECTOR_NAND:
+    case kind::BITVECTOR_NOR:
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_OR:
+    {
+      bool isAnd = k == kind::BITVECTOR_AND || k == kind::BITVECTOR_NAND;
+      BitVector bits = (k == kind::BITVECTOR_AND || k == kind::BITVECTOR_OR)
+                           ? target
+                           : ~target;
+      BitVector other = isAnd ? ones : zero;
+      for (unsigned j = 0; j < values.size(); ++j)
+      {
+        if (j != i)
+        {
+          const BitVector& v = values[j];
+          other = isAnd ? other & v : other | v;
+        }
+      }
+      if (isAnd)
+      {
+        // the bits set in the target must be set in the other children
+        if ((bits & ~other) != zero)
+        {
+          return false;
+        }
+        x = bits | (randomValue(size) & ~other);
+      }
+      else
+      {
+        // the bits set in the other children must be set in the target
+        if ((other & ~bits) != zero)
+        {
+          return false;
+        }
+        x = (bits & ~other) | (randomValue(size) & other);
+      }
+      return true;
+    }
+    case kind::BITVECTOR_XOR:
+    case kind::BITVECTOR_XNOR:
+    {
+      x = k == kind::BITVECTOR_XOR ? target : ~target;
+      for (unsigned j = 0; j < values.size(); ++j)
+      {
+        if (j != i)
+        {
+          x = x ^ values[j];
+        }
+      }
+      return true;
+    }
+    case kind::BITVECTOR_PLUS:
+    {
+      x = target;
+      for (unsigned j = 0; j < values.size(); ++j)
+      {
+        if (j != i)
+        {
+          x = x - values[j];
+        }
+      }
+      return true;
+    }
+    case kind::BITVECTOR_SUB: x = i == 0 ? target + s : s - target; return true;
+    case kind::BITVECTOR_MULT:
+    {
+      BitVector other(size, 1u);
+      for (unsigned j = 0; j < values.size(); ++j)
+      {
+        if (j != i)
+        {
+          other = other * values[j];
+        }
+      }
+      // x * other = target has a solution iff other has at most as many
+      // trailing zeros as target, the low bits are then determined by the
+      // inverse of the odd part of other
+      unsigned tz = countTrailingZeros(other);
+      if (tz == size)
+      {
+        x = randomValue(size);
+        return target == zero;
+      }
+      if (countTrailingZeros(target) < tz)
+      {
+        return false;
+      }
+      unsigned low = size - tz;
+      BitVector shift(size, tz);
+      BitVector odd = other.logicalRightShift(shift).extract(low - 1, 0);
+      BitVector rest = target.logicalRightShift(shift).extract(low - 1, 0);
+      Integer modulus = Integer(1).multiplyByPow2(low);
+      x = BitVector(low, rest.getValue() * odd.getValue().modInverse(modulus));
+      if (tz > 0)
+      {
+        x = randomValue(tz).concat(x);
+      }
+      return x * other == target;
+    }
+    case kind::BITVECTOR_UDIV_TOTAL:
+      if (i == 0)
+      {
+        // x / s = target
+        if (s == zero)
+        {
+          x = randomValue(size);
+          return target == ones;
+        }
+        Integer product = target.getValue() * s.getValue();
+        x = BitVector(size, product);
+        return x.getValue() == product && x.unsignedDivTotal(s) == target;
+      }
+      // s / x = target
+      if (target == ones)
+      {
+        // division by zero
+        x = zero;
+        return true;
+      }
+      if (target == zero)
+      {
+        return inverseLessThan(s, true, true, true, x);
+      }
+      x = s.unsignedDivTotal(target);
+      return x != zero && s.unsignedDivTotal(x) == target;
+    case kind::BITVECTOR_UREM_TOTAL:
+      if (i == 0)
+      {
+        // x % s = target
+        x = target;
+        return s == zero || target < s;
+      }
+      // s % x = target
+      if (s == target)
+      {
+        x = zero;
+        return true;
+      }
+      if (target < s)
+      {
+        x = s - target;
+        return target < x;
+      }
+      return false;
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    case kind::BITVECTOR_ASHR:
+    {
+      if (i == 0)
+      {
+        // shift back and check that no bits were lost
+        x = k == kind::BITVECTOR_SHL ? target.logicalRightShift(s)
+                                     : target.leftShift(s);
+      }
+      else
+      {
+        // find a shift amount that works
+        const BitVector& a = values[0];
+        unsigned amount = 0;
+        for (; amount <= size; ++amount)
+        {
+          BitVector shift(size, amount);
+          BitVector shifted =
+              k == kind::BITVECTOR_SHL
+                  ? a.leftShift(shift)
+                  : (k == kind::BITVECTOR_LSHR ? a.logicalRightShift(shift)
+                                               : a.arithRightShift(shift));
+          if (shifted == target)
+          {
+            break;
+          }
+        }
+        if (amount > size)
+        {
+          return false;
+        }
+        x = BitVector(size, amount);
+        return true;
+      }
+      BitVector shifted =
+          k == kind::BITVECTOR_SHL
+              ? x.leftShift(s)
+              : (k == kind::BITVECTOR_LSHR ? x.logicalRightShift(s)
+                                           : x.arithRightShift(s));
+      return shifted == target;
+    }
+    case kind::BITVECTOR_CONCAT:
+    {
+      unsigned lo = 0;
+      for (unsigned j = i + 1; j < values.size(); ++j)
+      {
+        lo += values[j].getSize();
+      }
+      x = target.extract(lo + size - 1, lo);
+      return true;
+    }
+    case kind::BITVECTOR_EXTRACT:
+    {
+      // replace the extracted bits of the current value
+      unsigned hi = utils::getExtractHigh(node);
+      unsigned lo = utils::getExtractLow(node);
+      const BitVector& current = values[0];
+      x = target;
+      if (lo > 0)
+      {
+        x = x.concat(current.extract(lo - 1, 0));
+      }
+      if (hi + 1 < size)
+      {
+        x = current.extract(size - 1, hi + 1).concat(x);
+      }
+      return true;
+    }
+    case kind::BITVECTOR_ZERO_EXTEND:
+    case kind::BITVECTOR_SIGN_EXTEND:
+    {
+      x = target.extract(size - 1, 0);
+      BitVector extended = k == kind::BITVECTOR_ZERO_EXTEND
+                               ? x.zeroExtend(utils::getSize(node) - size)
+                               : x.signExtend(utils::getSize(node) - size);
+      return extended == target;
+    }
+    default: return false;
+  }
+}
+
+}  // namespace inverse
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
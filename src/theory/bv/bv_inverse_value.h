@@ -0,0 +1,59 @@
+/*********************                                                        */
+/*! \file bv_inverse_value.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Inverse values of bit-vector operators
+ **
+ ** Computation of the values of the operands of bit-vector operators that
+ ** produce a given value, shared by the word-level local search procedures.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__BV__BV_INVERSE_VALUE_H
+#define CVC4__THEORY__BV__BV_INVERSE_VALUE_H
+
+#include <vector>
+
+#include "expr/node.h"
+#include "util/bitvector.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+namespace inverse {
+
+/** Returns a random value of the given width. */
+BitVector randomValue(unsigned size);
+
+/** Returns a random value in the unsigned interval [min, max]. */
+BitVector randomValue(const BitVector& min, const BitVector& max);
+
+/** Returns true if node is an operator supported by getInverseValue. */
+bool isSupported(Kind k);
+
+/**
+ * Computes a value x of the i-th child of node such that node has the value
+ * target if the other children keep the values in values, which holds the
+ * current values of all children. Predicates have the value 1 if they are
+ * true. Returns false if there is no such value.
+ */
+bool getInverseValue(TNode node,
+                     unsigned i,
+                     const std::vector<BitVector>& values,
+                     const BitVector& target,
+                     BitVector& x);
+
+}  // namespace inverse
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__BV__BV_INVERSE_VALUE_H */
@@ -0,0 +1,501 @@
+/*********************                                                        */
+/*! \file bv_sls.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Stochastic local search for bit-vector formulas
+ **
+ ** Stochastic local search for bit-vector formulas.
+ **/
+
+#include "theory/bv/bv_sls.h"
+
+#include <unordered_set>
+
+#include "options/bv_options.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/bv/bv_inverse_value.h"
+#include "theory/bv/bv_solver_lazy.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "theory/quantifiers/bv_inverter_utils.h"
+#include "theory/theory_model.h"
+#include "util/random.h"
+#include "util/resource_manager.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+namespace {
+
+bool isSupported(TNode n)
+{
+  if (n.isConst())
+  {
+    return true;
+  }
+  if (n.isVar())
+  {
+    return n.getType().isBoolean() || n.getType().isBitVector();
+  }
+  switch (n.getKind())
+  {
+    case kind::NOT:
+    case kind::AND:
+    case kind::OR:
+    case kind::XOR:
+    case kind::IMPLIES:
+    case kind::ITE: return true;
+    default: return inverse::isSupported(n.getKind());
+  }
+}
+
+}  // namespace
+
+SlsSolver::SlsSolver(BVSolverLazy* bv)
+    : d_bv(bv), d_numUnsat(0), d_hasModel(false), d_statistics()
+{
+}
+
+SlsSolver::~SlsSolver() {}
+
+bool SlsSolver::solve(const std::vector<Node>& assertions)
+{
+  TimerStat::CodeTimer solveTimer(d_statistics.d_solveTime);
+  ++(d_statistics.d_numCalls);
+  d_hasModel = false;
+  d_assertions = assertions;
+  d_vars.clear();
+  d_vars.resize(d_assertions.size());
+  d_occurrences.clear();
+  for (unsigned i = 0; i < d_assertions.size(); ++i)
+  {
+    if (!addAssertion(i))
+    {
+      ++(d_statistics.d_numUnsupported);
+      return false;
+    }
+  }
+
+  // start from the last model, new variables start at zero
+  NodeManager* nm = NodeManager::currentNM();
+  for (const std::pair<const Node, std::vector<unsigned>>& p : d_occurrences)
+  {
+    if (d_assignment.find(p.first) == d_assignment.end())
+    {
+      d_assignment[p.first] = p.first.getType().isBoolean()
+                                  ? nm->mkConst(false)
+                                  : utils::mkZero(utils::getSize(p.first));
+    }
+  }
+  d_isSat.assign(d_assertions.size(), false);
+  d_numUnsat = 0;
+  for (unsigned i = 0; i < d_assertions.size(); ++i)
+  {
+    d_isSat[i] = getValue(i, d_assertions[i]).isBitSet(0);
+    if (!d_isSat[i])
+    {
+      if (!d_hasVar[d_assertions[i]])
+      {
+        // no move can satisfy the assertion
+        return false;
+      }
+      ++d_numUnsat;
+    }
+  }
+
+  Random& rnd = Random::getRandom();
+  WallClockTimer timer;
+  timer.set(options::bvSlsTimeLimit());
+  std::vector<unsigned> unsat;
+  for (unsigned moves = 0; d_numUnsat > 0; ++moves)
+  {
+    if (moves >= options::bvSlsMoves() || timer.expired())
+    {
+      return false;
+    }
+    ++(d_statistics.d_numMoves);
+    d_bv->spendResource(ResourceManager::Resource::BvPropagationStep);
+
+    unsat.clear();
+    for (unsigned i = 0; i < d_assertions.size(); ++i)
+    {
+      if (!d_isSat[i])
+      {
+        unsat.push_back(i);
+      }
+    }
+    Node var;
+    BitVector value;
+    if (selectMove(unsat[rnd.pick(0, unsat.size() - 1)], var, value))
+    {
+      update(var, value);
+    }
+  }
+  ++(d_statistics.d_numSat);
+  d_hasModel = true;
+  return true;
+}
+
+bool SlsSolver::addAssertion(unsigned index)
+{
+  std::vector<Node>& vars = d_vars[index];
+  std::unordered_set<TNode, TNodeHashFunction> visited;
+  std::vector<std::pair<TNode, bool>> visit;
+  visit.emplace_back(d_assertions[index], false);
+  while (!visit.empty())
+  {
+    TNode current = visit.back().first;
+    bool childrenAdded = visit.back().second;
+    visit.pop_back();
+    if (!childrenAdded)
+    {
+      if (!visited.insert(current).second)
+      {
+        continue;
+      }
+      if (!isSupported(current))
+      {
+        return false;
+      }
+      if (current.isVar())
+      {
+        vars.push_back(current);
+        d_occurrences[current].push_back(index);
+        d_hasVar[current] = true;
+        continue;
+      }
+      visit.emplace_back(current, true);
+      for (TNode child : current)
+      {
+        visit.emplace_back(child, false);
+      }
+      continue;
+    }
+    bool hasVar = false;
+    for (TNode child : current)
+    {
+      hasVar = hasVar || d_hasVar[child];
+    }
+    d_hasVar[current] = hasVar;
+  }
+  return true;
+}
+
+BitVector SlsSolver::getValue(unsigned index, TNode n)
+{
+  const std::vector<Node>& vars = d_vars[index];
+  std::vector<Node> vals;
+  for (const Node& var : vars)
+  {
+    vals.push_back(d_assignment[var]);
+  }
+  Node res = d_evaluator.eval(n, vars, vals);
+  Assert(res.isConst());
+  if (res.getType().isBoolean())
+  {
+    return BitVector(1u, res.getConst<bool>() ? 1u : 0u);
+  }
+  return res.getConst<BitVector>();
+}
+
+bool SlsSolver::selectMove(unsigned index, Node& var, BitVector& value)
+{
+  Random& rnd = Random::getRandom();
+  TNode current = d_assertions[index];
+  BitVector target(1u, 1u);
+  while (!current.isVar())
+  {
+    Assert(d_hasVar[current]);
+    Kind k = current.getKind();
+    std::vector<BitVector> values;
+    for (TNode child : current)
+    {
+      values.push_back(getValue(index, child));
+    }
+    // the children that may change and the values they should have
+    std::vector<unsigned> candidates;
+    std::vector<BitVector> targets;
+    switch (k)
+    {
+      case kind::NOT:
+        candidates.push_back(0);
+        targets.push_back(~target);
+        break;
+      case kind::AND:
+      case kind::OR:
+      case kind::IMPLIES:
+        // the children that do not have the target value yet
+        for (unsigned i = 0; i < values.size(); ++i)
+        {
+          BitVector t = k == kind::IMPLIES && i == 0 ? ~target : target;
+          if (d_hasVar[current[i]] && values[i] != t)
+          {
+            candidates.push_back(i);
+            targets.push_back(t);
+          }
+        }
+        break;
+      case kind::XOR:
+        for (unsigned i = 0; i < values.size(); ++i)
+        {
+          if (d_hasVar[current[i]])
+          {
+            BitVector t = target;
+            for (unsigned j = 0; j < values.size(); ++j)
+            {
+              t = j == i ? t : t ^ values[j];
+            }
+            candidates.push_back(i);
+            targets.push_back(t);
+          }
+        }
+        break;
+      case kind::ITE:
+      {
+        // either change the selected branch or select the other one if it
+        // has the target value
+        bool cond = values[0].isBitSet(0);
+        unsigned branch = cond ? 1 : 2;
+        if (d_hasVar[current[branch]])
+        {
+          candidates.push_back(branch);
+          targets.push_back(target);
+        }
+        if (d_hasVar[current[0]]
+            && (values[3 - branch] == target || candidates.empty()))
+        {
+          candidates.push_back(0);
+          targets.push_back(BitVector(1u, cond ? 0u : 1u));
+        }
+        break;
+      }
+      default:
+      {
+        // prefer the children for which the target value can be reached
+        std::vector<unsigned> children;
+        std::vector<unsigned> invertible;
+        for (unsigned i = 0; i < values.size(); ++i)
+        {
+          if (d_hasVar[current[i]])
+          {
+            children.push_back(i);
+            if (isInvertible(current, i, values, target))
+            {
+              invertible.push_back(i);
+            }
+          }
+        }
+        BitVector x;
+        if (!invertible.empty())
+        {
+          unsigned i = invertible[rnd.pick(0, invertible.size() - 1)];
+          if (inverse::getInverseValue(current, i, values, target, x))
+          {
+            candidates.push_back(i);
+            targets.push_back(x);
+            break;
+          }
+        }
+        // otherwise change a random child to a random value
+        if (!children.empty())
+        {
+          unsigned i = children[rnd.pick(0, children.size() - 1)];
+          candidates.push_back(i);
+          targets.push_back(inverse::randomValue(values[i].getSize()));
+        }
+        break;
+      }
+    }
+    if (candidates.empty())
+    {
+      return false;
+    }
+    unsigned j = rnd.pick(0, candidates.size() - 1);
+    current = current[candidates[j]];
+    target = targets[j];
+  }
+  var = current;
+  value = target;
+  return true;
+}
+
+bool SlsSolver::isInvertible(TNode n,
+                             unsigned i,
+                             const std::vector<BitVector>& values,
+                             const BitVector& target)
+{
+  switch (n.getKind())
+  {
+    case kind::BITVECTOR_ULT:
+    case kind::BITVECTOR_UGT:
+    case kind::BITVECTOR_SLT:
+    case kind::BITVECTOR_SGT:
+    case kind::BITVECTOR_MULT:
+    case kind::BITVECTOR_UREM_TOTAL:
+    case kind::BITVECTOR_UDIV_TOTAL:
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_OR:
+    case kind::BITVECTOR_SHL:
+    case kind::BITVECTOR_LSHR:
+    case kind::BITVECTOR_ASHR: break;
+    // the other operators can always be inverted or have no invertibility
+    // condition, getInverseValue decides
+    default: return true;
+  }
+  NodeManager* nm = NodeManager::currentNM();
+  Kind k = n.getKind();
+  // the value of the other children as one operand
+  BitVector s = values[i == 0 ? 1 : 0];
+  for (unsigned j = i == 0 ? 2 : 1; j < values.size(); ++j)
+  {
+    if (j == i)
+    {
+      continue;
+    }
+    if (k == kind::BITVECTOR_MULT)
+    {
+      s = s * values[j];
+    }
+    else if (k == kind::BITVECTOR_AND)
+    {
+      s = s & values[j];
+    }
+    else
+    {
+      Assert(k == kind::BITVECTOR_OR);
+      s = s | values[j];
+    }
+  }
+  // only the condition on s and t is used, which does not contain x
+  Node x = n[i];
+  Node sc = nm->mkConst(s);
+  Node t = nm->mkConst(target);
+  bool pol = target.isBitSet(0);
+  Node ic;
+  switch (k)
+  {
+    case kind::BITVECTOR_ULT:
+    case kind::BITVECTOR_UGT:
+    {
+      Kind litk = i == 0 ? k
+                         : (k == kind::BITVECTOR_ULT ? kind::BITVECTOR_UGT
+                                                     : kind::BITVECTOR_ULT);
+      ic = quantifiers::utils::getICBvUltUgt(pol, litk, x, sc);
+      break;
+    }
+    case kind::BITVECTOR_SLT:
+    case kind::BITVECTOR_SGT:
+    {
+      Kind litk = i == 0 ? k
+                         : (k == kind::BITVECTOR_SLT ? kind::BITVECTOR_SGT
+                                                     : kind::BITVECTOR_SLT);
+      ic = quantifiers::utils::getICBvSltSgt(pol, litk, x, sc);
+      break;
+    }
+    case kind::BITVECTOR_MULT:
+      ic = quantifiers::utils::getICBvMult(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_UREM_TOTAL:
+      ic = quantifiers::utils::getICBvUrem(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_UDIV_TOTAL:
+      ic = quantifiers::utils::getICBvUdiv(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_AND:
+    case kind::BITVECTOR_OR:
+      ic = quantifiers::utils::getICBvAndOr(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_SHL:
+      ic = quantifiers::utils::getICBvShl(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_LSHR:
+      ic = quantifiers::utils::getICBvLshr(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    case kind::BITVECTOR_ASHR:
+      ic = quantifiers::utils::getICBvAshr(true, kind::EQUAL, k, i, x, sc, t);
+      break;
+    default: return true;
+  }
+  // the invertibility conditions have the form (=> ic (op x s t)), the
+  // literal itself is returned if the operator can always be inverted
+  if (ic.getKind() != kind::IMPLIES)
+  {
+    return true;
+  }
+  Node res = d_evaluator.eval(ic[0], {}, {});
+  return res.isConst() && res.getConst<bool>();
+}
+
+void SlsSolver::update(TNode var, const BitVector& value)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  d_assignment[var] = var.getType().isBoolean()
+                          ? nm->mkConst(value.isBitSet(0))
+                          : nm->mkConst(value);
+  for (unsigned i : d_occurrences[var])
+  {
+    bool isSat = getValue(i, d_assertions[i]).isBitSet(0);
+    if (isSat != d_isSat[i])
+    {
+      d_isSat[i] = isSat;
+      if (isSat)
+      {
+        --d_numUnsat;
+      }
+      else
+      {
+        ++d_numUnsat;
+      }
+    }
+  }
+}
+
+bool SlsSolver::collectModelInfo(TheoryModel* m)
+{
+  Assert(d_hasModel);
+  for (const std::pair<const Node, std::vector<unsigned>>& p : d_occurrences)
+  {
+    Debug("bitvector-model") << "SlsSolver::collectModelInfo (assert (= "
+                             << p.first << " " << d_assignment[p.first]
+                             << "))\n";
+    if (!m->assertEquality(p.first, d_assignment[p.first], true))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+SlsSolver::Statistics::Statistics()
+    : d_numCalls("theory::bv::sls::NumCalls", 0),
+      d_numSat("theory::bv::sls::NumSat", 0),
+      d_numUnsupported("theory::bv::sls::NumUnsupported", 0),
+      d_numMoves("theory::bv::sls::NumMoves", 0),
+      d_solveTime("theory::bv::sls::SolveTime")
+{
+  smtStatisticsRegistry()->registerStat(&d_numCalls);
+  smtStatisticsRegistry()->registerStat(&d_numSat);
+  smtStatisticsRegistry()->registerStat(&d_numUnsupported);
+  smtStatisticsRegistry()->registerStat(&d_numMoves);
+  smtStatisticsRegistry()->registerStat(&d_solveTime);
+}
+
+SlsSolver::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_numCalls);
+  smtStatisticsRegistry()->unregisterStat(&d_numSat);
+  smtStatisticsRegistry()->unregisterStat(&d_numUnsupported);
+  smtStatisticsRegistry()->unregisterStat(&d_numMoves);
+  smtStatisticsRegistry()->unregisterStat(&d_solveTime);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
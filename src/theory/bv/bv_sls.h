@@ -0,0 +1,132 @@
+/*********************                                                        */
+/*! \file bv_sls.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Stochastic local search for bit-vector formulas
+ **
+ ** A stochastic local search that is run on the assertions of the eager
+ ** bit-vector solver before the SAT solver is called. Starting from the last
+ ** model, each move selects an unsatisfied assertion and propagates the value
+ ** it should have down to a variable, choosing children whose operator can be
+ ** inverted according to the invertibility conditions of the quantifier
+ ** instantiation for bit-vectors (Niemetz et al., CAV 2018). Terms are
+ ** evaluated with the Evaluator. The search gives up after a time limit and a
+ ** maximum number of moves, the SAT solver then decides the assertions.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__BV__BV_SLS_H
+#define CVC4__THEORY__BV__BV_SLS_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "theory/evaluator.h"
+#include "util/bitvector.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+
+class TheoryModel;
+
+namespace bv {
+
+class BVSolverLazy;
+
+/**
+ * SlsSolver
+ */
+class SlsSolver
+{
+ public:
+  SlsSolver(BVSolverLazy* bv);
+  ~SlsSolver();
+
+  /**
+   * Searches for a model of the assertions within the limits given by the
+   * options, returns true if one is found.
+   */
+  bool solve(const std::vector<Node>& assertions);
+  /** Adds the values of the variables in the model found by solve to m. */
+  bool collectModelInfo(TheoryModel* m);
+
+ private:
+  struct Statistics
+  {
+    IntStat d_numCalls;
+    IntStat d_numSat;
+    IntStat d_numUnsupported;
+    IntStat d_numMoves;
+    TimerStat d_solveTime;
+    Statistics();
+    ~Statistics();
+  };
+
+  /**
+   * Adds the variables of the assertion to d_vars and d_occurrences. Returns
+   * false if it contains a term that is not supported.
+   */
+  bool addAssertion(unsigned index);
+  /** Returns the value of n, Boolean terms have values of width 1. */
+  BitVector getValue(unsigned index, TNode n);
+  /**
+   * Propagates the value true of the index-th assertion down to a variable.
+   * Returns false if no variable can be reached, otherwise var and value are
+   * the move.
+   */
+  bool selectMove(unsigned index, Node& var, BitVector& value);
+  /**
+   * Returns true if the invertibility condition of the i-th child of n holds,
+   * that is, if n can have the value target by only changing the value of
+   * the i-th child. The values of the children are given by values.
+   */
+  bool isInvertible(TNode n,
+                    unsigned i,
+                    const std::vector<BitVector>& values,
+                    const BitVector& target);
+  /** Sets the value of a variable and re-evaluates its assertions. */
+  void update(TNode var, const BitVector& value);
+
+  BVSolverLazy* d_bv;
+  Evaluator d_evaluator;
+
+  /** The assertions of the current call to solve. */
+  std::vector<Node> d_assertions;
+  /** The variables of each assertion. */
+  std::vector<std::vector<Node>> d_vars;
+  /** The assertions each variable occurs in. */
+  std::unordered_map<Node, std::vector<unsigned>, NodeHashFunction>
+      d_occurrences;
+  /** Whether a term contains a variable. */
+  std::unordered_map<Node, bool, NodeHashFunction> d_hasVar;
+  /** Whether each assertion is satisfied by the current assignment. */
+  std::vector<bool> d_isSat;
+  /** The number of unsatisfied assertions. */
+  unsigned d_numUnsat;
+
+  /**
+   * The current values of the variables, kept across calls to solve such
+   * that the search starts from the last model.
+   */
+  std::unordered_map<Node, Node, NodeHashFunction> d_assignment;
+  /** Whether the current assignment satisfies the last assertions. */
+  bool d_hasModel;
+
+  Statistics d_statistics;
+}; /* class SlsSolver */
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__BV__BV_SLS_H */
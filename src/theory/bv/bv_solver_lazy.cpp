@@ -25,6 +25,7 @@
 #include "theory/bv/bv_subtheory_bitblast.h"
 #include "theory/bv/bv_subtheory_core.h"
 #include "theory/bv/bv_subtheory_inequality.h"
+#include "theory/bv/bv_subtheory_propagation.h"
 #include "theory/bv/theory_bv_rewrite_rules_normalization.h"
 #include "theory/bv/theory_bv_rewrite_rules_simplification.h"
 #include "theory/bv/theory_bv_rewriter.h"
@@ -85,6 +86,12 @@ BVSolverLazy::BVSolverLazy(TheoryBV& bv,
     d_subtheoryMap[SUB_ALGEBRAIC] = d_subtheories.back().get();
   }
 
+  if (options::bitvectorPropagationSolver())
+  {
+    d_subtheories.emplace_back(new PropagationSolver(c, this));
+    d_subtheoryMap[SUB_PROPAGATION] = d_subtheories.back().get();
+  }
+
   BitblastSolver* bb_solver = new BitblastSolver(c, this);
   if (options::bvAbstraction())
   {
@@ -795,7 +802,7 @@ bool BVSolverLazy::applyAbstraction(const std::vector<Node>& assertions,
   bool changed =
       d_abstractionModule->applyAbstraction(assertions, new_assertions);
   if (changed && options::bitblastMode() == options::BitblastMode::EAGER
-      && options::bitvectorAig())
+      && (options::bitvectorAig() || options::bitvectorNativeAig()))
   {
     // disable AIG mode
     AlwaysAssert(!d_eagerSolver->isInitialized());
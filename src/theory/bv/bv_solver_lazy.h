@@ -35,6 +35,7 @@ namespace bv {
 class CoreSolver;
 class InequalitySolver;
 class AlgebraicSolver;
+class PropagationSolver;
 class BitblastSolver;
 class EagerBitblastSolver;
 class AbstractionModule;
@@ -218,11 +219,13 @@ class BVSolverLazy : public BVSolver
   friend class LazyBitblaster;
   friend class TLazyBitblaster;
   friend class EagerBitblaster;
+  friend class NativeAigBitblaster;
   friend class BitblastSolver;
   friend class EqualitySolver;
   friend class CoreSolver;
   friend class InequalitySolver;
   friend class AlgebraicSolver;
+  friend class PropagationSolver;
   friend class EagerBitblastSolver;
 }; /* class BVSolverLazy */
 
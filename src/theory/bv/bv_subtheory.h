@@ -35,7 +35,8 @@ enum SubTheory {
   SUB_CORE = 1,
   SUB_BITBLAST = 2,
   SUB_INEQUALITY = 3,
-  SUB_ALGEBRAIC = 4
+  SUB_ALGEBRAIC = 4,
+  SUB_PROPAGATION = 5
 };
 
 inline std::ostream& operator<<(std::ostream& out, SubTheory subtheory) {
@@ -48,6 +49,8 @@ inline std::ostream& operator<<(std::ostream& out, SubTheory subtheory) {
       return out << "BV_INEQUALITY_SUBTHEORY";
     case SUB_ALGEBRAIC:
       return out << "BV_ALGEBRAIC_SUBTHEORY";
+    case SUB_PROPAGATION:
+      return out << "BV_PROPAGATION_SUBTHEORY";
     default:
       break;
   }
@@ -0,0 +1,813 @@
+/*********************                                                        */
+/*! \file bv_subtheory_propagation.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Word-level propagation solver for bit-vectors
+ **
+ ** Word-level propagation solver for bit-vectors.
+ **/
+
+#include "theory/bv/bv_subtheory_propagation.h"
+
+#include <set>
+
+#include "options/bv_options.h"
+#include "smt/smt_statistics_registry.h"
+#include "theory/bv/bv_inverse_value.h"
+#include "theory/bv/bv_solver_lazy.h"
+#include "theory/bv/theory_bv_utils.h"
+#include "theory/theory_model.h"
+#include "util/random.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+namespace {
+
+BitVector mkBool(bool value) { return BitVector(1u, value ? 1u : 0u); }
+
+/** Returns value with its bits moved to [lo + width(value) - 1, lo]. */
+BitVector place(const BitVector& value, unsigned size, unsigned lo)
+{
+  BitVector res = value.zeroExtend(size - value.getSize());
+  return res.leftShift(BitVector(size, lo));
+}
+
+}  // namespace
+
+PropagationDomain::PropagationDomain(unsigned size)
+    : d_size(size),
+      d_mask(size),
+      d_bits(size),
+      d_min(size),
+      d_max(BitVector::mkOnes(size))
+{
+}
+
+bool PropagationDomain::fix(const BitVector& mask, const BitVector& bits)
+{
+  if (((d_mask & mask) & (d_bits ^ bits)) != BitVector(d_size))
+  {
+    return false;
+  }
+  d_bits = d_bits | (bits & mask);
+  d_mask = d_mask | mask;
+  BitVector value;
+  return nextFixed(d_min, true, value) && value <= d_max;
+}
+
+bool PropagationDomain::restrictInterval(const BitVector& min,
+                                         const BitVector& max)
+{
+  if (d_min < min)
+  {
+    d_min = min;
+  }
+  if (max < d_max)
+  {
+    d_max = max;
+  }
+  BitVector value;
+  return d_min <= d_max && nextFixed(d_min, true, value) && value <= d_max;
+}
+
+bool PropagationDomain::isFixed() const
+{
+  return d_mask == BitVector::mkOnes(d_size) || d_min == d_max;
+}
+
+bool PropagationDomain::contains(const BitVector& value) const
+{
+  return (value & d_mask) == d_bits && d_min <= value && value <= d_max;
+}
+
+bool PropagationDomain::project(const BitVector& value, BitVector& res) const
+{
+  res = (value & ~d_mask) | d_bits;
+  if (res < d_min)
+  {
+    return nextFixed(d_min, true, res) && res <= d_max;
+  }
+  if (d_max < res)
+  {
+    return nextFixed(d_max, false, res) && d_min <= res;
+  }
+  return true;
+}
+
+bool PropagationDomain::nextFixed(const BitVector& value,
+                                  bool up,
+                                  BitVector& res) const
+{
+  // Walk from the most significant bit while the result equals value. A free
+  // bit of value that is 0 (1 if !up) can be flipped to move past value, the
+  // lowest such bit is remembered for fixed bits that force a backtrack.
+  std::vector<bool> bits(d_size);
+  unsigned i = d_size;
+  bool found = false;
+  while (i > 0)
+  {
+    --i;
+    bool v = value.isBitSet(i);
+    if (!d_mask.isBitSet(i))
+    {
+      bits[i] = v;
+      continue;
+    }
+    bool b = d_bits.isBitSet(i);
+    bits[i] = b;
+    if (b == v)
+    {
+      continue;
+    }
+    if (b != up)
+    {
+      // the prefix is already smaller (larger if !up) than value, find the
+      // lowest free bit above i that can be flipped
+      unsigned j = i + 1;
+      while (j < d_size && (d_mask.isBitSet(j) || value.isBitSet(j) == up))
+      {
+        ++j;
+      }
+      if (j == d_size)
+      {
+        return false;
+      }
+      bits[j] = up;
+      i = j;
+    }
+    found = true;
+    break;
+  }
+  // fill the bits below the first difference with the extreme free values
+  if (found)
+  {
+    while (i > 0)
+    {
+      --i;
+      bits[i] = d_mask.isBitSet(i) ? d_bits.isBitSet(i) : !up;
+    }
+  }
+  res = BitVector(d_size);
+  for (unsigned k = 0; k < d_size; ++k)
+  {
+    if (bits[k])
+    {
+      res = res.setBit(k);
+    }
+  }
+  return true;
+}
+
+PropagationSolver::PropagationSolver(context::Context* c, BVSolverLazy* bv)
+    : SubtheorySolver(c, bv),
+      d_terms(),
+      d_termIndex(),
+      d_domains(),
+      d_roots(),
+      d_model(),
+      d_isComplete(c, false),
+      d_budget(options::bitvectorPropagationBudget()),
+      d_numSolved(0),
+      d_numCalls(0),
+      d_statistics()
+{
+}
+
+PropagationSolver::~PropagationSolver() {}
+
+void PropagationSolver::assertFact(TNode fact)
+{
+  d_assertionQueue.push_back(fact);
+  d_isComplete.set(false);
+}
+
+bool PropagationSolver::useHeuristic()
+{
+  // give up on problems where the search keeps failing, as the bit-blaster
+  // has to decide them anyway
+  if (d_numCalls < 16)
+  {
+    return true;
+  }
+  return d_numSolved * 8 >= d_numCalls;
+}
+
+bool PropagationSolver::check(Theory::Effort e)
+{
+  Assert(options::bitblastMode() == options::BitblastMode::LAZY);
+
+  if (!Theory::fullEffort(e)) { return true; }
+  if (d_isComplete.get()) { return true; }
+  if (!useHeuristic()) { return true; }
+
+  TimerStat::CodeTimer propagationTimer(d_statistics.d_solveTime);
+  Debug("bv-subtheory-propagation")
+      << "PropagationSolver::check (" << e << ")\n";
+  ++d_numCalls;
+  ++(d_statistics.d_numCallsToCheck);
+
+  d_terms.clear();
+  d_termIndex.clear();
+  d_domains.clear();
+  d_roots.clear();
+  for (AssertionQueue::const_iterator it = assertionsBegin();
+       it != assertionsEnd();
+       ++it)
+  {
+    if (!addAssertion(*it))
+    {
+      Debug("bv-subtheory-propagation") << " Unsupported: " << *it << "\n";
+      ++(d_statistics.d_numUnsupported);
+      return true;
+    }
+  }
+
+  if (!propagateDomains() || !search())
+  {
+    Debug("bv-subtheory-propagation") << " Unknown.\n";
+    ++(d_statistics.d_numUnknown);
+    return true;
+  }
+
+  Debug("bv-subtheory-propagation") << " SAT.\n";
+  ++(d_statistics.d_numSat);
+  ++d_numSolved;
+  d_model.clear();
+  for (const std::pair<const unsigned, PropagationDomain>& d : d_domains)
+  {
+    const Term& var = d_terms[d.first];
+    d_model[var.d_node] = var.d_value;
+  }
+  d_isComplete.set(true);
+  return true;
+}
+
+bool PropagationSolver::addAssertion(TNode assertion)
+{
+  bool pol = assertion.getKind() != kind::NOT;
+  TNode atom = pol ? assertion : assertion[0];
+  if (!atom.getType().isBoolean() || !inverse::isSupported(atom.getKind())
+      || (atom.getKind() == kind::EQUAL && !atom[0].getType().isBitVector()))
+  {
+    return false;
+  }
+
+  std::vector<std::pair<TNode, bool>> visit;
+  visit.emplace_back(atom, false);
+  while (!visit.empty())
+  {
+    TNode current = visit.back().first;
+    bool childrenAdded = visit.back().second;
+    visit.pop_back();
+    if (d_termIndex.find(current) != d_termIndex.end())
+    {
+      continue;
+    }
+    if (d_bv->isSharedTerm(current))
+    {
+      // the values of shared terms must agree with the other theories
+      return false;
+    }
+    bool isAtom = current.getType().isBoolean();
+    if (!isAtom && !current.getType().isBitVector())
+    {
+      return false;
+    }
+    if (!childrenAdded && current.getNumChildren() > 0)
+    {
+      if (!inverse::isSupported(current.getKind())
+          || (isAtom && current != atom))
+      {
+        return false;
+      }
+      visit.emplace_back(current, true);
+      for (TNode child : current)
+      {
+        visit.emplace_back(child, false);
+      }
+      continue;
+    }
+
+    unsigned index = d_terms.size();
+    d_terms.emplace_back(current, isAtom ? 1 : utils::getSize(current));
+    d_termIndex[current] = index;
+    Term& term = d_terms.back();
+    if (current.getKind() == kind::CONST_BITVECTOR)
+    {
+      term.d_value = current.getConst<BitVector>();
+      term.d_isFixed = true;
+    }
+    else if (current.isVar())
+    {
+      d_domains.emplace(index, PropagationDomain(term.d_size));
+    }
+    else if (current.getNumChildren() == 0)
+    {
+      return false;
+    }
+    for (TNode child : current)
+    {
+      unsigned c = d_termIndex[child];
+      term.d_children.push_back(c);
+      d_terms[c].d_parents.push_back(index);
+    }
+  }
+  d_roots.emplace_back(d_termIndex[atom], pol);
+  return true;
+}
+
+bool PropagationSolver::propagateDomains()
+{
+  for (const std::pair<unsigned, bool>& root : d_roots)
+  {
+    const Term& atom = d_terms[root.first];
+    unsigned a = atom.d_children[0];
+    unsigned b = atom.d_children[1];
+    bool aIsConst = d_terms[a].d_node.getKind() == kind::CONST_BITVECTOR;
+    bool bIsConst = d_terms[b].d_node.getKind() == kind::CONST_BITVECTOR;
+    if (aIsConst == bIsConst)
+    {
+      continue;
+    }
+    Kind k = atom.d_node.getKind();
+    if (k == kind::EQUAL)
+    {
+      if (!root.second)
+      {
+        continue;
+      }
+      unsigned var = aIsConst ? b : a;
+      const BitVector& value = d_terms[aIsConst ? a : b].d_value;
+      if (!propagateValue(
+              var, BitVector::mkOnes(value.getSize()), value))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    // normalize to lhs < rhs or lhs <= rhs
+    bool swap = k == kind::BITVECTOR_UGT || k == kind::BITVECTOR_UGE;
+    bool strict = k == kind::BITVECTOR_ULT || k == kind::BITVECTOR_UGT;
+    if (!swap && !strict && k != kind::BITVECTOR_ULE)
+    {
+      continue;
+    }
+    if (!root.second)
+    {
+      swap = !swap;
+      strict = !strict;
+    }
+    unsigned lhs = swap ? b : a;
+    unsigned rhs = swap ? a : b;
+    if (d_domains.find(lhs) == d_domains.end()
+        && d_domains.find(rhs) == d_domains.end())
+    {
+      continue;
+    }
+    unsigned size = d_terms[lhs].d_size;
+    BitVector zero(size);
+    BitVector ones = BitVector::mkOnes(size);
+    if (d_domains.find(lhs) != d_domains.end())
+    {
+      BitVector max = d_terms[rhs].d_value;
+      if (strict)
+      {
+        if (max == zero)
+        {
+          return false;
+        }
+        max = max - BitVector(size, 1u);
+      }
+      if (!d_domains.at(lhs).restrictInterval(zero, max))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      BitVector min = d_terms[lhs].d_value;
+      if (strict)
+      {
+        if (min == ones)
+        {
+          return false;
+        }
+        min = min + BitVector(size, 1u);
+      }
+      if (!d_domains.at(rhs).restrictInterval(min, ones))
+      {
+        return false;
+      }
+    }
+  }
+
+  for (unsigned i = 0; i < d_terms.size(); ++i)
+  {
+    Term& term = d_terms[i];
+    if (term.d_node.getKind() == kind::CONST_BITVECTOR)
+    {
+      continue;
+    }
+    std::unordered_map<unsigned, PropagationDomain>::const_iterator it =
+        d_domains.find(i);
+    if (it != d_domains.end())
+    {
+      term.d_isFixed = it->second.isFixed();
+      continue;
+    }
+    term.d_isFixed = true;
+    for (unsigned c : term.d_children)
+    {
+      term.d_isFixed = term.d_isFixed && d_terms[c].d_isFixed;
+    }
+  }
+  return true;
+}
+
+bool PropagationSolver::propagateValue(unsigned term,
+                                       BitVector mask,
+                                       BitVector value)
+{
+  const Term& t = d_terms[term];
+  unsigned size = t.d_size;
+  if (mask == BitVector(size))
+  {
+    return true;
+  }
+  std::unordered_map<unsigned, PropagationDomain>::iterator it =
+      d_domains.find(term);
+  if (it != d_domains.end())
+  {
+    return it->second.fix(mask, value & mask);
+  }
+
+  switch (t.d_node.getKind())
+  {
+    case kind::CONST_BITVECTOR:
+      return ((t.d_value ^ value) & mask) == BitVector(size);
+    case kind::BITVECTOR_NOT:
+      return propagateValue(t.d_children[0], mask, ~value);
+    case kind::BITVECTOR_CONCAT:
+    {
+      unsigned hi = size;
+      for (unsigned c : t.d_children)
+      {
+        unsigned lo = hi - d_terms[c].d_size;
+        if (!propagateValue(
+                c, mask.extract(hi - 1, lo), value.extract(hi - 1, lo)))
+        {
+          return false;
+        }
+        hi = lo;
+      }
+      return true;
+    }
+    case kind::BITVECTOR_EXTRACT:
+    {
+      unsigned c = t.d_children[0];
+      unsigned lo = utils::getExtractLow(t.d_node);
+      return propagateValue(c,
+                            place(mask, d_terms[c].d_size, lo),
+                            place(value, d_terms[c].d_size, lo));
+    }
+    case kind::BITVECTOR_ZERO_EXTEND:
+    {
+      unsigned c = t.d_children[0];
+      unsigned csize = d_terms[c].d_size;
+      if (size > csize
+          && (mask.extract(size - 1, csize) & value.extract(size - 1, csize))
+                 != BitVector(size - csize))
+      {
+        return false;
+      }
+      return propagateValue(
+          c, mask.extract(csize - 1, 0), value.extract(csize - 1, 0));
+    }
+    case kind::BITVECTOR_SIGN_EXTEND:
+    {
+      unsigned c = t.d_children[0];
+      unsigned csize = d_terms[c].d_size;
+      return propagateValue(
+          c, mask.extract(csize - 1, 0), value.extract(csize - 1, 0));
+    }
+    case kind::BITVECTOR_XOR:
+    case kind::BITVECTOR_PLUS:
+    {
+      // only one child may depend on variables
+      bool isXor = t.d_node.getKind() == kind::BITVECTOR_XOR;
+      if (!isXor && mask != BitVector::mkOnes(size))
+      {
+        return true;
+      }
+      unsigned var = t.d_children.size();
+      BitVector other(size);
+      for (unsigned i = 0; i < t.d_children.size(); ++i)
+      {
+        const Term& c = d_terms[t.d_children[i]];
+        if (c.d_node.getKind() != kind::CONST_BITVECTOR)
+        {
+          if (var != t.d_children.size())
+          {
+            return true;
+          }
+          var = i;
+          continue;
+        }
+        other = isXor ? other ^ c.d_value : other + c.d_value;
+      }
+      if (var == t.d_children.size())
+      {
+        return ((other ^ value) & mask) == BitVector(size);
+      }
+      return propagateValue(t.d_children[var],
+                            mask,
+                            isXor ? value ^ other : value - other);
+    }
+    default: return true;
+  }
+}
+
+BitVector PropagationSolver::evaluate(unsigned term) const
+{
+  const Term& t = d_terms[term];
+  Kind k = t.d_node.getKind();
+  if (t.d_children.empty())
+  {
+    return t.d_value;
+  }
+  const BitVector& a = d_terms[t.d_children[0]].d_value;
+  switch (k)
+  {
+    case kind::EQUAL:
+    case kind::BITVECTOR_COMP:
+      return mkBool(a == d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_ULT:
+      return mkBool(a < d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_ULE:
+      return mkBool(a <= d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_UGT:
+      return mkBool(a > d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_UGE:
+      return mkBool(a >= d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_SLT:
+      return mkBool(a.signedLessThan(d_terms[t.d_children[1]].d_value));
+    case kind::BITVECTOR_SLE:
+      return mkBool(a.signedLessThanEq(d_terms[t.d_children[1]].d_value));
+    case kind::BITVECTOR_SGT:
+      return mkBool(d_terms[t.d_children[1]].d_value.signedLessThan(a));
+    case kind::BITVECTOR_SGE:
+      return mkBool(d_terms[t.d_children[1]].d_value.signedLessThanEq(a));
+    case kind::BITVECTOR_NOT: return ~a;
+    case kind::BITVECTOR_NEG: return -a;
+    case kind::BITVECTOR_NAND: return ~(a & d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_NOR: return ~(a | d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_XNOR: return ~(a ^ d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_SUB: return a - d_terms[t.d_children[1]].d_value;
+    case kind::BITVECTOR_UDIV_TOTAL:
+      return a.unsignedDivTotal(d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_UREM_TOTAL:
+      return a.unsignedRemTotal(d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_SHL:
+      return a.leftShift(d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_LSHR:
+      return a.logicalRightShift(d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_ASHR:
+      return a.arithRightShift(d_terms[t.d_children[1]].d_value);
+    case kind::BITVECTOR_EXTRACT:
+      return a.extract(utils::getExtractHigh(t.d_node),
+                       utils::getExtractLow(t.d_node));
+    case kind::BITVECTOR_ZERO_EXTEND: return a.zeroExtend(t.d_size - a.getSize());
+    case kind::BITVECTOR_SIGN_EXTEND: return a.signExtend(t.d_size - a.getSize());
+    default: break;
+  }
+
+  // n-ary operators
+  BitVector res = a;
+  for (unsigned i = 1; i < t.d_children.size(); ++i)
+  {
+    const BitVector& b = d_terms[t.d_children[i]].d_value;
+    switch (k)
+    {
+      case kind::BITVECTOR_AND: res = res & b; break;
+      case kind::BITVECTOR_OR: res = res | b; break;
+      case kind::BITVECTOR_XOR: res = res ^ b; break;
+      case kind::BITVECTOR_PLUS: res = res + b; break;
+      case kind::BITVECTOR_MULT: res = res * b; break;
+      case kind::BITVECTOR_CONCAT: res = res.concat(b); break;
+      default: Unreachable() << "unsupported operator " << k;
+    }
+  }
+  return res;
+}
+
+void PropagationSolver::update(unsigned var, const BitVector& value)
+{
+  d_terms[var].d_value = value;
+  // parents have larger indices than their children
+  std::set<unsigned> queue(d_terms[var].d_parents.begin(),
+                           d_terms[var].d_parents.end());
+  while (!queue.empty())
+  {
+    unsigned term = *queue.begin();
+    queue.erase(queue.begin());
+    BitVector newValue = evaluate(term);
+    if (newValue != d_terms[term].d_value)
+    {
+      d_terms[term].d_value = newValue;
+      queue.insert(d_terms[term].d_parents.begin(),
+                   d_terms[term].d_parents.end());
+    }
+  }
+}
+
+bool PropagationSolver::search()
+{
+  Random& rnd = Random::getRandom();
+
+  // start from the last model, which is often close to one of the current
+  // assertions in incremental and DPLL(T) search
+  for (std::pair<const unsigned, PropagationDomain>& d : d_domains)
+  {
+    Term& var = d_terms[d.first];
+    std::unordered_map<Node, BitVector, NodeHashFunction>::const_iterator it =
+        d_model.find(var.d_node);
+    BitVector start =
+        it != d_model.end() ? it->second : BitVector(var.d_size);
+    if (!d.second.project(start, var.d_value))
+    {
+      return false;
+    }
+  }
+  for (unsigned i = 0; i < d_terms.size(); ++i)
+  {
+    d_terms[i].d_value = evaluate(i);
+  }
+
+  std::vector<unsigned> unsat;
+  for (unsigned moves = 0;; ++moves)
+  {
+    unsat.clear();
+    for (unsigned i = 0; i < d_roots.size(); ++i)
+    {
+      if (d_terms[d_roots[i].first].d_value.isBitSet(0) != d_roots[i].second)
+      {
+        unsat.push_back(i);
+      }
+    }
+    if (unsat.empty())
+    {
+      return true;
+    }
+    if (moves >= d_budget)
+    {
+      return false;
+    }
+    ++(d_statistics.d_numMoves);
+    d_bv->spendResource(ResourceManager::Resource::BvPropagationStep);
+
+    // propagate the target value of a random unsatisfied root down to a
+    // variable, preferring children for which the operator can be inverted
+    const std::pair<unsigned, bool>& root =
+        d_roots[unsat[rnd.pick(0, unsat.size() - 1)]];
+    if (d_terms[root.first].d_isFixed)
+    {
+      return false;
+    }
+    unsigned current = root.first;
+    BitVector target = mkBool(root.second);
+    while (d_domains.find(current) == d_domains.end())
+    {
+      const Term& t = d_terms[current];
+      std::vector<unsigned> candidates;
+      for (unsigned i = 0; i < t.d_children.size(); ++i)
+      {
+        if (!d_terms[t.d_children[i]].d_isFixed)
+        {
+          candidates.push_back(i);
+        }
+      }
+      if (candidates.empty())
+      {
+        break;
+      }
+      unsigned first = rnd.pick(0, candidates.size() - 1);
+      unsigned chosen = t.d_children.size();
+      BitVector x;
+      for (unsigned j = 0; j < candidates.size(); ++j)
+      {
+        unsigned i = candidates[(first + j) % candidates.size()];
+        if (inverseValue(current, i, target, x))
+        {
+          chosen = i;
+          break;
+        }
+      }
+      if (chosen == t.d_children.size())
+      {
+        chosen = candidates[first];
+        x = inverse::randomValue(d_terms[t.d_children[chosen]].d_size);
+      }
+      current = t.d_children[chosen];
+      target = x;
+    }
+
+    std::unordered_map<unsigned, PropagationDomain>::const_iterator it =
+        d_domains.find(current);
+    BitVector value;
+    if (it != d_domains.end() && it->second.project(target, value)
+        && value != d_terms[current].d_value)
+    {
+      update(current, value);
+    }
+  }
+}
+
+bool PropagationSolver::inverseValue(unsigned term,
+                                     unsigned i,
+                                     const BitVector& target,
+                                     BitVector& x)
+{
+  const Term& t = d_terms[term];
+  std::vector<BitVector> values;
+  for (unsigned c : t.d_children)
+  {
+    values.push_back(d_terms[c].d_value);
+  }
+  return inverse::getInverseValue(t.d_node, i, values, target, x);
+}
+
+bool PropagationSolver::collectModelValues(TheoryModel* m,
+                                           const std::set<Node>& termSet)
+{
+  Debug("bitvector-model") << "PropagationSolver::collectModelValues\n";
+  for (const Node& term : termSet)
+  {
+    // the other variables do not occur in the assertions, their values are
+    // chosen by the model builder
+    std::unordered_map<Node, BitVector, NodeHashFunction>::const_iterator it =
+        d_model.find(term);
+    if (it == d_model.end())
+    {
+      continue;
+    }
+    Node value = utils::mkConst(it->second);
+    Debug("bitvector-model") << "PropagationSolver:   " << term << " => "
+                             << value << "\n";
+    if (!m->assertEquality(term, value, true))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+Node PropagationSolver::getModelValue(TNode node)
+{
+  std::unordered_map<Node, BitVector, NodeHashFunction>::const_iterator it =
+      d_model.find(node);
+  if (!d_isComplete.get() || it == d_model.end())
+  {
+    return Node::null();
+  }
+  return utils::mkConst(it->second);
+}
+
+PropagationSolver::Statistics::Statistics()
+    : d_numCallsToCheck("theory::bv::propagation::NumCallsToCheck", 0),
+      d_numSat("theory::bv::propagation::NumSat", 0),
+      d_numUnknown("theory::bv::propagation::NumUnknown", 0),
+      d_numUnsupported("theory::bv::propagation::NumUnsupported", 0),
+      d_numMoves("theory::bv::propagation::NumMoves", 0),
+      d_solveTime("theory::bv::propagation::SolveTime")
+{
+  smtStatisticsRegistry()->registerStat(&d_numCallsToCheck);
+  smtStatisticsRegistry()->registerStat(&d_numSat);
+  smtStatisticsRegistry()->registerStat(&d_numUnknown);
+  smtStatisticsRegistry()->registerStat(&d_numUnsupported);
+  smtStatisticsRegistry()->registerStat(&d_numMoves);
+  smtStatisticsRegistry()->registerStat(&d_solveTime);
+}
+
+PropagationSolver::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_numCallsToCheck);
+  smtStatisticsRegistry()->unregisterStat(&d_numSat);
+  smtStatisticsRegistry()->unregisterStat(&d_numUnknown);
+  smtStatisticsRegistry()->unregisterStat(&d_numUnsupported);
+  smtStatisticsRegistry()->unregisterStat(&d_numMoves);
+  smtStatisticsRegistry()->unregisterStat(&d_solveTime);
+}
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,190 @@
+/*********************                                                        */
+/*! \file bv_subtheory_propagation.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Word-level propagation solver for bit-vectors
+ **
+ ** A subtheory of the lazy bit-vector solver that searches for a model of the
+ ** current assertions on the word level before they are bit-blasted. The
+ ** values of the variables are restricted to domains of fixed bits and
+ ** unsigned intervals derived from the assertions, and the search follows
+ ** the propagation-based local search of Niemetz, Preiner and Biere
+ ** ("Propagation based local search for bit-precise reasoning", FMSD 2017):
+ ** the target value of an unsatisfied assertion is propagated down to a
+ ** variable by inverting the operators along a path. If no model is found
+ ** within the budget, the subtheory is incomplete and the bit-blaster
+ ** decides the assertions.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "theory/bv/bv_subtheory.h"
+#include "util/bitvector.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+namespace bv {
+
+/**
+ * The possible values of a bit-vector variable: the values in the unsigned
+ * interval [min, max] whose bits in the mask of fixed bits are those of the
+ * given bits.
+ */
+class PropagationDomain
+{
+ public:
+  PropagationDomain(unsigned size);
+
+  /** Fixes the bits of mask to those of bits, returns false if empty. */
+  bool fix(const BitVector& mask, const BitVector& bits);
+  /** Restricts the interval to [min, max], returns false if empty. */
+  bool restrictInterval(const BitVector& min, const BitVector& max);
+  /** Returns true if the domain has exactly one value. */
+  bool isFixed() const;
+  /** Returns true if value is in the domain. */
+  bool contains(const BitVector& value) const;
+  /**
+   * Sets res to the value of the domain closest to value. Returns false if
+   * the domain is empty.
+   */
+  bool project(const BitVector& value, BitVector& res) const;
+
+ private:
+  /**
+   * Sets res to the smallest value at least value (the largest value at most
+   * value if !up) with the fixed bits. Returns false if there is none.
+   */
+  bool nextFixed(const BitVector& value, bool up, BitVector& res) const;
+
+  unsigned d_size;
+  BitVector d_mask;
+  BitVector d_bits;
+  BitVector d_min;
+  BitVector d_max;
+}; /* class PropagationDomain */
+
+/**
+ * PropagationSolver
+ */
+class PropagationSolver : public SubtheorySolver
+{
+  struct Statistics
+  {
+    IntStat d_numCallsToCheck;
+    IntStat d_numSat;
+    IntStat d_numUnknown;
+    IntStat d_numUnsupported;
+    IntStat d_numMoves;
+    TimerStat d_solveTime;
+    Statistics();
+    ~Statistics();
+  };
+
+  /** A term of the assertions, indexed in topological order. */
+  struct Term
+  {
+    Term(TNode node, unsigned size)
+        : d_node(node), d_size(size), d_value(size), d_isFixed(false)
+    {
+    }
+    TNode d_node;
+    /** The width of the term, 1 for atoms. */
+    unsigned d_size;
+    /** The indices of the children. */
+    std::vector<unsigned> d_children;
+    /** The indices of the parents. */
+    std::vector<unsigned> d_parents;
+    /** The current value, atoms have the value 1 if they are true. */
+    BitVector d_value;
+    /** Whether the value does not depend on a variable with a free domain. */
+    bool d_isFixed;
+  };
+
+  /** The terms of the assertions, children before parents. */
+  std::vector<Term> d_terms;
+  /** Map from nodes to their index in d_terms. */
+  std::unordered_map<TNode, unsigned, TNodeHashFunction> d_termIndex;
+  /** The domains of the variables, by index in d_terms. */
+  std::unordered_map<unsigned, PropagationDomain> d_domains;
+  /** The atoms of the assertions and their polarities. */
+  std::vector<std::pair<unsigned, bool>> d_roots;
+
+  /** The values of the variables in the last model. */
+  std::unordered_map<Node, BitVector, NodeHashFunction> d_model;
+  /** Whether the last model satisfies the current assertions. */
+  context::CDO<bool> d_isComplete;
+
+  unsigned d_budget;
+  uint64_t d_numSolved;
+  uint64_t d_numCalls;
+  Statistics d_statistics;
+
+  /**
+   * Adds the terms of the assertion and their subterms to d_terms. Returns
+   * false if it contains an operator or a term that is not supported.
+   */
+  bool addAssertion(TNode assertion);
+  /**
+   * Restricts the domains of the variables by the unit assertions. Returns
+   * false if a domain becomes empty.
+   */
+  bool propagateDomains();
+  /**
+   * Restricts the domains of the variables in term such that the bits of
+   * mask in the value of term are those of value.
+   */
+  bool propagateValue(unsigned term, BitVector mask, BitVector value);
+  /** Searches for a model within the budget, returns true if one is found. */
+  bool search();
+  /** Computes the value of the term from the values of its children. */
+  BitVector evaluate(unsigned term) const;
+  /** Sets the value of a variable and updates the values of its parents. */
+  void update(unsigned var, const BitVector& value);
+  /**
+   * Computes a value x of the i-th child of term such that term has the value
+   * target if the other children keep their values. Returns false if there is
+   * no such value.
+   */
+  bool inverseValue(unsigned term,
+                    unsigned i,
+                    const BitVector& target,
+                    BitVector& x);
+  /** Returns true if the solver succeeded often enough to be worth calling. */
+  bool useHeuristic();
+
+ public:
+  PropagationSolver(context::Context* c, BVSolverLazy* bv);
+  ~PropagationSolver();
+
+  bool check(Theory::Effort e) override;
+  void explain(TNode literal, std::vector<TNode>& assumptions) override
+  {
+    Unreachable() << "PropagationSolver does not propagate.\n";
+  }
+  EqualityStatus getEqualityStatus(TNode a, TNode b) override
+  {
+    return EQUALITY_UNKNOWN;
+  }
+  bool collectModelValues(TheoryModel* m,
+                          const std::set<Node>& termSet) override;
+  Node getModelValue(TNode node) override;
+  bool isComplete() override { return d_isComplete.get(); }
+  void assertFact(TNode fact) override;
+}; /* class PropagationSolver */
+
+}  // namespace bv
+}  // namespace theory
+}  // namespace CVC4
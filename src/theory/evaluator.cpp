@@ -396,6 +396,24 @@ EvalResult Evaluator::evalInternal(
           break;
         }
 
+        case kind::XOR:
+        {
+          bool res = results[currNode[0]].d_bool;
+          for (size_t i = 1, end = currNode.getNumChildren(); i < end; i++)
+          {
+            res = res != results[currNode[i]].d_bool;
+          }
+          results[currNode] = EvalResult(res);
+          break;
+        }
+
+        case kind::IMPLIES:
+        {
+          results[currNode] = EvalResult(!results[currNode[0]].d_bool
+                                         || results[currNode[1]].d_bool);
+          break;
+        }
+
         case kind::CONST_RATIONAL:
         {
           const Rational& r = currNodeVal.getConst<Rational>();
@@ -732,6 +750,13 @@ EvalResult Evaluator::evalInternal(
           break;
         }
 
+        case kind::BITVECTOR_SUB:
+        {
+          results[currNode] = EvalResult(results[currNode[0]].d_bv
+                                         - results[currNode[1]].d_bv);
+          break;
+        }
+
         case kind::BITVECTOR_MULT:
         {
           BitVector res = results[currNode[0]].d_bv;
@@ -813,6 +838,79 @@ EvalResult Evaluator::evalInternal(
           break;
         }
 
+        case kind::BITVECTOR_ZERO_EXTEND:
+        {
+          unsigned amount =
+              currNodeVal.getOperator().getConst<BitVectorZeroExtend>();
+          results[currNode] =
+              EvalResult(results[currNode[0]].d_bv.zeroExtend(amount));
+          break;
+        }
+
+        case kind::BITVECTOR_SIGN_EXTEND:
+        {
+          unsigned amount =
+              currNodeVal.getOperator().getConst<BitVectorSignExtend>();
+          results[currNode] =
+              EvalResult(results[currNode[0]].d_bv.signExtend(amount));
+          break;
+        }
+
+        case kind::BITVECTOR_SHL:
+        {
+          const BitVector& a = results[currNode[0]].d_bv;
+          results[currNode] =
+              EvalResult(a.leftShift(results[currNode[1]].d_bv));
+          break;
+        }
+
+        case kind::BITVECTOR_LSHR:
+        {
+          const BitVector& a = results[currNode[0]].d_bv;
+          results[currNode] =
+              EvalResult(a.logicalRightShift(results[currNode[1]].d_bv));
+          break;
+        }
+
+        case kind::BITVECTOR_ASHR:
+        {
+          const BitVector& a = results[currNode[0]].d_bv;
+          results[currNode] =
+              EvalResult(a.arithRightShift(results[currNode[1]].d_bv));
+          break;
+        }
+
+        case kind::BITVECTOR_ULT:
+        case kind::BITVECTOR_ULE:
+        case kind::BITVECTOR_UGT:
+        case kind::BITVECTOR_UGE:
+        case kind::BITVECTOR_SLT:
+        case kind::BITVECTOR_SLE:
+        case kind::BITVECTOR_SGT:
+        case kind::BITVECTOR_SGE:
+        {
+          Kind k = currNodeVal.getKind();
+          const BitVector& a = results[currNode[0]].d_bv;
+          const BitVector& b = results[currNode[1]].d_bv;
+          bool res;
+          switch (k)
+          {
+            case kind::BITVECTOR_ULT: res = a.unsignedLessThan(b); break;
+            case kind::BITVECTOR_ULE: res = a.unsignedLessThanEq(b); break;
+            case kind::BITVECTOR_UGT: res = b.unsignedLessThan(a); break;
+            case kind::BITVECTOR_UGE: res = b.unsignedLessThanEq(a); break;
+            case kind::BITVECTOR_SLT: res = a.signedLessThan(b); break;
+            case kind::BITVECTOR_SLE: res = a.signedLessThanEq(b); break;
+            case kind::BITVECTOR_SGT: res = b.signedLessThan(a); break;
+            default:
+              Assert(k == kind::BITVECTOR_SGE);
+              res = b.signedLessThanEq(a);
+              break;
+          }
+          results[currNode] = EvalResult(res);
+          break;
+        }
+
         case kind::EQUAL:
         {
           EvalResult lhs = results[currNode[0]];
@@ -0,0 +1,821 @@
+/*********************                                                        */
+/*! \file persistent_rewrite_cache.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A rewrite cache that persists across solver runs
+ **
+ ** A rewrite cache that persists across solver runs.
+ **/
+
+#include "theory/persistent_rewrite_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* _WIN32 */
+
+#include "base/configuration.h"
+#include "base/output.h"
+#include "expr/kind.h"
+#include "expr/node_manager.h"
+#include "options/language.h"
+#include "options/options.h"
+#include "smt/smt_statistics_registry.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+
+namespace {
+
+/** The magic number at the beginning of a cache file */
+const char s_magic[8] = {'C', 'V', 'C', '4', 'R', 'W', 'C', '1'};
+/** The size of the header: magic number and fingerprint */
+constexpr size_t s_headerSize = sizeof(s_magic) + sizeof(uint64_t);
+/** The size of the fixed part of a record: hash, key and value sizes */
+constexpr size_t s_recordHeaderSize = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+/**
+ * Options that do not affect rewriting (by long name), and are thus not part
+ * of the fingerprint.  Options are only listed here if they affect neither
+ * the rewriter nor the defaults of other options, e.g. the produce-* options
+ * are part of the fingerprint.
+ */
+const char* s_ignoredOptions[] = {"rewrite-cache-file",
+                                  "rewrite-cache-file-limit",
+                                  "rewrite-cache-file-flush",
+                                  "rewrite-cache-limit",
+                                  "stats",
+                                  "stats-every-query",
+                                  "stats-hide-zeros",
+                                  "verbosity",
+                                  "seed",
+                                  "tlimit",
+                                  "tlimit-per",
+                                  "rlimit",
+                                  "rlimit-per",
+                                  "dump",
+                                  "dump-to",
+                                  "dump-instantiations",
+                                  "dump-models",
+                                  "dump-proofs",
+                                  "dump-synth",
+                                  "dump-unsat-cores",
+                                  "dump-unsat-cores-full",
+                                  "print-success",
+                                  "interactive",
+                                  "interactive-mode",
+                                  "interactive-prompt",
+                                  "early-exit",
+                                  "portfolio-jobs"};
+
+/** 64-bit FNV-1a hash of the given bytes, continuing from h */
+uint64_t fnv1a(const char* data,
+               size_t size,
+               uint64_t h = UINT64_C(0xcbf29ce484222325))
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    h ^= static_cast<unsigned char>(data[i]);
+    h *= UINT64_C(0x100000001b3);
+  }
+  return h;
+}
+
+uint64_t fnv1a(const std::string& s, uint64_t h = UINT64_C(0xcbf29ce484222325))
+{
+  return fnv1a(s.data(), s.size(), h);
+}
+
+template <class T>
+T readRaw(const char* data)
+{
+  T t;
+  std::memcpy(&t, data, sizeof(T));
+  return t;
+}
+
+template <class T>
+void writeRaw(std::ostream& out, T t)
+{
+  out.write(reinterpret_cast<const char*>(&t), sizeof(T));
+}
+
+/** Whether the (BV) indexed operator kind k is supported by the encoding */
+bool isEncodableOperator(Kind k)
+{
+  switch (k)
+  {
+    case kind::BITVECTOR_EXTRACT_OP:
+    case kind::BITVECTOR_BITOF_OP:
+    case kind::BITVECTOR_REPEAT_OP:
+    case kind::BITVECTOR_ZERO_EXTEND_OP:
+    case kind::BITVECTOR_SIGN_EXTEND_OP:
+    case kind::BITVECTOR_ROTATE_LEFT_OP:
+    case kind::BITVECTOR_ROTATE_RIGHT_OP:
+    case kind::INT_TO_BITVECTOR_OP: return true;
+    default: return false;
+  }
+}
+
+}  // namespace
+
+PersistentRewriteCache::Statistics::Statistics()
+    : d_hits("theory::Rewriter::persistentCache::hits", 0),
+      d_misses("theory::Rewriter::persistentCache::misses", 0),
+      d_hitRate("theory::Rewriter::persistentCache::hitRate"),
+      d_loadedEntries("theory::Rewriter::persistentCache::loadedEntries", 0),
+      d_storedEntries("theory::Rewriter::persistentCache::storedEntries", 0),
+      d_flushes("theory::Rewriter::persistentCache::flushes", 0)
+{
+  smtStatisticsRegistry()->registerStat(&d_hits);
+  smtStatisticsRegistry()->registerStat(&d_misses);
+  smtStatisticsRegistry()->registerStat(&d_hitRate);
+  smtStatisticsRegistry()->registerStat(&d_loadedEntries);
+  smtStatisticsRegistry()->registerStat(&d_storedEntries);
+  smtStatisticsRegistry()->registerStat(&d_flushes);
+}
+
+PersistentRewriteCache::Statistics::~Statistics()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_hits);
+  smtStatisticsRegistry()->unregisterStat(&d_misses);
+  smtStatisticsRegistry()->unregisterStat(&d_hitRate);
+  smtStatisticsRegistry()->unregisterStat(&d_loadedEntries);
+  smtStatisticsRegistry()->unregisterStat(&d_storedEntries);
+  smtStatisticsRegistry()->unregisterStat(&d_flushes);
+}
+
+PersistentRewriteCache::PersistentRewriteCache(const std::string& filename,
+                                               uint64_t fingerprint,
+                                               size_t maxEntries,
+                                               size_t flushInterval)
+    : d_filename(filename),
+      d_fingerprint(fingerprint),
+      d_maxEntries(maxEntries),
+      d_flushInterval(flushInterval),
+      d_data(nullptr),
+      d_size(0),
+      d_mappedSize(0),
+      d_mapped(false),
+      d_append(false)
+{
+  load();
+  d_statistics.d_loadedEntries.setData(d_index.size());
+}
+
+PersistentRewriteCache::~PersistentRewriteCache()
+{
+  flush();
+  unload();
+}
+
+uint64_t PersistentRewriteCache::computeFingerprint(const std::string& logic)
+{
+  std::stringstream ss;
+  ss << Configuration::getVersionString() << '\n'
+     << Configuration::getGitId() << '\n'
+     << static_cast<unsigned>(kind::LAST_KIND) << '\n'
+     << logic << '\n';
+  for (const std::vector<std::string>& opt : Options::current()->getOptions())
+  {
+    // the names of options with arguments end with "=<argument name>"
+    std::string name = opt[0].substr(0, opt[0].find('='));
+    bool ignored = false;
+    for (const char* ignoredName : s_ignoredOptions)
+    {
+      if (name == ignoredName)
+      {
+        ignored = true;
+        break;
+      }
+    }
+    if (!ignored)
+    {
+      ss << opt[0] << '=' << opt[1] << '\n';
+    }
+  }
+  return fnv1a(ss.str());
+}
+
+bool PersistentRewriteCache::computeKey(TNode n,
+                                        std::string& key,
+                                        std::vector<Node>& subterms)
+{
+  // collect the subterms in post-order, including the operators of
+  // parameterized terms
+  std::map<std::string, Node> symbols;
+  std::unordered_set<TNode, TNodeHashFunction> visited;
+  std::vector<std::pair<TNode, bool>> visit;
+  visit.emplace_back(n, false);
+  while (!visit.empty())
+  {
+    std::pair<TNode, bool> cur = visit.back();
+    visit.pop_back();
+    if (cur.second)
+    {
+      subterms.push_back(cur.first);
+      continue;
+    }
+    if (!visited.insert(cur.first).second)
+    {
+      continue;
+    }
+    TNode t = cur.first;
+    if (kindToTheoryId(t.getKind()) == THEORY_DATATYPES)
+    {
+      // datatypes are identified by name only when printed
+      return false;
+    }
+    if (t.isVar())
+    {
+      // skolems are not stable across runs
+      if (t.getKind() != kind::VARIABLE && t.getKind() != kind::BOUND_VARIABLE)
+      {
+        return false;
+      }
+      TypeNode tn = t.getType();
+      if (tn.isDatatype() || tn.isCodatatype())
+      {
+        return false;
+      }
+      std::stringstream ss;
+      t.toStream(ss, -1, false, 0, language::output::LANG_SMTLIB_V2_6);
+      auto it = symbols.emplace(ss.str(), t);
+      if (!it.second && it.first->second != t)
+      {
+        // two distinct symbols with the same name
+        return false;
+      }
+    }
+    else if (t.getNumChildren() == 0 && !t.isConst())
+    {
+      return false;
+    }
+    visit.emplace_back(t, true);
+    for (size_t i = t.getNumChildren(); i > 0; --i)
+    {
+      visit.emplace_back(t[i - 1], false);
+    }
+    if (t.getMetaKind() == kind::metakind::PARAMETERIZED)
+    {
+      visit.emplace_back(t.getOperator(), false);
+    }
+  }
+
+  std::stringstream ss;
+  n.toStream(ss, -1, false, 1, language::output::LANG_SMTLIB_V2_6);
+  ss << '\n';
+  n.getType().toStream(ss, language::output::LANG_SMTLIB_V2_6);
+  ss << '\n';
+  for (const std::pair<const std::string, Node>& s : symbols)
+  {
+    ss << s.first << ' ';
+    s.second.getType().toStream(ss, language::output::LANG_SMTLIB_V2_6);
+    ss << '\n';
+  }
+  // the printer may not distinguish all kinds, the kinds of the subterms do
+  for (const Node& s : subterms)
+  {
+    ss << static_cast<unsigned>(s.getKind()) << ',';
+  }
+  key = ss.str();
+  return true;
+}
+
+bool PersistentRewriteCache::encodeValue(TNode rewritten,
+                                         const std::vector<Node>& subterms,
+                                         std::string& value)
+{
+  std::unordered_map<TNode, size_t, TNodeHashFunction> inputIndex;
+  for (size_t i = 0, size = subterms.size(); i < size; ++i)
+  {
+    inputIndex[subterms[i]] = i;
+  }
+  // maps terms of rewritten to their items in the encoding
+  std::unordered_map<TNode, size_t, TNodeHashFunction> items;
+  std::vector<std::pair<TNode, bool>> visit;
+  std::stringstream ss;
+  visit.emplace_back(rewritten, false);
+  while (!visit.empty())
+  {
+    std::pair<TNode, bool> cur = visit.back();
+    visit.pop_back();
+    TNode t = cur.first;
+    if (items.find(t) != items.end())
+    {
+      continue;
+    }
+    auto iit = inputIndex.find(t);
+    bool isLeaf = iit != inputIndex.end() || t.isConst();
+    if (!isLeaf && !cur.second)
+    {
+      if (t.getNumChildren() == 0)
+      {
+        // a symbol that does not occur in the input
+        return false;
+      }
+      visit.emplace_back(t, true);
+      for (size_t i = t.getNumChildren(); i > 0; --i)
+      {
+        visit.emplace_back(t[i - 1], false);
+      }
+      if (t.getMetaKind() == kind::metakind::PARAMETERIZED)
+      {
+        visit.emplace_back(t.getOperator(), false);
+      }
+      continue;
+    }
+    if (!items.empty())
+    {
+      ss << ' ';
+    }
+    if (iit != inputIndex.end())
+    {
+      ss << 'r' << iit->second;
+    }
+    else if (t.isConst())
+    {
+      Kind k = t.getKind();
+      if (k == kind::CONST_BOOLEAN)
+      {
+        ss << 'b' << (t.getConst<bool>() ? 1 : 0);
+      }
+      else if (k == kind::CONST_RATIONAL)
+      {
+        ss << 'q' << t.getConst<Rational>().toString();
+      }
+      else if (k == kind::CONST_BITVECTOR)
+      {
+        const BitVector& bv = t.getConst<BitVector>();
+        ss << 'v' << bv.getSize() << ':' << bv.getValue().toString();
+      }
+      else if (k == kind::BITVECTOR_EXTRACT_OP)
+      {
+        const BitVectorExtract& e = t.getConst<BitVectorExtract>();
+        ss << 'x' << static_cast<unsigned>(k) << ':' << e.d_high << ':'
+           << e.d_low;
+      }
+      else if (k == kind::BITVECTOR_BITOF_OP)
+      {
+        ss << 'x' << static_cast<unsigned>(k) << ':'
+           << t.getConst<BitVectorBitOf>().d_bitIndex;
+      }
+      else if (isEncodableOperator(k))
+      {
+        // the remaining operators are convertible to their only index
+        unsigned index = 0;
+        switch (k)
+        {
+          case kind::BITVECTOR_REPEAT_OP:
+            index = t.getConst<BitVectorRepeat>();
+            break;
+          case kind::BITVECTOR_ZERO_EXTEND_OP:
+            index = t.getConst<BitVectorZeroExtend>();
+            break;
+          case kind::BITVECTOR_SIGN_EXTEND_OP:
+            index = t.getConst<BitVectorSignExtend>();
+            break;
+          case kind::BITVECTOR_ROTATE_LEFT_OP:
+            index = t.getConst<BitVectorRotateLeft>();
+            break;
+          case kind::BITVECTOR_ROTATE_RIGHT_OP:
+            index = t.getConst<BitVectorRotateRight>();
+            break;
+          default:
+            Assert(k == kind::INT_TO_BITVECTOR_OP);
+            index = t.getConst<IntToBitVector>();
+            break;
+        }
+        ss << 'x' << static_cast<unsigned>(k) << ':' << index;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    else
+    {
+      ss << 'k' << static_cast<unsigned>(t.getKind()) << ':';
+      bool first = true;
+      if (t.getMetaKind() == kind::metakind::PARAMETERIZED)
+      {
+        ss << items[t.getOperator()];
+        first = false;
+      }
+      for (const Node& c : t)
+      {
+        ss << (first ? "" : ",") << items[c];
+        first = false;
+      }
+    }
+    size_t next = items.size();
+    items[t] = next;
+  }
+  value = ss.str();
+  return true;
+}
+
+Node PersistentRewriteCache::decodeValue(const char* value,
+                                         size_t size,
+                                         const std::vector<Node>& subterms)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  std::vector<Node> items;
+  std::istringstream in(std::string(value, size));
+  std::string item;
+  try
+  {
+    while (in >> item)
+    {
+      char tag = item[0];
+      std::string arg = item.substr(1);
+      if (tag == 'r')
+      {
+        size_t i = std::stoul(arg);
+        if (i >= subterms.size())
+        {
+          return Node::null();
+        }
+        items.push_back(subterms[i]);
+      }
+      else if (tag == 'b')
+      {
+        items.push_back(nm->mkConst(arg == "1"));
+      }
+      else if (tag == 'q')
+      {
+        items.push_back(nm->mkConst(Rational(arg)));
+      }
+      else if (tag == 'v')
+      {
+        size_t colon = arg.find(':');
+        if (colon == std::string::npos)
+        {
+          return Node::null();
+        }
+        unsigned bvSize = std::stoul(arg.substr(0, colon));
+        items.push_back(
+            nm->mkConst(BitVector(bvSize, Integer(arg.substr(colon + 1)))));
+      }
+      else if (tag == 'x' || tag == 'k')
+      {
+        std::vector<size_t> args;
+        size_t colon = arg.find(':');
+        if (colon == std::string::npos)
+        {
+          return Node::null();
+        }
+        unsigned k = std::stoul(arg.substr(0, colon));
+        std::istringstream argIn(arg.substr(colon + 1));
+        std::string a;
+        while (std::getline(argIn, a, tag == 'x' ? ':' : ','))
+        {
+          args.push_back(std::stoul(a));
+        }
+        if (k >= kind::LAST_KIND)
+        {
+          return Node::null();
+        }
+        Kind kk = static_cast<Kind>(k);
+        if (tag == 'x')
+        {
+          if (!isEncodableOperator(kk)
+              || args.size() != (kk == kind::BITVECTOR_EXTRACT_OP ? 2 : 1))
+          {
+            return Node::null();
+          }
+          switch (kk)
+          {
+            case kind::BITVECTOR_EXTRACT_OP:
+              items.push_back(
+                  nm->mkConst(BitVectorExtract(args[0], args[1])));
+              break;
+            case kind::BITVECTOR_BITOF_OP:
+              items.push_back(nm->mkConst(BitVectorBitOf(args[0])));
+              break;
+            case kind::BITVECTOR_REPEAT_OP:
+              items.push_back(nm->mkConst(BitVectorRepeat(args[0])));
+              break;
+            case kind::BITVECTOR_ZERO_EXTEND_OP:
+              items.push_back(nm->mkConst(BitVectorZeroExtend(args[0])));
+              break;
+            case kind::BITVECTOR_SIGN_EXTEND_OP:
+              items.push_back(nm->mkConst(BitVectorSignExtend(args[0])));
+              break;
+            case kind::BITVECTOR_ROTATE_LEFT_OP:
+              items.push_back(nm->mkConst(BitVectorRotateLeft(args[0])));
+              break;
+            case kind::BITVECTOR_ROTATE_RIGHT_OP:
+              items.push_back(nm->mkConst(BitVectorRotateRight(args[0])));
+              break;
+            default:
+              items.push_back(nm->mkConst(IntToBitVector(args[0])));
+              break;
+          }
+          continue;
+        }
+        kind::MetaKind mk = kind::metaKindOf(kk);
+        size_t nchildren = args.size();
+        if (mk == kind::metakind::PARAMETERIZED)
+        {
+          --nchildren;
+        }
+        else if (mk != kind::metakind::OPERATOR)
+        {
+          return Node::null();
+        }
+        if (args.empty() || nchildren < kind::metakind::getLowerBoundForKind(kk)
+            || nchildren > kind::metakind::getUpperBoundForKind(kk))
+        {
+          return Node::null();
+        }
+        std::vector<Node> children;
+        for (size_t i : args)
+        {
+          if (i >= items.size())
+          {
+            return Node::null();
+          }
+          children.push_back(items[i]);
+        }
+        items.push_back(nm->mkNode(kk, children));
+      }
+      else
+      {
+        return Node::null();
+      }
+    }
+    if (items.empty())
+    {
+      return Node::null();
+    }
+    // type check the result, which may throw
+    items.back().getType(true);
+  }
+  catch (const std::exception& e)
+  {
+    // malformed numbers, or ill-typed terms
+    return Node::null();
+  }
+  return items.back();
+}
+
+Node PersistentRewriteCache::lookup(TNode n)
+{
+  std::string key;
+  std::vector<Node> subterms;
+  Node ret;
+  if (computeKey(n, key, subterms))
+  {
+    auto pit = d_entries.find(key);
+    if (pit != d_entries.end())
+    {
+      ret = decodeValue(pit->second.data(), pit->second.size(), subterms);
+    }
+    else
+    {
+      auto range = d_index.equal_range(fnv1a(key));
+      for (auto it = range.first; it != range.second && ret.isNull(); ++it)
+      {
+        const char* record = d_data + it->second;
+        uint32_t keySize = readRaw<uint32_t>(record + sizeof(uint64_t));
+        uint32_t valueSize =
+            readRaw<uint32_t>(record + sizeof(uint64_t) + sizeof(uint32_t));
+        const char* recordKey = record + s_recordHeaderSize;
+        if (keySize == key.size()
+            && std::memcmp(recordKey, key.data(), keySize) == 0)
+        {
+          ret = decodeValue(recordKey + keySize, valueSize, subterms);
+        }
+      }
+    }
+    if (!ret.isNull() && !ret.getType().isComparableTo(n.getType()))
+    {
+      ret = Node::null();
+    }
+  }
+  if (ret.isNull())
+  {
+    ++d_statistics.d_misses;
+    d_statistics.d_hitRate.addEntry(0);
+  }
+  else
+  {
+    ++d_statistics.d_hits;
+    d_statistics.d_hitRate.addEntry(1);
+  }
+  return ret;
+}
+
+void PersistentRewriteCache::store(TNode n, TNode rewritten)
+{
+  if (d_maxEntries != 0 && d_index.size() + d_entries.size() >= d_maxEntries)
+  {
+    return;
+  }
+  std::string key;
+  std::string value;
+  std::vector<Node> subterms;
+  if (!computeKey(n, key, subterms)
+      || !encodeValue(rewritten, subterms, value))
+  {
+    return;
+  }
+  auto it = d_entries.emplace(key, value);
+  if (!it.second)
+  {
+    return;
+  }
+  ++d_statistics.d_storedEntries;
+  d_unwritten.push_back(&*it.first);
+  if (d_flushInterval != 0 && d_unwritten.size() >= d_flushInterval)
+  {
+    flush();
+  }
+}
+
+void PersistentRewriteCache::flush()
+{
+  if (d_unwritten.empty())
+  {
+    return;
+  }
+  std::stringstream records;
+  for (const std::pair<const std::string, std::string>* p : d_unwritten)
+  {
+    writeRaw<uint64_t>(records, fnv1a(p->first));
+    writeRaw<uint32_t>(records, p->first.size());
+    writeRaw<uint32_t>(records, p->second.size());
+    records << p->first << p->second;
+  }
+  std::string data = records.str();
+  ++d_statistics.d_flushes;
+  if (d_append)
+  {
+    bool written = false;
+#ifndef _WIN32
+    // a single write to a file opened for appending is not interleaved with
+    // the writes of other processes
+    int fd = open(d_filename.c_str(), O_WRONLY | O_APPEND);
+    if (fd >= 0)
+    {
+      written = write(fd, data.data(), data.size())
+                == static_cast<ssize_t>(data.size());
+      written = close(fd) == 0 && written;
+    }
+#else  /* _WIN32 */
+    std::ofstream out(d_filename, std::ios::binary | std::ios::app);
+    out.write(data.data(), data.size());
+    out.close();
+    written = static_cast<bool>(out);
+#endif /* _WIN32 */
+    if (!written)
+    {
+      Warning() << "could not write the rewrite cache to " << d_filename
+                << std::endl;
+    }
+    d_unwritten.clear();
+    return;
+  }
+  // write a new file with the well-formed records of the loaded one
+  std::stringstream tmp;
+  tmp << d_filename << ".tmp";
+#ifndef _WIN32
+  tmp << '.' << getpid();
+#endif /* _WIN32 */
+  {
+    std::ofstream out(tmp.str(), std::ios::binary | std::ios::trunc);
+    out.write(s_magic, sizeof(s_magic));
+    writeRaw<uint64_t>(out, d_fingerprint);
+    if (d_size > s_headerSize)
+    {
+      out.write(d_data + s_headerSize, d_size - s_headerSize);
+    }
+    out.write(data.data(), data.size());
+    out.close();
+    if (!out)
+    {
+      Warning() << "could not write the rewrite cache to " << tmp.str()
+                << std::endl;
+      std::remove(tmp.str().c_str());
+      d_unwritten.clear();
+      return;
+    }
+  }
+  if (std::rename(tmp.str().c_str(), d_filename.c_str()) != 0)
+  {
+    Warning() << "could not write the rewrite cache to " << d_filename
+              << std::endl;
+    std::remove(tmp.str().c_str());
+  }
+  else
+  {
+    d_append = true;
+  }
+  d_unwritten.clear();
+}
+
+void PersistentRewriteCache::load()
+{
+  Assert(d_data == nullptr);
+#ifndef _WIN32
+  int fd = open(d_filename.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    struct stat st;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= s_headerSize)
+    {
+      void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED)
+      {
+        d_data = static_cast<const char*>(data);
+        d_size = st.st_size;
+        d_mappedSize = st.st_size;
+        d_mapped = true;
+      }
+    }
+    close(fd);
+  }
+#endif /* _WIN32 */
+  if (!d_mapped)
+  {
+    std::ifstream in(d_filename, std::ios::binary);
+    if (!in)
+    {
+      return;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    d_buffer = ss.str();
+    d_data = d_buffer.data();
+    d_size = d_buffer.size();
+  }
+  if (d_size < s_headerSize
+      || std::memcmp(d_data, s_magic, sizeof(s_magic)) != 0
+      || readRaw<uint64_t>(d_data + sizeof(s_magic)) != d_fingerprint)
+  {
+    // not a cache file, or one created with another configuration
+    Trace("rewrite-cache") << "ignoring incompatible rewrite cache "
+                           << d_filename << std::endl;
+    unload();
+    return;
+  }
+  size_t offset = s_headerSize;
+  while (offset + s_recordHeaderSize <= d_size)
+  {
+    const char* record = d_data + offset;
+    uint64_t hash = readRaw<uint64_t>(record);
+    size_t keySize = readRaw<uint32_t>(record + sizeof(uint64_t));
+    size_t valueSize =
+        readRaw<uint32_t>(record + sizeof(uint64_t) + sizeof(uint32_t));
+    size_t next = offset + s_recordHeaderSize + keySize + valueSize;
+    if (next > d_size)
+    {
+      // truncated record
+      break;
+    }
+    d_index.emplace(hash, offset);
+    offset = next;
+  }
+  // a truncated tail is dropped by writing a new file on the next flush
+  d_append = offset == d_size;
+  d_size = offset;
+}
+
+void PersistentRewriteCache::unload()
+{
+#ifndef _WIN32
+  if (d_mapped)
+  {
+    munmap(const_cast<char*>(d_data), d_mappedSize);
+  }
+#endif /* _WIN32 */
+  d_data = nullptr;
+  d_size = 0;
+  d_mappedSize = 0;
+  d_mapped = false;
+  d_buffer.clear();
+  d_index.clear();
+  d_append = false;
+}
+
+}  // namespace theory
+}  // namespace CVC4
@@ -0,0 +1,181 @@
+/*********************                                                        */
+/*! \file persistent_rewrite_cache.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A rewrite cache that persists across solver runs
+ **
+ ** A cache of the results of Rewriter::rewrite() that is stored in a file,
+ ** which is memory-mapped by subsequent runs.  Since node ids are only
+ ** meaningful within a process, terms are keyed by their structure: their
+ ** SMT-LIB 2 serialization together with the declarations of their free
+ ** symbols.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__PERSISTENT_REWRITE_CACHE_H
+#define CVC4__THEORY__PERSISTENT_REWRITE_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace theory {
+
+/**
+ * A map from terms to their rewritten forms that is loaded from and saved to
+ * a file.
+ *
+ * The file starts with a header containing a fingerprint of the
+ * configuration (version and options) it was created with; a file with a
+ * different fingerprint is ignored and overwritten.  It is followed by a
+ * sequence of records, each consisting of the structural hash of a term, its
+ * key and the encoding of its rewritten form (see encodeValue()).  On
+ * Linux and macOS, the file is memory-mapped rather than read, and only an
+ * index from hashes to records is built when it is loaded.
+ *
+ * New entries are appended to the file by flush(), which is called once
+ * a number of entries were added and when the cache is destroyed.  Each
+ * flush writes its records with a single append, so that concurrent
+ * processes sharing the file do not interleave their records.  A file that
+ * is incompatible or ends with a truncated record is instead replaced: a new
+ * file is written and atomically renamed to the cache file, in which case
+ * entries added by concurrent processes may be lost.
+ */
+class PersistentRewriteCache
+{
+ public:
+  /**
+   * Load the cache from filename, if it exists and was created with the given
+   * fingerprint.  The cache contains at most maxEntries entries, or is
+   * unbounded if maxEntries is 0.  New entries are flushed whenever
+   * flushInterval of them were added, or only on destruction if it is 0.
+   */
+  PersistentRewriteCache(const std::string& filename,
+                         uint64_t fingerprint,
+                         size_t maxEntries,
+                         size_t flushInterval = 0);
+  /** Flushes the cache. */
+  ~PersistentRewriteCache();
+
+  /**
+   * Compute the fingerprint of the current configuration: the version and
+   * git commit of CVC4, the logic and the values of all options affecting
+   * rewriting.
+   */
+  static uint64_t computeFingerprint(const std::string& logic);
+
+  /**
+   * Get the rewritten form of n, or the null node if it is not cached.
+   */
+  Node lookup(TNode n);
+
+  /**
+   * Cache that n rewrites to rewritten.  Does nothing if either of the terms
+   * cannot be represented in the cache (e.g. because n has several free
+   * symbols with the same name, or rewritten contains symbols that do not
+   * occur in n), or if the cache is full.  Flushes the cache if the flush
+   * interval is reached.
+   */
+  void store(TNode n, TNode rewritten);
+
+  /** Write the entries added since the last flush to the cache file. */
+  void flush();
+
+ private:
+  /**
+   * Compute the key of n.  Returns false if n cannot be keyed.  Stores the
+   * (distinct) subterms of n in post-order in subterms, which is what the
+   * encoding of values refers to.
+   */
+  static bool computeKey(TNode n,
+                         std::string& key,
+                         std::vector<Node>& subterms);
+  /**
+   * Encode rewritten, the rewritten form of the term with the given
+   * subterms.  Returns false if it cannot be encoded.
+   */
+  static bool encodeValue(TNode rewritten,
+                          const std::vector<Node>& subterms,
+                          std::string& value);
+  /**
+   * Decode a value that was encoded with respect to the given subterms, or
+   * return the null node if it is malformed.
+   */
+  static Node decodeValue(const char* value,
+                          size_t size,
+                          const std::vector<Node>& subterms);
+
+  /** Map the file and build the index, if it exists and is compatible. */
+  void load();
+  /** Unmap the file and clear the index. */
+  void unload();
+
+  /** The name of the cache file */
+  std::string d_filename;
+  /** The fingerprint of the current configuration */
+  uint64_t d_fingerprint;
+  /** The maximal number of entries, 0 if unbounded */
+  size_t d_maxEntries;
+  /** The number of new entries that triggers a flush, 0 if none does */
+  size_t d_flushInterval;
+
+  /** The contents of the cache file */
+  const char* d_data;
+  /** The size of the (well-formed) contents of the cache file */
+  size_t d_size;
+  /** The size of the memory mapping */
+  size_t d_mappedSize;
+  /** Whether d_data is memory-mapped (rather than pointing to d_buffer) */
+  bool d_mapped;
+  /** The contents of the cache file if it could not be memory-mapped */
+  std::string d_buffer;
+  /**
+   * Whether records can be appended to the cache file, i.e. whether it was
+   * loaded and ends with a complete record
+   */
+  bool d_append;
+  /** Maps hashes of keys to the offsets of the records in d_data */
+  std::unordered_multimap<uint64_t, size_t> d_index;
+  /** The entries (keys to values) added to the cache by this process */
+  std::unordered_map<std::string, std::string> d_entries;
+  /** The entries of d_entries not yet written to the file */
+  std::vector<const std::pair<const std::string, std::string>*> d_unwritten;
+
+  /** Statistics of the persistent cache */
+  struct Statistics
+  {
+    Statistics();
+    ~Statistics();
+    /** Number of lookups that found an entry */
+    IntStat d_hits;
+    /** Number of lookups that found no entry */
+    IntStat d_misses;
+    /** Fraction of lookups that found an entry */
+    AverageStat d_hitRate;
+    /** Number of entries loaded from the cache file */
+    IntStat d_loadedEntries;
+    /** Number of entries added to the cache */
+    IntStat d_storedEntries;
+    /** Number of writes to the cache file */
+    IntStat d_flushes;
+  };
+  Statistics d_statistics;
+}; /* class PersistentRewriteCache */
+
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__PERSISTENT_REWRITE_CACHE_H */
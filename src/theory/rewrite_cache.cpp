@@ -0,0 +1,124 @@
+/*********************                                                        */
+/*! \file rewrite_cache.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The cache of the rewriter
+ **
+ ** The cache of the rewriter.
+ **/
+
+#include "theory/rewrite_cache.h"
+
+#include "base/check.h"
+
+namespace CVC4 {
+namespace theory {
+
+RewriteCache::RewriteCache(size_t maxEntries)
+    : d_mask(0), d_shift(64), d_size(0), d_maxCapacity(0)
+{
+  setMaxEntries(maxEntries);
+}
+
+void RewriteCache::setMaxEntries(size_t maxEntries)
+{
+  d_maxCapacity = 0;
+  if (maxEntries > 0)
+  {
+    d_maxCapacity = s_initialCapacity;
+    while (d_maxCapacity < maxEntries)
+    {
+      d_maxCapacity *= 2;
+    }
+    if (d_table.size() > d_maxCapacity)
+    {
+      rehash(d_maxCapacity);
+    }
+  }
+}
+
+bool RewriteCache::set(TNode n, TNode value)
+{
+  Assert(!value.isNull());
+  if (d_table.empty())
+  {
+    rehash(s_initialCapacity);
+  }
+  else if (2 * d_size >= d_table.size()
+           && (d_maxCapacity == 0 || d_table.size() < d_maxCapacity))
+  {
+    rehash(2 * d_table.size());
+  }
+  // do not reference n from its own entry, which would keep it alive
+  return insert(n.getId(), n == value ? Node::null() : Node(value));
+}
+
+bool RewriteCache::insert(uint64_t id, Node value)
+{
+  Assert(id != 0);
+  for (;;)
+  {
+    for (size_t i = home(id), j = 0; j < s_probeWindow;
+         ++j, i = (i + 1) & d_mask)
+    {
+      Entry& e = d_table[i];
+      if (e.d_id == 0 || e.d_id == id)
+      {
+        d_size += e.d_id == 0 ? 1 : 0;
+        e.d_id = id;
+        e.d_value = value;
+        return false;
+      }
+    }
+    if (d_maxCapacity != 0 && d_table.size() >= d_maxCapacity)
+    {
+      // the probe window is full and we may not grow: evict the entry in
+      // the home slot
+      Entry& e = d_table[home(id)];
+      e.d_id = id;
+      e.d_value = value;
+      return true;
+    }
+    rehash(2 * d_table.size());
+  }
+}
+
+void RewriteCache::rehash(size_t capacity)
+{
+  std::vector<Entry> old(capacity);
+  old.swap(d_table);
+  d_mask = capacity - 1;
+  d_shift = 64;
+  for (size_t c = capacity; c > 1; c >>= 1)
+  {
+    --d_shift;
+  }
+  d_size = 0;
+  for (Entry& e : old)
+  {
+    if (e.d_id != 0)
+    {
+      // entries that do not fit anymore (when shrinking) are dropped
+      insert(e.d_id, e.d_value);
+    }
+  }
+}
+
+void RewriteCache::clear()
+{
+  d_table.clear();
+  d_table.shrink_to_fit();
+  d_mask = 0;
+  d_shift = 64;
+  d_size = 0;
+}
+
+}  // namespace theory
+}  // namespace CVC4
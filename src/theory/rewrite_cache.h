@@ -0,0 +1,134 @@
+/*********************                                                        */
+/*! \file rewrite_cache.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The cache of the rewriter
+ **
+ ** An open-addressing hash table mapping nodes (by id) to their pre- or
+ ** post-rewritten forms, used by the Rewriter instead of node attributes.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__REWRITE_CACHE_H
+#define CVC4__THEORY__REWRITE_CACHE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "expr/node.h"
+
+namespace CVC4 {
+namespace theory {
+
+/**
+ * A map from nodes to (rewritten) nodes, implemented as an open-addressing
+ * hash table with linear probing that is keyed by node ids.
+ *
+ * The keys are not referenced: since node ids are never reused, the entry of
+ * a node that has been garbage collected is never found again.  Such stale
+ * entries are overwritten over time, as the number of entries can be bounded:
+ * if the table reached its maximal capacity, inserting a node whose probe
+ * window is full evicts the entry in its home slot.
+ */
+class RewriteCache
+{
+ public:
+  /**
+   * Construct an empty cache with at most maxEntries entries (rounded up to
+   * a power of two), or no bound if maxEntries is 0.
+   */
+  RewriteCache(size_t maxEntries = 0);
+
+  /** Set the maximal number of entries (see constructor). */
+  void setMaxEntries(size_t maxEntries);
+
+  /**
+   * Get the cached value for n, or the null node if there is none.
+   */
+  Node get(TNode n) const
+  {
+    if (d_table.empty())
+    {
+      return Node::null();
+    }
+    uint64_t id = n.getId();
+    for (size_t i = home(id), j = 0; j < s_probeWindow;
+         ++j, i = (i + 1) & d_mask)
+    {
+      const Entry& e = d_table[i];
+      if (e.d_id == id)
+      {
+        return e.d_value.isNull() ? Node(n) : e.d_value;
+      }
+      if (e.d_id == 0)
+      {
+        break;
+      }
+    }
+    return Node::null();
+  }
+
+  /**
+   * Cache value for n.  Returns true if another entry was evicted for this.
+   */
+  bool set(TNode n, TNode value);
+
+  /** Remove all entries. */
+  void clear();
+
+  /** The number of entries. */
+  size_t size() const { return d_size; }
+
+ private:
+  /** An entry of the table */
+  struct Entry
+  {
+    Entry() : d_id(0) {}
+    /** The id of the key, 0 (the id of the null node) for empty entries */
+    uint64_t d_id;
+    /** The value, null if it is the key itself */
+    Node d_value;
+  };
+
+  /** The number of slots searched for a key, starting at its home slot */
+  static constexpr size_t s_probeWindow = 16;
+  /** The initial number of slots */
+  static constexpr size_t s_initialCapacity = 1024;
+
+  /** The home slot of the node with the given id. */
+  size_t home(uint64_t id) const
+  {
+    // Fibonacci hashing spreads consecutive ids over the table
+    return ((id * UINT64_C(0x9E3779B97F4A7C15)) >> d_shift) & d_mask;
+  }
+
+  /** Insert an entry, returns true if another entry was evicted. */
+  bool insert(uint64_t id, Node value);
+
+  /** Resize the table to capacity slots and reinsert the entries. */
+  void rehash(size_t capacity);
+
+  /** The table, its size being a power of two */
+  std::vector<Entry> d_table;
+  /** The size of the table minus one */
+  size_t d_mask;
+  /** The right shift applied to the product in home() */
+  unsigned d_shift;
+  /** The number of entries */
+  size_t d_size;
+  /** The maximal size of the table, 0 if unbounded */
+  size_t d_maxCapacity;
+}; /* class RewriteCache */
+
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__REWRITE_CACHE_H */
@@ -17,6 +17,9 @@
 
 #include "theory/rewriter.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #include "options/theory_options.h"
 #include "smt/smt_engine.h"
 #include "smt/smt_engine_scope.h"
@@ -89,6 +92,74 @@ RewriteResponse identityRewrite(RewriteEnvironment* re, TNode n)
   return RewriteResponse(REWRITE_DONE, n);
 }
 
+Rewriter::Statistics::Statistics()
+    : d_cacheHits("theory::Rewriter::cacheHits", 0),
+      d_cacheMisses("theory::Rewriter::cacheMisses", 0),
+      d_cacheEvictions("theory::Rewriter::cacheEvictions", 0)
+{
+}
+
+std::shared_ptr<Rewriter::Caches> Rewriter::getSharedCaches(NodeManager* nm)
+{
+  // The caches are not owned by the node manager, as they are only needed
+  // while some SmtEngine uses it. Entries of expired caches are removed
+  // lazily.
+  static std::mutex mutex;
+  static std::unordered_map<NodeManager*, std::weak_ptr<Caches>> caches;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::weak_ptr<Caches>& entry = caches[nm];
+  std::shared_ptr<Caches> shared = entry.lock();
+  if (shared == nullptr)
+  {
+    for (auto it = caches.begin(); it != caches.end();)
+    {
+      it = it->second.expired() ? caches.erase(it) : std::next(it);
+    }
+    shared = std::make_shared<Caches>();
+    caches[nm] = shared;
+  }
+  return shared;
+}
+
+Rewriter::~Rewriter()
+{
+  if (d_statisticsRegistered)
+  {
+    smtStatisticsRegistry()->unregisterStat(&d_statistics.d_cacheHits);
+    smtStatisticsRegistry()->unregisterStat(&d_statistics.d_cacheMisses);
+    smtStatisticsRegistry()->unregisterStat(&d_statistics.d_cacheEvictions);
+  }
+}
+
+void Rewriter::finishInit(const LogicInfo& logic, bool isInternalSubsolver)
+{
+  if (!d_caches->d_bounded)
+  {
+    for (size_t i = 0; i < theory::THEORY_LAST; ++i)
+    {
+      d_caches->d_pre[i].setMaxEntries(options::rewriteCacheLimit());
+      d_caches->d_post[i].setMaxEntries(options::rewriteCacheLimit());
+    }
+    d_caches->d_bounded = true;
+  }
+  if (!options::rewriteCacheFile().empty() && !isInternalSubsolver
+      && d_persistentCache == nullptr)
+  {
+    d_persistentCache.reset(new PersistentRewriteCache(
+        options::rewriteCacheFile(),
+        PersistentRewriteCache::computeFingerprint(logic.getLogicString()),
+        options::rewriteCacheFileLimit(),
+        options::rewriteCacheFileFlush()));
+  }
+  if (!d_statisticsRegistered)
+  {
+    smtStatisticsRegistry()->registerStat(&d_statistics.d_cacheHits);
+    smtStatisticsRegistry()->registerStat(&d_statistics.d_cacheMisses);
+    smtStatisticsRegistry()->registerStat(&d_statistics.d_cacheEvictions);
+    d_statisticsRegistered = true;
+  }
+}
+
 Node Rewriter::rewrite(TNode node) {
   if (node.getNumChildren() == 0)
   {
@@ -99,6 +170,35 @@ Node Rewriter::rewrite(TNode node) {
   return getInstance()->rewriteTo(theoryOf(node), node);
 }
 
+Node Rewriter::rewriteAssertion(TNode node)
+{
+  Rewriter* rewriter = getInstance();
+  if (rewriter->d_persistentCache != nullptr && node.getNumChildren() > 0)
+  {
+    return rewriter->rewriteWithPersistentCache(node);
+  }
+  return rewrite(node);
+}
+
+Node Rewriter::rewriteWithPersistentCache(TNode node)
+{
+  TheoryId theoryId = theoryOf(node);
+  Node ret = d_caches->d_post[theoryId].get(node);
+  if (!ret.isNull())
+  {
+    return ret;
+  }
+  ret = d_persistentCache->lookup(node);
+  if (!ret.isNull())
+  {
+    setPostRewriteCache(theoryId, node, ret);
+    return ret;
+  }
+  ret = rewriteTo(theoryId, node);
+  d_persistentCache->store(node, ret);
+  return ret;
+}
+
 TrustNode Rewriter::rewriteWithProof(TNode node,
                                      bool elimTheoryRewrite,
                                      bool isExtEq)
@@ -178,6 +278,58 @@ Rewriter* Rewriter::getInstance()
   return smt::currentSmtEngine()->getRewriter();
 }
 
+Node Rewriter::getPreRewriteCache(theory::TheoryId theoryId, TNode node)
+{
+  Node cached = d_caches->d_pre[theoryId].get(node);
+  if (cached.isNull())
+  {
+    ++d_statistics.d_cacheMisses;
+  }
+  else
+  {
+    ++d_statistics.d_cacheHits;
+  }
+  return cached;
+}
+
+Node Rewriter::getPostRewriteCache(theory::TheoryId theoryId, TNode node)
+{
+  Node cached = d_caches->d_post[theoryId].get(node);
+  if (cached.isNull())
+  {
+    ++d_statistics.d_cacheMisses;
+  }
+  else
+  {
+    ++d_statistics.d_cacheHits;
+  }
+  return cached;
+}
+
+void Rewriter::setPreRewriteCache(theory::TheoryId theoryId,
+                                  TNode node,
+                                  TNode cache)
+{
+  Trace("rewriter") << "setting pre-rewrite of " << node << " to " << cache
+                    << std::endl;
+  if (d_caches->d_pre[theoryId].set(node, cache))
+  {
+    ++d_statistics.d_cacheEvictions;
+  }
+}
+
+void Rewriter::setPostRewriteCache(theory::TheoryId theoryId,
+                                   TNode node,
+                                   TNode cache)
+{
+  Trace("rewriter") << "setting rewrite of " << node << " to " << cache
+                    << std::endl;
+  if (d_caches->d_post[theoryId].set(node, cache))
+  {
+    ++d_statistics.d_cacheEvictions;
+  }
+}
+
 Node Rewriter::rewriteTo(theory::TheoryId theoryId,
                          Node node,
                          TConvProofGenerator* tcpg)
@@ -200,6 +352,10 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
     return cached;
   }
 
+  // Results of this call, so that shared subterms are rewritten once even if
+  // the (bounded) post-rewrite cache evicts them in the meantime
+  std::unordered_map<Node, Node, NodeHashFunction> visited[THEORY_LAST];
+
   // Put the node on the stack in order to start the "recursive" rewrite
   vector<RewriteStackElement> rewriteStack;
   rewriteStack.push_back(RewriteStackElement(node, theoryId));
@@ -267,11 +423,16 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
 
     rewriteStackTop.d_original = rewriteStackTop.d_node;
     // Now it's time to rewrite the children, check if this has already been done
-    cached = getPostRewriteCache(rewriteStackTop.getTheoryId(),
-                                 rewriteStackTop.d_node);
+    std::unordered_map<Node, Node, NodeHashFunction>::const_iterator itv =
+        visited[rewriteStackTop.getTheoryId()].find(rewriteStackTop.d_node);
+    bool wasVisited = itv != visited[rewriteStackTop.getTheoryId()].end();
+    cached = wasVisited ? itv->second
+                        : getPostRewriteCache(rewriteStackTop.getTheoryId(),
+                                              rewriteStackTop.d_node);
     // If not, go through the children
     if (cached.isNull()
-        || (tcpg != nullptr && !tcpg->hasRewriteStep(rewriteStackTop.d_node)))
+        || (!wasVisited && tcpg != nullptr
+            && !tcpg->hasRewriteStep(rewriteStackTop.d_node)))
     {
       // The child we need to rewrite
       unsigned child = rewriteStackTop.d_nextChild++;
@@ -358,6 +519,8 @@ Node Rewriter::rewriteTo(theory::TheoryId theoryId,
       setPostRewriteCache(rewriteStackTop.getOriginalTheoryId(),
                           rewriteStackTop.d_original,
                           rewriteStackTop.d_node);
+      visited[rewriteStackTop.getOriginalTheoryId()]
+             [rewriteStackTop.d_original] = rewriteStackTop.d_node;
     }
     else
     {
@@ -468,5 +631,14 @@ void Rewriter::clearCaches() {
   rewriter->clearCachesInternal();
 }
 
+void Rewriter::clearCachesInternal()
+{
+  for (size_t i = 0; i < theory::THEORY_LAST; ++i)
+  {
+    d_caches->d_pre[i].clear();
+    d_caches->d_post[i].clear();
+  }
+}
+
 }/* CVC4::theory namespace */
 }/* CVC4 namespace */
@@ -18,10 +18,16 @@
 
 #pragma once
 
+#include <memory>
+
 #include "expr/node.h"
 #include "expr/term_conversion_proof_generator.h"
+#include "theory/logic_info.h"
+#include "theory/persistent_rewrite_cache.h"
+#include "theory/rewrite_cache.h"
 #include "theory/theory_rewriter.h"
 #include "theory/trust_node.h"
+#include "util/statistics_registry.h"
 #include "util/unsafe_interrupt_exception.h"
 
 namespace CVC4 {
@@ -57,7 +63,21 @@ class Rewriter {
   friend builtin::BuiltinProofRuleChecker;
 
  public:
-  Rewriter();
+  /**
+   * Constructs a rewriter for nodes of nm.  Its rewrite caches are shared
+   * with all other rewriters for nm (e.g. the ones of subsolvers), as long
+   * as one of them exists.
+   */
+  Rewriter(NodeManager* nm);
+  ~Rewriter();
+
+  /**
+   * Finish initialization once the options are set: bounds the rewrite
+   * caches (if they are not shared with a rewriter that bounded them
+   * already), loads the persistent rewrite cache (unless this rewriter belongs
+   * to an internal subsolver) and registers the statistics of this rewriter.
+   */
+  void finishInit(const LogicInfo& logic, bool isInternalSubsolver);
 
   /**
    * Rewrites the node using theoryOf() to determine which rewriter to
@@ -65,6 +85,14 @@ class Rewriter {
    */
   static Node rewrite(TNode node);
 
+  /**
+   * Rewrites an input assertion.  Same as rewrite(), except that the result
+   * is looked up in (and added to) the persistent rewrite cache, if enabled.
+   * Other calls to the rewriter do not use the persistent cache, since
+   * computing the key of a term takes time linear in its size.
+   */
+  static Node rewriteAssertion(TNode node);
+
   /**
    * Rewrites the equality node using theoryOf() to determine which rewriter to
    * use on the node corresponding to an equality s = t.
@@ -171,6 +199,12 @@ class Rewriter {
   /** Sets the appropriate cache for a node */
   void setPostRewriteCache(theory::TheoryId theoryId, TNode node, TNode cache);
 
+  /**
+   * Rewrites the node, looking it up in (and adding it to) the persistent
+   * rewrite cache if it is not in the post-rewrite cache.
+   */
+  Node rewriteWithPersistentCache(TNode node);
+
   /**
    * Rewrites the node using the given theory rewriter.
    */
@@ -204,6 +238,44 @@ class Rewriter {
   /** Theory rewriters used by this rewriter instance */
   TheoryRewriter* d_theoryRewriters[theory::THEORY_LAST];
 
+  /** The rewrite caches of a node manager */
+  struct Caches
+  {
+    Caches() : d_bounded(false) {}
+    /** The pre-rewrite cache of each theory */
+    RewriteCache d_pre[theory::THEORY_LAST];
+    /** The post-rewrite cache of each theory */
+    RewriteCache d_post[theory::THEORY_LAST];
+    /** Whether the caches are bounded according to the options */
+    bool d_bounded;
+  };
+
+  /**
+   * Returns the caches for nm, creating them if no rewriter for nm exists.
+   */
+  static std::shared_ptr<Caches> getSharedCaches(NodeManager* nm);
+
+  /** The rewrite caches, shared by all rewriters of the node manager */
+  std::shared_ptr<Caches> d_caches;
+
+  /** The persistent rewrite cache, if enabled */
+  std::unique_ptr<PersistentRewriteCache> d_persistentCache;
+
+  /** Statistics of the rewrite caches */
+  struct Statistics
+  {
+    Statistics();
+    /** Number of lookups in the rewrite caches that found an entry */
+    IntStat d_cacheHits;
+    /** Number of lookups in the rewrite caches that found no entry */
+    IntStat d_cacheMisses;
+    /** Number of entries evicted from the rewrite caches */
+    IntStat d_cacheEvictions;
+  };
+  Statistics d_statistics;
+  /** Whether d_statistics are registered */
+  bool d_statisticsRegistered;
+
   unsigned long d_iterationCount = 0;
 
   /** Rewriter table for prewrites. Maps kinds to rewriter function. */
@@ -20,48 +20,14 @@
 #pragma once
 
 #include "theory/rewriter.h"
-#include "theory/rewriter_attributes.h"
-#include "expr/attribute_unique_id.h"
-#include "expr/attribute.h"
 
 ${rewriter_includes}
 
 namespace CVC4 {
 namespace theory {
 
-Node Rewriter::getPreRewriteCache(theory::TheoryId theoryId, TNode node) {
-  switch(theoryId) {
-${pre_rewrite_get_cache}
-  default:
-    Unreachable();
-  }
-}
-
-Node Rewriter::getPostRewriteCache(theory::TheoryId theoryId, TNode node) {
-  switch(theoryId) {
-${post_rewrite_get_cache}
-    default:
-    Unreachable();
-  }
-}
-
-void Rewriter::setPreRewriteCache(theory::TheoryId theoryId, TNode node, TNode cache) {
-  switch(theoryId) {
-${pre_rewrite_set_cache}
-  default:
-    Unreachable();
-  }
-}
-
-void Rewriter::setPostRewriteCache(theory::TheoryId theoryId, TNode node, TNode cache) {
-  switch(theoryId) {
-${post_rewrite_set_cache}
-  default:
-    Unreachable();
-  }
-}
-
-Rewriter::Rewriter()
+Rewriter::Rewriter(NodeManager* nm)
+    : d_caches(getSharedCaches(nm)), d_statisticsRegistered(false)
 {
 for (size_t i = 0; i < kind::LAST_KIND; ++i)
 {
@@ -76,23 +42,5 @@ for (size_t i = 0; i < theory::THEORY_LAST; ++i)
 }
 }
 
-void Rewriter::clearCachesInternal() {
-  typedef CVC4::expr::attr::AttributeUniqueId AttributeUniqueId;
-  std::vector<AttributeUniqueId> preids;
-  ${pre_rewrite_attribute_ids}
-
-  std::vector<AttributeUniqueId> postids;
-  ${post_rewrite_attribute_ids}
-
-  std::vector<const AttributeUniqueId*> allids;
-  for(unsigned i = 0; i < preids.size(); ++i){
-    allids.push_back(&preids[i]);
-  }
-  for(unsigned i = 0; i < postids.size(); ++i){
-    allids.push_back(&postids[i]);
-  }
-  NodeManager::currentNM()->deleteAttributes(allids);
-}
-
 }/* CVC4::theory namespace */
 }/* CVC4 namespace */
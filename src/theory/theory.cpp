@@ -538,6 +538,9 @@ void Theory::check(Effort level)
     // check aborted for a theory-specific reason
     return;
   }
+  // whether positive equalities are merged in batches
+  bool batch = level == EFFORT_STANDARD && batchEqualities();
+  bool inBatch = false;
   // process the pending fact queue
   while (!done() && !d_theoryState->isInConflict())
   {
@@ -546,6 +549,17 @@ void Theory::check(Effort level)
     TNode fact = assertion.d_assertion;
     bool polarity = fact.getKind() != kind::NOT;
     TNode atom = polarity ? fact : fact[0];
+    bool batched = batch && polarity && atom.getKind() == kind::EQUAL;
+    if (inBatch && !batched)
+    {
+      // propagate the batch before processing other facts
+      d_equalityEngine->endBatch();
+      inBatch = false;
+      if (d_theoryState->isInConflict())
+      {
+        break;
+      }
+    }
     // call the pre-notify method
     if (preNotifyFact(atom, polarity, fact, assertion.d_isPreregistered, false))
     {
@@ -558,6 +572,11 @@ void Theory::check(Effort level)
     // assert to the equality engine
     if (atom.getKind() == kind::EQUAL)
     {
+      if (batched && !inBatch)
+      {
+        d_equalityEngine->beginBatch();
+        inBatch = true;
+      }
       d_equalityEngine->assertEquality(atom, polarity, fact);
     }
     else
@@ -567,6 +586,10 @@ void Theory::check(Effort level)
     // notify the theory of the new fact, which is not internal
     notifyFact(atom, polarity, fact, false);
   }
+  if (inBatch)
+  {
+    d_equalityEngine->endBatch();
+  }
   // post-check at level
   postCheck(level);
 }
@@ -581,6 +604,8 @@ bool Theory::preNotifyFact(
   return false;
 }
 
+bool Theory::batchEqualities() const { return false; }
+
 void Theory::notifyFact(TNode atom, bool polarity, TNode fact, bool isInternal)
 {
 }
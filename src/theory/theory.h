@@ -646,6 +646,14 @@ class Theory {
    * is false, the fact was asserted via the fact queue of the theory.
    */
   virtual void notifyFact(TNode atom, bool pol, TNode fact, bool isInternal);
+  /**
+   * Whether the standard check method may assert consecutive positive
+   * equalities at standard effort to the equality engine in one batch (see
+   * EqualityEngine::beginBatch). The equality engine is then propagated after
+   * the last equality of the batch, so theories returning true must not depend
+   * on its state in preNotifyFact and notifyFact for positive equalities.
+   */
+  virtual bool batchEqualities() const;
   //--------------------------------- end check
 
   //--------------------------------- collect model info
@@ -29,12 +29,22 @@ EqualityEngine::Statistics::Statistics(std::string name)
     : d_mergesCount(name + "::mergesCount", 0),
       d_termsCount(name + "::termsCount", 0),
       d_functionTermsCount(name + "::functionTermsCount", 0),
-      d_constantTermsCount(name + "::constantTermsCount", 0)
+      d_constantTermsCount(name + "::constantTermsCount", 0),
+      d_explanationCacheLookups(name + "::explanationCacheLookups", 0),
+      d_explanationCacheHits(name + "::explanationCacheHits", 0),
+      d_explanationCacheHitRate(name + "::explanationCacheHitRate", 0.0),
+      d_batchedEqualitiesCount(name + "::batchedEqualities", 0),
+      d_useListSweepsCount(name + "::useListSweeps", 0)
 {
   smtStatisticsRegistry()->registerStat(&d_mergesCount);
   smtStatisticsRegistry()->registerStat(&d_termsCount);
   smtStatisticsRegistry()->registerStat(&d_functionTermsCount);
   smtStatisticsRegistry()->registerStat(&d_constantTermsCount);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheLookups);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheHits);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheHitRate);
+  smtStatisticsRegistry()->registerStat(&d_batchedEqualitiesCount);
+  smtStatisticsRegistry()->registerStat(&d_useListSweepsCount);
 }
 
 EqualityEngine::Statistics::~Statistics() {
@@ -42,6 +52,11 @@ EqualityEngine::Statistics::~Statistics() {
   smtStatisticsRegistry()->unregisterStat(&d_termsCount);
   smtStatisticsRegistry()->unregisterStat(&d_functionTermsCount);
   smtStatisticsRegistry()->unregisterStat(&d_constantTermsCount);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheLookups);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheHits);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheHitRate);
+  smtStatisticsRegistry()->unregisterStat(&d_batchedEqualitiesCount);
+  smtStatisticsRegistry()->unregisterStat(&d_useListSweepsCount);
 }
 
 /**
@@ -126,12 +141,17 @@ EqualityEngine::EqualityEngine(context::Context* context,
       d_subtermEvaluatesSize(context, 0),
       d_stats(name),
       d_inPropagate(false),
+      d_inBatch(false),
+      d_deferUseLists(false),
       d_constantsAreTriggers(constantsAreTriggers),
       d_anyTermsAreTriggers(anyTermTriggers),
       d_triggerDatabaseSize(context, 0),
       d_triggerTermSetUpdatesSize(context, 0),
       d_deducedDisequalitiesSize(context, 0),
       d_deducedDisequalityReasonsSize(context, 0),
+      d_explanationCache(context),
+      d_explanationReasonsSize(context, 0),
+      d_explanationsOmitted(0),
       d_propagatedDisequalities(context),
       d_name(name)
 {
@@ -156,12 +176,17 @@ EqualityEngine::EqualityEngine(EqualityEngineNotify& notify,
       d_subtermEvaluatesSize(context, 0),
       d_stats(name),
       d_inPropagate(false),
+      d_inBatch(false),
+      d_deferUseLists(false),
       d_constantsAreTriggers(constantsAreTriggers),
       d_anyTermsAreTriggers(anyTermTriggers),
       d_triggerDatabaseSize(context, 0),
       d_triggerTermSetUpdatesSize(context, 0),
       d_deducedDisequalitiesSize(context, 0),
       d_deducedDisequalityReasonsSize(context, 0),
+      d_explanationCache(context),
+      d_explanationReasonsSize(context, 0),
+      d_explanationsOmitted(0),
       d_propagatedDisequalities(context),
       d_name(name)
 {
@@ -228,9 +253,9 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
 
   // Add to the use lists
   Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): adding " << original << " to the uselist of " << d_nodes[t1] << std::endl;
-  d_equalityNodes[t1].usedIn(funId, d_useListNodes);
+  d_nodeRecords[t1].d_node.usedIn(funId, d_useListNodes);
   Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): adding " << original << " to the uselist of " << d_nodes[t2] << std::endl;
-  d_equalityNodes[t2].usedIn(funId, d_useListNodes);
+  d_nodeRecords[t2].d_node.usedIn(funId, d_useListNodes);
 
   // Return the new id
   Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << ") => " << funId << std::endl;
@@ -246,27 +271,16 @@ EqualityNodeId EqualityEngine::newNode(TNode node) {
 
   // Register the new id of the term
   EqualityNodeId newId = d_nodes.size();
-  d_nodeIds[node] = newId;
+  d_nodeIds.insert(node, newId);
   // Add the node to it's position
   d_nodes.push_back(node);
   // Note if this is an application or not
   d_applications.push_back(FunctionApplicationPair());
-  // Add the trigger list for this node
-  d_nodeTriggers.push_back(+null_trigger);
   // Add it to the equality graph
   d_equalityGraph.push_back(+null_edge);
-  // Mark the no-individual trigger
-  d_nodeIndividualTrigger.push_back(+null_set_id);
-  // Mark non-constant by default
-  d_isConstant.push_back(false);
-  // No terms to evaluate by defaul
-  d_subtermsToEvaluate.push_back(0);
-  // Mark equality nodes
-  d_isEquality.push_back(false);
-  // Mark the node as internal by default
-  d_isInternal.push_back(true);
-  // Add the equality node to the nodes
-  d_equalityNodes.push_back(EqualityNode(newId));
+  // Add the equality node with no triggers, non-constant, non-equality and
+  // internal by default
+  d_nodeRecords.push_back(EqualityNodeRecord(newId, null_set_id));
 
   // Increase the counters
   d_nodesCount = d_nodesCount + 1;
@@ -291,15 +305,15 @@ void EqualityEngine::addFunctionKind(Kind fun, bool interpreted, bool extOperato
 }
 
 void EqualityEngine::subtermEvaluates(EqualityNodeId id)  {
-  Debug("equality::evaluation") << d_name << "::eq::subtermEvaluates(" << d_nodes[id] << "): " << d_subtermsToEvaluate[id] << std::endl;
-  Assert(!d_isInternal[id]);
-  Assert(d_subtermsToEvaluate[id] > 0);
-  if ((-- d_subtermsToEvaluate[id]) == 0) {
+  Debug("equality::evaluation") << d_name << "::eq::subtermEvaluates(" << d_nodes[id] << "): " << d_nodeRecords[id].d_subtermsToEvaluate << std::endl;
+  Assert(!d_nodeRecords[id].isInternal());
+  Assert(d_nodeRecords[id].d_subtermsToEvaluate > 0);
+  if ((-- d_nodeRecords[id].d_subtermsToEvaluate) == 0) {
     d_evaluationQueue.push(id);
   }
   d_subtermEvaluates.push_back(id);
   d_subtermEvaluatesSize = d_subtermEvaluates.size();
-  Debug("equality::evaluation") << d_name << "::eq::subtermEvaluates(" << d_nodes[id] << "): new " << d_subtermsToEvaluate[id] << std::endl;
+  Debug("equality::evaluation") << d_name << "::eq::subtermEvaluates(" << d_nodes[id] << "): new " << d_nodeRecords[id].d_subtermsToEvaluate << std::endl;
 }
 
 void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
@@ -326,8 +340,8 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
     EqualityNodeId t0id = getNodeId(t[0]);
     EqualityNodeId t1id = getNodeId(t[1]);
     result = newApplicationNode(t, t0id, t1id, APP_EQUALITY);
-    d_isInternal[result] = false;
-    d_isConstant[result] = false;
+    d_nodeRecords[result].setInternal(false);
+    d_nodeRecords[result].setConstant(false);
   }
   else if (t.getNumChildren() > 0 && d_congruenceKinds[tk])
   {
@@ -344,12 +358,12 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
       // Add the application
       result = newApplicationNode(t, result, tiId, isInterpreted ? APP_INTERPRETED : APP_UNINTERPRETED);
     }
-    d_isInternal[result] = false;
-    d_isConstant[result] = t.isConst();
+    d_nodeRecords[result].setInternal(false);
+    d_nodeRecords[result].setConstant(t.isConst());
     // If interpreted, set the number of non-interpreted children
     if (isInterpreted) {
       // How many children are not constants yet
-      d_subtermsToEvaluate[result] = t.getNumChildren();
+      d_nodeRecords[result].d_subtermsToEvaluate = t.getNumChildren();
       for (unsigned i = 0; i < t.getNumChildren(); ++ i) {
         if (isConstant(getNodeId(t[i]))) {
           Debug("equality::evaluation") << d_name << "::eq::addTermInternal(" << t << "): evaluates " << t[i] << std::endl;
@@ -363,15 +377,15 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
     // Otherwise we just create the new id
     result = newNode(t);
     // Is this an operator
-    d_isInternal[result] = isOperator;
-    d_isConstant[result] = !isOperator && t.isConst();
+    d_nodeRecords[result].setInternal(isOperator);
+    d_nodeRecords[result].setConstant(!isOperator && t.isConst());
   }
 
   if (tk == kind::EQUAL)
   {
     // We set this here as this only applies to actual terms, not the
     // intermediate application terms
-    d_isEquality[result] = true;
+    d_nodeRecords[result].setEquality(true);
   }
   else
   {
@@ -381,7 +395,7 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
     {
       d_notify.eqNotifyNewClass(t);
     }
-    if (d_constantsAreTriggers && d_isConstant[result])
+    if (d_constantsAreTriggers && d_nodeRecords[result].isConstant())
     {
       // Non-Boolean constants are trigger terms for all tags
       EqualityNodeId tId = getNodeId(t);
@@ -399,13 +413,13 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
       d_triggerTermSetUpdates.push_back(TriggerSetUpdate(tId, null_set_id));
       d_triggerTermSetUpdatesSize = d_triggerTermSetUpdatesSize + 1;
       // Mark the the new set as a trigger
-      d_nodeIndividualTrigger[tId] =
+      d_nodeRecords[tId].d_triggerSet =
           newTriggerTermSet(newSetTags, newSetTriggers, newSetTriggersSize);
     }
   }
 
   // If this is not an internal node, add it to the master
-  if (d_masterEqualityEngine && !d_isInternal[result]) {
+  if (d_masterEqualityEngine && !d_nodeRecords[result].isInternal()) {
     d_masterEqualityEngine->addTermInternal(t);
   }
 
@@ -418,12 +432,12 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
 }
 
 bool EqualityEngine::hasTerm(TNode t) const {
-  return d_nodeIds.find(t) != d_nodeIds.end();
+  return d_nodeIds.find(t) != null_id;
 }
 
 EqualityNodeId EqualityEngine::getNodeId(TNode node) const {
   Assert(hasTerm(node)) << node;
-  return (*d_nodeIds.find(node)).second;
+  return d_nodeIds.find(node);
 }
 
 EqualityNode& EqualityEngine::getEqualityNode(TNode t) {
@@ -431,8 +445,8 @@ EqualityNode& EqualityEngine::getEqualityNode(TNode t) {
 }
 
 EqualityNode& EqualityEngine::getEqualityNode(EqualityNodeId nodeId) {
-  Assert(nodeId < d_equalityNodes.size());
-  return d_equalityNodes[nodeId];
+  Assert(nodeId < d_nodeRecords.size());
+  return d_nodeRecords[nodeId].d_node;
 }
 
 const EqualityNode& EqualityEngine::getEqualityNode(TNode t) const {
@@ -440,8 +454,8 @@ const EqualityNode& EqualityEngine::getEqualityNode(TNode t) const {
 }
 
 const EqualityNode& EqualityEngine::getEqualityNode(EqualityNodeId nodeId) const {
-  Assert(nodeId < d_equalityNodes.size());
-  return d_equalityNodes[nodeId];
+  Assert(nodeId < d_nodeRecords.size());
+  return d_nodeRecords[nodeId].d_node;
 }
 
 void EqualityEngine::assertEqualityInternal(TNode t1, TNode t2, TNode reason, unsigned pid) {
@@ -471,6 +485,7 @@ bool EqualityEngine::assertPredicate(TNode t,
 {
   Debug("equality") << d_name << "::eq::addPredicate(" << t << "," << (polarity ? "true" : "false") << ")" << std::endl;
   Assert(t.getKind() != kind::EQUAL) << "Use assertEquality instead";
+  Assert(!d_inBatch) << "Only positive equalities are batched";
   TNode b = polarity ? d_true : d_false;
   if (hasTerm(t) && areEqual(t, b))
   {
@@ -494,8 +509,12 @@ bool EqualityEngine::assertEquality(TNode eq,
     }
     // Add equality between terms
     assertEqualityInternal(eq[0], eq[1], reason, pid);
+    if (d_inBatch) {
+      ++d_stats.d_batchedEqualitiesCount;
+    }
     propagate();
   } else {
+    Assert(!d_inBatch) << "Only positive equalities are batched";
     // If two terms are already dis-equal, don't assert anything
     if (hasTerm(eq[0]) && hasTerm(eq[1]) && areDisequal(eq[0], eq[1], false)) {
       return false;
@@ -520,14 +539,14 @@ bool EqualityEngine::assertEquality(TNode eq,
     EqualityNodeId b = getNodeId(eq[1]);
     EqualityNodeId aClassId = getEqualityNode(a).getFind();
     EqualityNodeId bClassId = getEqualityNode(b).getFind();
-    if (d_isConstant[aClassId] && d_isConstant[bClassId]) {
+    if (d_nodeRecords[aClassId].isConstant() && d_nodeRecords[bClassId].isConstant()) {
       return true;
     }
 
     // If we are adding a disequality, notify of the shared term representatives
     EqualityNodeId eqId = getNodeId(eq);
-    TriggerTermSetRef aTriggerRef = d_nodeIndividualTrigger[aClassId];
-    TriggerTermSetRef bTriggerRef = d_nodeIndividualTrigger[bClassId];
+    TriggerTermSetRef aTriggerRef = d_nodeRecords[aClassId].d_triggerSet;
+    TriggerTermSetRef bTriggerRef = d_nodeRecords[bClassId].d_triggerSet;
     if (aTriggerRef != +null_set_id && bTriggerRef != +null_set_id) {
       Debug("equality::trigger") << d_name << "::eq::addEquality(" << eq << "," << (polarity ? "true" : "false") << ": have triggers" << std::endl;
       // The sets of trigger terms
@@ -580,7 +599,7 @@ TNode EqualityEngine::getRepresentative(TNode t) const {
   Debug("equality::internal") << d_name << "::eq::getRepresentative(" << t << ")" << std::endl;
   Assert(hasTerm(t));
   EqualityNodeId representativeId = getEqualityNode(t).getFind();
-  Assert(!d_isInternal[representativeId]);
+  Assert(!d_nodeRecords[representativeId].isInternal());
   Debug("equality::internal") << d_name << "::eq::getRepresentative(" << t << ") => " << d_nodes[representativeId] << std::endl;
   return d_nodes[representativeId];
 }
@@ -610,19 +629,19 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
   }
 
   // Check for constant merges
-  bool class1isConstant = d_isConstant[class1Id];
-  bool class2isConstant = d_isConstant[class2Id];
+  bool class1isConstant = d_nodeRecords[class1Id].isConstant();
+  bool class2isConstant = d_nodeRecords[class2Id].isConstant();
   Assert(class1isConstant || !class2isConstant)
       << "Should always merge into constants";
   Assert(!class1isConstant || !class2isConstant) << "Don't merge constants";
 
   // Trigger set of class 1
-  TriggerTermSetRef class1triggerRef = d_nodeIndividualTrigger[class1Id];
+  TriggerTermSetRef class1triggerRef = d_nodeRecords[class1Id].d_triggerSet;
   TheoryIdSet class1Tags = class1triggerRef == null_set_id
                                ? 0
                                : getTriggerTermSet(class1triggerRef).d_tags;
   // Trigger set of class 2
-  TriggerTermSetRef class2triggerRef = d_nodeIndividualTrigger[class2Id];
+  TriggerTermSetRef class2triggerRef = d_nodeRecords[class2Id].d_triggerSet;
   TheoryIdSet class2Tags = class2triggerRef == null_set_id
                                ? 0
                                : getTriggerTermSet(class2triggerRef).d_tags;
@@ -656,7 +675,7 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
     currentNode.setFind(class1Id);
 
     // Go through the triggers and inform if necessary
-    TriggerId currentTrigger = d_nodeTriggers[currentId];
+    TriggerId currentTrigger = d_nodeRecords[currentId].d_triggers;
     while (currentTrigger != null_trigger) {
       Trigger& trigger = d_equalityTriggers[currentTrigger];
       Trigger& otherTrigger = d_equalityTriggers[currentTrigger ^ 1];
@@ -684,49 +703,18 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
 
   // Update class2 table lookup and information if not a boolean
   // since booleans can't be in an application
-  if (!d_isEquality[class2Id]) {
+  if (!d_nodeRecords[class2Id].isEquality()) {
     Debug("equality") << d_name << "::eq::merge(" << class1.getFind() << "," << class2.getFind() << "): updating lookups of " << class2Id << std::endl;
     do {
       // Get the current node
       EqualityNode& currentNode = getEqualityNode(currentId);
-      Debug("equality") << d_name << "::eq::merge(" << class1.getFind() << "," << class2.getFind() << "): updating lookups of node " << currentId << std::endl;
-
-      // Go through the uselist and check for congruences
-      UseListNodeId currentUseId = currentNode.getUseList();
-      while (currentUseId != null_uselist_id) {
-        // Get the node of the use list
-        UseListNode& useNode = d_useListNodes[currentUseId];
-        // Get the function application
-        EqualityNodeId funId = useNode.getApplicationId();
-        Debug("equality") << d_name << "::eq::merge(" << class1.getFind() << "," << class2.getFind() << "): " << d_nodes[currentId] << " in " << d_nodes[funId] << std::endl;
-        const FunctionApplication& fun =
-            d_applications[useNode.getApplicationId()].d_normalized;
-        // If it's interpreted and we can interpret
-        if (fun.isInterpreted() && class1isConstant && !d_isInternal[currentId])
-        {
-          // Get the actual term id
-          TNode term = d_nodes[funId];
-          subtermEvaluates(getNodeId(term));
-        }
-        // Check if there is an application with find arguments
-        EqualityNodeId aNormalized = getEqualityNode(fun.d_a).getFind();
-        EqualityNodeId bNormalized = getEqualityNode(fun.d_b).getFind();
-        FunctionApplication funNormalized(fun.d_type, aNormalized, bNormalized);
-        ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-        if (find != d_applicationLookup.end()) {
-          // Applications fun and the funNormalized can be merged due to congruence
-          if (getEqualityNode(funId).getFind() != getEqualityNode(find->second).getFind()) {
-            enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
-          }
-        } else {
-          // There is no representative, so we can add one, we remove this when backtracking
-          storeApplicationLookup(funNormalized, funId);
-        }
-
-        // Go to the next one in the use list
-        currentUseId = useNode.getNext();
+      if (!d_deferUseLists) {
+        updateUseList(currentId, class1isConstant);
+      } else if (!d_nodeRecords[currentId].isUseListDeferred()) {
+        // Go through the use list once the pending merges are done
+        d_nodeRecords[currentId].setUseListDeferred(true);
+        d_deferredUseLists.push_back(currentId);
       }
-
       // Move to the next node
       currentId = currentNode.getNext();
     } while (currentId != class2Id);
@@ -752,7 +740,7 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
   if (class2triggerRef != +null_set_id) {
     if (class1triggerRef == +null_set_id) {
       // If class1 doesn't have individual triggers, but class2 does, mark it
-      d_nodeIndividualTrigger[class1Id] = class2triggerRef;
+      d_nodeRecords[class1Id].d_triggerSet = class2triggerRef;
       // Add it to the list for backtracking
       d_triggerTermSetUpdates.push_back(TriggerSetUpdate(class1Id, +null_set_id));
       d_triggerTermSetUpdatesSize = d_triggerTermSetUpdatesSize + 1;
@@ -812,7 +800,7 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
         d_triggerTermSetUpdates.push_back(TriggerSetUpdate(class1Id, class1triggerRef));
         d_triggerTermSetUpdatesSize = d_triggerTermSetUpdatesSize + 1;
         // Mark the the new set as a trigger
-        d_nodeIndividualTrigger[class1Id] = newTriggerTermSet(newSetTags, newSetTriggers, newSetTriggersSize);
+        d_nodeRecords[class1Id].d_triggerSet = newTriggerTermSet(newSetTags, newSetTriggers, newSetTriggersSize);
       }
     }
   }
@@ -821,6 +809,78 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
   return true;
 }
 
+void EqualityEngine::updateUseList(EqualityNodeId nodeId, bool classIsConstant) {
+  Debug("equality") << d_name << "::eq::updateUseList(" << nodeId << "): updating lookups of node " << d_nodes[nodeId] << std::endl;
+
+  // Go through the uselist and check for congruences
+  UseListNodeId currentUseId = getEqualityNode(nodeId).getUseList();
+  while (currentUseId != null_uselist_id) {
+    // Get the node of the use list
+    UseListNode& useNode = d_useListNodes[currentUseId];
+    // Get the function application
+    EqualityNodeId funId = useNode.getApplicationId();
+    Debug("equality") << d_name << "::eq::updateUseList(" << nodeId << "): " << d_nodes[nodeId] << " in " << d_nodes[funId] << std::endl;
+    const FunctionApplication& fun =
+        d_applications[useNode.getApplicationId()].d_normalized;
+    // If it's interpreted and we can interpret
+    if (fun.isInterpreted() && classIsConstant && !d_nodeRecords[nodeId].isInternal())
+    {
+      // Get the actual term id
+      TNode term = d_nodes[funId];
+      subtermEvaluates(getNodeId(term));
+    }
+    // Check if there is an application with find arguments
+    EqualityNodeId aNormalized = getEqualityNode(fun.d_a).getFind();
+    EqualityNodeId bNormalized = getEqualityNode(fun.d_b).getFind();
+    FunctionApplication funNormalized(fun.d_type, aNormalized, bNormalized);
+    ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
+    if (find != d_applicationLookup.end()) {
+      // Applications fun and the funNormalized can be merged due to congruence
+      if (getEqualityNode(funId).getFind() != getEqualityNode(find->second).getFind()) {
+        enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+      }
+    } else {
+      // There is no representative, so we can add one, we remove this when backtracking
+      storeApplicationLookup(funNormalized, funId);
+    }
+
+    // Go to the next one in the use list
+    currentUseId = useNode.getNext();
+  }
+}
+
+void EqualityEngine::processDeferredUseLists() {
+  Debug("equality") << d_name << "::eq::processDeferredUseLists(): " << d_deferredUseLists.size() << " nodes" << std::endl;
+  ++d_stats.d_useListSweepsCount;
+  // Going through the use lists enqueues the congruences, which are deferred
+  // to the next sweep
+  std::vector<EqualityNodeId> nodes;
+  nodes.swap(d_deferredUseLists);
+  for (EqualityNodeId nodeId : nodes) {
+    d_nodeRecords[nodeId].setUseListDeferred(false);
+  }
+  for (EqualityNodeId nodeId : nodes) {
+    EqualityNodeId classId = getEqualityNode(nodeId).getFind();
+    updateUseList(nodeId, d_nodeRecords[classId].isConstant());
+  }
+}
+
+void EqualityEngine::beginBatch() {
+  Debug("equality") << d_name << "::eq::beginBatch()" << std::endl;
+  Assert(!d_inBatch);
+  Assert(!d_inPropagate);
+  d_inBatch = true;
+}
+
+void EqualityEngine::endBatch() {
+  Debug("equality") << d_name << "::eq::endBatch()" << std::endl;
+  Assert(d_inBatch);
+  d_inBatch = false;
+  ScopedBool deferUseLists(d_deferUseLists, true);
+  propagate();
+  Assert(d_deferredUseLists.empty());
+}
+
 void EqualityEngine::undoMerge(EqualityNode& class1, EqualityNode& class2, EqualityNodeId class2Id) {
 
   Debug("equality") << d_name << "::eq::undoMerge(" << class1.getFind() << "," << class2Id << ")" << std::endl;
@@ -839,7 +899,7 @@ void EqualityEngine::undoMerge(EqualityNode& class1, EqualityNode& class2, Equal
     currentNode.setFind(class2Id);
 
     // Go through the trigger list (if any) and undo the class
-    TriggerId currentTrigger = d_nodeTriggers[currentId];
+    TriggerId currentTrigger = d_nodeRecords[currentId].d_triggers;
     while (currentTrigger != null_trigger) {
       Trigger& trigger = d_equalityTriggers[currentTrigger];
       trigger.d_classId = class2Id;
@@ -874,7 +934,7 @@ void EqualityEngine::backtrack() {
       if (eq.d_lhs != null_id)
       {
         undoMerge(
-            d_equalityNodes[eq.d_lhs], d_equalityNodes[eq.d_rhs], eq.d_rhs);
+            d_nodeRecords[eq.d_lhs].d_node, d_nodeRecords[eq.d_rhs].d_node, eq.d_rhs);
       }
     }
 
@@ -896,7 +956,7 @@ void EqualityEngine::backtrack() {
     // Unset the individual triggers
     for (int i = d_triggerTermSetUpdates.size() - 1, i_end = d_triggerTermSetUpdatesSize; i >= i_end; -- i) {
       const TriggerSetUpdate& update = d_triggerTermSetUpdates[i];
-      d_nodeIndividualTrigger[update.d_classId] = update.d_oldValue;
+      d_nodeRecords[update.d_classId].d_triggerSet = update.d_oldValue;
     }
     d_triggerTermSetUpdates.resize(d_triggerTermSetUpdatesSize);
   }
@@ -905,7 +965,7 @@ void EqualityEngine::backtrack() {
     // Unlink the triggers from the lists
     for (int i = d_equalityTriggers.size() - 1, i_end = d_equalityTriggersCount; i >= i_end; -- i) {
       const Trigger& trigger = d_equalityTriggers[i];
-      d_nodeTriggers[trigger.d_classId] = trigger.d_nextTrigger;
+      d_nodeRecords[trigger.d_classId].d_triggers = trigger.d_nextTrigger;
     }
     // Get rid of the triggers
     d_equalityTriggers.resize(d_equalityTriggersCount);
@@ -921,7 +981,7 @@ void EqualityEngine::backtrack() {
 
   if (d_subtermEvaluates.size() > d_subtermEvaluatesSize) {
     for(int i = d_subtermEvaluates.size() - 1, i_end = (int)d_subtermEvaluatesSize; i >= i_end; --i) {
-      d_subtermsToEvaluate[d_subtermEvaluates[i]] ++;
+      d_nodeRecords[d_subtermEvaluates[i]].d_subtermsToEvaluate++;
     }
     d_subtermEvaluates.resize(d_subtermEvaluatesSize);
   }
@@ -945,14 +1005,8 @@ void EqualityEngine::backtrack() {
     // Now get rid of the nodes and the rest
     d_nodes.resize(d_nodesCount);
     d_applications.resize(d_nodesCount);
-    d_nodeTriggers.resize(d_nodesCount);
-    d_nodeIndividualTrigger.resize(d_nodesCount);
-    d_isConstant.resize(d_nodesCount);
-    d_subtermsToEvaluate.resize(d_nodesCount);
-    d_isEquality.resize(d_nodesCount);
-    d_isInternal.resize(d_nodesCount);
     d_equalityGraph.resize(d_nodesCount);
-    d_equalityNodes.resize(d_nodesCount);
+    d_nodeRecords.resize(d_nodesCount);
   }
 
   if (d_deducedDisequalities.size() > d_deducedDisequalitiesSize) {
@@ -969,6 +1023,10 @@ void EqualityEngine::backtrack() {
     d_deducedDisequalities.resize(d_deducedDisequalitiesSize);
   }
 
+  if (d_explanationReasons.size() > d_explanationReasonsSize) {
+    d_explanationReasons.resize(d_explanationReasonsSize);
+  }
+
 }
 
 void EqualityEngine::addGraphEdge(EqualityNodeId t1, EqualityNodeId t2, unsigned type, TNode reason) {
@@ -1013,7 +1071,7 @@ void EqualityEngine::buildEqConclusion(EqualityNodeId id1,
   // only try to build build if full applications corresponding to the given ids
   // have the same congruence n-ary non-APPLY_UF kind, since the internal nodes
   // may be full nodes.
-  if ((d_isInternal[id1] || d_isInternal[id2])
+  if ((d_nodeRecords[id1].isInternal() || d_nodeRecords[id2].isInternal())
       && (k1 != k2 || k1 == kind::APPLY_UF || !ExprManager::isNAryKind(k1)))
   {
     return;
@@ -1025,7 +1083,7 @@ void EqualityEngine::buildEqConclusion(EqualityNodeId id1,
     EqualityNodeId equalityNodeId = i == 0 ? id1 : id2;
     Node equalityNode = d_nodes[equalityNodeId];
     // if not an internal node, just retrieve it
-    if (!d_isInternal[equalityNodeId])
+    if (!d_nodeRecords[equalityNodeId].isInternal())
     {
       eq[i] = equalityNode;
       continue;
@@ -1334,6 +1392,10 @@ void EqualityEngine::getExplanation(
     it = cache.find(cacheKey);
     if (it != cache.end())
     {
+      if (t1Id != t2Id)
+      {
+        ++d_explanationsOmitted;
+      }
       return;
     }
   }
@@ -1390,8 +1452,8 @@ void EqualityEngine::getExplanation(
       //
       // Note that this is robust for HOL because in that case function
       // symbols are not internal nodes
-      if (d_isInternal[t1Id] && d_nodes[t1Id].getNumChildren() == 0
-          && !d_isConstant[t1Id])
+      if (d_nodeRecords[t1Id].isInternal() && d_nodes[t1Id].getNumChildren() == 0
+          && !d_nodeRecords[t1Id].isConstant())
       {
         eqp->d_node = Node::null();
       }
@@ -1404,6 +1466,27 @@ void EqualityEngine::getExplanation(
     return;
   }
 
+  if (!eqp)
+  {
+    ++d_stats.d_explanationCacheLookups;
+    ExplanationCache::const_iterator cached = d_explanationCache.find(cacheKey);
+    if (cached != d_explanationCache.end())
+    {
+      ++d_stats.d_explanationCacheHits;
+    }
+    d_stats.d_explanationCacheHitRate.setData(
+        double(d_stats.d_explanationCacheHits.getData())
+        / d_stats.d_explanationCacheLookups.getData());
+    if (cached != d_explanationCache.end())
+    {
+      const ExplanationRef& ref = (*cached).second;
+      equalities.insert(equalities.end(),
+                        d_explanationReasons.begin() + ref.d_reasonsStart,
+                        d_explanationReasons.begin() + ref.d_reasonsEnd);
+      return;
+    }
+  }
+
   // Queue for the BFS containing nodes
   std::vector<BfsData> bfsQueue;
 
@@ -1449,6 +1532,12 @@ void EqualityEngine::getExplanation(
 
           std::vector<std::shared_ptr<EqProof>> eqp_trans;
 
+          // The nodes of the path with the number of reasons explaining their
+          // equality to t2, for the explanation cache
+          std::vector<std::pair<EqualityNodeId, size_t>> pathExplanations;
+          size_t reasonsStart = equalities.size();
+          size_t omittedStart = d_explanationsOmitted;
+
           // Reconstruct the path
           do {
             // The current node
@@ -1640,6 +1729,14 @@ void EqualityEngine::getExplanation(
             }
             }
 
+            // The reasons added so far explain currentNode = t2, unless some
+            // were omitted
+            if (!eqp && d_explanationsOmitted == omittedStart)
+            {
+              pathExplanations.push_back(std::make_pair(
+                  currentNode, equalities.size() - reasonsStart));
+            }
+
             // Go to the previous
             currentEdge = bfsQueue[currentIndex].d_edgeId;
             currentIndex = bfsQueue[currentIndex].d_previousIndex;
@@ -1659,6 +1756,27 @@ void EqualityEngine::getExplanation(
             eqp_trans.push_back(eqpc);
           } while (currentEdge != null_id);
 
+          if (!pathExplanations.empty())
+          {
+            // Cache the explanations of the path, sharing their reasons
+            size_t start = d_explanationReasons.size();
+            d_explanationReasons.insert(
+                d_explanationReasons.end(),
+                equalities.begin() + reasonsStart,
+                equalities.begin() + reasonsStart
+                    + pathExplanations.back().second);
+            d_explanationReasonsSize = d_explanationReasons.size();
+            for (const std::pair<EqualityNodeId, size_t>& p : pathExplanations)
+            {
+              EqualityPair key = std::minmax(p.first, t2Id);
+              if (d_explanationCache.find(key) == d_explanationCache.end())
+              {
+                d_explanationCache.insert(
+                    key, ExplanationRef(start, start + p.second));
+              }
+            }
+          }
+
           if (eqp) {
             if(eqp_trans.size() == 1) {
               *eqp = *eqp_trans[0];
@@ -1785,13 +1903,13 @@ void EqualityEngine::addTriggerEqualityInternal(TNode t1, TNode t2, TNode trigge
   EqualityNodeId t1Id = getNodeId(t1);
   EqualityNodeId t1classId = getEqualityNode(t1Id).getFind();
   // We will attach it to the class representative, since then we know how to backtrack it
-  TriggerId t1TriggerId = d_nodeTriggers[t1classId];
+  TriggerId t1TriggerId = d_nodeRecords[t1classId].d_triggers;
 
   // Get the information about t2
   EqualityNodeId t2Id = getNodeId(t2);
   EqualityNodeId t2classId = getEqualityNode(t2Id).getFind();
   // We will attach it to the class representative, since then we know how to backtrack it
-  TriggerId t2TriggerId = d_nodeTriggers[t2classId];
+  TriggerId t2TriggerId = d_nodeRecords[t2classId].d_triggers;
 
   Debug("equality") << d_name << "::eq::addTrigger(" << trigger << "): " << t1Id << " (" << t1classId << ") = " << t2Id << " (" << t2classId << ")" << std::endl;
 
@@ -1809,8 +1927,8 @@ void EqualityEngine::addTriggerEqualityInternal(TNode t1, TNode t2, TNode trigge
   Assert(d_equalityTriggers.size() % 2 == 0);
 
   // Add the trigger to the trigger graph
-  d_nodeTriggers[t1classId] = t1NewTriggerId;
-  d_nodeTriggers[t2classId] = t2NewTriggerId;
+  d_nodeRecords[t1classId].d_triggers = t1NewTriggerId;
+  d_nodeRecords[t2classId].d_triggers = t2NewTriggerId;
 
   if (Debug.isOn("equality::internal")) {
     debugPrintGraph();
@@ -1862,8 +1980,8 @@ void EqualityEngine::processEvaluationQueue() {
 
 void EqualityEngine::propagate() {
 
-  if (d_inPropagate) {
-    // We're already in propagate, go back
+  if (d_inPropagate || d_inBatch) {
+    // We're already in propagate, or the batch will propagate, go back
     return;
   }
 
@@ -1872,12 +1990,17 @@ void EqualityEngine::propagate() {
 
   Debug("equality") << d_name << "::eq::propagate()" << std::endl;
 
-  while (!d_propagationQueue.empty() || !d_evaluationQueue.empty()) {
+  while (!d_propagationQueue.empty() || !d_evaluationQueue.empty()
+         || !d_deferredUseLists.empty()) {
 
     if (d_done) {
       // If we're done, just empty the queue
       while (!d_propagationQueue.empty()) d_propagationQueue.pop_front();
       while (!d_evaluationQueue.empty()) d_evaluationQueue.pop();
+      for (EqualityNodeId nodeId : d_deferredUseLists) {
+        d_nodeRecords[nodeId].setUseListDeferred(false);
+      }
+      d_deferredUseLists.clear();
       continue;
     }
 
@@ -1887,6 +2010,12 @@ void EqualityEngine::propagate() {
       continue;
     }
 
+    // Look for the congruences of the batched merges once they are done
+    if (d_propagationQueue.empty()) {
+      processDeferredUseLists();
+      continue;
+    }
+
     // The current merge candidate
     const MergeCandidate current = d_propagationQueue.front();
     d_propagationQueue.pop_front();
@@ -1900,8 +2029,8 @@ void EqualityEngine::propagate() {
       continue;
     }
 
-    Debug("equality::internal") << d_name << "::eq::propagate(): t1: " << (d_isInternal[t1classId] ? "internal" : "proper") << std::endl;
-    Debug("equality::internal") << d_name << "::eq::propagate(): t2: " << (d_isInternal[t2classId] ? "internal" : "proper") << std::endl;
+    Debug("equality::internal") << d_name << "::eq::propagate(): t1: " << (d_nodeRecords[t1classId].isInternal() ? "internal" : "proper") << std::endl;
+    Debug("equality::internal") << d_name << "::eq::propagate(): t2: " << (d_nodeRecords[t2classId].isInternal() ? "internal" : "proper") << std::endl;
 
     // Get the nodes of the representatives
     EqualityNode& node1 = getEqualityNode(t1classId);
@@ -1915,7 +2044,7 @@ void EqualityEngine::propagate() {
         current.d_t1Id, current.d_t2Id, current.d_type, current.d_reason);
 
     // If constants are being merged we're done
-    if (d_isConstant[t1classId] && d_isConstant[t2classId]) {
+    if (d_nodeRecords[t1classId].isConstant() && d_nodeRecords[t2classId].isConstant()) {
       // When merging constants we are inconsistent, hence done
       d_done = true;
       // But in order to keep invariants (edges = 2*equalities) we put an equalities in
@@ -1935,18 +2064,18 @@ void EqualityEngine::propagate() {
 
     // Figure out the merge preference
     EqualityNodeId mergeInto = t1classId;
-    if (d_isInternal[t2classId] != d_isInternal[t1classId]) {
+    if (d_nodeRecords[t2classId].isInternal() != d_nodeRecords[t1classId].isInternal()) {
       // We always keep non-internal nodes as representatives: if any node in
       // the class is non-internal, then the representative will be non-internal
-      if (d_isInternal[t1classId]) {
+      if (d_nodeRecords[t1classId].isInternal()) {
         mergeInto = t2classId;
       } else {
         mergeInto = t1classId;
       }
-    } else if (d_isConstant[t2classId] != d_isConstant[t1classId]) {
+    } else if (d_nodeRecords[t2classId].isConstant() != d_nodeRecords[t1classId].isConstant()) {
       // We always keep constants as representatives: if any (at most one) node
       // in the class in a constant, then the representative will be a constant
-      if (d_isConstant[t2classId]) {
+      if (d_nodeRecords[t2classId].isConstant()) {
         mergeInto = t2classId;
       } else {
         mergeInto = t1classId;
@@ -1978,7 +2107,7 @@ void EqualityEngine::propagate() {
     }
 
     // If not merging internal nodes, notify the master
-    if (d_masterEqualityEngine && !d_isInternal[t1classId] && !d_isInternal[t2classId]) {
+    if (d_masterEqualityEngine && !d_nodeRecords[t1classId].isInternal() && !d_nodeRecords[t2classId].isInternal()) {
       d_masterEqualityEngine->assertEqualityInternal(d_nodes[t1classId], d_nodes[t2classId], TNode::null());
       d_masterEqualityEngine->propagate();
     }
@@ -2092,7 +2221,7 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
   EqualityEngine* nonConst = const_cast<EqualityEngine*>(this);
 
   // Check for constants
-  if (d_isConstant[t1ClassId] && d_isConstant[t2ClassId] && t1ClassId != t2ClassId) {
+  if (d_nodeRecords[t1ClassId].isConstant() && d_nodeRecords[t2ClassId].isConstant() && t1ClassId != t2ClassId) {
     if (ensureProof) {
       nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t1Id, t1ClassId));
       nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t2Id, t2ClassId));
@@ -2180,7 +2309,7 @@ void EqualityEngine::addTriggerTerm(TNode t, TheoryId tag)
   EqualityNodeId classId = eqNode.getFind();
 
   // Possibly existing set of triggers
-  TriggerTermSetRef triggerSetRef = d_nodeIndividualTrigger[classId];
+  TriggerTermSetRef triggerSetRef = d_nodeRecords[classId].d_triggerSet;
   if (triggerSetRef != +null_set_id && getTriggerTermSet(triggerSetRef).hasTrigger(tag)) {
     // If the term already is in the equivalence class that a tagged representative, just notify
     if (d_performNotify) {
@@ -2197,7 +2326,7 @@ void EqualityEngine::addTriggerTerm(TNode t, TheoryId tag)
     // side of such disequalities, that have the tag on, are put in a set.
     TaggedEqualitiesSet disequalitiesToNotify;
     TheoryIdSet tags = TheoryIdSetUtil::setInsert(tag);
-    getDisequalities(!d_isConstant[classId], classId, tags, disequalitiesToNotify);
+    getDisequalities(!d_nodeRecords[classId].isConstant(), classId, tags, disequalitiesToNotify);
 
     // Trigger data
     TheoryIdSet newSetTags;
@@ -2234,7 +2363,7 @@ void EqualityEngine::addTriggerTerm(TNode t, TheoryId tag)
     d_triggerTermSetUpdates.push_back(TriggerSetUpdate(classId, triggerSetRef));
     d_triggerTermSetUpdatesSize = d_triggerTermSetUpdatesSize + 1;
     // Mark the the new set as a trigger
-    d_nodeIndividualTrigger[classId] = triggerSetRef = newTriggerTermSet(newSetTags, newSetTriggers, newSetTriggersSize);
+    d_nodeRecords[classId].d_triggerSet = triggerSetRef = newTriggerTermSet(newSetTags, newSetTriggers, newSetTriggersSize);
 
     // Propagate trigger term disequalities we remembered
     Debug("equality::trigger") << d_name << "::eq::addTriggerTerm(" << t << ", " << tag << "): propagating " << disequalitiesToNotify.size() << " disequalities " << std::endl;
@@ -2245,7 +2374,7 @@ void EqualityEngine::addTriggerTerm(TNode t, TheoryId tag)
 bool EqualityEngine::isTriggerTerm(TNode t, TheoryId tag) const {
   if (!hasTerm(t)) return false;
   EqualityNodeId classId = getEqualityNode(t).getFind();
-  TriggerTermSetRef triggerSetRef = d_nodeIndividualTrigger[classId];
+  TriggerTermSetRef triggerSetRef = d_nodeRecords[classId].d_triggerSet;
   return triggerSetRef != +null_set_id && getTriggerTermSet(triggerSetRef).hasTrigger(tag);
 }
 
@@ -2253,7 +2382,7 @@ bool EqualityEngine::isTriggerTerm(TNode t, TheoryId tag) const {
 TNode EqualityEngine::getTriggerTermRepresentative(TNode t, TheoryId tag) const {
   Assert(isTriggerTerm(t, tag));
   EqualityNodeId classId = getEqualityNode(t).getFind();
-  const TriggerTermSet& triggerSet = getTriggerTermSet(d_nodeIndividualTrigger[classId]);
+  const TriggerTermSet& triggerSet = getTriggerTermSet(d_nodeRecords[classId].d_triggerSet);
   unsigned i = 0;
   TheoryIdSet tags = triggerSet.d_tags;
   while (TheoryIdSetUtil::setPop(tags) != tag)
@@ -2278,7 +2407,7 @@ void EqualityEngine::storeApplicationLookup(FunctionApplication& funNormalized,
     {
       enqueue(MergeCandidate(funId, d_trueId, MERGED_THROUGH_REFLEXIVITY, TNode::null()));
     }
-    else if (d_isConstant[funNormalized.d_a] && d_isConstant[funNormalized.d_b])
+    else if (d_nodeRecords[funNormalized.d_a].isConstant() && d_nodeRecords[funNormalized.d_b].isConstant())
     {
       enqueue(MergeCandidate(funId, d_falseId, MERGED_THROUGH_CONSTANTS, TNode::null()));
     }
@@ -2435,9 +2564,9 @@ void EqualityEngine::getDisequalities(bool allowConstants,
   // Must be empty on input
   Assert(out.size() == 0);
   // The class we are looking for, shouldn't have any of the tags we are looking for already set
-  Assert(d_nodeIndividualTrigger[classId] == null_set_id
+  Assert(d_nodeRecords[classId].d_triggerSet == null_set_id
          || TheoryIdSetUtil::setIntersection(
-                getTriggerTermSet(d_nodeIndividualTrigger[classId]).d_tags,
+                getTriggerTermSet(d_nodeRecords[classId].d_triggerSet).d_tags,
                 inputTags)
                 == 0);
 
@@ -2488,9 +2617,9 @@ void EqualityEngine::getDisequalities(bool allowConstants,
           // Mark as visited
           alreadyVisited.insert(toCompareRep);
           // Get the trigger set
-          TriggerTermSetRef toCompareTriggerSetRef = d_nodeIndividualTrigger[toCompareRep];
+          TriggerTermSetRef toCompareTriggerSetRef = d_nodeRecords[toCompareRep].d_triggerSet;
           // We only care if we're not both constants and there are trigger terms in the other class
-          if ((allowConstants || !d_isConstant[toCompareRep]) && toCompareTriggerSetRef != null_set_id) {
+          if ((allowConstants || !d_nodeRecords[toCompareRep].isConstant()) && toCompareTriggerSetRef != null_set_id) {
             // Tags of the other gey
             TriggerTermSet& toCompareTriggerSet = getTriggerTermSet(toCompareTriggerSetRef);
             // We only care if there are things in inputTags that is also in toCompareTags
@@ -37,6 +37,7 @@
 #include "theory/uf/equality_engine_iterator.h"
 #include "theory/uf/equality_engine_notify.h"
 #include "theory/uf/equality_engine_types.h"
+#include "theory/uf/node_id_map.h"
 #include "util/statistics_registry.h"
 
 namespace CVC4 {
@@ -107,6 +108,16 @@ class EqualityEngine : public context::ContextNotifyObj {
     IntStat d_functionTermsCount;
     /** Number of constant terms managed by the system */
     IntStat d_constantTermsCount;
+    /** Number of explanations looked up in the explanation cache */
+    IntStat d_explanationCacheLookups;
+    /** Number of explanations found in the explanation cache */
+    IntStat d_explanationCacheHits;
+    /** Ratio of the hits to the lookups of the explanation cache */
+    BackedStat<double> d_explanationCacheHitRate;
+    /** Number of equalities asserted in batches */
+    IntStat d_batchedEqualitiesCount;
+    /** Number of sweeps through the use lists of batched merges */
+    IntStat d_useListSweepsCount;
 
     Statistics(std::string name);
 
@@ -137,7 +148,7 @@ private:
   KindMap d_congruenceKindsExtOperators;
 
   /** Map from nodes to their ids */
-  std::unordered_map<TNode, EqualityNodeId, TNodeHashFunction> d_nodeIds;
+  NodeIdMap d_nodeIds;
 
   /** Map from function applications to their ids */
   typedef std::unordered_map<FunctionApplication, EqualityNodeId, FunctionApplicationHashFunction> ApplicationIdsMap;
@@ -168,8 +179,8 @@ private:
   /** Map from ids to the applications */
   std::vector<FunctionApplicationPair> d_applications;
 
-  /** Map from ids to the equality nodes */
-  std::vector<EqualityNode> d_equalityNodes;
+  /** Map from ids to the equality nodes, with their triggers and flags */
+  std::vector<EqualityNodeRecord> d_nodeRecords;
 
   /** Number of asserted equalities we have so far */
   context::CDO<DefaultSizeType> d_assertedEqualitiesCount;
@@ -279,6 +290,24 @@ private:
   /** Undo the merge of class2 into class1 */
   void undoMerge(EqualityNode& class1, EqualityNode& class2, EqualityNodeId class2Id);
 
+  /**
+   * Goes through the use list of the node with the given id, whose class was
+   * merged into a class that is constant if classIsConstant, and looks up the
+   * applications with the new representatives of their arguments for
+   * congruences.
+   */
+  void updateUseList(EqualityNodeId nodeId, bool classIsConstant);
+
+  /**
+   * Nodes whose representatives changed in merges of the current batch, whose
+   * use lists are gone through once the propagation queue is empty (see
+   * endBatch).
+   */
+  std::vector<EqualityNodeId> d_deferredUseLists;
+
+  /** Goes through the deferred use lists and clears them */
+  void processDeferredUseLists();
+
   /** Backtrack the information if necessary */
   void backtrack();
 
@@ -315,25 +344,6 @@ private:
    */
   context::CDO<DefaultSizeType> d_equalityTriggersCount;
 
-  /**
-   * Trigger lists per node. The begin id changes as we merge, but the end always points to
-   * the actual end of the triggers for this node.
-   */
-  std::vector<TriggerId> d_nodeTriggers;
-
-  /**
-   * Map from ids to whether they are constants (constants are always
-   * representatives of their class.
-   */
-  std::vector<bool> d_isConstant;
-
-  /**
-   * Map from ids of proper terms, to the number of non-constant direct subterms. If we update an interpreted
-   * application to a constant, we can decrease this value. If we hit 0, we can evaluate the term.
-   *
-   */
-  std::vector<unsigned> d_subtermsToEvaluate;
-
   /**
    * For nodes that we need to postpone evaluation.
    */
@@ -363,27 +373,16 @@ private:
    * Returns true if it's a constant
    */
   bool isConstant(EqualityNodeId id) const {
-    return d_isConstant[getEqualityNode(id).getFind()];
+    return d_nodeRecords[getEqualityNode(id).getFind()].isConstant();
   }
 
-  /**
-   * Map from ids to whether they are Boolean.
-   */
-  std::vector<bool> d_isEquality;
-
-  /**
-   * Map from ids to whether the nods is internal. An internal node is a node
-   * that corresponds to a partially currified node, for example.
-   */
-  std::vector<bool> d_isInternal;
-
   /**
    * Adds the trigger with triggerId to the beginning of the trigger list of the node with id nodeId.
    */
   void addTriggerToList(EqualityNodeId nodeId, TriggerId triggerId);
 
   /** Statistics */
-  Statistics d_stats;
+  mutable Statistics d_stats;
 
   /** Add a new function application node to the database, i.e APP t1 t2 */
   EqualityNodeId newApplicationNode(TNode original, EqualityNodeId t1, EqualityNodeId t2, FunctionApplicationType type);
@@ -403,6 +402,12 @@ private:
   /** Are we in propagate */
   bool d_inPropagate;
 
+  /** Are we in a batch of equalities, see beginBatch() */
+  bool d_inBatch;
+
+  /** Are the use lists of merged classes deferred, see endBatch() */
+  bool d_deferUseLists;
+
   /** Proof-new specific construction of equality conclusions for EqProofs
    *
    * Given two equality node ids, build an equality between the nodes they
@@ -432,6 +437,9 @@ private:
    *
    * We cache results of this call in cache, where cache[t1Id][t2Id] stores
    * a proof of t1 = t2.
+   *
+   * If eqp is null, the explanation is also looked up in and added to the
+   * context-dependent explanation cache, see d_explanationCache.
    */
   void getExplanation(
       EqualityEdgeId t1Id,
@@ -547,11 +555,6 @@ private:
    */
   context::CDO<unsigned> d_triggerTermSetUpdatesSize;
 
-  /**
-   * Map from ids to the individual trigger set representatives.
-   */
-  std::vector<TriggerTermSetRef> d_nodeIndividualTrigger;
-
   typedef std::unordered_map<EqualityPair, DisequalityReasonRef, EqualityPairHashFunction> DisequalityReasonsMap;
 
   /**
@@ -579,6 +582,38 @@ private:
    */
   context::CDO<size_t> d_deducedDisequalityReasonsSize;
 
+  typedef context::CDHashMap<EqualityPair, ExplanationRef, EqualityPairHashFunction> ExplanationCache;
+
+  /**
+   * Map from pairs of node ids, the smaller id first, to the explanation of
+   * their equality in d_explanationReasons. An explanation only uses edges of
+   * the equality graph that were added at the level of the entry or before,
+   * so it stays valid until the entry is popped. When getExplanation finds a
+   * path t1 = n1 = ... = nk = t2, it adds the explanation of ni = t2 for each
+   * node ni of the path, so the explanations of the path are compressed to
+   * one lookup.
+   */
+  mutable ExplanationCache d_explanationCache;
+
+  /**
+   * The reasons of the cached explanations. The explanations of the nodes of
+   * one path share their reasons, the explanation of ni = t2 being a prefix of
+   * the explanation of t1 = t2.
+   */
+  mutable std::vector<TNode> d_explanationReasons;
+
+  /**
+   * Context dependent size of the reasons of the cached explanations.
+   */
+  mutable context::CDO<size_t> d_explanationReasonsSize;
+
+  /**
+   * Number of times getExplanation returned without adding the reasons of an
+   * explanation because it was in its local cache. The reasons added by a call
+   * are only a complete explanation if this count did not change.
+   */
+  mutable size_t d_explanationsOmitted;
+
   /**
    * Map from equalities to the tags that have received the notification.
    */
@@ -674,7 +709,7 @@ private:
   /**
    * Add a kind to treat as function applications.
    * When extOperator is true, this equality engine will treat the operators of this kind
-   * as "external" e.g. not internal nodes (see d_isInternal). This means that we will
+   * as "external" e.g. not internal nodes (see EqualityNodeRecord::isInternal). This means that we will
    * consider equivalence classes containing the operators of such terms, and "hasTerm" will
    * return true.
    */
@@ -736,6 +771,22 @@ private:
                       TNode reason,
                       unsigned pid = MERGED_THROUGH_EQUALITY);
 
+  /**
+   * Starts a batch of equalities. Until endBatch(), assertEquality() with
+   * positive polarity only enqueues the merge, and the engine is not
+   * propagated. Nothing but positive equalities may be asserted during a batch,
+   * and the engine should not be queried before endBatch().
+   */
+  void beginBatch();
+
+  /**
+   * Ends the batch of equalities and propagates them. The classes are merged
+   * first and the use lists of the merged classes are gone through for
+   * congruences once all pending merges are done, so that each use list is
+   * gone through once per round of congruences instead of once per merge.
+   */
+  void endBatch();
+
   /**
    * Returns the current representative of the term t.
    */
@@ -139,6 +139,19 @@ struct DisequalityReasonRef {
   }
 };
 
+/**
+ * A cached explanation: the reasons d_reasonsStart, ..., d_reasonsEnd - 1 in
+ * the list of explanation reasons of the equality engine.
+ */
+struct ExplanationRef {
+  size_t d_reasonsStart;
+  size_t d_reasonsEnd;
+  ExplanationRef(size_t reasonsStart = 0, size_t reasonsEnd = 0)
+      : d_reasonsStart(reasonsStart), d_reasonsEnd(reasonsEnd)
+  {
+  }
+};
+
 /**
  * We maintain uselist where a node appears in, and this is the node
  * of such a list.
@@ -279,6 +292,94 @@ public:
   }
 };
 
+/**
+ * The data of a node that merge() and propagate() look up for the
+ * representatives of the classes they merge, packed into a record of 32
+ * bytes: the equality node, the heads of its trigger lists, the number of
+ * its subterms left to evaluate and its flags.
+ */
+class EqualityNodeRecord {
+
+public:
+
+  /** The equality node (class list and use list) */
+  EqualityNode d_node;
+
+  /**
+   * Trigger list of the node. The begin id changes as we merge, but the end
+   * always points to the actual end of the triggers for this node.
+   */
+  TriggerId d_triggers;
+
+  /** The individual trigger set of the node (a TriggerTermSetRef) */
+  DefaultSizeType d_triggerSet;
+
+  /**
+   * For proper interpreted applications, the number of non-constant direct
+   * subterms. If we update an interpreted application to a constant, we can
+   * decrease this value. If we hit 0, we can evaluate the term.
+   */
+  DefaultSizeType d_subtermsToEvaluate;
+
+  /**
+   * Creates the record of a new internal node that has no triggers, given
+   * the null trigger set reference.
+   */
+  EqualityNodeRecord(EqualityNodeId nodeId = null_id,
+                     DefaultSizeType nullSetId = (DefaultSizeType)(-1))
+      : d_node(nodeId),
+        d_triggers(null_trigger),
+        d_triggerSet(nullSetId),
+        d_subtermsToEvaluate(0),
+        d_flags(INTERNAL)
+  {
+  }
+
+  /** Is this a constant (constants are always representatives) */
+  bool isConstant() const { return d_flags & CONSTANT; }
+  void setConstant(bool value) { setFlag(CONSTANT, value); }
+
+  /** Is this an equality */
+  bool isEquality() const { return d_flags & EQUALITY; }
+  void setEquality(bool value) { setFlag(EQUALITY, value); }
+
+  /**
+   * Is this an internal node, i.e. one that corresponds to a partially
+   * currified node, for example.
+   */
+  bool isInternal() const { return d_flags & INTERNAL; }
+  void setInternal(bool value) { setFlag(INTERNAL, value); }
+
+  /** Is the use list of this node waiting to be gone through after merges */
+  bool isUseListDeferred() const { return d_flags & USE_LIST_DEFERRED; }
+  void setUseListDeferred(bool value) { setFlag(USE_LIST_DEFERRED, value); }
+
+private:
+
+  /** The bits of the flags */
+  enum Flag : uint8_t
+  {
+    CONSTANT = 1,
+    EQUALITY = 2,
+    INTERNAL = 4,
+    USE_LIST_DEFERRED = 8
+  };
+
+  /** The flags */
+  uint8_t d_flags;
+
+  void setFlag(Flag flag, bool value) {
+    if (value) {
+      d_flags |= flag;
+    } else {
+      d_flags &= ~flag;
+    }
+  }
+};
+
+static_assert(sizeof(EqualityNodeRecord) == 32,
+              "EqualityNodeRecord should fill half a cache line");
+
 /** A pair of ids */
 typedef std::pair<EqualityNodeId, EqualityNodeId> EqualityPair;
 using EqualityPairHashFunction =
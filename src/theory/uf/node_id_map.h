@@ -0,0 +1,99 @@
+/*********************                                                        */
+/*! \file node_id_map.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Map from nodes to their ids in the equality engine
+ **
+ ** NodeIdMap indexes the equality node ids by the ids of the NodeValues.
+ ** The ids are kept in pages of a fixed size that are allocated when a node
+ ** of their range is first inserted, so a lookup is two array accesses and
+ ** no hashing.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__THEORY__UF__NODE_ID_MAP_H
+#define CVC4__THEORY__UF__NODE_ID_MAP_H
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/node.h"
+#include "theory/uf/equality_engine_types.h"
+
+namespace CVC4 {
+namespace theory {
+namespace eq {
+
+class NodeIdMap
+{
+ public:
+  /** The number of ids per page */
+  static const size_t PAGE_SIZE = 1024;
+
+  /** Returns the id of t, or null_id if t is not in the map. */
+  EqualityNodeId find(TNode t) const
+  {
+    uint64_t id = t.getId();
+    size_t page = id / PAGE_SIZE;
+    if (page >= d_pages.size() || d_pages[page] == nullptr)
+    {
+      return null_id;
+    }
+    return d_pages[page][id % PAGE_SIZE];
+  }
+
+  /** Maps t to nodeId. */
+  void insert(TNode t, EqualityNodeId nodeId)
+  {
+    uint64_t id = t.getId();
+    size_t page = id / PAGE_SIZE;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (d_pages[page] == nullptr)
+    {
+      d_pages[page].reset(new EqualityNodeId[PAGE_SIZE]);
+      std::fill(d_pages[page].get(), d_pages[page].get() + PAGE_SIZE, null_id);
+      ++d_pagesCount;
+    }
+    d_pages[page][id % PAGE_SIZE] = nodeId;
+  }
+
+  /** Removes t from the map. The page of t is kept. */
+  void erase(TNode t)
+  {
+    Assert(find(t) != null_id);
+    uint64_t id = t.getId();
+    d_pages[id / PAGE_SIZE][id % PAGE_SIZE] = null_id;
+  }
+
+  /** Returns the number of bytes used by the pages. */
+  size_t getBytes() const
+  {
+    return d_pages.capacity() * sizeof(d_pages[0])
+           + d_pagesCount * PAGE_SIZE * sizeof(EqualityNodeId);
+  }
+
+ private:
+  /** The pages, null if no node of their range was inserted */
+  std::vector<std::unique_ptr<EqualityNodeId[]>> d_pages;
+  /** The number of allocated pages */
+  size_t d_pagesCount = 0;
+}; /* class NodeIdMap */
+
+}  // namespace eq
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* CVC4__THEORY__UF__NODE_ID_MAP_H */
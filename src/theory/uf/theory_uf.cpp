@@ -202,6 +202,13 @@ void TheoryUF::notifyFact(TNode atom, bool pol, TNode fact, bool isInternal)
     }
   }
 }
+
+bool TheoryUF::batchEqualities() const
+{
+  // the cardinality extension looks at the equality engine when notified of
+  // facts
+  return options::ufBatchMerges() && d_thss == nullptr;
+}
 //--------------------------------- end standard check
 
 TrustNode TheoryUF::expandDefinition(Node node)
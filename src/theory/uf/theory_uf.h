@@ -136,6 +136,8 @@ private:
                      bool isInternal) override;
   /** Notify fact */
   void notifyFact(TNode atom, bool pol, TNode fact, bool isInternal) override;
+  /** Batch equalities if enabled and without the cardinality extension */
+  bool batchEqualities() const override;
   //--------------------------------- end standard check
 
   /** Collect model values in m based on the relevant terms given by termSet */
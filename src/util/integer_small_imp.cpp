@@ -0,0 +1,300 @@
+/*********************                                                        */
+/*! \file integer_small_imp.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A multiprecision integer constant; stores small values inline and
+ ** wraps a GMP multiprecision integer otherwise.
+ **
+ ** A multiprecision integer constant; stores small values inline and wraps a
+ ** GMP multiprecision integer otherwise.
+ **/
+#include "util/integer.h"
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include "cvc4autoconfig.h"
+
+#include "base/check.h"
+#include "util/rational.h"
+
+#if !defined(CVC4_GMP_IMP) || !defined(CVC4_SMALL_IMP)
+#  error "This source should only ever be built if CVC4_SMALL_IMP is on !"
+#endif /* !CVC4_GMP_IMP || !CVC4_SMALL_IMP */
+
+
+using namespace std;
+
+namespace CVC4 {
+
+Integer::Integer(const char* s, unsigned base) : d_small(0), d_big(nullptr)
+{
+  setValue(mpz_class(s, base));
+}
+
+Integer::Integer(const std::string& s, unsigned base)
+    : d_small(0), d_big(nullptr)
+{
+  setValue(mpz_class(s, base));
+}
+
+mpz_class Integer::smallToMpz(int64_t v)
+{
+  if (v >= std::numeric_limits<long>::min()
+      && v <= std::numeric_limits<long>::max())
+  {
+    return mpz_class(static_cast<long>(v));
+  }
+  mpz_class res = unsignedToMpz(absSmall(v));
+  return v < 0 ? mpz_class(-res) : res;
+}
+
+mpz_class Integer::unsignedToMpz(uint64_t v)
+{
+  if (v <= std::numeric_limits<unsigned long>::max())
+  {
+    return mpz_class(static_cast<unsigned long>(v));
+  }
+  mpz_class res;
+  mpz_import(res.get_mpz_t(), 1, 1, sizeof(v), 0, 0, &v);
+  return res;
+}
+
+void Integer::setValue(const mpz_class& v)
+{
+  // |v| < 2^63, see fitsSmall()
+  if (mpz_sizeinbase(v.get_mpz_t(), 2) < 64)
+  {
+    if (mpz_fits_slong_p(v.get_mpz_t()))
+    {
+      d_small = mpz_get_si(v.get_mpz_t());
+    }
+    else
+    {
+      uint64_t abs = 0;
+      mpz_export(&abs, nullptr, 1, sizeof(abs), 0, 0, v.get_mpz_t());
+      d_small = mpz_sgn(v.get_mpz_t()) < 0 ? -static_cast<int64_t>(abs)
+                                           : static_cast<int64_t>(abs);
+    }
+    delete d_big;
+    d_big = nullptr;
+  }
+  else if (d_big == nullptr)
+  {
+    d_big = new mpz_class(v);
+  }
+  else
+  {
+    *d_big = v;
+  }
+}
+
+int Integer::compareSlow(const Integer& y) const
+{
+  // a value stored in a GMP integer is larger in absolute value than any
+  // inline value
+  if (d_big == nullptr)
+  {
+    return -mpz_sgn(y.d_big->get_mpz_t());
+  }
+  if (y.d_big == nullptr)
+  {
+    return mpz_sgn(d_big->get_mpz_t());
+  }
+  int c = mpz_cmp(d_big->get_mpz_t(), y.d_big->get_mpz_t());
+  return (c > 0) - (c < 0);
+}
+
+void Integer::ceilingQR(Integer& q,
+                        Integer& r,
+                        const Integer& x,
+                        const Integer& y)
+{
+  if (x.d_big == nullptr && y.d_big == nullptr && y.d_small != 0)
+  {
+    int64_t qs = x.d_small / y.d_small;
+    int64_t rs = x.d_small % y.d_small;
+    if (rs != 0 && ((rs > 0) == (y.d_small > 0)))
+    {
+      qs += 1;
+      rs -= y.d_small;
+    }
+    q = fromSmall(qs);
+    r = fromSmall(rs);
+    return;
+  }
+  mpz_class qv, rv, xv = x.getValue(), yv = y.getValue();
+  mpz_cdiv_qr(qv.get_mpz_t(), rv.get_mpz_t(), xv.get_mpz_t(), yv.get_mpz_t());
+  q = Integer(qv);
+  r = Integer(rv);
+}
+
+bool Integer::fitsSignedInt() const {
+  return d_big == nullptr && d_small >= std::numeric_limits<int>::min()
+         && d_small <= std::numeric_limits<int>::max();
+}
+
+bool Integer::fitsUnsignedInt() const {
+  return d_big == nullptr && d_small >= 0
+         && d_small <= std::numeric_limits<unsigned int>::max();
+}
+
+signed int Integer::getSignedInt() const {
+  // ensure there isn't overflow
+  CheckArgument(fitsSignedInt(), this,
+                "Overflow detected in Integer::getSignedInt().");
+  return (signed int) d_small;
+}
+
+unsigned int Integer::getUnsignedInt() const {
+  // ensure there isn't overflow
+  CheckArgument(fitsUnsignedInt(), this,
+                "Overflow detected in Integer::getUnsignedInt()");
+  return (unsigned int) d_small;
+}
+
+bool Integer::fitsSignedLong() const {
+  if (d_big == nullptr)
+  {
+    return d_small >= std::numeric_limits<long>::min()
+           && d_small <= std::numeric_limits<long>::max();
+  }
+  return d_big->fits_slong_p();
+}
+
+bool Integer::fitsUnsignedLong() const {
+  if (d_big == nullptr)
+  {
+    return d_small >= 0
+           && static_cast<uint64_t>(d_small)
+                  <= std::numeric_limits<unsigned long>::max();
+  }
+  return d_big->fits_ulong_p();
+}
+
+long Integer::getLong() const
+{
+  // ensure there wasn't overflow
+  CheckArgument(fitsSignedLong(),
+                this,
+                "Overflow detected in Integer::getLong().");
+  return d_big == nullptr ? static_cast<long>(d_small) : d_big->get_si();
+}
+
+unsigned long Integer::getUnsignedLong() const
+{
+  // ensure there wasn't overflow
+  CheckArgument(fitsUnsignedLong(),
+                this,
+                "Overflow detected in Integer::getUnsignedLong().");
+  return d_big == nullptr ? static_cast<unsigned long>(d_small)
+                          : d_big->get_ui();
+}
+
+Integer Integer::oneExtend(uint32_t size, uint32_t amount) const {
+  // check that the size is accurate
+  DebugCheckArgument((*this) < Integer(1).multiplyByPow2(size), size);
+  mpz_class res = getValue();
+
+  for (unsigned i = size; i < size + amount; ++i) {
+    mpz_setbit(res.get_mpz_t(), i);
+  }
+
+  return Integer(res);
+}
+
+Integer Integer::exactQuotient(const Integer& y) const {
+  DebugCheckArgument(y.divides(*this), y);
+  if (d_big == nullptr && y.d_big == nullptr)
+  {
+    return fromSmall(d_small / y.d_small);
+  }
+  mpz_class q, x = getValue(), yv = y.getValue();
+  mpz_divexact(q.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+  return Integer( q );
+}
+
+Integer Integer::pow(unsigned long int exp) const
+{
+  if (d_big == nullptr)
+  {
+    // square and multiply while the intermediate results fit
+    int64_t result = 1, base = d_small;
+    unsigned long int e = exp;
+    bool overflow = false;
+    while (e > 0 && !overflow)
+    {
+      if ((e & 1) != 0)
+      {
+        overflow = __builtin_mul_overflow(result, base, &result)
+                   || !fitsSmall(result);
+      }
+      e >>= 1;
+      if (e > 0 && !overflow)
+      {
+        overflow =
+            __builtin_mul_overflow(base, base, &base) || !fitsSmall(base);
+      }
+    }
+    if (!overflow)
+    {
+      return fromSmall(result);
+    }
+  }
+  mpz_class result, x = getValue();
+  mpz_pow_ui(result.get_mpz_t(), x.get_mpz_t(), exp);
+  return Integer(result);
+}
+
+Integer Integer::modAdd(const Integer& y, const Integer& m) const
+{
+  mpz_class res, x = getValue(), yv = y.getValue(), mv = m.getValue();
+  mpz_add(res.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), mv.get_mpz_t());
+  return Integer(res);
+}
+
+Integer Integer::modMultiply(const Integer& y, const Integer& m) const
+{
+  mpz_class res, x = getValue(), yv = y.getValue(), mv = m.getValue();
+  mpz_mul(res.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), mv.get_mpz_t());
+  return Integer(res);
+}
+
+Integer Integer::modInverse(const Integer& m) const
+{
+  PrettyCheckArgument(m > 0, m, "m must be greater than zero");
+  mpz_class res, x = getValue(), mv = m.getValue();
+  if (mpz_invert(res.get_mpz_t(), x.get_mpz_t(), mv.get_mpz_t()) == 0)
+  {
+    return Integer(-1);
+  }
+  return Integer(res);
+}
+
+void Integer::extendedGcd(
+    Integer& g, Integer& s, Integer& t, const Integer& a, const Integer& b)
+{
+  // see the documentation for:
+  // mpz_gcdext (mpz_t g, mpz_t s, mpz_t t, mpz_t a, mpz_t b);
+  mpz_class gv, sv, tv, av = a.getValue(), bv = b.getValue();
+  mpz_gcdext(gv.get_mpz_t(),
+             sv.get_mpz_t(),
+             tv.get_mpz_t(),
+             av.get_mpz_t(),
+             bv.get_mpz_t());
+  g = Integer(gv);
+  s = Integer(sv);
+  t = Integer(tv);
+}
+
+} /* namespace CVC4 */
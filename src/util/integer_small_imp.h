@@ -0,0 +1,827 @@
+/*********************                                                        */
+/*! \file integer_small_imp.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A multiprecision integer constant; stores small values inline and
+ ** wraps a GMP multiprecision integer otherwise.
+ **
+ ** A multiprecision integer constant; stores small values inline and wraps a
+ ** GMP multiprecision integer otherwise.
+ **/
+
+#include "cvc4_public.h"
+
+#ifndef CVC4__INTEGER_H
+#define CVC4__INTEGER_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <string>
+
+#include "base/exception.h"
+#include "util/gmp_util.h"
+
+namespace CVC4 {
+
+class Rational;
+
+/**
+ * A multi-precision integer constant.
+ *
+ * Values whose absolute value fits into a signed 64-bit integer are stored
+ * inline and computed on with overflow-checked machine arithmetic.  Only
+ * values that do not fit (and the results of operations that overflow) are
+ * stored in a heap-allocated GMP integer.  The representation is canonical:
+ * a value is stored in a GMP integer if and only if it does not fit, so two
+ * integers are equal iff they have the same representation and the same
+ * value.
+ */
+class CVC4_PUBLIC Integer
+{
+  friend class CVC4::Rational;
+
+ public:
+  /**
+   * Constructs an Integer by copying a GMP C++ primitive.
+   */
+  Integer(const mpz_class& val) : d_small(0), d_big(nullptr) { setValue(val); }
+
+  /** Constructs a rational with the value 0. */
+  Integer() : d_small(0), d_big(nullptr) {}
+
+  /**
+   * Constructs a Integer from a C string.
+   * Throws std::invalid_argument if the string is not a valid rational.
+   * For more information about what is a valid rational string,
+   * see GMP's documentation for mpq_set_str().
+   */
+  explicit Integer(const char* s, unsigned base = 10);
+  explicit Integer(const std::string& s, unsigned base = 10);
+
+  Integer(const Integer& q)
+      : d_small(q.d_small),
+        d_big(q.d_big == nullptr ? nullptr : new mpz_class(*q.d_big))
+  {
+  }
+  Integer(Integer&& q) : d_small(q.d_small), d_big(q.d_big)
+  {
+    q.d_big = nullptr;
+  }
+
+  Integer(signed int z) : d_small(z), d_big(nullptr) {}
+  Integer(unsigned int z) : d_small(z), d_big(nullptr) {}
+  Integer(signed long int z) : d_small(0), d_big(nullptr) { setSigned(z); }
+  Integer(unsigned long int z) : d_small(0), d_big(nullptr) { setUnsigned(z); }
+
+#ifdef CVC4_NEED_INT64_T_OVERLOADS
+  Integer(int64_t z) : d_small(0), d_big(nullptr) { setSigned(z); }
+  Integer(uint64_t z) : d_small(0), d_big(nullptr) { setUnsigned(z); }
+#endif /* CVC4_NEED_INT64_T_OVERLOADS */
+
+  ~Integer() { delete d_big; }
+
+  /**
+   * Returns a copy of the value as a GMP integer.
+   */
+  mpz_class getValue() const
+  {
+    return d_big == nullptr ? smallToMpz(d_small) : *d_big;
+  }
+
+  Integer& operator=(const Integer& x)
+  {
+    if (this == &x) return *this;
+    if (x.d_big == nullptr)
+    {
+      delete d_big;
+      d_big = nullptr;
+      d_small = x.d_small;
+    }
+    else if (d_big == nullptr)
+    {
+      d_big = new mpz_class(*x.d_big);
+    }
+    else
+    {
+      *d_big = *x.d_big;
+    }
+    return *this;
+  }
+  Integer& operator=(Integer&& x)
+  {
+    if (this == &x) return *this;
+    delete d_big;
+    d_small = x.d_small;
+    d_big = x.d_big;
+    x.d_big = nullptr;
+    return *this;
+  }
+
+  bool operator==(const Integer& y) const
+  {
+    if (d_big == nullptr || y.d_big == nullptr)
+    {
+      return d_big == y.d_big && d_small == y.d_small;
+    }
+    return *d_big == *y.d_big;
+  }
+
+  Integer operator-() const
+  {
+    return d_big == nullptr ? fromSmall(-d_small) : Integer(-*d_big);
+  }
+
+  bool operator!=(const Integer& y) const { return !(*this == y); }
+
+  bool operator<(const Integer& y) const { return compare(y) < 0; }
+
+  bool operator<=(const Integer& y) const { return compare(y) <= 0; }
+
+  bool operator>(const Integer& y) const { return compare(y) > 0; }
+
+  bool operator>=(const Integer& y) const { return compare(y) >= 0; }
+
+  Integer operator+(const Integer& y) const
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_add_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      return fromSmall(r);
+    }
+    return Integer(getValue() + y.getValue());
+  }
+  Integer& operator+=(const Integer& y)
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_add_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      d_small = r;
+      return *this;
+    }
+    return *this = *this + y;
+  }
+
+  Integer operator-(const Integer& y) const
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_sub_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      return fromSmall(r);
+    }
+    return Integer(getValue() - y.getValue());
+  }
+  Integer& operator-=(const Integer& y)
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_sub_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      d_small = r;
+      return *this;
+    }
+    return *this = *this - y;
+  }
+
+  Integer operator*(const Integer& y) const
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_mul_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      return fromSmall(r);
+    }
+    return Integer(getValue() * y.getValue());
+  }
+  Integer& operator*=(const Integer& y)
+  {
+    int64_t r;
+    if (d_big == nullptr && y.d_big == nullptr
+        && !__builtin_mul_overflow(d_small, y.d_small, &r) && fitsSmall(r))
+    {
+      d_small = r;
+      return *this;
+    }
+    return *this = *this * y;
+  }
+
+  Integer bitwiseOr(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return fromInt64(d_small | y.d_small);
+    }
+    mpz_class result;
+    mpz_class x = getValue(), yv = y.getValue();
+    mpz_ior(result.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+    return Integer(result);
+  }
+
+  Integer bitwiseAnd(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return fromInt64(d_small & y.d_small);
+    }
+    mpz_class result;
+    mpz_class x = getValue(), yv = y.getValue();
+    mpz_and(result.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+    return Integer(result);
+  }
+
+  Integer bitwiseXor(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return fromInt64(d_small ^ y.d_small);
+    }
+    mpz_class result;
+    mpz_class x = getValue(), yv = y.getValue();
+    mpz_xor(result.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+    return Integer(result);
+  }
+
+  Integer bitwiseNot() const
+  {
+    if (d_big == nullptr)
+    {
+      return fromInt64(~d_small);
+    }
+    mpz_class result;
+    mpz_com(result.get_mpz_t(), d_big->get_mpz_t());
+    return Integer(result);
+  }
+
+  /**
+   * Return this*(2^pow).
+   */
+  Integer multiplyByPow2(uint32_t pow) const
+  {
+    int64_t r;
+    if (d_big == nullptr && pow < 63
+        && !__builtin_mul_overflow(d_small, int64_t(1) << pow, &r))
+    {
+      return fromInt64(r);
+    }
+    mpz_class result, x = getValue();
+    mpz_mul_2exp(result.get_mpz_t(), x.get_mpz_t(), pow);
+    return Integer(result);
+  }
+
+  /**
+   * Returns the Integer obtained by setting the ith bit of the
+   * current Integer to 1.
+   */
+  Integer setBit(uint32_t i) const
+  {
+    if (d_big == nullptr && i < 63)
+    {
+      return fromInt64(d_small | (int64_t(1) << i));
+    }
+    mpz_class res = getValue();
+    mpz_setbit(res.get_mpz_t(), i);
+    return Integer(res);
+  }
+
+  bool isBitSet(uint32_t i) const { return !extractBitRange(1, i).isZero(); }
+
+  /**
+   * Returns the integer with the binary representation of size bits
+   * extended with amount 1's
+   */
+  Integer oneExtend(uint32_t size, uint32_t amount) const;
+
+  uint32_t toUnsignedInt() const
+  {
+    if (d_big == nullptr)
+    {
+      // like mpz_get_ui, the least significant bits of the absolute value
+      return static_cast<uint32_t>(absSmall(d_small));
+    }
+    return mpz_get_ui(d_big->get_mpz_t());
+  }
+
+  /** See GMP Documentation. */
+  Integer extractBitRange(uint32_t bitCount, uint32_t low) const
+  {
+    // bitCount = high-low+1
+    uint32_t high = low + bitCount - 1;
+    if (d_big == nullptr && bitCount > 0 && (high < 62 || d_small >= 0))
+    {
+      int64_t rem =
+          high < 62 ? d_small & ((int64_t(1) << (high + 1)) - 1) : d_small;
+      return fromSmall(low < 63 ? rem >> low : 0);
+    }
+    //— Function: void mpz_fdiv_r_2exp (mpz_t r, mpz_t n, mp_bitcnt_t b)
+    mpz_class rem, div, x = getValue();
+    mpz_fdiv_r_2exp(rem.get_mpz_t(), x.get_mpz_t(), high + 1);
+    mpz_fdiv_q_2exp(div.get_mpz_t(), rem.get_mpz_t(), low);
+
+    return Integer(div);
+  }
+
+  /**
+   * Returns the floor(this / y)
+   */
+  Integer floorDivideQuotient(const Integer& y) const
+  {
+    Integer q, r;
+    floorQR(q, r, *this, y);
+    return q;
+  }
+
+  /**
+   * Returns r == this - floor(this/y)*y
+   */
+  Integer floorDivideRemainder(const Integer& y) const
+  {
+    Integer q, r;
+    floorQR(q, r, *this, y);
+    return r;
+  }
+
+  /**
+   * Computes a floor quotient and remainder for x divided by y.
+   */
+  static void floorQR(Integer& q,
+                      Integer& r,
+                      const Integer& x,
+                      const Integer& y)
+  {
+    if (x.d_big == nullptr && y.d_big == nullptr && y.d_small != 0)
+    {
+      int64_t qs = x.d_small / y.d_small;
+      int64_t rs = x.d_small % y.d_small;
+      if (rs != 0 && ((rs < 0) != (y.d_small < 0)))
+      {
+        qs -= 1;
+        rs += y.d_small;
+      }
+      q = fromSmall(qs);
+      r = fromSmall(rs);
+      return;
+    }
+    mpz_class qv, rv, xv = x.getValue(), yv = y.getValue();
+    mpz_fdiv_qr(
+        qv.get_mpz_t(), rv.get_mpz_t(), xv.get_mpz_t(), yv.get_mpz_t());
+    q = Integer(qv);
+    r = Integer(rv);
+  }
+
+  /**
+   * Returns the ceil(this / y)
+   */
+  Integer ceilingDivideQuotient(const Integer& y) const
+  {
+    Integer q, r;
+    ceilingQR(q, r, *this, y);
+    return q;
+  }
+
+  /**
+   * Returns the ceil(this / y)
+   */
+  Integer ceilingDivideRemainder(const Integer& y) const
+  {
+    Integer q, r;
+    ceilingQR(q, r, *this, y);
+    return r;
+  }
+
+  /**
+   * Computes a quotient and remainder according to Boute's Euclidean
+   * definition. euclidianDivideQuotient, euclidianDivideRemainder.
+   *
+   * Boute, Raymond T. (April 1992).
+   * The Euclidean definition of the functions div and mod.
+   * ACM Transactions on Programming Languages and Systems (TOPLAS)
+   * ACM Press. 14 (2): 127 - 144. doi:10.1145/128861.128862.
+   */
+  static void euclidianQR(Integer& q,
+                          Integer& r,
+                          const Integer& x,
+                          const Integer& y)
+  {
+    // compute the floor and then fix the value up if needed.
+    floorQR(q, r, x, y);
+
+    if (r.strictlyNegative())
+    {
+      // if r < 0
+      // abs(r) < abs(y)
+      // - abs(y) < r < 0, then 0 < r + abs(y) < abs(y)
+      // n = y * q + r
+      // n = y * q - abs(y) + r + abs(y)
+      if (r.sgn() >= 0)
+      {
+        // y = abs(y)
+        // n = y * q - y + r + y
+        // n = y * (q-1) + (r+y)
+        q -= 1;
+        r += y;
+      }
+      else
+      {
+        // y = -abs(y)
+        // n = y * q + y + r - y
+        // n = y * (q+1) + (r-y)
+        q += 1;
+        r -= y;
+      }
+    }
+  }
+
+  /**
+   * Returns the quotient according to Boute's Euclidean definition.
+   * See the documentation for euclidianQR.
+   */
+  Integer euclidianDivideQuotient(const Integer& y) const
+  {
+    Integer q, r;
+    euclidianQR(q, r, *this, y);
+    return q;
+  }
+
+  /**
+   * Returns the remainder according to Boute's Euclidean definition.
+   * See the documentation for euclidianQR.
+   */
+  Integer euclidianDivideRemainder(const Integer& y) const
+  {
+    Integer q, r;
+    euclidianQR(q, r, *this, y);
+    return r;
+  }
+
+  /**
+   * If y divides *this, then exactQuotient returns (this/y)
+   */
+  Integer exactQuotient(const Integer& y) const;
+
+  /**
+   * Returns y mod 2^exp
+   */
+  Integer modByPow2(uint32_t exp) const
+  {
+    if (d_big == nullptr && (exp < 63 || d_small >= 0))
+    {
+      return fromSmall(exp < 63 ? d_small & ((int64_t(1) << exp) - 1)
+                                : d_small);
+    }
+    mpz_class res, x = getValue();
+    mpz_fdiv_r_2exp(res.get_mpz_t(), x.get_mpz_t(), exp);
+    return Integer(res);
+  }
+
+  /**
+   * Returns y / 2^exp
+   */
+  Integer divByPow2(uint32_t exp) const
+  {
+    if (d_big == nullptr)
+    {
+      // arithmetic shift, i.e., rounding towards negative infinity
+      return fromSmall(exp < 63 ? d_small >> exp : (d_small < 0 ? -1 : 0));
+    }
+    mpz_class res;
+    mpz_fdiv_q_2exp(res.get_mpz_t(), d_big->get_mpz_t(), exp);
+    return Integer(res);
+  }
+
+  int sgn() const
+  {
+    if (d_big == nullptr)
+    {
+      return (d_small > 0) - (d_small < 0);
+    }
+    return mpz_sgn(d_big->get_mpz_t());
+  }
+
+  inline bool strictlyPositive() const { return sgn() > 0; }
+
+  inline bool strictlyNegative() const { return sgn() < 0; }
+
+  inline bool isZero() const { return d_big == nullptr && d_small == 0; }
+
+  bool isOne() const { return d_big == nullptr && d_small == 1; }
+
+  bool isNegativeOne() const { return d_big == nullptr && d_small == -1; }
+
+  /**
+   * Raise this Integer to the power <code>exp</code>.
+   *
+   * @param exp the exponent
+   */
+  Integer pow(unsigned long int exp) const;
+
+  /**
+   * Return the greatest common divisor of this integer with another.
+   */
+  Integer gcd(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return fromSmall(
+          static_cast<int64_t>(gcdSmall(absSmall(d_small), absSmall(y.d_small))));
+    }
+    mpz_class result, x = getValue(), yv = y.getValue();
+    mpz_gcd(result.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+    return Integer(result);
+  }
+
+  /**
+   * Return the least common multiple of this integer with another.
+   */
+  Integer lcm(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      if (d_small == 0 || y.d_small == 0)
+      {
+        return Integer();
+      }
+      uint64_t a = absSmall(d_small), b = absSmall(y.d_small);
+      int64_t r;
+      if (!__builtin_mul_overflow(
+              static_cast<int64_t>(a / gcdSmall(a, b)), static_cast<int64_t>(b), &r)
+          && fitsSmall(r))
+      {
+        return fromSmall(r);
+      }
+    }
+    mpz_class result, x = getValue(), yv = y.getValue();
+    mpz_lcm(result.get_mpz_t(), x.get_mpz_t(), yv.get_mpz_t());
+    return Integer(result);
+  }
+
+  /**
+   * Compute addition of this Integer x + y modulo m.
+   */
+  Integer modAdd(const Integer& y, const Integer& m) const;
+
+  /**
+   * Compute multiplication of this Integer x * y modulo m.
+   */
+  Integer modMultiply(const Integer& y, const Integer& m) const;
+
+  /**
+   * Compute modular inverse x^-1 of this Integer x modulo m with m > 0.
+   * Returns a value x^-1 with 0 <= x^-1 < m such that x * x^-1 = 1 modulo m
+   * if such an inverse exists, and -1 otherwise.
+   *
+   * Such an inverse only exists if
+   *   - x is non-zero
+   *   - x and m are coprime, i.e., if gcd (x, m) = 1
+   *
+   * Note that if x and m are coprime, then x^-1 > 0 if m > 1 and x^-1 = 0
+   * if m = 1 (the zero ring).
+   */
+  Integer modInverse(const Integer& m) const;
+
+  /**
+   * All non-zero integers z, z.divide(0)
+   * ! zero.divides(zero)
+   */
+  bool divides(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return d_small == 0 ? y.d_small == 0 : y.d_small % d_small == 0;
+    }
+    mpz_class x = getValue(), yv = y.getValue();
+    return mpz_divisible_p(yv.get_mpz_t(), x.get_mpz_t()) != 0;
+  }
+
+  /**
+   * Return the absolute value of this integer.
+   */
+  Integer abs() const { return sgn() >= 0 ? *this : -*this; }
+
+  std::string toString(int base = 10) const
+  {
+    if (d_big == nullptr && base == 10)
+    {
+      return std::to_string(d_small);
+    }
+    return getValue().get_str(base);
+  }
+
+  bool fitsSignedInt() const;
+
+  bool fitsUnsignedInt() const;
+
+  signed int getSignedInt() const;
+
+  unsigned int getUnsignedInt() const;
+
+  bool fitsSignedLong() const;
+
+  bool fitsUnsignedLong() const;
+
+  long getLong() const;
+
+  unsigned long getUnsignedLong() const;
+
+  /**
+   * Computes the hash of the node from the first word of the
+   * numerator, the denominator.
+   */
+  size_t hash() const
+  {
+    // agrees with gmpz_hash() on the absolute value for 64-bit limbs
+    return d_big == nullptr ? static_cast<size_t>(absSmall(d_small))
+                            : gmpz_hash(d_big->get_mpz_t());
+  }
+
+  /**
+   * Returns true iff bit n is set.
+   *
+   * @param n the bit to test (0 == least significant bit)
+   * @return true if bit n is set in this integer; false otherwise
+   */
+  bool testBit(unsigned n) const
+  {
+    if (d_big == nullptr)
+    {
+      return n < 64 ? (d_small >> n) & 1 : d_small < 0;
+    }
+    return mpz_tstbit(d_big->get_mpz_t(), n);
+  }
+
+  /**
+   * Returns k if the integer is equal to 2^(k-1)
+   * @return k if the integer is equal to 2^(k-1) and 0 otherwise
+   */
+  unsigned isPow2() const
+  {
+    if (d_big == nullptr)
+    {
+      if (d_small <= 0 || (d_small & (d_small - 1)) != 0) return 0;
+      return __builtin_ctzll(static_cast<uint64_t>(d_small)) + 1;
+    }
+    if (mpz_sgn(d_big->get_mpz_t()) <= 0) return 0;
+    // check that the number of ones in the binary representation is 1
+    if (mpz_popcount(d_big->get_mpz_t()) == 1)
+    {
+      // return the index of the first one plus 1
+      return mpz_scan1(d_big->get_mpz_t(), 0) + 1;
+    }
+    return 0;
+  }
+
+  /**
+   * If x != 0, returns the smallest n s.t. 2^{n-1} <= abs(x) < 2^{n}.
+   * If x == 0, returns 1.
+   */
+  size_t length() const
+  {
+    if (d_big == nullptr)
+    {
+      return d_small == 0 ? 1 : 64 - __builtin_clzll(absSmall(d_small));
+    }
+    return mpz_sizeinbase(d_big->get_mpz_t(), 2);
+  }
+
+  static void extendedGcd(
+      Integer& g, Integer& s, Integer& t, const Integer& a, const Integer& b);
+
+  /** Returns a reference to the minimum of two integers. */
+  static const Integer& min(const Integer& a, const Integer& b)
+  {
+    return (a <= b) ? a : b;
+  }
+
+  /** Returns a reference to the maximum of two integers. */
+  static const Integer& max(const Integer& a, const Integer& b)
+  {
+    return (a >= b) ? a : b;
+  }
+
+ private:
+  /**
+   * Whether v can be stored inline.  The most negative 64-bit integer is
+   * excluded so that negating an inline value never overflows.
+   */
+  static bool fitsSmall(int64_t v)
+  {
+    return v != std::numeric_limits<int64_t>::min();
+  }
+  /** The absolute value of an inline value */
+  static uint64_t absSmall(int64_t v)
+  {
+    return v < 0 ? -static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+  }
+  /** The greatest common divisor of a and b, binary gcd */
+  static uint64_t gcdSmall(uint64_t a, uint64_t b)
+  {
+    if (a == 0) return b;
+    if (b == 0) return a;
+    int shift = __builtin_ctzll(a | b);
+    a >>= __builtin_ctzll(a);
+    do
+    {
+      b >>= __builtin_ctzll(b);
+      if (a > b)
+      {
+        uint64_t t = b;
+        b = a;
+        a = t;
+      }
+      b -= a;
+    } while (b != 0);
+    return a << shift;
+  }
+  /** The integer with value v, which must satisfy fitsSmall(v) */
+  static Integer fromSmall(int64_t v)
+  {
+    Integer z;
+    z.d_small = v;
+    return z;
+  }
+  /** The integer with value v */
+  static Integer fromInt64(int64_t v)
+  {
+    Integer z;
+    z.setSigned(v);
+    return z;
+  }
+  /** Converts the inline value v to a GMP integer. */
+  static mpz_class smallToMpz(int64_t v);
+
+  /** Sets the value to v, storing it inline if possible. */
+  void setValue(const mpz_class& v);
+  void setSigned(int64_t v)
+  {
+    if (fitsSmall(v))
+    {
+      d_small = v;
+    }
+    else
+    {
+      setValue(smallToMpz(v));
+    }
+  }
+  void setUnsigned(uint64_t v)
+  {
+    if (v <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+    {
+      d_small = static_cast<int64_t>(v);
+    }
+    else
+    {
+      setValue(unsignedToMpz(v));
+    }
+  }
+  /** Converts v to a GMP integer. */
+  static mpz_class unsignedToMpz(uint64_t v);
+
+  /** Returns -1, 0 or 1 if this is less than, equal to or greater than y. */
+  int compare(const Integer& y) const
+  {
+    if (d_big == nullptr && y.d_big == nullptr)
+    {
+      return (d_small > y.d_small) - (d_small < y.d_small);
+    }
+    return compareSlow(y);
+  }
+  int compareSlow(const Integer& y) const;
+
+  /** Computes a ceiling quotient and remainder for x divided by y. */
+  static void ceilingQR(Integer& q,
+                        Integer& r,
+                        const Integer& x,
+                        const Integer& y);
+
+  /**
+   * The value of the integer if d_big is null.
+   */
+  int64_t d_small;
+  /**
+   * The value of the integer if it does not fit into d_small, null otherwise.
+   */
+  mpz_class* d_big;
+}; /* class Integer */
+
+struct IntegerHashFunction
+{
+  inline size_t operator()(const CVC4::Integer& i) const { return i.hash(); }
+}; /* struct IntegerHashFunction */
+
+inline std::ostream& operator<<(std::ostream& os, const Integer& n)
+{
+  return os << n.toString();
+}
+
+}  // namespace CVC4
+
+#endif /* CVC4__INTEGER_H */
@@ -0,0 +1,185 @@
+/*********************                                                        */
+/*! \file rational_small_imp.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Multiprecision rational constants; stores small values inline and
+ ** wraps a GMP multiprecision rational otherwise.
+ **
+ ** Multiprecision rational constants; stores small values inline and wraps a
+ ** GMP multiprecision rational otherwise.
+ **/
+#include "util/rational.h"
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include "cvc4autoconfig.h"
+
+// Make sure this comes after cvc4autoconfig.h
+#if !defined(CVC4_GMP_IMP) || !defined(CVC4_SMALL_IMP)
+#  error "This source should only ever be built if CVC4_SMALL_IMP is on !"
+#endif /* !CVC4_GMP_IMP || !CVC4_SMALL_IMP */
+
+#include "base/check.h"
+
+namespace CVC4 {
+
+std::ostream& operator<<(std::ostream& os, const Rational& q){
+  return os << q.toString();
+}
+
+Rational::Rational(const char* s, unsigned base)
+    : d_num(0), d_den(1), d_big(nullptr)
+{
+  mpq_class q(s, base);
+  q.canonicalize();
+  setValue(q);
+}
+
+Rational::Rational(const std::string& s, unsigned base)
+    : d_num(0), d_den(1), d_big(nullptr)
+{
+  mpq_class q(s, base);
+  q.canonicalize();
+  setValue(q);
+}
+
+mpq_class Rational::getValue() const
+{
+  if (d_big == nullptr)
+  {
+    mpq_class q;
+    mpq_set_num(q.get_mpq_t(), Integer::smallToMpz(d_num).get_mpz_t());
+    mpq_set_den(q.get_mpq_t(), Integer::smallToMpz(d_den).get_mpz_t());
+    return q;
+  }
+  return *d_big;
+}
+
+void Rational::setValue(const mpq_class& v)
+{
+  Integer num(v.get_num());
+  Integer den(v.get_den());
+  if (num.d_big == nullptr && den.d_big == nullptr)
+  {
+    delete d_big;
+    d_big = nullptr;
+    d_num = num.d_small;
+    d_den = den.d_small;
+  }
+  else if (d_big == nullptr)
+  {
+    d_big = new mpq_class(v);
+  }
+  else
+  {
+    *d_big = v;
+  }
+}
+
+void Rational::initSlow(const Integer& n, const Integer& d)
+{
+  mpq_class q(n.getValue(), d.getValue());
+  q.canonicalize();
+  setValue(q);
+}
+
+int Rational::cmpSlow(const Rational& x) const
+{
+  if (d_big == nullptr && x.d_big == nullptr)
+  {
+    // the cross products overflowed
+    int s = sgn(), xs = x.sgn();
+    if (s != xs)
+    {
+      return (s > xs) - (s < xs);
+    }
+  }
+  int c = mpq_cmp(getValue().get_mpq_t(), x.getValue().get_mpq_t());
+  return (c > 0) - (c < 0);
+}
+
+double Rational::getDouble() const
+{
+  // integers of up to 53 bits are represented exactly by a double
+  if (d_big == nullptr && d_den == 1
+      && Integer::absSmall(d_num) <= (uint64_t(1) << 53))
+  {
+    return static_cast<double>(d_num);
+  }
+  return getValue().get_d();
+}
+
+/* Computes a rational given a decimal string. The rational
+ * version of <code>xxx.yyy</code> is <code>xxxyyy/(10^3)</code>.
+ */
+Rational Rational::fromDecimal(const std::string& dec) {
+  using std::string;
+  // Find the decimal point, if there is one
+  string::size_type i( dec.find(".") );
+  if( i != string::npos ) {
+    /* Erase the decimal point, so we have just the numerator. */
+    Integer numerator( string(dec).erase(i,1) );
+
+    /* Compute the denominator: 10 raise to the number of decimal places */
+    int decPlaces = dec.size() - (i + 1);
+    Integer denominator( Integer(10).pow(decPlaces) );
+
+    return Rational( numerator, denominator );
+  } else {
+    /* No decimal point, assume it's just an integer. */
+    return Rational( dec );
+  }
+}
+
+
+
+/** Equivalent to calling (this->abs()).cmp(b.abs()) */
+int Rational::absCmp(const Rational& q) const{
+  const Rational& r = *this;
+  int rsgn = r.sgn();
+  int qsgn = q.sgn();
+  if(rsgn == 0){
+    return (qsgn == 0) ? 0 : -1;
+  }else if(qsgn == 0){
+    Assert(rsgn != 0);
+    return 1;
+  }else if((rsgn > 0) && (qsgn > 0)){
+    return r.cmp(q);
+  }else if((rsgn < 0) && (qsgn < 0)){
+    // if r < q < 0, q.cmp(r) = +1, (r.abs()).cmp(q.abs()) = +1
+    // if q < r < 0, q.cmp(r) = -1, (r.abs()).cmp(q.abs()) = -1
+    // if q = r < 0, q.cmp(r) =  0, (r.abs()).cmp(q.abs()) =  0
+    return q.cmp(r);
+  }else if((rsgn < 0) && (qsgn > 0)){
+    Rational rpos = -r;
+    return rpos.cmp(q);
+  }else {
+    Assert(rsgn > 0 && (qsgn < 0));
+    Rational qpos = -q;
+    return r.cmp(qpos);
+  }
+}
+
+
+/** Return an exact rational for a double d. */
+Maybe<Rational> Rational::fromDouble(double d)
+{
+  using namespace std;
+  if(isfinite(d)){
+    mpq_class q;
+    mpq_set_d(q.get_mpq_t(), d);
+    return Rational(q);
+  }
+  return Maybe<Rational>();
+}
+
+} /* namespace CVC4 */
@@ -0,0 +1,625 @@
+/*********************                                                        */
+/*! \file rational_small_imp.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Multiprecision rational constants; stores small values inline and
+ ** wraps a GMP multiprecision rational otherwise.
+ **
+ ** Multiprecision rational constants; stores small values inline and wraps a
+ ** GMP multiprecision rational otherwise.
+ **/
+
+#include "cvc4_public.h"
+
+#ifndef CVC4__RATIONAL_H
+#define CVC4__RATIONAL_H
+
+/*
+ * Older versions of GMP in combination with newer versions of GCC and C++11
+ * cause errors: https://gcc.gnu.org/gcc-4.9/porting_to.html
+ * Including <cstddef> is a workaround for this issue.
+ */
+#include <gmp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "base/exception.h"
+#include "util/integer.h"
+#include "util/maybe.h"
+
+namespace CVC4 {
+
+/**
+ ** A multi-precision rational constant.
+ ** This stores the rational as a pair of integers, one for the numerator and
+ ** one for the denominator.
+ ** The number is always stored so that the gcd of the numerator and denominator
+ ** is 1.  (This is referred to as referred to as canonical form in GMP's
+ ** literature.) A consequence is that that the numerator and denominator may be
+ ** different than the values used to construct the Rational.
+ **
+ ** If both the numerator and the denominator fit into a signed 64-bit integer
+ ** (see Integer), they are stored inline and the arithmetic operations are
+ ** computed with overflow-checked machine arithmetic.  Otherwise, or if an
+ ** operation overflows, the value is stored in a heap-allocated GMP rational.
+ ** As for Integer, the representation is canonical.
+ **
+ ** NOTE: The correct way to create a Rational from an int is to use one of the
+ ** int numerator/int denominator constructors with the denominator 1.  Trying
+ ** to construct a Rational with a single int, e.g., Rational(0), will put you
+ ** in danger of invoking the char* constructor, from whence you will segfault.
+ **/
+
+class CVC4_PUBLIC Rational
+{
+ public:
+  /**
+   * Constructs a Rational from a mpq_class object.
+   * Does a deep copy.
+   * Assumes that the value is in canonical form, and thus does not
+   * have to call canonicalize() on the value.
+   */
+  Rational(const mpq_class& val) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    setValue(val);
+  }
+
+  /**
+   * Creates a rational from a decimal string (e.g., <code>"1.5"</code>).
+   *
+   * @param dec a string encoding a decimal number in the format
+   * <code>[0-9]*\.[0-9]*</code>
+   */
+  static Rational fromDecimal(const std::string& dec);
+
+  /** Constructs a rational with the value 0/1. */
+  Rational() : d_num(0), d_den(1), d_big(nullptr) {}
+
+  /**
+   * Constructs a Rational from a C string in a given base (defaults to 10).
+   *
+   * Throws std::invalid_argument if the string is not a valid rational.
+   * For more information about what is a valid rational string,
+   * see GMP's documentation for mpq_set_str().
+   */
+  explicit Rational(const char* s, unsigned base = 10);
+  Rational(const std::string& s, unsigned base = 10);
+
+  /**
+   * Creates a Rational from another Rational, q, by performing a deep copy.
+   */
+  Rational(const Rational& q)
+      : d_num(q.d_num),
+        d_den(q.d_den),
+        d_big(q.d_big == nullptr ? nullptr : new mpq_class(*q.d_big))
+  {
+  }
+  Rational(Rational&& q) : d_num(q.d_num), d_den(q.d_den), d_big(q.d_big)
+  {
+    q.d_big = nullptr;
+  }
+
+  /**
+   * Constructs a canonical Rational from a numerator.
+   */
+  Rational(signed int n) : d_num(n), d_den(1), d_big(nullptr) {}
+  Rational(unsigned int n) : d_num(n), d_den(1), d_big(nullptr) {}
+  Rational(signed long int n) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(1));
+  }
+  Rational(unsigned long int n) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(1));
+  }
+
+#ifdef CVC4_NEED_INT64_T_OVERLOADS
+  Rational(int64_t n) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(1));
+  }
+  Rational(uint64_t n) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(1));
+  }
+#endif /* CVC4_NEED_INT64_T_OVERLOADS */
+
+  /**
+   * Constructs a canonical Rational from a numerator and denominator.
+   */
+  Rational(signed int n, signed int d) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+  Rational(unsigned int n, unsigned int d) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+  Rational(signed long int n, signed long int d)
+      : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+  Rational(unsigned long int n, unsigned long int d)
+      : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+
+#ifdef CVC4_NEED_INT64_T_OVERLOADS
+  Rational(int64_t n, int64_t d) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+  Rational(uint64_t n, uint64_t d) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(Integer(n), Integer(d));
+  }
+#endif /* CVC4_NEED_INT64_T_OVERLOADS */
+
+  Rational(const Integer& n, const Integer& d)
+      : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(n, d);
+  }
+  Rational(const Integer& n) : d_num(0), d_den(1), d_big(nullptr)
+  {
+    init(n, Integer(1));
+  }
+  ~Rational() { delete d_big; }
+
+  /**
+   * Returns a copy of the value as a GMP rational.
+   */
+  mpq_class getValue() const;
+
+  /**
+   * Returns the value of numerator of the Rational.
+   * Note that this makes a deep copy of the numerator.
+   */
+  Integer getNumerator() const
+  {
+    return d_big == nullptr ? Integer::fromSmall(d_num)
+                            : Integer(d_big->get_num());
+  }
+
+  /**
+   * Returns the value of denominator of the Rational.
+   * Note that this makes a deep copy of the denominator.
+   */
+  Integer getDenominator() const
+  {
+    return d_big == nullptr ? Integer::fromSmall(d_den)
+                            : Integer(d_big->get_den());
+  }
+
+  static Maybe<Rational> fromDouble(double d);
+
+  /**
+   * Get a double representation of this Rational, which is
+   * approximate: truncation may occur, overflow may result in
+   * infinity, and underflow may result in zero.
+   */
+  double getDouble() const;
+
+  Rational inverse() const
+  {
+    if (d_big == nullptr && d_num != 0)
+    {
+      return d_num > 0 ? fromSmall(d_den, d_num) : fromSmall(-d_den, -d_num);
+    }
+    return Rational(getDenominator(), getNumerator());
+  }
+
+  int cmp(const Rational& x) const
+  {
+    if (d_big == nullptr && x.d_big == nullptr)
+    {
+      if (d_den == x.d_den)
+      {
+        return (d_num > x.d_num) - (d_num < x.d_num);
+      }
+      int64_t l, r;
+      if (!__builtin_mul_overflow(d_num, x.d_den, &l)
+          && !__builtin_mul_overflow(x.d_num, d_den, &r))
+      {
+        return (l > r) - (l < r);
+      }
+    }
+    return cmpSlow(x);
+  }
+
+  int sgn() const
+  {
+    if (d_big == nullptr)
+    {
+      return (d_num > 0) - (d_num < 0);
+    }
+    return mpq_sgn(d_big->get_mpq_t());
+  }
+
+  bool isZero() const { return d_big == nullptr && d_num == 0; }
+
+  bool isOne() const { return d_big == nullptr && d_num == 1 && d_den == 1; }
+
+  bool isNegativeOne() const
+  {
+    return d_big == nullptr && d_num == -1 && d_den == 1;
+  }
+
+  Rational abs() const
+  {
+    if (sgn() < 0)
+    {
+      return -(*this);
+    }
+    else
+    {
+      return *this;
+    }
+  }
+
+  Integer floor() const
+  {
+    if (d_big == nullptr)
+    {
+      return Integer::fromSmall(floorSmall(d_num, d_den));
+    }
+    mpz_class q;
+    mpz_fdiv_q(
+        q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
+    return Integer(q);
+  }
+
+  Integer ceiling() const
+  {
+    if (d_big == nullptr)
+    {
+      return Integer::fromSmall(-floorSmall(-d_num, d_den));
+    }
+    mpz_class q;
+    mpz_cdiv_q(
+        q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
+    return Integer(q);
+  }
+
+  Rational floor_frac() const { return (*this) - Rational(floor()); }
+
+  Rational& operator=(const Rational& x)
+  {
+    if (this == &x) return *this;
+    if (x.d_big == nullptr)
+    {
+      delete d_big;
+      d_big = nullptr;
+      d_num = x.d_num;
+      d_den = x.d_den;
+    }
+    else if (d_big == nullptr)
+    {
+      d_big = new mpq_class(*x.d_big);
+    }
+    else
+    {
+      *d_big = *x.d_big;
+    }
+    return *this;
+  }
+  Rational& operator=(Rational&& x)
+  {
+    if (this == &x) return *this;
+    delete d_big;
+    d_num = x.d_num;
+    d_den = x.d_den;
+    d_big = x.d_big;
+    x.d_big = nullptr;
+    return *this;
+  }
+
+  Rational operator-() const
+  {
+    return d_big == nullptr ? fromSmall(-d_num, d_den) : Rational(-*d_big);
+  }
+
+  bool operator==(const Rational& y) const
+  {
+    if (d_big == nullptr || y.d_big == nullptr)
+    {
+      return d_big == y.d_big && d_num == y.d_num && d_den == y.d_den;
+    }
+    return *d_big == *y.d_big;
+  }
+
+  bool operator!=(const Rational& y) const { return !(*this == y); }
+
+  bool operator<(const Rational& y) const { return cmp(y) < 0; }
+
+  bool operator<=(const Rational& y) const { return cmp(y) <= 0; }
+
+  bool operator>(const Rational& y) const { return cmp(y) > 0; }
+
+  bool operator>=(const Rational& y) const { return cmp(y) >= 0; }
+
+  Rational operator+(const Rational& y) const
+  {
+    Rational res;
+    if (d_big != nullptr || y.d_big != nullptr
+        || !addSmall(d_num, d_den, y.d_num, y.d_den, res.d_num, res.d_den))
+    {
+      res.setValue(getValue() + y.getValue());
+    }
+    return res;
+  }
+  Rational operator-(const Rational& y) const
+  {
+    Rational res;
+    if (d_big != nullptr || y.d_big != nullptr
+        || !addSmall(d_num, d_den, -y.d_num, y.d_den, res.d_num, res.d_den))
+    {
+      res.setValue(getValue() - y.getValue());
+    }
+    return res;
+  }
+
+  Rational operator*(const Rational& y) const
+  {
+    Rational res;
+    if (d_big != nullptr || y.d_big != nullptr
+        || !mulSmall(d_num, d_den, y.d_num, y.d_den, res.d_num, res.d_den))
+    {
+      res.setValue(getValue() * y.getValue());
+    }
+    return res;
+  }
+  Rational operator/(const Rational& y) const
+  {
+    Rational res;
+    if (d_big != nullptr || y.d_big != nullptr || y.d_num == 0
+        || !mulSmall(d_num,
+                     d_den,
+                     y.d_num > 0 ? y.d_den : -y.d_den,
+                     y.d_num > 0 ? y.d_num : -y.d_num,
+                     res.d_num,
+                     res.d_den))
+    {
+      res.setValue(getValue() / y.getValue());
+    }
+    return res;
+  }
+
+  Rational& operator+=(const Rational& y)
+  {
+    if (d_big != nullptr || y.d_big != nullptr
+        || !addSmall(d_num, d_den, y.d_num, y.d_den, d_num, d_den))
+    {
+      setValue(getValue() + y.getValue());
+    }
+    return (*this);
+  }
+  Rational& operator-=(const Rational& y)
+  {
+    if (d_big != nullptr || y.d_big != nullptr
+        || !addSmall(d_num, d_den, -y.d_num, y.d_den, d_num, d_den))
+    {
+      setValue(getValue() - y.getValue());
+    }
+    return (*this);
+  }
+
+  Rational& operator*=(const Rational& y)
+  {
+    if (d_big != nullptr || y.d_big != nullptr
+        || !mulSmall(d_num, d_den, y.d_num, y.d_den, d_num, d_den))
+    {
+      setValue(getValue() * y.getValue());
+    }
+    return (*this);
+  }
+
+  Rational& operator/=(const Rational& y)
+  {
+    return *this = *this / y;
+  }
+
+  bool isIntegral() const
+  {
+    if (d_big == nullptr)
+    {
+      return d_den == 1;
+    }
+    return mpz_cmp_ui(d_big->get_den_mpz_t(), 1) == 0;
+  }
+
+  /** Returns a string representing the rational in the given base. */
+  std::string toString(int base = 10) const
+  {
+    if (d_big == nullptr && base == 10)
+    {
+      return d_den == 1 ? std::to_string(d_num)
+                        : std::to_string(d_num) + "/" + std::to_string(d_den);
+    }
+    return getValue().get_str(base);
+  }
+
+  /**
+   * Computes the hash of the rational from hashes of the numerator and the
+   * denominator.
+   */
+  size_t hash() const
+  {
+    if (d_big == nullptr)
+    {
+      // agrees with the hash of the GMP rational for 64-bit limbs
+      return static_cast<size_t>(Integer::absSmall(d_num))
+             xor static_cast<size_t>(d_den);
+    }
+    size_t numeratorHash = gmpz_hash(d_big->get_num_mpz_t());
+    size_t denominatorHash = gmpz_hash(d_big->get_den_mpz_t());
+
+    return numeratorHash xor denominatorHash;
+  }
+
+  uint32_t complexity() const
+  {
+    uint32_t numLen = getNumerator().length();
+    uint32_t denLen = getDenominator().length();
+    return numLen + denLen;
+  }
+
+  /** Equivalent to calling (this->abs()).cmp(b.abs()) */
+  int absCmp(const Rational& q) const;
+
+ private:
+  /**
+   * The rational num/den, which must be canonical and satisfy
+   * Integer::fitsSmall() for both num and den.
+   */
+  static Rational fromSmall(int64_t num, int64_t den)
+  {
+    Rational q;
+    q.d_num = num;
+    q.d_den = den;
+    return q;
+  }
+
+  /**
+   * Computes the canonical form of a/b + c/d into rnum/rden, where a/b and
+   * c/d are canonical inline values.  Returns false (leaving rnum and rden
+   * unchanged) if the result does not fit inline.
+   */
+  static bool addSmall(int64_t a,
+                       int64_t b,
+                       int64_t c,
+                       int64_t d,
+                       int64_t& rnum,
+                       int64_t& rden)
+  {
+    int64_t n, m;
+    if (b == 1 && d == 1)
+    {
+      if (__builtin_add_overflow(a, c, &n) || !Integer::fitsSmall(n))
+      {
+        return false;
+      }
+      rnum = n;
+      rden = 1;
+      return true;
+    }
+    // Knuth, TAOCP Vol. 2, 4.5.1: with g = gcd(b, d), the result is
+    // (a*(d/g) + c*(b/g)) / (b*(d/g)), reduced by gcd(numerator, g)
+    int64_t g = static_cast<int64_t>(Integer::gcdSmall(b, d));
+    int64_t bg = b / g, dg = d / g;
+    if (__builtin_mul_overflow(a, dg, &n) || __builtin_mul_overflow(c, bg, &m)
+        || __builtin_add_overflow(n, m, &n) || !Integer::fitsSmall(n))
+    {
+      return false;
+    }
+    int64_t g2 = g == 1 ? 1
+                        : static_cast<int64_t>(
+                              Integer::gcdSmall(Integer::absSmall(n), g));
+    if (__builtin_mul_overflow(bg, d / g2, &m))
+    {
+      return false;
+    }
+    rnum = n / g2;
+    rden = n == 0 ? 1 : m;
+    return true;
+  }
+
+  /**
+   * Computes the canonical form of (a/b) * (c/d) into rnum/rden, where a/b
+   * and c/d are canonical inline values.  Returns false (leaving rnum and
+   * rden unchanged) if the result does not fit inline.
+   */
+  static bool mulSmall(int64_t a,
+                       int64_t b,
+                       int64_t c,
+                       int64_t d,
+                       int64_t& rnum,
+                       int64_t& rden)
+  {
+    if (a == 0 || c == 0)
+    {
+      rnum = 0;
+      rden = 1;
+      return true;
+    }
+    int64_t g1 = static_cast<int64_t>(
+        Integer::gcdSmall(Integer::absSmall(a), static_cast<uint64_t>(d)));
+    int64_t g2 = static_cast<int64_t>(
+        Integer::gcdSmall(Integer::absSmall(c), static_cast<uint64_t>(b)));
+    int64_t n, m;
+    if (__builtin_mul_overflow(a / g1, c / g2, &n) || !Integer::fitsSmall(n)
+        || __builtin_mul_overflow(b / g2, d / g1, &m))
+    {
+      return false;
+    }
+    rnum = n;
+    rden = m;
+    return true;
+  }
+
+  /** floor(a/b) for b > 0 */
+  static int64_t floorSmall(int64_t a, int64_t b)
+  {
+    int64_t q = a / b;
+    return (a % b < 0) ? q - 1 : q;
+  }
+
+  /** Sets the value to v, which must be canonical. */
+  void setValue(const mpq_class& v);
+  /**
+   * Initializes the value to the canonical form of n/d, used by the
+   * constructors.
+   */
+  void init(const Integer& n, const Integer& d)
+  {
+    if (n.d_big == nullptr && d.d_big == nullptr && d.d_small != 0)
+    {
+      int64_t g = static_cast<int64_t>(Integer::gcdSmall(
+          Integer::absSmall(n.d_small), Integer::absSmall(d.d_small)));
+      if (d.d_small < 0)
+      {
+        g = -g;
+      }
+      d_num = n.d_small / g;
+      d_den = d.d_small / g;
+      return;
+    }
+    initSlow(n, d);
+  }
+  void initSlow(const Integer& n, const Integer& d);
+  /** Compares to x if one of the values is not inline or overflows. */
+  int cmpSlow(const Rational& x) const;
+
+  /** The numerator if d_big is null */
+  int64_t d_num;
+  /** The (positive) denominator if d_big is null */
+  int64_t d_den;
+  /**
+   * The value of the rational if its numerator or denominator does not fit
+   * inline, null otherwise.
+   */
+  mpq_class* d_big;
+
+}; /* class Rational */
+
+struct RationalHashFunction
+{
+  inline size_t operator()(const CVC4::Rational& r) const { return r.hash(); }
+}; /* struct RationalHashFunction */
+
+CVC4_PUBLIC std::ostream& operator<<(std::ostream& os, const Rational& n);
+
+}  // namespace CVC4
+
+#endif /* CVC4__RATIONAL_H */
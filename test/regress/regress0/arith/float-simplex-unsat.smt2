@@ -0,0 +1,32 @@
+; COMMAND-LINE: --float-simplex --float-simplex-min-rows=0
+; EXPECT: unsat
+(set-logic QF_LRA)
+(set-info :status unsat)
+(declare-fun x0 () Real)
+(declare-fun x1 () Real)
+(declare-fun x2 () Real)
+(declare-fun x3 () Real)
+(declare-fun x4 () Real)
+(declare-fun x5 () Real)
+(declare-fun x6 () Real)
+(declare-fun x7 () Real)
+(declare-fun x8 () Real)
+(declare-fun x9 () Real)
+(assert (<= (+ (* 2 x0) (* 5 x3) (* 2 x4) (* (- 2) x5) (* (- 2) x9)) 28))
+(assert (<= (+ (* 2 x3) (* (- 3) x9)) 5))
+(assert (<= (+ (* (- 3) x0) (* (- 1) x1) (* (- 3) x5) (* 5 x6) (* 3 x8)) (- 47)))
+(assert (<= (+ (* (- 2) x2) (* (- 3) x4) (* (- 2) x5) (* 3 x6) (* (- 4) x8)) (- 86)))
+(assert (< (+ (* 2 x3) (* 1 x4) (* (- 3) x7) (* (- 1) x8) (* (- 4) x9)) (- 27)))
+(assert (<= (+ (* 2 x1) (* 3 x2) (* 2 x4) (* (- 4) x8) (* (- 2) x9)) (- 8)))
+(assert (<= (+ (* 3 x0) (* (- 1) x8)) 20))
+(assert (<= (+ (* 5 x0) (* (- 4) x1) (* 1 x3) (* 1 x8) (* 3 x9)) 64))
+(assert (<= (+ (* (- 1) x7) (* 2 x8)) 15))
+(assert (< (+ (* (- 2) x1) (* (- 2) x7) (* 2 x8) (* 5 x9)) 18))
+(assert (<= (+ (* (- 2) x0) (* (- 1) x4) (* 2 x9)) (- 13)))
+(assert (<= (+ (* (- 2) x1) (* 2 x3)) 6))
+(assert (<= (+ (* 5 x1) (* 2 x3) (* 5 x4) (* 1 x6)) 19))
+(assert (<= (+ (* 1 x0) (* 1 x2) (* 5 x4) (* 2 x7) (* (- 1) x8)) 20))
+(assert (< (+ (* 1 x0) (* (- 1) x1) (* (- 2) x8) (* 3 x9)) (- 3)))
+(assert (<= (+ (* 3 x0) (* (- 3) x4) (* 3 x6) (* 3 x7) (* (- 1) x8)) 28))
+(assert (<= (+ (* 1 x0) (* (- 1) x1) (* 3 x2) (* (- 9) x3) (* 5 x4) (* 11 x5) (* (- 14) x6) (* 13 x8) (* 10 x9)) 274))
+(check-sat)
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --arith-parallel-bb=2
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun s1 () Int)
+(declare-fun s2 () Int)
+(declare-fun s3 () Int)
+(assert (and (>= s1 0) (>= s2 0) (>= s3 0)))
+(assert (<= (+ s1 3) 12))
+(assert (<= (+ s2 4) 12))
+(assert (<= (+ s3 5) 12))
+; tasks 1 and 2 do not overlap
+(assert (or (<= (+ s1 3) s2) (<= (+ s2 4) s1)))
+(assert (<= 7 (+ (* 2 s1) (* 4 s3)) 9))
+(assert (<= 11 (+ (* 3 s2) (* 5 s3)) 25))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --arith-parallel-bb=4
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (and (<= (- 10) x 10) (<= (- 10) y 10) (<= (- 10) z 10)))
+(assert (<= 1 (- (* 3 x) (* 3 y)) 2))
+(assert (<= 1 (+ (* 4 y) (* 2 z)) 1))
+(check-sat)
@@ -0,0 +1,40 @@
+; COMMAND-LINE: --incremental --arith-warm-start
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+(set-logic QF_LRA)
+(declare-fun x0 () Real)
+(declare-fun x1 () Real)
+(declare-fun x2 () Real)
+(declare-fun x3 () Real)
+(declare-fun x4 () Real)
+(declare-fun d0 () Real)
+(declare-fun d1 () Real)
+(declare-fun d2 () Real)
+(declare-fun d3 () Real)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(assert (= x0 0))
+(assert (= x1 (+ x0 d0)))
+(assert (= x2 (+ x1 d1)))
+(assert (= x3 (+ x2 d2)))
+(assert (= x4 (+ x3 (* 2 d3))))
+(assert (and (<= 0 d0 2) (<= 0 d1 2) (<= 0 d2 2) (<= 0 d3 1)))
+(assert (=> p (>= x4 7)))
+(assert (=> q (>= (+ x4 x2) 13)))
+; x4 <= 8 and x2 <= 4, so q is unsat
+(check-sat-assuming (p))
+(check-sat-assuming (q))
+(push 1)
+(assert (<= x2 1))
+(check-sat-assuming (p))
+(check-sat-assuming (p (not q)))
+(pop 1)
+(check-sat-assuming (p (not q)))
+(push 1)
+(assert (< (+ x1 x2) 5))
+(check-sat-assuming (p))
+(pop 1)
@@ -0,0 +1,8 @@
+; COMMAND-LINE: --bv-propagation-solver --bv-propagation-budget=100
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (= (bvmul x y) #x01))
+(assert (= ((_ extract 0 0) x) #b0))
+(check-sat)
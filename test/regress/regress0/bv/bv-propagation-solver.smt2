@@ -0,0 +1,19 @@
+; COMMAND-LINE: --bv-propagation-solver
+; COMMAND-LINE: --bv-propagation-solver --incremental
+; EXPECT: sat
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(declare-fun z () (_ BitVec 16))
+(assert (= ((_ extract 3 0) x) #xa))
+(assert (bvult y #x0100))
+(assert (bvugt z #x00ff))
+(assert (= (bvadd (bvmul x #x0003) y) (bvxor z #x1234)))
+(assert (bvslt (bvsub x z) #x0000))
+(check-sat)
+(push 1)
+(assert (= (bvurem z y) #x0007))
+(assert (distinct (bvshl x #x0002) (bvlshr z #x0001)))
+(check-sat)
+(pop 1)
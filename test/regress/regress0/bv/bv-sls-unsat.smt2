@@ -0,0 +1,8 @@
+; COMMAND-LINE: --bitblast=eager --bv-sls-moves=1000
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (bvult x y))
+(assert (= (bvmul x #x02) (bvor y #x01)))
+(check-sat)
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --bitblast=eager --bv-sls
+; COMMAND-LINE: --bitblast=eager --bv-sls-moves=10
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun p () Bool)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(declare-fun z () (_ BitVec 16))
+(assert (or p (bvult x y)))
+(assert (= (ite p (bvadd x y) (bvmul x #x0005)) #x1234))
+(assert (bvslt y #x0000))
+(assert (=> (not p) (= ((_ extract 0 0) y) #b1)))
+(assert (= (bvand z #x00ff) #x0042))
+(assert (bvugt (bvlshr z #x0004) x))
+(check-sat)
@@ -0,0 +1,39 @@
+; COMMAND-LINE: --incremental --bv-sat-solver=minisat --bitblast=eager
+; COMMAND-LINE: --incremental --bv-sat-solver=minisat --bitblast=eager --bitblast-native-aig
+(set-logic QF_BV)
+(set-option :incremental true)
+(declare-fun a () (_ BitVec 16))
+(declare-fun b () (_ BitVec 16))
+(declare-fun c () (_ BitVec 16))
+
+(assert (bvult a (bvadd b c)))
+(set-info :status sat)
+(check-sat)
+
+(push 1)
+(assert (bvult c b))
+(set-info :status sat)
+(check-sat)
+
+(push 1)
+(assert (bvugt c b))
+(set-info :status unsat)
+(check-sat)
+(pop 2)
+
+(set-info :status sat)
+(check-sat)
+
+(push 1)
+(assert (bvugt c b))
+(assert (bvule c b))
+(set-info :status unsat)
+(check-sat)
+(pop 1)
+
+(push 1)
+(assert (bvult c b))
+(set-info :status sat)
+(check-sat)
+(pop 1)
+(exit)
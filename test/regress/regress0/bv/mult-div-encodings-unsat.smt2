@@ -0,0 +1,11 @@
+; COMMAND-LINE: --bv-multiplier=wallace --bv-divider=non-restoring
+; COMMAND-LINE: --bv-multiplier=dadda --bv-karatsuba-width=4
+; COMMAND-LINE: --bitblast=eager --bv-multiplier=dadda --bv-divider=non-restoring --bv-karatsuba-width=4 --no-check-unsat-cores
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (not (= y #x00)))
+(assert (or (not (= x (bvadd (bvmul (bvudiv x y) y) (bvurem x y))))
+            (not (bvult (bvurem x y) y))))
+(check-sat)
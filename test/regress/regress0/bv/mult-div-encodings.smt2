@@ -0,0 +1,15 @@
+; COMMAND-LINE: --bv-multiplier=wallace --bv-divider=non-restoring
+; COMMAND-LINE: --bv-multiplier=dadda --bv-karatsuba-width=4
+; COMMAND-LINE: --bitblast=eager --bv-multiplier=dadda --bv-divider=non-restoring --bv-karatsuba-width=8
+; EXPECT: sat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 12))
+(declare-fun y () (_ BitVec 12))
+(declare-fun z () (_ BitVec 12))
+(assert (= (bvmul x y) #x8f1))
+(assert (bvugt x #x001))
+(assert (bvugt y #x001))
+(assert (bvugt z #x010))
+(assert (= (bvudiv x z) #x003))
+(assert (= (bvurem x z) #x002))
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --simplification=none --bv-divider=non-restoring
+; COMMAND-LINE: --simplification=none --bv-divider=restoring
+; COMMAND-LINE: --simplification=none --bitblast=eager --bv-divider=non-restoring --no-check-unsat-cores
+; EXPECT: unsat
+; Division by zero: the divider itself must produce x udiv 0 = 11..11 and
+; x urem 0 = x, since the divisor is only known to be zero in the SAT solver.
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun u () (_ BitVec 7))
+(declare-fun v () (_ BitVec 7))
+(assert (= y #x00))
+(assert (= v #b0000000))
+(assert (or (not (= (bvudiv x y) #xff))
+            (not (= (bvurem x y) x))
+            (not (= (bvudiv u v) #b1111111))
+            (not (= (bvurem u v) u))))
+(check-sat)
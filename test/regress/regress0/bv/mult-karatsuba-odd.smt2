@@ -0,0 +1,48 @@
+; COMMAND-LINE: --simplification=none --bv-multiplier=shift-add --bv-karatsuba-width=4
+; COMMAND-LINE: --simplification=none --bv-multiplier=wallace --bv-karatsuba-width=4
+; COMMAND-LINE: --simplification=none --bv-multiplier=dadda --bv-karatsuba-width=5
+; COMMAND-LINE: --simplification=none --bitblast=eager --bv-multiplier=dadda --bv-karatsuba-width=4 --no-check-unsat-cores
+; EXPECT: unsat
+; Commutativity and distributivity of bvmul and a constant product at odd
+; widths, where the top-level Karatsuba split computes a truncated product
+; wider than twice the low half. The copies x5_2, y5_2, ... are declared in
+; reverse order, so that their products are not normalized to the same
+; terms and the multipliers are built with swapped factors.
+(set-logic QF_BV)
+(declare-fun x5 () (_ BitVec 5))
+(declare-fun y5 () (_ BitVec 5))
+(declare-fun z5 () (_ BitVec 5))
+(declare-fun z5_2 () (_ BitVec 5))
+(declare-fun y5_2 () (_ BitVec 5))
+(declare-fun x5_2 () (_ BitVec 5))
+(assert (= x5 x5_2))
+(assert (= y5 y5_2))
+(assert (= z5 z5_2))
+(declare-fun x7 () (_ BitVec 7))
+(declare-fun y7 () (_ BitVec 7))
+(declare-fun z7 () (_ BitVec 7))
+(declare-fun z7_2 () (_ BitVec 7))
+(declare-fun y7_2 () (_ BitVec 7))
+(declare-fun x7_2 () (_ BitVec 7))
+(assert (= x7 x7_2))
+(assert (= y7 y7_2))
+(assert (= z7 z7_2))
+(declare-fun x9 () (_ BitVec 9))
+(declare-fun y9 () (_ BitVec 9))
+(declare-fun z9 () (_ BitVec 9))
+(declare-fun z9_2 () (_ BitVec 9))
+(declare-fun y9_2 () (_ BitVec 9))
+(declare-fun x9_2 () (_ BitVec 9))
+(assert (= x9 x9_2))
+(assert (= y9 y9_2))
+(assert (= z9 z9_2))
+(assert (or (not (= (bvmul x5 y5) (bvmul y5_2 x5_2)))
+            (not (= (bvmul x5 (bvadd y5 z5)) (bvadd (bvmul y5_2 x5_2) (bvmul z5_2 x5_2))))
+            (and (= x5 #b11011) (= y5 #b10011) (not (= (bvmul x5 y5) #b00001)))
+            (not (= (bvmul x7 y7) (bvmul y7_2 x7_2)))
+            (not (= (bvmul x7 (bvadd y7 z7)) (bvadd (bvmul y7_2 x7_2) (bvmul z7_2 x7_2))))
+            (and (= x7 #b1011011) (= y7 #b1110101) (not (= (bvmul x7 y7) #b0010111)))
+            (not (= (bvmul x9 y9) (bvmul y9_2 x9_2)))
+            (not (= (bvmul x9 (bvadd y9 z9)) (bvadd (bvmul y9_2 x9_2) (bvmul z9_2 x9_2))))
+            (and (= x9 #b110110101) (= y9 #b100101100) (not (= (bvmul x9 y9) #b000011100)))))
+(check-sat)
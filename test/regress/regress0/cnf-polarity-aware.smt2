@@ -0,0 +1,23 @@
+; COMMAND-LINE: --incremental --cnf-polarity-aware --decision=internal
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun x () Int)
+(declare-fun y () Int)
+; the conjunctions only occur positively
+(assert (or (and a (> x 0)) (and b (< y x)) c))
+(check-sat)
+(push 1)
+; ... until here, which requires completing the definition of one of them
+(assert (= c (and b (< y x))))
+(assert b)
+(assert (< y x))
+(assert (not c))
+(check-sat)
+(pop 1)
+(assert (not c))
+(check-sat)
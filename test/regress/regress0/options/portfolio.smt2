@@ -0,0 +1,17 @@
+; COMMAND-LINE: --portfolio-jobs=3 --incremental
+; COMMAND-LINE: --portfolio-jobs=2 --portfolio-config=decision=internal,random-seed=3 --incremental
+; EXPECT: sat
+; EXPECT: ((x 1))
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(set-option :produce-models true)
+(declare-fun x () Int)
+(assert (and (> x 0) (< x 2)))
+(check-sat)
+(get-value (x))
+(push 1)
+(assert (> x 5))
+(check-sat)
+(pop 1)
+(check-sat)
@@ -0,0 +1,1214 @@
+; COMMAND-LINE: --rewrite-cache-limit=1
+; EXPECT: unsat
+; A DAG of depth 1200 whose tree unfolding is exponential, with more
+; distinct subterms than the (smallest possible) rewrite cache holds.
+(set-logic QF_UF)
+(set-info :status unsat)
+(declare-sort U 0)
+(declare-fun f (U U) U)
+(declare-fun x () U)
+(declare-fun y () U)
+(define-fun a0 () U (f x y))
+(define-fun a1 () U (f a0 (ite (= a0 x) x a0)))
+(define-fun a2 () U (f a1 (ite (= a1 x) x a1)))
+(define-fun a3 () U (f a2 (ite (= a2 x) x a2)))
+(define-fun a4 () U (f a3 (ite (= a3 x) x a3)))
+(define-fun a5 () U (f a4 (ite (= a4 x) x a4)))
+(define-fun a6 () U (f a5 (ite (= a5 x) x a5)))
+(define-fun a7 () U (f a6 (ite (= a6 x) x a6)))
+(define-fun a8 () U (f a7 (ite (= a7 x) x a7)))
+(define-fun a9 () U (f a8 (ite (= a8 x) x a8)))
+(define-fun a10 () U (f a9 (ite (= a9 x) x a9)))
+(define-fun a11 () U (f a10 (ite (= a10 x) x a10)))
+(define-fun a12 () U (f a11 (ite (= a11 x) x a11)))
+(define-fun a13 () U (f a12 (ite (= a12 x) x a12)))
+(define-fun a14 () U (f a13 (ite (= a13 x) x a13)))
+(define-fun a15 () U (f a14 (ite (= a14 x) x a14)))
+(define-fun a16 () U (f a15 (ite (= a15 x) x a15)))
+(define-fun a17 () U (f a16 (ite (= a16 x) x a16)))
+(define-fun a18 () U (f a17 (ite (= a17 x) x a17)))
+(define-fun a19 () U (f a18 (ite (= a18 x) x a18)))
+(define-fun a20 () U (f a19 (ite (= a19 x) x a19)))
+(define-fun a21 () U (f a20 (ite (= a20 x) x a20)))
+(define-fun a22 () U (f a21 (ite (= a21 x) x a21)))
+(define-fun a23 () U (f a22 (ite (= a22 x) x a22)))
+(define-fun a24 () U (f a23 (ite (= a23 x) x a23)))
+(define-fun a25 () U (f a24 (ite (= a24 x) x a24)))
+(define-fun a26 () U (f a25 (ite (= a25 x) x a25)))
+(define-fun a27 () U (f a26 (ite (= a26 x) x a26)))
+(define-fun a28 () U (f a27 (ite (= a27 x) x a27)))
+(define-fun a29 () U (f a28 (ite (= a28 x) x a28)))
+(define-fun a30 () U (f a29 (ite (= a29 x) x a29)))
+(define-fun a31 () U (f a30 (ite (= a30 x) x a30)))
+(define-fun a32 () U (f a31 (ite (= a31 x) x a31)))
+(define-fun a33 () U (f a32 (ite (= a32 x) x a32)))
+(define-fun a34 () U (f a33 (ite (= a33 x) x a33)))
+(define-fun a35 () U (f a34 (ite (= a34 x) x a34)))
+(define-fun a36 () U (f a35 (ite (= a35 x) x a35)))
+(define-fun a37 () U (f a36 (ite (= a36 x) x a36)))
+(define-fun a38 () U (f a37 (ite (= a37 x) x a37)))
+(define-fun a39 () U (f a38 (ite (= a38 x) x a38)))
+(define-fun a40 () U (f a39 (ite (= a39 x) x a39)))
+(define-fun a41 () U (f a40 (ite (= a40 x) x a40)))
+(define-fun a42 () U (f a41 (ite (= a41 x) x a41)))
+(define-fun a43 () U (f a42 (ite (= a42 x) x a42)))
+(define-fun a44 () U (f a43 (ite (= a43 x) x a43)))
+(define-fun a45 () U (f a44 (ite (= a44 x) x a44)))
+(define-fun a46 () U (f a45 (ite (= a45 x) x a45)))
+(define-fun a47 () U (f a46 (ite (= a46 x) x a46)))
+(define-fun a48 () U (f a47 (ite (= a47 x) x a47)))
+(define-fun a49 () U (f a48 (ite (= a48 x) x a48)))
+(define-fun a50 () U (f a49 (ite (= a49 x) x a49)))
+(define-fun a51 () U (f a50 (ite (= a50 x) x a50)))
+(define-fun a52 () U (f a51 (ite (= a51 x) x a51)))
+(define-fun a53 () U (f a52 (ite (= a52 x) x a52)))
+(define-fun a54 () U (f a53 (ite (= a53 x) x a53)))
+(define-fun a55 () U (f a54 (ite (= a54 x) x a54)))
+(define-fun a56 () U (f a55 (ite (= a55 x) x a55)))
+(define-fun a57 () U (f a56 (ite (= a56 x) x a56)))
+(define-fun a58 () U (f a57 (ite (= a57 x) x a57)))
+(define-fun a59 () U (f a58 (ite (= a58 x) x a58)))
+(define-fun a60 () U (f a59 (ite (= a59 x) x a59)))
+(define-fun a61 () U (f a60 (ite (= a60 x) x a60)))
+(define-fun a62 () U (f a61 (ite (= a61 x) x a61)))
+(define-fun a63 () U (f a62 (ite (= a62 x) x a62)))
+(define-fun a64 () U (f a63 (ite (= a63 x) x a63)))
+(define-fun a65 () U (f a64 (ite (= a64 x) x a64)))
+(define-fun a66 () U (f a65 (ite (= a65 x) x a65)))
+(define-fun a67 () U (f a66 (ite (= a66 x) x a66)))
+(define-fun a68 () U (f a67 (ite (= a67 x) x a67)))
+(define-fun a69 () U (f a68 (ite (= a68 x) x a68)))
+(define-fun a70 () U (f a69 (ite (= a69 x) x a69)))
+(define-fun a71 () U (f a70 (ite (= a70 x) x a70)))
+(define-fun a72 () U (f a71 (ite (= a71 x) x a71)))
+(define-fun a73 () U (f a72 (ite (= a72 x) x a72)))
+(define-fun a74 () U (f a73 (ite (= a73 x) x a73)))
+(define-fun a75 () U (f a74 (ite (= a74 x) x a74)))
+(define-fun a76 () U (f a75 (ite (= a75 x) x a75)))
+(define-fun a77 () U (f a76 (ite (= a76 x) x a76)))
+(define-fun a78 () U (f a77 (ite (= a77 x) x a77)))
+(define-fun a79 () U (f a78 (ite (= a78 x) x a78)))
+(define-fun a80 () U (f a79 (ite (= a79 x) x a79)))
+(define-fun a81 () U (f a80 (ite (= a80 x) x a80)))
+(define-fun a82 () U (f a81 (ite (= a81 x) x a81)))
+(define-fun a83 () U (f a82 (ite (= a82 x) x a82)))
+(define-fun a84 () U (f a83 (ite (= a83 x) x a83)))
+(define-fun a85 () U (f a84 (ite (= a84 x) x a84)))
+(define-fun a86 () U (f a85 (ite (= a85 x) x a85)))
+(define-fun a87 () U (f a86 (ite (= a86 x) x a86)))
+(define-fun a88 () U (f a87 (ite (= a87 x) x a87)))
+(define-fun a89 () U (f a88 (ite (= a88 x) x a88)))
+(define-fun a90 () U (f a89 (ite (= a89 x) x a89)))
+(define-fun a91 () U (f a90 (ite (= a90 x) x a90)))
+(define-fun a92 () U (f a91 (ite (= a91 x) x a91)))
+(define-fun a93 () U (f a92 (ite (= a92 x) x a92)))
+(define-fun a94 () U (f a93 (ite (= a93 x) x a93)))
+(define-fun a95 () U (f a94 (ite (= a94 x) x a94)))
+(define-fun a96 () U (f a95 (ite (= a95 x) x a95)))
+(define-fun a97 () U (f a96 (ite (= a96 x) x a96)))
+(define-fun a98 () U (f a97 (ite (= a97 x) x a97)))
+(define-fun a99 () U (f a98 (ite (= a98 x) x a98)))
+(define-fun a100 () U (f a99 (ite (= a99 x) x a99)))
+(define-fun a101 () U (f a100 (ite (= a100 x) x a100)))
+(define-fun a102 () U (f a101 (ite (= a101 x) x a101)))
+(define-fun a103 () U (f a102 (ite (= a102 x) x a102)))
+(define-fun a104 () U (f a103 (ite (= a103 x) x a103)))
+(define-fun a105 () U (f a104 (ite (= a104 x) x a104)))
+(define-fun a106 () U (f a105 (ite (= a105 x) x a105)))
+(define-fun a107 () U (f a106 (ite (= a106 x) x a106)))
+(define-fun a108 () U (f a107 (ite (= a107 x) x a107)))
+(define-fun a109 () U (f a108 (ite (= a108 x) x a108)))
+(define-fun a110 () U (f a109 (ite (= a109 x) x a109)))
+(define-fun a111 () U (f a110 (ite (= a110 x) x a110)))
+(define-fun a112 () U (f a111 (ite (= a111 x) x a111)))
+(define-fun a113 () U (f a112 (ite (= a112 x) x a112)))
+(define-fun a114 () U (f a113 (ite (= a113 x) x a113)))
+(define-fun a115 () U (f a114 (ite (= a114 x) x a114)))
+(define-fun a116 () U (f a115 (ite (= a115 x) x a115)))
+(define-fun a117 () U (f a116 (ite (= a116 x) x a116)))
+(define-fun a118 () U (f a117 (ite (= a117 x) x a117)))
+(define-fun a119 () U (f a118 (ite (= a118 x) x a118)))
+(define-fun a120 () U (f a119 (ite (= a119 x) x a119)))
+(define-fun a121 () U (f a120 (ite (= a120 x) x a120)))
+(define-fun a122 () U (f a121 (ite (= a121 x) x a121)))
+(define-fun a123 () U (f a122 (ite (= a122 x) x a122)))
+(define-fun a124 () U (f a123 (ite (= a123 x) x a123)))
+(define-fun a125 () U (f a124 (ite (= a124 x) x a124)))
+(define-fun a126 () U (f a125 (ite (= a125 x) x a125)))
+(define-fun a127 () U (f a126 (ite (= a126 x) x a126)))
+(define-fun a128 () U (f a127 (ite (= a127 x) x a127)))
+(define-fun a129 () U (f a128 (ite (= a128 x) x a128)))
+(define-fun a130 () U (f a129 (ite (= a129 x) x a129)))
+(define-fun a131 () U (f a130 (ite (= a130 x) x a130)))
+(define-fun a132 () U (f a131 (ite (= a131 x) x a131)))
+(define-fun a133 () U (f a132 (ite (= a132 x) x a132)))
+(define-fun a134 () U (f a133 (ite (= a133 x) x a133)))
+(define-fun a135 () U (f a134 (ite (= a134 x) x a134)))
+(define-fun a136 () U (f a135 (ite (= a135 x) x a135)))
+(define-fun a137 () U (f a136 (ite (= a136 x) x a136)))
+(define-fun a138 () U (f a137 (ite (= a137 x) x a137)))
+(define-fun a139 () U (f a138 (ite (= a138 x) x a138)))
+(define-fun a140 () U (f a139 (ite (= a139 x) x a139)))
+(define-fun a141 () U (f a140 (ite (= a140 x) x a140)))
+(define-fun a142 () U (f a141 (ite (= a141 x) x a141)))
+(define-fun a143 () U (f a142 (ite (= a142 x) x a142)))
+(define-fun a144 () U (f a143 (ite (= a143 x) x a143)))
+(define-fun a145 () U (f a144 (ite (= a144 x) x a144)))
+(define-fun a146 () U (f a145 (ite (= a145 x) x a145)))
+(define-fun a147 () U (f a146 (ite (= a146 x) x a146)))
+(define-fun a148 () U (f a147 (ite (= a147 x) x a147)))
+(define-fun a149 () U (f a148 (ite (= a148 x) x a148)))
+(define-fun a150 () U (f a149 (ite (= a149 x) x a149)))
+(define-fun a151 () U (f a150 (ite (= a150 x) x a150)))
+(define-fun a152 () U (f a151 (ite (= a151 x) x a151)))
+(define-fun a153 () U (f a152 (ite (= a152 x) x a152)))
+(define-fun a154 () U (f a153 (ite (= a153 x) x a153)))
+(define-fun a155 () U (f a154 (ite (= a154 x) x a154)))
+(define-fun a156 () U (f a155 (ite (= a155 x) x a155)))
+(define-fun a157 () U (f a156 (ite (= a156 x) x a156)))
+(define-fun a158 () U (f a157 (ite (= a157 x) x a157)))
+(define-fun a159 () U (f a158 (ite (= a158 x) x a158)))
+(define-fun a160 () U (f a159 (ite (= a159 x) x a159)))
+(define-fun a161 () U (f a160 (ite (= a160 x) x a160)))
+(define-fun a162 () U (f a161 (ite (= a161 x) x a161)))
+(define-fun a163 () U (f a162 (ite (= a162 x) x a162)))
+(define-fun a164 () U (f a163 (ite (= a163 x) x a163)))
+(define-fun a165 () U (f a164 (ite (= a164 x) x a164)))
+(define-fun a166 () U (f a165 (ite (= a165 x) x a165)))
+(define-fun a167 () U (f a166 (ite (= a166 x) x a166)))
+(define-fun a168 () U (f a167 (ite (= a167 x) x a167)))
+(define-fun a169 () U (f a168 (ite (= a168 x) x a168)))
+(define-fun a170 () U (f a169 (ite (= a169 x) x a169)))
+(define-fun a171 () U (f a170 (ite (= a170 x) x a170)))
+(define-fun a172 () U (f a171 (ite (= a171 x) x a171)))
+(define-fun a173 () U (f a172 (ite (= a172 x) x a172)))
+(define-fun a174 () U (f a173 (ite (= a173 x) x a173)))
+(define-fun a175 () U (f a174 (ite (= a174 x) x a174)))
+(define-fun a176 () U (f a175 (ite (= a175 x) x a175)))
+(define-fun a177 () U (f a176 (ite (= a176 x) x a176)))
+(define-fun a178 () U (f a177 (ite (= a177 x) x a177)))
+(define-fun a179 () U (f a178 (ite (= a178 x) x a178)))
+(define-fun a180 () U (f a179 (ite (= a179 x) x a179)))
+(define-fun a181 () U (f a180 (ite (= a180 x) x a180)))
+(define-fun a182 () U (f a181 (ite (= a181 x) x a181)))
+(define-fun a183 () U (f a182 (ite (= a182 x) x a182)))
+(define-fun a184 () U (f a183 (ite (= a183 x) x a183)))
+(define-fun a185 () U (f a184 (ite (= a184 x) x a184)))
+(define-fun a186 () U (f a185 (ite (= a185 x) x a185)))
+(define-fun a187 () U (f a186 (ite (= a186 x) x a186)))
+(define-fun a188 () U (f a187 (ite (= a187 x) x a187)))
+(define-fun a189 () U (f a188 (ite (= a188 x) x a188)))
+(define-fun a190 () U (f a189 (ite (= a189 x) x a189)))
+(define-fun a191 () U (f a190 (ite (= a190 x) x a190)))
+(define-fun a192 () U (f a191 (ite (= a191 x) x a191)))
+(define-fun a193 () U (f a192 (ite (= a192 x) x a192)))
+(define-fun a194 () U (f a193 (ite (= a193 x) x a193)))
+(define-fun a195 () U (f a194 (ite (= a194 x) x a194)))
+(define-fun a196 () U (f a195 (ite (= a195 x) x a195)))
+(define-fun a197 () U (f a196 (ite (= a196 x) x a196)))
+(define-fun a198 () U (f a197 (ite (= a197 x) x a197)))
+(define-fun a199 () U (f a198 (ite (= a198 x) x a198)))
+(define-fun a200 () U (f a199 (ite (= a199 x) x a199)))
+(define-fun a201 () U (f a200 (ite (= a200 x) x a200)))
+(define-fun a202 () U (f a201 (ite (= a201 x) x a201)))
+(define-fun a203 () U (f a202 (ite (= a202 x) x a202)))
+(define-fun a204 () U (f a203 (ite (= a203 x) x a203)))
+(define-fun a205 () U (f a204 (ite (= a204 x) x a204)))
+(define-fun a206 () U (f a205 (ite (= a205 x) x a205)))
+(define-fun a207 () U (f a206 (ite (= a206 x) x a206)))
+(define-fun a208 () U (f a207 (ite (= a207 x) x a207)))
+(define-fun a209 () U (f a208 (ite (= a208 x) x a208)))
+(define-fun a210 () U (f a209 (ite (= a209 x) x a209)))
+(define-fun a211 () U (f a210 (ite (= a210 x) x a210)))
+(define-fun a212 () U (f a211 (ite (= a211 x) x a211)))
+(define-fun a213 () U (f a212 (ite (= a212 x) x a212)))
+(define-fun a214 () U (f a213 (ite (= a213 x) x a213)))
+(define-fun a215 () U (f a214 (ite (= a214 x) x a214)))
+(define-fun a216 () U (f a215 (ite (= a215 x) x a215)))
+(define-fun a217 () U (f a216 (ite (= a216 x) x a216)))
+(define-fun a218 () U (f a217 (ite (= a217 x) x a217)))
+(define-fun a219 () U (f a218 (ite (= a218 x) x a218)))
+(define-fun a220 () U (f a219 (ite (= a219 x) x a219)))
+(define-fun a221 () U (f a220 (ite (= a220 x) x a220)))
+(define-fun a222 () U (f a221 (ite (= a221 x) x a221)))
+(define-fun a223 () U (f a222 (ite (= a222 x) x a222)))
+(define-fun a224 () U (f a223 (ite (= a223 x) x a223)))
+(define-fun a225 () U (f a224 (ite (= a224 x) x a224)))
+(define-fun a226 () U (f a225 (ite (= a225 x) x a225)))
+(define-fun a227 () U (f a226 (ite (= a226 x) x a226)))
+(define-fun a228 () U (f a227 (ite (= a227 x) x a227)))
+(define-fun a229 () U (f a228 (ite (= a228 x) x a228)))
+(define-fun a230 () U (f a229 (ite (= a229 x) x a229)))
+(define-fun a231 () U (f a230 (ite (= a230 x) x a230)))
+(define-fun a232 () U (f a231 (ite (= a231 x) x a231)))
+(define-fun a233 () U (f a232 (ite (= a232 x) x a232)))
+(define-fun a234 () U (f a233 (ite (= a233 x) x a233)))
+(define-fun a235 () U (f a234 (ite (= a234 x) x a234)))
+(define-fun a236 () U (f a235 (ite (= a235 x) x a235)))
+(define-fun a237 () U (f a236 (ite (= a236 x) x a236)))
+(define-fun a238 () U (f a237 (ite (= a237 x) x a237)))
+(define-fun a239 () U (f a238 (ite (= a238 x) x a238)))
+(define-fun a240 () U (f a239 (ite (= a239 x) x a239)))
+(define-fun a241 () U (f a240 (ite (= a240 x) x a240)))
+(define-fun a242 () U (f a241 (ite (= a241 x) x a241)))
+(define-fun a243 () U (f a242 (ite (= a242 x) x a242)))
+(define-fun a244 () U (f a243 (ite (= a243 x) x a243)))
+(define-fun a245 () U (f a244 (ite (= a244 x) x a244)))
+(define-fun a246 () U (f a245 (ite (= a245 x) x a245)))
+(define-fun a247 () U (f a246 (ite (= a246 x) x a246)))
+(define-fun a248 () U (f a247 (ite (= a247 x) x a247)))
+(define-fun a249 () U (f a248 (ite (= a248 x) x a248)))
+(define-fun a250 () U (f a249 (ite (= a249 x) x a249)))
+(define-fun a251 () U (f a250 (ite (= a250 x) x a250)))
+(define-fun a252 () U (f a251 (ite (= a251 x) x a251)))
+(define-fun a253 () U (f a252 (ite (= a252 x) x a252)))
+(define-fun a254 () U (f a253 (ite (= a253 x) x a253)))
+(define-fun a255 () U (f a254 (ite (= a254 x) x a254)))
+(define-fun a256 () U (f a255 (ite (= a255 x) x a255)))
+(define-fun a257 () U (f a256 (ite (= a256 x) x a256)))
+(define-fun a258 () U (f a257 (ite (= a257 x) x a257)))
+(define-fun a259 () U (f a258 (ite (= a258 x) x a258)))
+(define-fun a260 () U (f a259 (ite (= a259 x) x a259)))
+(define-fun a261 () U (f a260 (ite (= a260 x) x a260)))
+(define-fun a262 () U (f a261 (ite (= a261 x) x a261)))
+(define-fun a263 () U (f a262 (ite (= a262 x) x a262)))
+(define-fun a264 () U (f a263 (ite (= a263 x) x a263)))
+(define-fun a265 () U (f a264 (ite (= a264 x) x a264)))
+(define-fun a266 () U (f a265 (ite (= a265 x) x a265)))
+(define-fun a267 () U (f a266 (ite (= a266 x) x a266)))
+(define-fun a268 () U (f a267 (ite (= a267 x) x a267)))
+(define-fun a269 () U (f a268 (ite (= a268 x) x a268)))
+(define-fun a270 () U (f a269 (ite (= a269 x) x a269)))
+(define-fun a271 () U (f a270 (ite (= a270 x) x a270)))
+(define-fun a272 () U (f a271 (ite (= a271 x) x a271)))
+(define-fun a273 () U (f a272 (ite (= a272 x) x a272)))
+(define-fun a274 () U (f a273 (ite (= a273 x) x a273)))
+(define-fun a275 () U (f a274 (ite (= a274 x) x a274)))
+(define-fun a276 () U (f a275 (ite (= a275 x) x a275)))
+(define-fun a277 () U (f a276 (ite (= a276 x) x a276)))
+(define-fun a278 () U (f a277 (ite (= a277 x) x a277)))
+(define-fun a279 () U (f a278 (ite (= a278 x) x a278)))
+(define-fun a280 () U (f a279 (ite (= a279 x) x a279)))
+(define-fun a281 () U (f a280 (ite (= a280 x) x a280)))
+(define-fun a282 () U (f a281 (ite (= a281 x) x a281)))
+(define-fun a283 () U (f a282 (ite (= a282 x) x a282)))
+(define-fun a284 () U (f a283 (ite (= a283 x) x a283)))
+(define-fun a285 () U (f a284 (ite (= a284 x) x a284)))
+(define-fun a286 () U (f a285 (ite (= a285 x) x a285)))
+(define-fun a287 () U (f a286 (ite (= a286 x) x a286)))
+(define-fun a288 () U (f a287 (ite (= a287 x) x a287)))
+(define-fun a289 () U (f a288 (ite (= a288 x) x a288)))
+(define-fun a290 () U (f a289 (ite (= a289 x) x a289)))
+(define-fun a291 () U (f a290 (ite (= a290 x) x a290)))
+(define-fun a292 () U (f a291 (ite (= a291 x) x a291)))
+(define-fun a293 () U (f a292 (ite (= a292 x) x a292)))
+(define-fun a294 () U (f a293 (ite (= a293 x) x a293)))
+(define-fun a295 () U (f a294 (ite (= a294 x) x a294)))
+(define-fun a296 () U (f a295 (ite (= a295 x) x a295)))
+(define-fun a297 () U (f a296 (ite (= a296 x) x a296)))
+(define-fun a298 () U (f a297 (ite (= a297 x) x a297)))
+(define-fun a299 () U (f a298 (ite (= a298 x) x a298)))
+(define-fun a300 () U (f a299 (ite (= a299 x) x a299)))
+(define-fun a301 () U (f a300 (ite (= a300 x) x a300)))
+(define-fun a302 () U (f a301 (ite (= a301 x) x a301)))
+(define-fun a303 () U (f a302 (ite (= a302 x) x a302)))
+(define-fun a304 () U (f a303 (ite (= a303 x) x a303)))
+(define-fun a305 () U (f a304 (ite (= a304 x) x a304)))
+(define-fun a306 () U (f a305 (ite (= a305 x) x a305)))
+(define-fun a307 () U (f a306 (ite (= a306 x) x a306)))
+(define-fun a308 () U (f a307 (ite (= a307 x) x a307)))
+(define-fun a309 () U (f a308 (ite (= a308 x) x a308)))
+(define-fun a310 () U (f a309 (ite (= a309 x) x a309)))
+(define-fun a311 () U (f a310 (ite (= a310 x) x a310)))
+(define-fun a312 () U (f a311 (ite (= a311 x) x a311)))
+(define-fun a313 () U (f a312 (ite (= a312 x) x a312)))
+(define-fun a314 () U (f a313 (ite (= a313 x) x a313)))
+(define-fun a315 () U (f a314 (ite (= a314 x) x a314)))
+(define-fun a316 () U (f a315 (ite (= a315 x) x a315)))
+(define-fun a317 () U (f a316 (ite (= a316 x) x a316)))
+(define-fun a318 () U (f a317 (ite (= a317 x) x a317)))
+(define-fun a319 () U (f a318 (ite (= a318 x) x a318)))
+(define-fun a320 () U (f a319 (ite (= a319 x) x a319)))
+(define-fun a321 () U (f a320 (ite (= a320 x) x a320)))
+(define-fun a322 () U (f a321 (ite (= a321 x) x a321)))
+(define-fun a323 () U (f a322 (ite (= a322 x) x a322)))
+(define-fun a324 () U (f a323 (ite (= a323 x) x a323)))
+(define-fun a325 () U (f a324 (ite (= a324 x) x a324)))
+(define-fun a326 () U (f a325 (ite (= a325 x) x a325)))
+(define-fun a327 () U (f a326 (ite (= a326 x) x a326)))
+(define-fun a328 () U (f a327 (ite (= a327 x) x a327)))
+(define-fun a329 () U (f a328 (ite (= a328 x) x a328)))
+(define-fun a330 () U (f a329 (ite (= a329 x) x a329)))
+(define-fun a331 () U (f a330 (ite (= a330 x) x a330)))
+(define-fun a332 () U (f a331 (ite (= a331 x) x a331)))
+(define-fun a333 () U (f a332 (ite (= a332 x) x a332)))
+(define-fun a334 () U (f a333 (ite (= a333 x) x a333)))
+(define-fun a335 () U (f a334 (ite (= a334 x) x a334)))
+(define-fun a336 () U (f a335 (ite (= a335 x) x a335)))
+(define-fun a337 () U (f a336 (ite (= a336 x) x a336)))
+(define-fun a338 () U (f a337 (ite (= a337 x) x a337)))
+(define-fun a339 () U (f a338 (ite (= a338 x) x a338)))
+(define-fun a340 () U (f a339 (ite (= a339 x) x a339)))
+(define-fun a341 () U (f a340 (ite (= a340 x) x a340)))
+(define-fun a342 () U (f a341 (ite (= a341 x) x a341)))
+(define-fun a343 () U (f a342 (ite (= a342 x) x a342)))
+(define-fun a344 () U (f a343 (ite (= a343 x) x a343)))
+(define-fun a345 () U (f a344 (ite (= a344 x) x a344)))
+(define-fun a346 () U (f a345 (ite (= a345 x) x a345)))
+(define-fun a347 () U (f a346 (ite (= a346 x) x a346)))
+(define-fun a348 () U (f a347 (ite (= a347 x) x a347)))
+(define-fun a349 () U (f a348 (ite (= a348 x) x a348)))
+(define-fun a350 () U (f a349 (ite (= a349 x) x a349)))
+(define-fun a351 () U (f a350 (ite (= a350 x) x a350)))
+(define-fun a352 () U (f a351 (ite (= a351 x) x a351)))
+(define-fun a353 () U (f a352 (ite (= a352 x) x a352)))
+(define-fun a354 () U (f a353 (ite (= a353 x) x a353)))
+(define-fun a355 () U (f a354 (ite (= a354 x) x a354)))
+(define-fun a356 () U (f a355 (ite (= a355 x) x a355)))
+(define-fun a357 () U (f a356 (ite (= a356 x) x a356)))
+(define-fun a358 () U (f a357 (ite (= a357 x) x a357)))
+(define-fun a359 () U (f a358 (ite (= a358 x) x a358)))
+(define-fun a360 () U (f a359 (ite (= a359 x) x a359)))
+(define-fun a361 () U (f a360 (ite (= a360 x) x a360)))
+(define-fun a362 () U (f a361 (ite (= a361 x) x a361)))
+(define-fun a363 () U (f a362 (ite (= a362 x) x a362)))
+(define-fun a364 () U (f a363 (ite (= a363 x) x a363)))
+(define-fun a365 () U (f a364 (ite (= a364 x) x a364)))
+(define-fun a366 () U (f a365 (ite (= a365 x) x a365)))
+(define-fun a367 () U (f a366 (ite (= a366 x) x a366)))
+(define-fun a368 () U (f a367 (ite (= a367 x) x a367)))
+(define-fun a369 () U (f a368 (ite (= a368 x) x a368)))
+(define-fun a370 () U (f a369 (ite (= a369 x) x a369)))
+(define-fun a371 () U (f a370 (ite (= a370 x) x a370)))
+(define-fun a372 () U (f a371 (ite (= a371 x) x a371)))
+(define-fun a373 () U (f a372 (ite (= a372 x) x a372)))
+(define-fun a374 () U (f a373 (ite (= a373 x) x a373)))
+(define-fun a375 () U (f a374 (ite (= a374 x) x a374)))
+(define-fun a376 () U (f a375 (ite (= a375 x) x a375)))
+(define-fun a377 () U (f a376 (ite (= a376 x) x a376)))
+(define-fun a378 () U (f a377 (ite (= a377 x) x a377)))
+(define-fun a379 () U (f a378 (ite (= a378 x) x a378)))
+(define-fun a380 () U (f a379 (ite (= a379 x) x a379)))
+(define-fun a381 () U (f a380 (ite (= a380 x) x a380)))
+(define-fun a382 () U (f a381 (ite (= a381 x) x a381)))
+(define-fun a383 () U (f a382 (ite (= a382 x) x a382)))
+(define-fun a384 () U (f a383 (ite (= a383 x) x a383)))
+(define-fun a385 () U (f a384 (ite (= a384 x) x a384)))
+(define-fun a386 () U (f a385 (ite (= a385 x) x a385)))
+(define-fun a387 () U (f a386 (ite (= a386 x) x a386)))
+(define-fun a388 () U (f a387 (ite (= a387 x) x a387)))
+(define-fun a389 () U (f a388 (ite (= a388 x) x a388)))
+(define-fun a390 () U (f a389 (ite (= a389 x) x a389)))
+(define-fun a391 () U (f a390 (ite (= a390 x) x a390)))
+(define-fun a392 () U (f a391 (ite (= a391 x) x a391)))
+(define-fun a393 () U (f a392 (ite (= a392 x) x a392)))
+(define-fun a394 () U (f a393 (ite (= a393 x) x a393)))
+(define-fun a395 () U (f a394 (ite (= a394 x) x a394)))
+(define-fun a396 () U (f a395 (ite (= a395 x) x a395)))
+(define-fun a397 () U (f a396 (ite (= a396 x) x a396)))
+(define-fun a398 () U (f a397 (ite (= a397 x) x a397)))
+(define-fun a399 () U (f a398 (ite (= a398 x) x a398)))
+(define-fun a400 () U (f a399 (ite (= a399 x) x a399)))
+(define-fun a401 () U (f a400 (ite (= a400 x) x a400)))
+(define-fun a402 () U (f a401 (ite (= a401 x) x a401)))
+(define-fun a403 () U (f a402 (ite (= a402 x) x a402)))
+(define-fun a404 () U (f a403 (ite (= a403 x) x a403)))
+(define-fun a405 () U (f a404 (ite (= a404 x) x a404)))
+(define-fun a406 () U (f a405 (ite (= a405 x) x a405)))
+(define-fun a407 () U (f a406 (ite (= a406 x) x a406)))
+(define-fun a408 () U (f a407 (ite (= a407 x) x a407)))
+(define-fun a409 () U (f a408 (ite (= a408 x) x a408)))
+(define-fun a410 () U (f a409 (ite (= a409 x) x a409)))
+(define-fun a411 () U (f a410 (ite (= a410 x) x a410)))
+(define-fun a412 () U (f a411 (ite (= a411 x) x a411)))
+(define-fun a413 () U (f a412 (ite (= a412 x) x a412)))
+(define-fun a414 () U (f a413 (ite (= a413 x) x a413)))
+(define-fun a415 () U (f a414 (ite (= a414 x) x a414)))
+(define-fun a416 () U (f a415 (ite (= a415 x) x a415)))
+(define-fun a417 () U (f a416 (ite (= a416 x) x a416)))
+(define-fun a418 () U (f a417 (ite (= a417 x) x a417)))
+(define-fun a419 () U (f a418 (ite (= a418 x) x a418)))
+(define-fun a420 () U (f a419 (ite (= a419 x) x a419)))
+(define-fun a421 () U (f a420 (ite (= a420 x) x a420)))
+(define-fun a422 () U (f a421 (ite (= a421 x) x a421)))
+(define-fun a423 () U (f a422 (ite (= a422 x) x a422)))
+(define-fun a424 () U (f a423 (ite (= a423 x) x a423)))
+(define-fun a425 () U (f a424 (ite (= a424 x) x a424)))
+(define-fun a426 () U (f a425 (ite (= a425 x) x a425)))
+(define-fun a427 () U (f a426 (ite (= a426 x) x a426)))
+(define-fun a428 () U (f a427 (ite (= a427 x) x a427)))
+(define-fun a429 () U (f a428 (ite (= a428 x) x a428)))
+(define-fun a430 () U (f a429 (ite (= a429 x) x a429)))
+(define-fun a431 () U (f a430 (ite (= a430 x) x a430)))
+(define-fun a432 () U (f a431 (ite (= a431 x) x a431)))
+(define-fun a433 () U (f a432 (ite (= a432 x) x a432)))
+(define-fun a434 () U (f a433 (ite (= a433 x) x a433)))
+(define-fun a435 () U (f a434 (ite (= a434 x) x a434)))
+(define-fun a436 () U (f a435 (ite (= a435 x) x a435)))
+(define-fun a437 () U (f a436 (ite (= a436 x) x a436)))
+(define-fun a438 () U (f a437 (ite (= a437 x) x a437)))
+(define-fun a439 () U (f a438 (ite (= a438 x) x a438)))
+(define-fun a440 () U (f a439 (ite (= a439 x) x a439)))
+(define-fun a441 () U (f a440 (ite (= a440 x) x a440)))
+(define-fun a442 () U (f a441 (ite (= a441 x) x a441)))
+(define-fun a443 () U (f a442 (ite (= a442 x) x a442)))
+(define-fun a444 () U (f a443 (ite (= a443 x) x a443)))
+(define-fun a445 () U (f a444 (ite (= a444 x) x a444)))
+(define-fun a446 () U (f a445 (ite (= a445 x) x a445)))
+(define-fun a447 () U (f a446 (ite (= a446 x) x a446)))
+(define-fun a448 () U (f a447 (ite (= a447 x) x a447)))
+(define-fun a449 () U (f a448 (ite (= a448 x) x a448)))
+(define-fun a450 () U (f a449 (ite (= a449 x) x a449)))
+(define-fun a451 () U (f a450 (ite (= a450 x) x a450)))
+(define-fun a452 () U (f a451 (ite (= a451 x) x a451)))
+(define-fun a453 () U (f a452 (ite (= a452 x) x a452)))
+(define-fun a454 () U (f a453 (ite (= a453 x) x a453)))
+(define-fun a455 () U (f a454 (ite (= a454 x) x a454)))
+(define-fun a456 () U (f a455 (ite (= a455 x) x a455)))
+(define-fun a457 () U (f a456 (ite (= a456 x) x a456)))
+(define-fun a458 () U (f a457 (ite (= a457 x) x a457)))
+(define-fun a459 () U (f a458 (ite (= a458 x) x a458)))
+(define-fun a460 () U (f a459 (ite (= a459 x) x a459)))
+(define-fun a461 () U (f a460 (ite (= a460 x) x a460)))
+(define-fun a462 () U (f a461 (ite (= a461 x) x a461)))
+(define-fun a463 () U (f a462 (ite (= a462 x) x a462)))
+(define-fun a464 () U (f a463 (ite (= a463 x) x a463)))
+(define-fun a465 () U (f a464 (ite (= a464 x) x a464)))
+(define-fun a466 () U (f a465 (ite (= a465 x) x a465)))
+(define-fun a467 () U (f a466 (ite (= a466 x) x a466)))
+(define-fun a468 () U (f a467 (ite (= a467 x) x a467)))
+(define-fun a469 () U (f a468 (ite (= a468 x) x a468)))
+(define-fun a470 () U (f a469 (ite (= a469 x) x a469)))
+(define-fun a471 () U (f a470 (ite (= a470 x) x a470)))
+(define-fun a472 () U (f a471 (ite (= a471 x) x a471)))
+(define-fun a473 () U (f a472 (ite (= a472 x) x a472)))
+(define-fun a474 () U (f a473 (ite (= a473 x) x a473)))
+(define-fun a475 () U (f a474 (ite (= a474 x) x a474)))
+(define-fun a476 () U (f a475 (ite (= a475 x) x a475)))
+(define-fun a477 () U (f a476 (ite (= a476 x) x a476)))
+(define-fun a478 () U (f a477 (ite (= a477 x) x a477)))
+(define-fun a479 () U (f a478 (ite (= a478 x) x a478)))
+(define-fun a480 () U (f a479 (ite (= a479 x) x a479)))
+(define-fun a481 () U (f a480 (ite (= a480 x) x a480)))
+(define-fun a482 () U (f a481 (ite (= a481 x) x a481)))
+(define-fun a483 () U (f a482 (ite (= a482 x) x a482)))
+(define-fun a484 () U (f a483 (ite (= a483 x) x a483)))
+(define-fun a485 () U (f a484 (ite (= a484 x) x a484)))
+(define-fun a486 () U (f a485 (ite (= a485 x) x a485)))
+(define-fun a487 () U (f a486 (ite (= a486 x) x a486)))
+(define-fun a488 () U (f a487 (ite (= a487 x) x a487)))
+(define-fun a489 () U (f a488 (ite (= a488 x) x a488)))
+(define-fun a490 () U (f a489 (ite (= a489 x) x a489)))
+(define-fun a491 () U (f a490 (ite (= a490 x) x a490)))
+(define-fun a492 () U (f a491 (ite (= a491 x) x a491)))
+(define-fun a493 () U (f a492 (ite (= a492 x) x a492)))
+(define-fun a494 () U (f a493 (ite (= a493 x) x a493)))
+(define-fun a495 () U (f a494 (ite (= a494 x) x a494)))
+(define-fun a496 () U (f a495 (ite (= a495 x) x a495)))
+(define-fun a497 () U (f a496 (ite (= a496 x) x a496)))
+(define-fun a498 () U (f a497 (ite (= a497 x) x a497)))
+(define-fun a499 () U (f a498 (ite (= a498 x) x a498)))
+(define-fun a500 () U (f a499 (ite (= a499 x) x a499)))
+(define-fun a501 () U (f a500 (ite (= a500 x) x a500)))
+(define-fun a502 () U (f a501 (ite (= a501 x) x a501)))
+(define-fun a503 () U (f a502 (ite (= a502 x) x a502)))
+(define-fun a504 () U (f a503 (ite (= a503 x) x a503)))
+(define-fun a505 () U (f a504 (ite (= a504 x) x a504)))
+(define-fun a506 () U (f a505 (ite (= a505 x) x a505)))
+(define-fun a507 () U (f a506 (ite (= a506 x) x a506)))
+(define-fun a508 () U (f a507 (ite (= a507 x) x a507)))
+(define-fun a509 () U (f a508 (ite (= a508 x) x a508)))
+(define-fun a510 () U (f a509 (ite (= a509 x) x a509)))
+(define-fun a511 () U (f a510 (ite (= a510 x) x a510)))
+(define-fun a512 () U (f a511 (ite (= a511 x) x a511)))
+(define-fun a513 () U (f a512 (ite (= a512 x) x a512)))
+(define-fun a514 () U (f a513 (ite (= a513 x) x a513)))
+(define-fun a515 () U (f a514 (ite (= a514 x) x a514)))
+(define-fun a516 () U (f a515 (ite (= a515 x) x a515)))
+(define-fun a517 () U (f a516 (ite (= a516 x) x a516)))
+(define-fun a518 () U (f a517 (ite (= a517 x) x a517)))
+(define-fun a519 () U (f a518 (ite (= a518 x) x a518)))
+(define-fun a520 () U (f a519 (ite (= a519 x) x a519)))
+(define-fun a521 () U (f a520 (ite (= a520 x) x a520)))
+(define-fun a522 () U (f a521 (ite (= a521 x) x a521)))
+(define-fun a523 () U (f a522 (ite (= a522 x) x a522)))
+(define-fun a524 () U (f a523 (ite (= a523 x) x a523)))
+(define-fun a525 () U (f a524 (ite (= a524 x) x a524)))
+(define-fun a526 () U (f a525 (ite (= a525 x) x a525)))
+(define-fun a527 () U (f a526 (ite (= a526 x) x a526)))
+(define-fun a528 () U (f a527 (ite (= a527 x) x a527)))
+(define-fun a529 () U (f a528 (ite (= a528 x) x a528)))
+(define-fun a530 () U (f a529 (ite (= a529 x) x a529)))
+(define-fun a531 () U (f a530 (ite (= a530 x) x a530)))
+(define-fun a532 () U (f a531 (ite (= a531 x) x a531)))
+(define-fun a533 () U (f a532 (ite (= a532 x) x a532)))
+(define-fun a534 () U (f a533 (ite (= a533 x) x a533)))
+(define-fun a535 () U (f a534 (ite (= a534 x) x a534)))
+(define-fun a536 () U (f a535 (ite (= a535 x) x a535)))
+(define-fun a537 () U (f a536 (ite (= a536 x) x a536)))
+(define-fun a538 () U (f a537 (ite (= a537 x) x a537)))
+(define-fun a539 () U (f a538 (ite (= a538 x) x a538)))
+(define-fun a540 () U (f a539 (ite (= a539 x) x a539)))
+(define-fun a541 () U (f a540 (ite (= a540 x) x a540)))
+(define-fun a542 () U (f a541 (ite (= a541 x) x a541)))
+(define-fun a543 () U (f a542 (ite (= a542 x) x a542)))
+(define-fun a544 () U (f a543 (ite (= a543 x) x a543)))
+(define-fun a545 () U (f a544 (ite (= a544 x) x a544)))
+(define-fun a546 () U (f a545 (ite (= a545 x) x a545)))
+(define-fun a547 () U (f a546 (ite (= a546 x) x a546)))
+(define-fun a548 () U (f a547 (ite (= a547 x) x a547)))
+(define-fun a549 () U (f a548 (ite (= a548 x) x a548)))
+(define-fun a550 () U (f a549 (ite (= a549 x) x a549)))
+(define-fun a551 () U (f a550 (ite (= a550 x) x a550)))
+(define-fun a552 () U (f a551 (ite (= a551 x) x a551)))
+(define-fun a553 () U (f a552 (ite (= a552 x) x a552)))
+(define-fun a554 () U (f a553 (ite (= a553 x) x a553)))
+(define-fun a555 () U (f a554 (ite (= a554 x) x a554)))
+(define-fun a556 () U (f a555 (ite (= a555 x) x a555)))
+(define-fun a557 () U (f a556 (ite (= a556 x) x a556)))
+(define-fun a558 () U (f a557 (ite (= a557 x) x a557)))
+(define-fun a559 () U (f a558 (ite (= a558 x) x a558)))
+(define-fun a560 () U (f a559 (ite (= a559 x) x a559)))
+(define-fun a561 () U (f a560 (ite (= a560 x) x a560)))
+(define-fun a562 () U (f a561 (ite (= a561 x) x a561)))
+(define-fun a563 () U (f a562 (ite (= a562 x) x a562)))
+(define-fun a564 () U (f a563 (ite (= a563 x) x a563)))
+(define-fun a565 () U (f a564 (ite (= a564 x) x a564)))
+(define-fun a566 () U (f a565 (ite (= a565 x) x a565)))
+(define-fun a567 () U (f a566 (ite (= a566 x) x a566)))
+(define-fun a568 () U (f a567 (ite (= a567 x) x a567)))
+(define-fun a569 () U (f a568 (ite (= a568 x) x a568)))
+(define-fun a570 () U (f a569 (ite (= a569 x) x a569)))
+(define-fun a571 () U (f a570 (ite (= a570 x) x a570)))
+(define-fun a572 () U (f a571 (ite (= a571 x) x a571)))
+(define-fun a573 () U (f a572 (ite (= a572 x) x a572)))
+(define-fun a574 () U (f a573 (ite (= a573 x) x a573)))
+(define-fun a575 () U (f a574 (ite (= a574 x) x a574)))
+(define-fun a576 () U (f a575 (ite (= a575 x) x a575)))
+(define-fun a577 () U (f a576 (ite (= a576 x) x a576)))
+(define-fun a578 () U (f a577 (ite (= a577 x) x a577)))
+(define-fun a579 () U (f a578 (ite (= a578 x) x a578)))
+(define-fun a580 () U (f a579 (ite (= a579 x) x a579)))
+(define-fun a581 () U (f a580 (ite (= a580 x) x a580)))
+(define-fun a582 () U (f a581 (ite (= a581 x) x a581)))
+(define-fun a583 () U (f a582 (ite (= a582 x) x a582)))
+(define-fun a584 () U (f a583 (ite (= a583 x) x a583)))
+(define-fun a585 () U (f a584 (ite (= a584 x) x a584)))
+(define-fun a586 () U (f a585 (ite (= a585 x) x a585)))
+(define-fun a587 () U (f a586 (ite (= a586 x) x a586)))
+(define-fun a588 () U (f a587 (ite (= a587 x) x a587)))
+(define-fun a589 () U (f a588 (ite (= a588 x) x a588)))
+(define-fun a590 () U (f a589 (ite (= a589 x) x a589)))
+(define-fun a591 () U (f a590 (ite (= a590 x) x a590)))
+(define-fun a592 () U (f a591 (ite (= a591 x) x a591)))
+(define-fun a593 () U (f a592 (ite (= a592 x) x a592)))
+(define-fun a594 () U (f a593 (ite (= a593 x) x a593)))
+(define-fun a595 () U (f a594 (ite (= a594 x) x a594)))
+(define-fun a596 () U (f a595 (ite (= a595 x) x a595)))
+(define-fun a597 () U (f a596 (ite (= a596 x) x a596)))
+(define-fun a598 () U (f a597 (ite (= a597 x) x a597)))
+(define-fun a599 () U (f a598 (ite (= a598 x) x a598)))
+(define-fun a600 () U (f a599 (ite (= a599 x) x a599)))
+(define-fun a601 () U (f a600 (ite (= a600 x) x a600)))
+(define-fun a602 () U (f a601 (ite (= a601 x) x a601)))
+(define-fun a603 () U (f a602 (ite (= a602 x) x a602)))
+(define-fun a604 () U (f a603 (ite (= a603 x) x a603)))
+(define-fun a605 () U (f a604 (ite (= a604 x) x a604)))
+(define-fun a606 () U (f a605 (ite (= a605 x) x a605)))
+(define-fun a607 () U (f a606 (ite (= a606 x) x a606)))
+(define-fun a608 () U (f a607 (ite (= a607 x) x a607)))
+(define-fun a609 () U (f a608 (ite (= a608 x) x a608)))
+(define-fun a610 () U (f a609 (ite (= a609 x) x a609)))
+(define-fun a611 () U (f a610 (ite (= a610 x) x a610)))
+(define-fun a612 () U (f a611 (ite (= a611 x) x a611)))
+(define-fun a613 () U (f a612 (ite (= a612 x) x a612)))
+(define-fun a614 () U (f a613 (ite (= a613 x) x a613)))
+(define-fun a615 () U (f a614 (ite (= a614 x) x a614)))
+(define-fun a616 () U (f a615 (ite (= a615 x) x a615)))
+(define-fun a617 () U (f a616 (ite (= a616 x) x a616)))
+(define-fun a618 () U (f a617 (ite (= a617 x) x a617)))
+(define-fun a619 () U (f a618 (ite (= a618 x) x a618)))
+(define-fun a620 () U (f a619 (ite (= a619 x) x a619)))
+(define-fun a621 () U (f a620 (ite (= a620 x) x a620)))
+(define-fun a622 () U (f a621 (ite (= a621 x) x a621)))
+(define-fun a623 () U (f a622 (ite (= a622 x) x a622)))
+(define-fun a624 () U (f a623 (ite (= a623 x) x a623)))
+(define-fun a625 () U (f a624 (ite (= a624 x) x a624)))
+(define-fun a626 () U (f a625 (ite (= a625 x) x a625)))
+(define-fun a627 () U (f a626 (ite (= a626 x) x a626)))
+(define-fun a628 () U (f a627 (ite (= a627 x) x a627)))
+(define-fun a629 () U (f a628 (ite (= a628 x) x a628)))
+(define-fun a630 () U (f a629 (ite (= a629 x) x a629)))
+(define-fun a631 () U (f a630 (ite (= a630 x) x a630)))
+(define-fun a632 () U (f a631 (ite (= a631 x) x a631)))
+(define-fun a633 () U (f a632 (ite (= a632 x) x a632)))
+(define-fun a634 () U (f a633 (ite (= a633 x) x a633)))
+(define-fun a635 () U (f a634 (ite (= a634 x) x a634)))
+(define-fun a636 () U (f a635 (ite (= a635 x) x a635)))
+(define-fun a637 () U (f a636 (ite (= a636 x) x a636)))
+(define-fun a638 () U (f a637 (ite (= a637 x) x a637)))
+(define-fun a639 () U (f a638 (ite (= a638 x) x a638)))
+(define-fun a640 () U (f a639 (ite (= a639 x) x a639)))
+(define-fun a641 () U (f a640 (ite (= a640 x) x a640)))
+(define-fun a642 () U (f a641 (ite (= a641 x) x a641)))
+(define-fun a643 () U (f a642 (ite (= a642 x) x a642)))
+(define-fun a644 () U (f a643 (ite (= a643 x) x a643)))
+(define-fun a645 () U (f a644 (ite (= a644 x) x a644)))
+(define-fun a646 () U (f a645 (ite (= a645 x) x a645)))
+(define-fun a647 () U (f a646 (ite (= a646 x) x a646)))
+(define-fun a648 () U (f a647 (ite (= a647 x) x a647)))
+(define-fun a649 () U (f a648 (ite (= a648 x) x a648)))
+(define-fun a650 () U (f a649 (ite (= a649 x) x a649)))
+(define-fun a651 () U (f a650 (ite (= a650 x) x a650)))
+(define-fun a652 () U (f a651 (ite (= a651 x) x a651)))
+(define-fun a653 () U (f a652 (ite (= a652 x) x a652)))
+(define-fun a654 () U (f a653 (ite (= a653 x) x a653)))
+(define-fun a655 () U (f a654 (ite (= a654 x) x a654)))
+(define-fun a656 () U (f a655 (ite (= a655 x) x a655)))
+(define-fun a657 () U (f a656 (ite (= a656 x) x a656)))
+(define-fun a658 () U (f a657 (ite (= a657 x) x a657)))
+(define-fun a659 () U (f a658 (ite (= a658 x) x a658)))
+(define-fun a660 () U (f a659 (ite (= a659 x) x a659)))
+(define-fun a661 () U (f a660 (ite (= a660 x) x a660)))
+(define-fun a662 () U (f a661 (ite (= a661 x) x a661)))
+(define-fun a663 () U (f a662 (ite (= a662 x) x a662)))
+(define-fun a664 () U (f a663 (ite (= a663 x) x a663)))
+(define-fun a665 () U (f a664 (ite (= a664 x) x a664)))
+(define-fun a666 () U (f a665 (ite (= a665 x) x a665)))
+(define-fun a667 () U (f a666 (ite (= a666 x) x a666)))
+(define-fun a668 () U (f a667 (ite (= a667 x) x a667)))
+(define-fun a669 () U (f a668 (ite (= a668 x) x a668)))
+(define-fun a670 () U (f a669 (ite (= a669 x) x a669)))
+(define-fun a671 () U (f a670 (ite (= a670 x) x a670)))
+(define-fun a672 () U (f a671 (ite (= a671 x) x a671)))
+(define-fun a673 () U (f a672 (ite (= a672 x) x a672)))
+(define-fun a674 () U (f a673 (ite (= a673 x) x a673)))
+(define-fun a675 () U (f a674 (ite (= a674 x) x a674)))
+(define-fun a676 () U (f a675 (ite (= a675 x) x a675)))
+(define-fun a677 () U (f a676 (ite (= a676 x) x a676)))
+(define-fun a678 () U (f a677 (ite (= a677 x) x a677)))
+(define-fun a679 () U (f a678 (ite (= a678 x) x a678)))
+(define-fun a680 () U (f a679 (ite (= a679 x) x a679)))
+(define-fun a681 () U (f a680 (ite (= a680 x) x a680)))
+(define-fun a682 () U (f a681 (ite (= a681 x) x a681)))
+(define-fun a683 () U (f a682 (ite (= a682 x) x a682)))
+(define-fun a684 () U (f a683 (ite (= a683 x) x a683)))
+(define-fun a685 () U (f a684 (ite (= a684 x) x a684)))
+(define-fun a686 () U (f a685 (ite (= a685 x) x a685)))
+(define-fun a687 () U (f a686 (ite (= a686 x) x a686)))
+(define-fun a688 () U (f a687 (ite (= a687 x) x a687)))
+(define-fun a689 () U (f a688 (ite (= a688 x) x a688)))
+(define-fun a690 () U (f a689 (ite (= a689 x) x a689)))
+(define-fun a691 () U (f a690 (ite (= a690 x) x a690)))
+(define-fun a692 () U (f a691 (ite (= a691 x) x a691)))
+(define-fun a693 () U (f a692 (ite (= a692 x) x a692)))
+(define-fun a694 () U (f a693 (ite (= a693 x) x a693)))
+(define-fun a695 () U (f a694 (ite (= a694 x) x a694)))
+(define-fun a696 () U (f a695 (ite (= a695 x) x a695)))
+(define-fun a697 () U (f a696 (ite (= a696 x) x a696)))
+(define-fun a698 () U (f a697 (ite (= a697 x) x a697)))
+(define-fun a699 () U (f a698 (ite (= a698 x) x a698)))
+(define-fun a700 () U (f a699 (ite (= a699 x) x a699)))
+(define-fun a701 () U (f a700 (ite (= a700 x) x a700)))
+(define-fun a702 () U (f a701 (ite (= a701 x) x a701)))
+(define-fun a703 () U (f a702 (ite (= a702 x) x a702)))
+(define-fun a704 () U (f a703 (ite (= a703 x) x a703)))
+(define-fun a705 () U (f a704 (ite (= a704 x) x a704)))
+(define-fun a706 () U (f a705 (ite (= a705 x) x a705)))
+(define-fun a707 () U (f a706 (ite (= a706 x) x a706)))
+(define-fun a708 () U (f a707 (ite (= a707 x) x a707)))
+(define-fun a709 () U (f a708 (ite (= a708 x) x a708)))
+(define-fun a710 () U (f a709 (ite (= a709 x) x a709)))
+(define-fun a711 () U (f a710 (ite (= a710 x) x a710)))
+(define-fun a712 () U (f a711 (ite (= a711 x) x a711)))
+(define-fun a713 () U (f a712 (ite (= a712 x) x a712)))
+(define-fun a714 () U (f a713 (ite (= a713 x) x a713)))
+(define-fun a715 () U (f a714 (ite (= a714 x) x a714)))
+(define-fun a716 () U (f a715 (ite (= a715 x) x a715)))
+(define-fun a717 () U (f a716 (ite (= a716 x) x a716)))
+(define-fun a718 () U (f a717 (ite (= a717 x) x a717)))
+(define-fun a719 () U (f a718 (ite (= a718 x) x a718)))
+(define-fun a720 () U (f a719 (ite (= a719 x) x a719)))
+(define-fun a721 () U (f a720 (ite (= a720 x) x a720)))
+(define-fun a722 () U (f a721 (ite (= a721 x) x a721)))
+(define-fun a723 () U (f a722 (ite (= a722 x) x a722)))
+(define-fun a724 () U (f a723 (ite (= a723 x) x a723)))
+(define-fun a725 () U (f a724 (ite (= a724 x) x a724)))
+(define-fun a726 () U (f a725 (ite (= a725 x) x a725)))
+(define-fun a727 () U (f a726 (ite (= a726 x) x a726)))
+(define-fun a728 () U (f a727 (ite (= a727 x) x a727)))
+(define-fun a729 () U (f a728 (ite (= a728 x) x a728)))
+(define-fun a730 () U (f a729 (ite (= a729 x) x a729)))
+(define-fun a731 () U (f a730 (ite (= a730 x) x a730)))
+(define-fun a732 () U (f a731 (ite (= a731 x) x a731)))
+(define-fun a733 () U (f a732 (ite (= a732 x) x a732)))
+(define-fun a734 () U (f a733 (ite (= a733 x) x a733)))
+(define-fun a735 () U (f a734 (ite (= a734 x) x a734)))
+(define-fun a736 () U (f a735 (ite (= a735 x) x a735)))
+(define-fun a737 () U (f a736 (ite (= a736 x) x a736)))
+(define-fun a738 () U (f a737 (ite (= a737 x) x a737)))
+(define-fun a739 () U (f a738 (ite (= a738 x) x a738)))
+(define-fun a740 () U (f a739 (ite (= a739 x) x a739)))
+(define-fun a741 () U (f a740 (ite (= a740 x) x a740)))
+(define-fun a742 () U (f a741 (ite (= a741 x) x a741)))
+(define-fun a743 () U (f a742 (ite (= a742 x) x a742)))
+(define-fun a744 () U (f a743 (ite (= a743 x) x a743)))
+(define-fun a745 () U (f a744 (ite (= a744 x) x a744)))
+(define-fun a746 () U (f a745 (ite (= a745 x) x a745)))
+(define-fun a747 () U (f a746 (ite (= a746 x) x a746)))
+(define-fun a748 () U (f a747 (ite (= a747 x) x a747)))
+(define-fun a749 () U (f a748 (ite (= a748 x) x a748)))
+(define-fun a750 () U (f a749 (ite (= a749 x) x a749)))
+(define-fun a751 () U (f a750 (ite (= a750 x) x a750)))
+(define-fun a752 () U (f a751 (ite (= a751 x) x a751)))
+(define-fun a753 () U (f a752 (ite (= a752 x) x a752)))
+(define-fun a754 () U (f a753 (ite (= a753 x) x a753)))
+(define-fun a755 () U (f a754 (ite (= a754 x) x a754)))
+(define-fun a756 () U (f a755 (ite (= a755 x) x a755)))
+(define-fun a757 () U (f a756 (ite (= a756 x) x a756)))
+(define-fun a758 () U (f a757 (ite (= a757 x) x a757)))
+(define-fun a759 () U (f a758 (ite (= a758 x) x a758)))
+(define-fun a760 () U (f a759 (ite (= a759 x) x a759)))
+(define-fun a761 () U (f a760 (ite (= a760 x) x a760)))
+(define-fun a762 () U (f a761 (ite (= a761 x) x a761)))
+(define-fun a763 () U (f a762 (ite (= a762 x) x a762)))
+(define-fun a764 () U (f a763 (ite (= a763 x) x a763)))
+(define-fun a765 () U (f a764 (ite (= a764 x) x a764)))
+(define-fun a766 () U (f a765 (ite (= a765 x) x a765)))
+(define-fun a767 () U (f a766 (ite (= a766 x) x a766)))
+(define-fun a768 () U (f a767 (ite (= a767 x) x a767)))
+(define-fun a769 () U (f a768 (ite (= a768 x) x a768)))
+(define-fun a770 () U (f a769 (ite (= a769 x) x a769)))
+(define-fun a771 () U (f a770 (ite (= a770 x) x a770)))
+(define-fun a772 () U (f a771 (ite (= a771 x) x a771)))
+(define-fun a773 () U (f a772 (ite (= a772 x) x a772)))
+(define-fun a774 () U (f a773 (ite (= a773 x) x a773)))
+(define-fun a775 () U (f a774 (ite (= a774 x) x a774)))
+(define-fun a776 () U (f a775 (ite (= a775 x) x a775)))
+(define-fun a777 () U (f a776 (ite (= a776 x) x a776)))
+(define-fun a778 () U (f a777 (ite (= a777 x) x a777)))
+(define-fun a779 () U (f a778 (ite (= a778 x) x a778)))
+(define-fun a780 () U (f a779 (ite (= a779 x) x a779)))
+(define-fun a781 () U (f a780 (ite (= a780 x) x a780)))
+(define-fun a782 () U (f a781 (ite (= a781 x) x a781)))
+(define-fun a783 () U (f a782 (ite (= a782 x) x a782)))
+(define-fun a784 () U (f a783 (ite (= a783 x) x a783)))
+(define-fun a785 () U (f a784 (ite (= a784 x) x a784)))
+(define-fun a786 () U (f a785 (ite (= a785 x) x a785)))
+(define-fun a787 () U (f a786 (ite (= a786 x) x a786)))
+(define-fun a788 () U (f a787 (ite (= a787 x) x a787)))
+(define-fun a789 () U (f a788 (ite (= a788 x) x a788)))
+(define-fun a790 () U (f a789 (ite (= a789 x) x a789)))
+(define-fun a791 () U (f a790 (ite (= a790 x) x a790)))
+(define-fun a792 () U (f a791 (ite (= a791 x) x a791)))
+(define-fun a793 () U (f a792 (ite (= a792 x) x a792)))
+(define-fun a794 () U (f a793 (ite (= a793 x) x a793)))
+(define-fun a795 () U (f a794 (ite (= a794 x) x a794)))
+(define-fun a796 () U (f a795 (ite (= a795 x) x a795)))
+(define-fun a797 () U (f a796 (ite (= a796 x) x a796)))
+(define-fun a798 () U (f a797 (ite (= a797 x) x a797)))
+(define-fun a799 () U (f a798 (ite (= a798 x) x a798)))
+(define-fun a800 () U (f a799 (ite (= a799 x) x a799)))
+(define-fun a801 () U (f a800 (ite (= a800 x) x a800)))
+(define-fun a802 () U (f a801 (ite (= a801 x) x a801)))
+(define-fun a803 () U (f a802 (ite (= a802 x) x a802)))
+(define-fun a804 () U (f a803 (ite (= a803 x) x a803)))
+(define-fun a805 () U (f a804 (ite (= a804 x) x a804)))
+(define-fun a806 () U (f a805 (ite (= a805 x) x a805)))
+(define-fun a807 () U (f a806 (ite (= a806 x) x a806)))
+(define-fun a808 () U (f a807 (ite (= a807 x) x a807)))
+(define-fun a809 () U (f a808 (ite (= a808 x) x a808)))
+(define-fun a810 () U (f a809 (ite (= a809 x) x a809)))
+(define-fun a811 () U (f a810 (ite (= a810 x) x a810)))
+(define-fun a812 () U (f a811 (ite (= a811 x) x a811)))
+(define-fun a813 () U (f a812 (ite (= a812 x) x a812)))
+(define-fun a814 () U (f a813 (ite (= a813 x) x a813)))
+(define-fun a815 () U (f a814 (ite (= a814 x) x a814)))
+(define-fun a816 () U (f a815 (ite (= a815 x) x a815)))
+(define-fun a817 () U (f a816 (ite (= a816 x) x a816)))
+(define-fun a818 () U (f a817 (ite (= a817 x) x a817)))
+(define-fun a819 () U (f a818 (ite (= a818 x) x a818)))
+(define-fun a820 () U (f a819 (ite (= a819 x) x a819)))
+(define-fun a821 () U (f a820 (ite (= a820 x) x a820)))
+(define-fun a822 () U (f a821 (ite (= a821 x) x a821)))
+(define-fun a823 () U (f a822 (ite (= a822 x) x a822)))
+(define-fun a824 () U (f a823 (ite (= a823 x) x a823)))
+(define-fun a825 () U (f a824 (ite (= a824 x) x a824)))
+(define-fun a826 () U (f a825 (ite (= a825 x) x a825)))
+(define-fun a827 () U (f a826 (ite (= a826 x) x a826)))
+(define-fun a828 () U (f a827 (ite (= a827 x) x a827)))
+(define-fun a829 () U (f a828 (ite (= a828 x) x a828)))
+(define-fun a830 () U (f a829 (ite (= a829 x) x a829)))
+(define-fun a831 () U (f a830 (ite (= a830 x) x a830)))
+(define-fun a832 () U (f a831 (ite (= a831 x) x a831)))
+(define-fun a833 () U (f a832 (ite (= a832 x) x a832)))
+(define-fun a834 () U (f a833 (ite (= a833 x) x a833)))
+(define-fun a835 () U (f a834 (ite (= a834 x) x a834)))
+(define-fun a836 () U (f a835 (ite (= a835 x) x a835)))
+(define-fun a837 () U (f a836 (ite (= a836 x) x a836)))
+(define-fun a838 () U (f a837 (ite (= a837 x) x a837)))
+(define-fun a839 () U (f a838 (ite (= a838 x) x a838)))
+(define-fun a840 () U (f a839 (ite (= a839 x) x a839)))
+(define-fun a841 () U (f a840 (ite (= a840 x) x a840)))
+(define-fun a842 () U (f a841 (ite (= a841 x) x a841)))
+(define-fun a843 () U (f a842 (ite (= a842 x) x a842)))
+(define-fun a844 () U (f a843 (ite (= a843 x) x a843)))
+(define-fun a845 () U (f a844 (ite (= a844 x) x a844)))
+(define-fun a846 () U (f a845 (ite (= a845 x) x a845)))
+(define-fun a847 () U (f a846 (ite (= a846 x) x a846)))
+(define-fun a848 () U (f a847 (ite (= a847 x) x a847)))
+(define-fun a849 () U (f a848 (ite (= a848 x) x a848)))
+(define-fun a850 () U (f a849 (ite (= a849 x) x a849)))
+(define-fun a851 () U (f a850 (ite (= a850 x) x a850)))
+(define-fun a852 () U (f a851 (ite (= a851 x) x a851)))
+(define-fun a853 () U (f a852 (ite (= a852 x) x a852)))
+(define-fun a854 () U (f a853 (ite (= a853 x) x a853)))
+(define-fun a855 () U (f a854 (ite (= a854 x) x a854)))
+(define-fun a856 () U (f a855 (ite (= a855 x) x a855)))
+(define-fun a857 () U (f a856 (ite (= a856 x) x a856)))
+(define-fun a858 () U (f a857 (ite (= a857 x) x a857)))
+(define-fun a859 () U (f a858 (ite (= a858 x) x a858)))
+(define-fun a860 () U (f a859 (ite (= a859 x) x a859)))
+(define-fun a861 () U (f a860 (ite (= a860 x) x a860)))
+(define-fun a862 () U (f a861 (ite (= a861 x) x a861)))
+(define-fun a863 () U (f a862 (ite (= a862 x) x a862)))
+(define-fun a864 () U (f a863 (ite (= a863 x) x a863)))
+(define-fun a865 () U (f a864 (ite (= a864 x) x a864)))
+(define-fun a866 () U (f a865 (ite (= a865 x) x a865)))
+(define-fun a867 () U (f a866 (ite (= a866 x) x a866)))
+(define-fun a868 () U (f a867 (ite (= a867 x) x a867)))
+(define-fun a869 () U (f a868 (ite (= a868 x) x a868)))
+(define-fun a870 () U (f a869 (ite (= a869 x) x a869)))
+(define-fun a871 () U (f a870 (ite (= a870 x) x a870)))
+(define-fun a872 () U (f a871 (ite (= a871 x) x a871)))
+(define-fun a873 () U (f a872 (ite (= a872 x) x a872)))
+(define-fun a874 () U (f a873 (ite (= a873 x) x a873)))
+(define-fun a875 () U (f a874 (ite (= a874 x) x a874)))
+(define-fun a876 () U (f a875 (ite (= a875 x) x a875)))
+(define-fun a877 () U (f a876 (ite (= a876 x) x a876)))
+(define-fun a878 () U (f a877 (ite (= a877 x) x a877)))
+(define-fun a879 () U (f a878 (ite (= a878 x) x a878)))
+(define-fun a880 () U (f a879 (ite (= a879 x) x a879)))
+(define-fun a881 () U (f a880 (ite (= a880 x) x a880)))
+(define-fun a882 () U (f a881 (ite (= a881 x) x a881)))
+(define-fun a883 () U (f a882 (ite (= a882 x) x a882)))
+(define-fun a884 () U (f a883 (ite (= a883 x) x a883)))
+(define-fun a885 () U (f a884 (ite (= a884 x) x a884)))
+(define-fun a886 () U (f a885 (ite (= a885 x) x a885)))
+(define-fun a887 () U (f a886 (ite (= a886 x) x a886)))
+(define-fun a888 () U (f a887 (ite (= a887 x) x a887)))
+(define-fun a889 () U (f a888 (ite (= a888 x) x a888)))
+(define-fun a890 () U (f a889 (ite (= a889 x) x a889)))
+(define-fun a891 () U (f a890 (ite (= a890 x) x a890)))
+(define-fun a892 () U (f a891 (ite (= a891 x) x a891)))
+(define-fun a893 () U (f a892 (ite (= a892 x) x a892)))
+(define-fun a894 () U (f a893 (ite (= a893 x) x a893)))
+(define-fun a895 () U (f a894 (ite (= a894 x) x a894)))
+(define-fun a896 () U (f a895 (ite (= a895 x) x a895)))
+(define-fun a897 () U (f a896 (ite (= a896 x) x a896)))
+(define-fun a898 () U (f a897 (ite (= a897 x) x a897)))
+(define-fun a899 () U (f a898 (ite (= a898 x) x a898)))
+(define-fun a900 () U (f a899 (ite (= a899 x) x a899)))
+(define-fun a901 () U (f a900 (ite (= a900 x) x a900)))
+(define-fun a902 () U (f a901 (ite (= a901 x) x a901)))
+(define-fun a903 () U (f a902 (ite (= a902 x) x a902)))
+(define-fun a904 () U (f a903 (ite (= a903 x) x a903)))
+(define-fun a905 () U (f a904 (ite (= a904 x) x a904)))
+(define-fun a906 () U (f a905 (ite (= a905 x) x a905)))
+(define-fun a907 () U (f a906 (ite (= a906 x) x a906)))
+(define-fun a908 () U (f a907 (ite (= a907 x) x a907)))
+(define-fun a909 () U (f a908 (ite (= a908 x) x a908)))
+(define-fun a910 () U (f a909 (ite (= a909 x) x a909)))
+(define-fun a911 () U (f a910 (ite (= a910 x) x a910)))
+(define-fun a912 () U (f a911 (ite (= a911 x) x a911)))
+(define-fun a913 () U (f a912 (ite (= a912 x) x a912)))
+(define-fun a914 () U (f a913 (ite (= a913 x) x a913)))
+(define-fun a915 () U (f a914 (ite (= a914 x) x a914)))
+(define-fun a916 () U (f a915 (ite (= a915 x) x a915)))
+(define-fun a917 () U (f a916 (ite (= a916 x) x a916)))
+(define-fun a918 () U (f a917 (ite (= a917 x) x a917)))
+(define-fun a919 () U (f a918 (ite (= a918 x) x a918)))
+(define-fun a920 () U (f a919 (ite (= a919 x) x a919)))
+(define-fun a921 () U (f a920 (ite (= a920 x) x a920)))
+(define-fun a922 () U (f a921 (ite (= a921 x) x a921)))
+(define-fun a923 () U (f a922 (ite (= a922 x) x a922)))
+(define-fun a924 () U (f a923 (ite (= a923 x) x a923)))
+(define-fun a925 () U (f a924 (ite (= a924 x) x a924)))
+(define-fun a926 () U (f a925 (ite (= a925 x) x a925)))
+(define-fun a927 () U (f a926 (ite (= a926 x) x a926)))
+(define-fun a928 () U (f a927 (ite (= a927 x) x a927)))
+(define-fun a929 () U (f a928 (ite (= a928 x) x a928)))
+(define-fun a930 () U (f a929 (ite (= a929 x) x a929)))
+(define-fun a931 () U (f a930 (ite (= a930 x) x a930)))
+(define-fun a932 () U (f a931 (ite (= a931 x) x a931)))
+(define-fun a933 () U (f a932 (ite (= a932 x) x a932)))
+(define-fun a934 () U (f a933 (ite (= a933 x) x a933)))
+(define-fun a935 () U (f a934 (ite (= a934 x) x a934)))
+(define-fun a936 () U (f a935 (ite (= a935 x) x a935)))
+(define-fun a937 () U (f a936 (ite (= a936 x) x a936)))
+(define-fun a938 () U (f a937 (ite (= a937 x) x a937)))
+(define-fun a939 () U (f a938 (ite (= a938 x) x a938)))
+(define-fun a940 () U (f a939 (ite (= a939 x) x a939)))
+(define-fun a941 () U (f a940 (ite (= a940 x) x a940)))
+(define-fun a942 () U (f a941 (ite (= a941 x) x a941)))
+(define-fun a943 () U (f a942 (ite (= a942 x) x a942)))
+(define-fun a944 () U (f a943 (ite (= a943 x) x a943)))
+(define-fun a945 () U (f a944 (ite (= a944 x) x a944)))
+(define-fun a946 () U (f a945 (ite (= a945 x) x a945)))
+(define-fun a947 () U (f a946 (ite (= a946 x) x a946)))
+(define-fun a948 () U (f a947 (ite (= a947 x) x a947)))
+(define-fun a949 () U (f a948 (ite (= a948 x) x a948)))
+(define-fun a950 () U (f a949 (ite (= a949 x) x a949)))
+(define-fun a951 () U (f a950 (ite (= a950 x) x a950)))
+(define-fun a952 () U (f a951 (ite (= a951 x) x a951)))
+(define-fun a953 () U (f a952 (ite (= a952 x) x a952)))
+(define-fun a954 () U (f a953 (ite (= a953 x) x a953)))
+(define-fun a955 () U (f a954 (ite (= a954 x) x a954)))
+(define-fun a956 () U (f a955 (ite (= a955 x) x a955)))
+(define-fun a957 () U (f a956 (ite (= a956 x) x a956)))
+(define-fun a958 () U (f a957 (ite (= a957 x) x a957)))
+(define-fun a959 () U (f a958 (ite (= a958 x) x a958)))
+(define-fun a960 () U (f a959 (ite (= a959 x) x a959)))
+(define-fun a961 () U (f a960 (ite (= a960 x) x a960)))
+(define-fun a962 () U (f a961 (ite (= a961 x) x a961)))
+(define-fun a963 () U (f a962 (ite (= a962 x) x a962)))
+(define-fun a964 () U (f a963 (ite (= a963 x) x a963)))
+(define-fun a965 () U (f a964 (ite (= a964 x) x a964)))
+(define-fun a966 () U (f a965 (ite (= a965 x) x a965)))
+(define-fun a967 () U (f a966 (ite (= a966 x) x a966)))
+(define-fun a968 () U (f a967 (ite (= a967 x) x a967)))
+(define-fun a969 () U (f a968 (ite (= a968 x) x a968)))
+(define-fun a970 () U (f a969 (ite (= a969 x) x a969)))
+(define-fun a971 () U (f a970 (ite (= a970 x) x a970)))
+(define-fun a972 () U (f a971 (ite (= a971 x) x a971)))
+(define-fun a973 () U (f a972 (ite (= a972 x) x a972)))
+(define-fun a974 () U (f a973 (ite (= a973 x) x a973)))
+(define-fun a975 () U (f a974 (ite (= a974 x) x a974)))
+(define-fun a976 () U (f a975 (ite (= a975 x) x a975)))
+(define-fun a977 () U (f a976 (ite (= a976 x) x a976)))
+(define-fun a978 () U (f a977 (ite (= a977 x) x a977)))
+(define-fun a979 () U (f a978 (ite (= a978 x) x a978)))
+(define-fun a980 () U (f a979 (ite (= a979 x) x a979)))
+(define-fun a981 () U (f a980 (ite (= a980 x) x a980)))
+(define-fun a982 () U (f a981 (ite (= a981 x) x a981)))
+(define-fun a983 () U (f a982 (ite (= a982 x) x a982)))
+(define-fun a984 () U (f a983 (ite (= a983 x) x a983)))
+(define-fun a985 () U (f a984 (ite (= a984 x) x a984)))
+(define-fun a986 () U (f a985 (ite (= a985 x) x a985)))
+(define-fun a987 () U (f a986 (ite (= a986 x) x a986)))
+(define-fun a988 () U (f a987 (ite (= a987 x) x a987)))
+(define-fun a989 () U (f a988 (ite (= a988 x) x a988)))
+(define-fun a990 () U (f a989 (ite (= a989 x) x a989)))
+(define-fun a991 () U (f a990 (ite (= a990 x) x a990)))
+(define-fun a992 () U (f a991 (ite (= a991 x) x a991)))
+(define-fun a993 () U (f a992 (ite (= a992 x) x a992)))
+(define-fun a994 () U (f a993 (ite (= a993 x) x a993)))
+(define-fun a995 () U (f a994 (ite (= a994 x) x a994)))
+(define-fun a996 () U (f a995 (ite (= a995 x) x a995)))
+(define-fun a997 () U (f a996 (ite (= a996 x) x a996)))
+(define-fun a998 () U (f a997 (ite (= a997 x) x a997)))
+(define-fun a999 () U (f a998 (ite (= a998 x) x a998)))
+(define-fun a1000 () U (f a999 (ite (= a999 x) x a999)))
+(define-fun a1001 () U (f a1000 (ite (= a1000 x) x a1000)))
+(define-fun a1002 () U (f a1001 (ite (= a1001 x) x a1001)))
+(define-fun a1003 () U (f a1002 (ite (= a1002 x) x a1002)))
+(define-fun a1004 () U (f a1003 (ite (= a1003 x) x a1003)))
+(define-fun a1005 () U (f a1004 (ite (= a1004 x) x a1004)))
+(define-fun a1006 () U (f a1005 (ite (= a1005 x) x a1005)))
+(define-fun a1007 () U (f a1006 (ite (= a1006 x) x a1006)))
+(define-fun a1008 () U (f a1007 (ite (= a1007 x) x a1007)))
+(define-fun a1009 () U (f a1008 (ite (= a1008 x) x a1008)))
+(define-fun a1010 () U (f a1009 (ite (= a1009 x) x a1009)))
+(define-fun a1011 () U (f a1010 (ite (= a1010 x) x a1010)))
+(define-fun a1012 () U (f a1011 (ite (= a1011 x) x a1011)))
+(define-fun a1013 () U (f a1012 (ite (= a1012 x) x a1012)))
+(define-fun a1014 () U (f a1013 (ite (= a1013 x) x a1013)))
+(define-fun a1015 () U (f a1014 (ite (= a1014 x) x a1014)))
+(define-fun a1016 () U (f a1015 (ite (= a1015 x) x a1015)))
+(define-fun a1017 () U (f a1016 (ite (= a1016 x) x a1016)))
+(define-fun a1018 () U (f a1017 (ite (= a1017 x) x a1017)))
+(define-fun a1019 () U (f a1018 (ite (= a1018 x) x a1018)))
+(define-fun a1020 () U (f a1019 (ite (= a1019 x) x a1019)))
+(define-fun a1021 () U (f a1020 (ite (= a1020 x) x a1020)))
+(define-fun a1022 () U (f a1021 (ite (= a1021 x) x a1021)))
+(define-fun a1023 () U (f a1022 (ite (= a1022 x) x a1022)))
+(define-fun a1024 () U (f a1023 (ite (= a1023 x) x a1023)))
+(define-fun a1025 () U (f a1024 (ite (= a1024 x) x a1024)))
+(define-fun a1026 () U (f a1025 (ite (= a1025 x) x a1025)))
+(define-fun a1027 () U (f a1026 (ite (= a1026 x) x a1026)))
+(define-fun a1028 () U (f a1027 (ite (= a1027 x) x a1027)))
+(define-fun a1029 () U (f a1028 (ite (= a1028 x) x a1028)))
+(define-fun a1030 () U (f a1029 (ite (= a1029 x) x a1029)))
+(define-fun a1031 () U (f a1030 (ite (= a1030 x) x a1030)))
+(define-fun a1032 () U (f a1031 (ite (= a1031 x) x a1031)))
+(define-fun a1033 () U (f a1032 (ite (= a1032 x) x a1032)))
+(define-fun a1034 () U (f a1033 (ite (= a1033 x) x a1033)))
+(define-fun a1035 () U (f a1034 (ite (= a1034 x) x a1034)))
+(define-fun a1036 () U (f a1035 (ite (= a1035 x) x a1035)))
+(define-fun a1037 () U (f a1036 (ite (= a1036 x) x a1036)))
+(define-fun a1038 () U (f a1037 (ite (= a1037 x) x a1037)))
+(define-fun a1039 () U (f a1038 (ite (= a1038 x) x a1038)))
+(define-fun a1040 () U (f a1039 (ite (= a1039 x) x a1039)))
+(define-fun a1041 () U (f a1040 (ite (= a1040 x) x a1040)))
+(define-fun a1042 () U (f a1041 (ite (= a1041 x) x a1041)))
+(define-fun a1043 () U (f a1042 (ite (= a1042 x) x a1042)))
+(define-fun a1044 () U (f a1043 (ite (= a1043 x) x a1043)))
+(define-fun a1045 () U (f a1044 (ite (= a1044 x) x a1044)))
+(define-fun a1046 () U (f a1045 (ite (= a1045 x) x a1045)))
+(define-fun a1047 () U (f a1046 (ite (= a1046 x) x a1046)))
+(define-fun a1048 () U (f a1047 (ite (= a1047 x) x a1047)))
+(define-fun a1049 () U (f a1048 (ite (= a1048 x) x a1048)))
+(define-fun a1050 () U (f a1049 (ite (= a1049 x) x a1049)))
+(define-fun a1051 () U (f a1050 (ite (= a1050 x) x a1050)))
+(define-fun a1052 () U (f a1051 (ite (= a1051 x) x a1051)))
+(define-fun a1053 () U (f a1052 (ite (= a1052 x) x a1052)))
+(define-fun a1054 () U (f a1053 (ite (= a1053 x) x a1053)))
+(define-fun a1055 () U (f a1054 (ite (= a1054 x) x a1054)))
+(define-fun a1056 () U (f a1055 (ite (= a1055 x) x a1055)))
+(define-fun a1057 () U (f a1056 (ite (= a1056 x) x a1056)))
+(define-fun a1058 () U (f a1057 (ite (= a1057 x) x a1057)))
+(define-fun a1059 () U (f a1058 (ite (= a1058 x) x a1058)))
+(define-fun a1060 () U (f a1059 (ite (= a1059 x) x a1059)))
+(define-fun a1061 () U (f a1060 (ite (= a1060 x) x a1060)))
+(define-fun a1062 () U (f a1061 (ite (= a1061 x) x a1061)))
+(define-fun a1063 () U (f a1062 (ite (= a1062 x) x a1062)))
+(define-fun a1064 () U (f a1063 (ite (= a1063 x) x a1063)))
+(define-fun a1065 () U (f a1064 (ite (= a1064 x) x a1064)))
+(define-fun a1066 () U (f a1065 (ite (= a1065 x) x a1065)))
+(define-fun a1067 () U (f a1066 (ite (= a1066 x) x a1066)))
+(define-fun a1068 () U (f a1067 (ite (= a1067 x) x a1067)))
+(define-fun a1069 () U (f a1068 (ite (= a1068 x) x a1068)))
+(define-fun a1070 () U (f a1069 (ite (= a1069 x) x a1069)))
+(define-fun a1071 () U (f a1070 (ite (= a1070 x) x a1070)))
+(define-fun a1072 () U (f a1071 (ite (= a1071 x) x a1071)))
+(define-fun a1073 () U (f a1072 (ite (= a1072 x) x a1072)))
+(define-fun a1074 () U (f a1073 (ite (= a1073 x) x a1073)))
+(define-fun a1075 () U (f a1074 (ite (= a1074 x) x a1074)))
+(define-fun a1076 () U (f a1075 (ite (= a1075 x) x a1075)))
+(define-fun a1077 () U (f a1076 (ite (= a1076 x) x a1076)))
+(define-fun a1078 () U (f a1077 (ite (= a1077 x) x a1077)))
+(define-fun a1079 () U (f a1078 (ite (= a1078 x) x a1078)))
+(define-fun a1080 () U (f a1079 (ite (= a1079 x) x a1079)))
+(define-fun a1081 () U (f a1080 (ite (= a1080 x) x a1080)))
+(define-fun a1082 () U (f a1081 (ite (= a1081 x) x a1081)))
+(define-fun a1083 () U (f a1082 (ite (= a1082 x) x a1082)))
+(define-fun a1084 () U (f a1083 (ite (= a1083 x) x a1083)))
+(define-fun a1085 () U (f a1084 (ite (= a1084 x) x a1084)))
+(define-fun a1086 () U (f a1085 (ite (= a1085 x) x a1085)))
+(define-fun a1087 () U (f a1086 (ite (= a1086 x) x a1086)))
+(define-fun a1088 () U (f a1087 (ite (= a1087 x) x a1087)))
+(define-fun a1089 () U (f a1088 (ite (= a1088 x) x a1088)))
+(define-fun a1090 () U (f a1089 (ite (= a1089 x) x a1089)))
+(define-fun a1091 () U (f a1090 (ite (= a1090 x) x a1090)))
+(define-fun a1092 () U (f a1091 (ite (= a1091 x) x a1091)))
+(define-fun a1093 () U (f a1092 (ite (= a1092 x) x a1092)))
+(define-fun a1094 () U (f a1093 (ite (= a1093 x) x a1093)))
+(define-fun a1095 () U (f a1094 (ite (= a1094 x) x a1094)))
+(define-fun a1096 () U (f a1095 (ite (= a1095 x) x a1095)))
+(define-fun a1097 () U (f a1096 (ite (= a1096 x) x a1096)))
+(define-fun a1098 () U (f a1097 (ite (= a1097 x) x a1097)))
+(define-fun a1099 () U (f a1098 (ite (= a1098 x) x a1098)))
+(define-fun a1100 () U (f a1099 (ite (= a1099 x) x a1099)))
+(define-fun a1101 () U (f a1100 (ite (= a1100 x) x a1100)))
+(define-fun a1102 () U (f a1101 (ite (= a1101 x) x a1101)))
+(define-fun a1103 () U (f a1102 (ite (= a1102 x) x a1102)))
+(define-fun a1104 () U (f a1103 (ite (= a1103 x) x a1103)))
+(define-fun a1105 () U (f a1104 (ite (= a1104 x) x a1104)))
+(define-fun a1106 () U (f a1105 (ite (= a1105 x) x a1105)))
+(define-fun a1107 () U (f a1106 (ite (= a1106 x) x a1106)))
+(define-fun a1108 () U (f a1107 (ite (= a1107 x) x a1107)))
+(define-fun a1109 () U (f a1108 (ite (= a1108 x) x a1108)))
+(define-fun a1110 () U (f a1109 (ite (= a1109 x) x a1109)))
+(define-fun a1111 () U (f a1110 (ite (= a1110 x) x a1110)))
+(define-fun a1112 () U (f a1111 (ite (= a1111 x) x a1111)))
+(define-fun a1113 () U (f a1112 (ite (= a1112 x) x a1112)))
+(define-fun a1114 () U (f a1113 (ite (= a1113 x) x a1113)))
+(define-fun a1115 () U (f a1114 (ite (= a1114 x) x a1114)))
+(define-fun a1116 () U (f a1115 (ite (= a1115 x) x a1115)))
+(define-fun a1117 () U (f a1116 (ite (= a1116 x) x a1116)))
+(define-fun a1118 () U (f a1117 (ite (= a1117 x) x a1117)))
+(define-fun a1119 () U (f a1118 (ite (= a1118 x) x a1118)))
+(define-fun a1120 () U (f a1119 (ite (= a1119 x) x a1119)))
+(define-fun a1121 () U (f a1120 (ite (= a1120 x) x a1120)))
+(define-fun a1122 () U (f a1121 (ite (= a1121 x) x a1121)))
+(define-fun a1123 () U (f a1122 (ite (= a1122 x) x a1122)))
+(define-fun a1124 () U (f a1123 (ite (= a1123 x) x a1123)))
+(define-fun a1125 () U (f a1124 (ite (= a1124 x) x a1124)))
+(define-fun a1126 () U (f a1125 (ite (= a1125 x) x a1125)))
+(define-fun a1127 () U (f a1126 (ite (= a1126 x) x a1126)))
+(define-fun a1128 () U (f a1127 (ite (= a1127 x) x a1127)))
+(define-fun a1129 () U (f a1128 (ite (= a1128 x) x a1128)))
+(define-fun a1130 () U (f a1129 (ite (= a1129 x) x a1129)))
+(define-fun a1131 () U (f a1130 (ite (= a1130 x) x a1130)))
+(define-fun a1132 () U (f a1131 (ite (= a1131 x) x a1131)))
+(define-fun a1133 () U (f a1132 (ite (= a1132 x) x a1132)))
+(define-fun a1134 () U (f a1133 (ite (= a1133 x) x a1133)))
+(define-fun a1135 () U (f a1134 (ite (= a1134 x) x a1134)))
+(define-fun a1136 () U (f a1135 (ite (= a1135 x) x a1135)))
+(define-fun a1137 () U (f a1136 (ite (= a1136 x) x a1136)))
+(define-fun a1138 () U (f a1137 (ite (= a1137 x) x a1137)))
+(define-fun a1139 () U (f a1138 (ite (= a1138 x) x a1138)))
+(define-fun a1140 () U (f a1139 (ite (= a1139 x) x a1139)))
+(define-fun a1141 () U (f a1140 (ite (= a1140 x) x a1140)))
+(define-fun a1142 () U (f a1141 (ite (= a1141 x) x a1141)))
+(define-fun a1143 () U (f a1142 (ite (= a1142 x) x a1142)))
+(define-fun a1144 () U (f a1143 (ite (= a1143 x) x a1143)))
+(define-fun a1145 () U (f a1144 (ite (= a1144 x) x a1144)))
+(define-fun a1146 () U (f a1145 (ite (= a1145 x) x a1145)))
+(define-fun a1147 () U (f a1146 (ite (= a1146 x) x a1146)))
+(define-fun a1148 () U (f a1147 (ite (= a1147 x) x a1147)))
+(define-fun a1149 () U (f a1148 (ite (= a1148 x) x a1148)))
+(define-fun a1150 () U (f a1149 (ite (= a1149 x) x a1149)))
+(define-fun a1151 () U (f a1150 (ite (= a1150 x) x a1150)))
+(define-fun a1152 () U (f a1151 (ite (= a1151 x) x a1151)))
+(define-fun a1153 () U (f a1152 (ite (= a1152 x) x a1152)))
+(define-fun a1154 () U (f a1153 (ite (= a1153 x) x a1153)))
+(define-fun a1155 () U (f a1154 (ite (= a1154 x) x a1154)))
+(define-fun a1156 () U (f a1155 (ite (= a1155 x) x a1155)))
+(define-fun a1157 () U (f a1156 (ite (= a1156 x) x a1156)))
+(define-fun a1158 () U (f a1157 (ite (= a1157 x) x a1157)))
+(define-fun a1159 () U (f a1158 (ite (= a1158 x) x a1158)))
+(define-fun a1160 () U (f a1159 (ite (= a1159 x) x a1159)))
+(define-fun a1161 () U (f a1160 (ite (= a1160 x) x a1160)))
+(define-fun a1162 () U (f a1161 (ite (= a1161 x) x a1161)))
+(define-fun a1163 () U (f a1162 (ite (= a1162 x) x a1162)))
+(define-fun a1164 () U (f a1163 (ite (= a1163 x) x a1163)))
+(define-fun a1165 () U (f a1164 (ite (= a1164 x) x a1164)))
+(define-fun a1166 () U (f a1165 (ite (= a1165 x) x a1165)))
+(define-fun a1167 () U (f a1166 (ite (= a1166 x) x a1166)))
+(define-fun a1168 () U (f a1167 (ite (= a1167 x) x a1167)))
+(define-fun a1169 () U (f a1168 (ite (= a1168 x) x a1168)))
+(define-fun a1170 () U (f a1169 (ite (= a1169 x) x a1169)))
+(define-fun a1171 () U (f a1170 (ite (= a1170 x) x a1170)))
+(define-fun a1172 () U (f a1171 (ite (= a1171 x) x a1171)))
+(define-fun a1173 () U (f a1172 (ite (= a1172 x) x a1172)))
+(define-fun a1174 () U (f a1173 (ite (= a1173 x) x a1173)))
+(define-fun a1175 () U (f a1174 (ite (= a1174 x) x a1174)))
+(define-fun a1176 () U (f a1175 (ite (= a1175 x) x a1175)))
+(define-fun a1177 () U (f a1176 (ite (= a1176 x) x a1176)))
+(define-fun a1178 () U (f a1177 (ite (= a1177 x) x a1177)))
+(define-fun a1179 () U (f a1178 (ite (= a1178 x) x a1178)))
+(define-fun a1180 () U (f a1179 (ite (= a1179 x) x a1179)))
+(define-fun a1181 () U (f a1180 (ite (= a1180 x) x a1180)))
+(define-fun a1182 () U (f a1181 (ite (= a1181 x) x a1181)))
+(define-fun a1183 () U (f a1182 (ite (= a1182 x) x a1182)))
+(define-fun a1184 () U (f a1183 (ite (= a1183 x) x a1183)))
+(define-fun a1185 () U (f a1184 (ite (= a1184 x) x a1184)))
+(define-fun a1186 () U (f a1185 (ite (= a1185 x) x a1185)))
+(define-fun a1187 () U (f a1186 (ite (= a1186 x) x a1186)))
+(define-fun a1188 () U (f a1187 (ite (= a1187 x) x a1187)))
+(define-fun a1189 () U (f a1188 (ite (= a1188 x) x a1188)))
+(define-fun a1190 () U (f a1189 (ite (= a1189 x) x a1189)))
+(define-fun a1191 () U (f a1190 (ite (= a1190 x) x a1190)))
+(define-fun a1192 () U (f a1191 (ite (= a1191 x) x a1191)))
+(define-fun a1193 () U (f a1192 (ite (= a1192 x) x a1192)))
+(define-fun a1194 () U (f a1193 (ite (= a1193 x) x a1193)))
+(define-fun a1195 () U (f a1194 (ite (= a1194 x) x a1194)))
+(define-fun a1196 () U (f a1195 (ite (= a1195 x) x a1195)))
+(define-fun a1197 () U (f a1196 (ite (= a1196 x) x a1196)))
+(define-fun a1198 () U (f a1197 (ite (= a1197 x) x a1197)))
+(define-fun a1199 () U (f a1198 (ite (= a1198 x) x a1198)))
+(define-fun a1200 () U (f a1199 (ite (= a1199 x) x a1199)))
+(assert (= a1200 y))
+(assert (not (= y a1200)))
+(check-sat)
@@ -0,0 +1,132 @@
+; COMMAND-LINE: --incremental --sat-inprocess --sat-inprocess-elim --sat-inprocess-interval=1 --decision=internal
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun b () Bool)
+(declare-fun p0_0 () Bool)
+(declare-fun p0_1 () Bool)
+(declare-fun p0_2 () Bool)
+(declare-fun p0_3 () Bool)
+(declare-fun p0_4 () Bool)
+(declare-fun p1_0 () Bool)
+(declare-fun p1_1 () Bool)
+(declare-fun p1_2 () Bool)
+(declare-fun p1_3 () Bool)
+(declare-fun p1_4 () Bool)
+(declare-fun p2_0 () Bool)
+(declare-fun p2_1 () Bool)
+(declare-fun p2_2 () Bool)
+(declare-fun p2_3 () Bool)
+(declare-fun p2_4 () Bool)
+(declare-fun p3_0 () Bool)
+(declare-fun p3_1 () Bool)
+(declare-fun p3_2 () Bool)
+(declare-fun p3_3 () Bool)
+(declare-fun p3_4 () Bool)
+(declare-fun p4_0 () Bool)
+(declare-fun p4_1 () Bool)
+(declare-fun p4_2 () Bool)
+(declare-fun p4_3 () Bool)
+(declare-fun p4_4 () Bool)
+(declare-fun p5_0 () Bool)
+(declare-fun p5_1 () Bool)
+(declare-fun p5_2 () Bool)
+(declare-fun p5_3 () Bool)
+(declare-fun p5_4 () Bool)
+(assert (> x 5))
+; the gates (and pi_j (> x j)) are candidates for elimination while the
+; pigeon hole problem guarded by b is refuted
+(assert (=> b (or (and p0_0 (> x 0)) (and p0_1 (> x 1)) (and p0_2 (> x 2)) (and p0_3 (> x 3)) (and p0_4 (> x 4)))))
+(assert (=> b (or (and p1_0 (> x 0)) (and p1_1 (> x 1)) (and p1_2 (> x 2)) (and p1_3 (> x 3)) (and p1_4 (> x 4)))))
+(assert (=> b (or (and p2_0 (> x 0)) (and p2_1 (> x 1)) (and p2_2 (> x 2)) (and p2_3 (> x 3)) (and p2_4 (> x 4)))))
+(assert (=> b (or (and p3_0 (> x 0)) (and p3_1 (> x 1)) (and p3_2 (> x 2)) (and p3_3 (> x 3)) (and p3_4 (> x 4)))))
+(assert (=> b (or (and p4_0 (> x 0)) (and p4_1 (> x 1)) (and p4_2 (> x 2)) (and p4_3 (> x 3)) (and p4_4 (> x 4)))))
+(assert (=> b (or (and p5_0 (> x 0)) (and p5_1 (> x 1)) (and p5_2 (> x 2)) (and p5_3 (> x 3)) (and p5_4 (> x 4)))))
+(assert (not (and p0_0 p1_0)))
+(assert (not (and p0_0 p2_0)))
+(assert (not (and p0_0 p3_0)))
+(assert (not (and p0_0 p4_0)))
+(assert (not (and p0_0 p5_0)))
+(assert (not (and p1_0 p2_0)))
+(assert (not (and p1_0 p3_0)))
+(assert (not (and p1_0 p4_0)))
+(assert (not (and p1_0 p5_0)))
+(assert (not (and p2_0 p3_0)))
+(assert (not (and p2_0 p4_0)))
+(assert (not (and p2_0 p5_0)))
+(assert (not (and p3_0 p4_0)))
+(assert (not (and p3_0 p5_0)))
+(assert (not (and p4_0 p5_0)))
+(assert (not (and p0_1 p1_1)))
+(assert (not (and p0_1 p2_1)))
+(assert (not (and p0_1 p3_1)))
+(assert (not (and p0_1 p4_1)))
+(assert (not (and p0_1 p5_1)))
+(assert (not (and p1_1 p2_1)))
+(assert (not (and p1_1 p3_1)))
+(assert (not (and p1_1 p4_1)))
+(assert (not (and p1_1 p5_1)))
+(assert (not (and p2_1 p3_1)))
+(assert (not (and p2_1 p4_1)))
+(assert (not (and p2_1 p5_1)))
+(assert (not (and p3_1 p4_1)))
+(assert (not (and p3_1 p5_1)))
+(assert (not (and p4_1 p5_1)))
+(assert (not (and p0_2 p1_2)))
+(assert (not (and p0_2 p2_2)))
+(assert (not (and p0_2 p3_2)))
+(assert (not (and p0_2 p4_2)))
+(assert (not (and p0_2 p5_2)))
+(assert (not (and p1_2 p2_2)))
+(assert (not (and p1_2 p3_2)))
+(assert (not (and p1_2 p4_2)))
+(assert (not (and p1_2 p5_2)))
+(assert (not (and p2_2 p3_2)))
+(assert (not (and p2_2 p4_2)))
+(assert (not (and p2_2 p5_2)))
+(assert (not (and p3_2 p4_2)))
+(assert (not (and p3_2 p5_2)))
+(assert (not (and p4_2 p5_2)))
+(assert (not (and p0_3 p1_3)))
+(assert (not (and p0_3 p2_3)))
+(assert (not (and p0_3 p3_3)))
+(assert (not (and p0_3 p4_3)))
+(assert (not (and p0_3 p5_3)))
+(assert (not (and p1_3 p2_3)))
+(assert (not (and p1_3 p3_3)))
+(assert (not (and p1_3 p4_3)))
+(assert (not (and p1_3 p5_3)))
+(assert (not (and p2_3 p3_3)))
+(assert (not (and p2_3 p4_3)))
+(assert (not (and p2_3 p5_3)))
+(assert (not (and p3_3 p4_3)))
+(assert (not (and p3_3 p5_3)))
+(assert (not (and p4_3 p5_3)))
+(assert (not (and p0_4 p1_4)))
+(assert (not (and p0_4 p2_4)))
+(assert (not (and p0_4 p3_4)))
+(assert (not (and p0_4 p4_4)))
+(assert (not (and p0_4 p5_4)))
+(assert (not (and p1_4 p2_4)))
+(assert (not (and p1_4 p3_4)))
+(assert (not (and p1_4 p4_4)))
+(assert (not (and p1_4 p5_4)))
+(assert (not (and p2_4 p3_4)))
+(assert (not (and p2_4 p4_4)))
+(assert (not (and p2_4 p5_4)))
+(assert (not (and p3_4 p4_4)))
+(assert (not (and p3_4 p5_4)))
+(assert (not (and p4_4 p5_4)))
+(push 1)
+(assert b)
+(check-sat)
+(pop 1)
+(check-sat)
+; new clauses with the gates of pigeon 0 restore them if they were eliminated
+(assert (or (and p0_0 (> x 0)) (and p0_1 (> x 1))))
+(check-sat)
+(assert b)
+(check-sat)
@@ -0,0 +1,140 @@
+; COMMAND-LINE: --incremental --sat-inprocess --sat-inprocess-elim --sat-inprocess-interval=1 --decision=internal --finite-model-find
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic UF)
+(declare-sort U 0)
+(declare-fun c0 () U)
+(declare-fun c1 () U)
+(declare-fun c2 () U)
+(declare-fun c3 () U)
+(declare-fun c4 () U)
+(declare-fun Q (U) Bool)
+(declare-fun R (U) Bool)
+(declare-fun b () Bool)
+(declare-fun p0_0 () Bool)
+(declare-fun p0_1 () Bool)
+(declare-fun p0_2 () Bool)
+(declare-fun p0_3 () Bool)
+(declare-fun p0_4 () Bool)
+(declare-fun p1_0 () Bool)
+(declare-fun p1_1 () Bool)
+(declare-fun p1_2 () Bool)
+(declare-fun p1_3 () Bool)
+(declare-fun p1_4 () Bool)
+(declare-fun p2_0 () Bool)
+(declare-fun p2_1 () Bool)
+(declare-fun p2_2 () Bool)
+(declare-fun p2_3 () Bool)
+(declare-fun p2_4 () Bool)
+(declare-fun p3_0 () Bool)
+(declare-fun p3_1 () Bool)
+(declare-fun p3_2 () Bool)
+(declare-fun p3_3 () Bool)
+(declare-fun p3_4 () Bool)
+(declare-fun p4_0 () Bool)
+(declare-fun p4_1 () Bool)
+(declare-fun p4_2 () Bool)
+(declare-fun p4_3 () Bool)
+(declare-fun p4_4 () Bool)
+(declare-fun p5_0 () Bool)
+(declare-fun p5_1 () Bool)
+(declare-fun p5_2 () Bool)
+(declare-fun p5_3 () Bool)
+(declare-fun p5_4 () Bool)
+(assert (distinct c0 c1 c2 c3 c4))
+; the gates (and pi_j (Q cj)) are candidates for elimination while the
+; pigeon hole problem guarded by b is refuted
+(assert (=> b (or (and p0_0 (Q c0)) (and p0_1 (Q c1)) (and p0_2 (Q c2)) (and p0_3 (Q c3)) (and p0_4 (Q c4)))))
+(assert (=> b (or (and p1_0 (Q c0)) (and p1_1 (Q c1)) (and p1_2 (Q c2)) (and p1_3 (Q c3)) (and p1_4 (Q c4)))))
+(assert (=> b (or (and p2_0 (Q c0)) (and p2_1 (Q c1)) (and p2_2 (Q c2)) (and p2_3 (Q c3)) (and p2_4 (Q c4)))))
+(assert (=> b (or (and p3_0 (Q c0)) (and p3_1 (Q c1)) (and p3_2 (Q c2)) (and p3_3 (Q c3)) (and p3_4 (Q c4)))))
+(assert (=> b (or (and p4_0 (Q c0)) (and p4_1 (Q c1)) (and p4_2 (Q c2)) (and p4_3 (Q c3)) (and p4_4 (Q c4)))))
+(assert (=> b (or (and p5_0 (Q c0)) (and p5_1 (Q c1)) (and p5_2 (Q c2)) (and p5_3 (Q c3)) (and p5_4 (Q c4)))))
+(assert (not (and p0_0 p1_0)))
+(assert (not (and p0_0 p2_0)))
+(assert (not (and p0_0 p3_0)))
+(assert (not (and p0_0 p4_0)))
+(assert (not (and p0_0 p5_0)))
+(assert (not (and p1_0 p2_0)))
+(assert (not (and p1_0 p3_0)))
+(assert (not (and p1_0 p4_0)))
+(assert (not (and p1_0 p5_0)))
+(assert (not (and p2_0 p3_0)))
+(assert (not (and p2_0 p4_0)))
+(assert (not (and p2_0 p5_0)))
+(assert (not (and p3_0 p4_0)))
+(assert (not (and p3_0 p5_0)))
+(assert (not (and p4_0 p5_0)))
+(assert (not (and p0_1 p1_1)))
+(assert (not (and p0_1 p2_1)))
+(assert (not (and p0_1 p3_1)))
+(assert (not (and p0_1 p4_1)))
+(assert (not (and p0_1 p5_1)))
+(assert (not (and p1_1 p2_1)))
+(assert (not (and p1_1 p3_1)))
+(assert (not (and p1_1 p4_1)))
+(assert (not (and p1_1 p5_1)))
+(assert (not (and p2_1 p3_1)))
+(assert (not (and p2_1 p4_1)))
+(assert (not (and p2_1 p5_1)))
+(assert (not (and p3_1 p4_1)))
+(assert (not (and p3_1 p5_1)))
+(assert (not (and p4_1 p5_1)))
+(assert (not (and p0_2 p1_2)))
+(assert (not (and p0_2 p2_2)))
+(assert (not (and p0_2 p3_2)))
+(assert (not (and p0_2 p4_2)))
+(assert (not (and p0_2 p5_2)))
+(assert (not (and p1_2 p2_2)))
+(assert (not (and p1_2 p3_2)))
+(assert (not (and p1_2 p4_2)))
+(assert (not (and p1_2 p5_2)))
+(assert (not (and p2_2 p3_2)))
+(assert (not (and p2_2 p4_2)))
+(assert (not (and p2_2 p5_2)))
+(assert (not (and p3_2 p4_2)))
+(assert (not (and p3_2 p5_2)))
+(assert (not (and p4_2 p5_2)))
+(assert (not (and p0_3 p1_3)))
+(assert (not (and p0_3 p2_3)))
+(assert (not (and p0_3 p3_3)))
+(assert (not (and p0_3 p4_3)))
+(assert (not (and p0_3 p5_3)))
+(assert (not (and p1_3 p2_3)))
+(assert (not (and p1_3 p3_3)))
+(assert (not (and p1_3 p4_3)))
+(assert (not (and p1_3 p5_3)))
+(assert (not (and p2_3 p3_3)))
+(assert (not (and p2_3 p4_3)))
+(assert (not (and p2_3 p5_3)))
+(assert (not (and p3_3 p4_3)))
+(assert (not (and p3_3 p5_3)))
+(assert (not (and p4_3 p5_3)))
+(assert (not (and p0_4 p1_4)))
+(assert (not (and p0_4 p2_4)))
+(assert (not (and p0_4 p3_4)))
+(assert (not (and p0_4 p4_4)))
+(assert (not (and p0_4 p5_4)))
+(assert (not (and p1_4 p2_4)))
+(assert (not (and p1_4 p3_4)))
+(assert (not (and p1_4 p4_4)))
+(assert (not (and p1_4 p5_4)))
+(assert (not (and p2_4 p3_4)))
+(assert (not (and p2_4 p4_4)))
+(assert (not (and p2_4 p5_4)))
+(assert (not (and p3_4 p4_4)))
+(assert (not (and p3_4 p5_4)))
+(assert (not (and p4_4 p5_4)))
+(push 1)
+(assert b)
+(check-sat)
+(pop 1)
+(check-sat)
+; the instances of the quantified formula contain the gates (and p0_j (Q cj)),
+; which are restored if they were eliminated when the lemmas are added
+(assert (forall ((y U)) (and (or (not (and p0_0 (Q y))) (R y)) (or (not (and p0_1 (Q y))) (R y)))))
+(check-sat)
+(assert (and p0_0 (Q c0) (not (R c0))))
+(check-sat)
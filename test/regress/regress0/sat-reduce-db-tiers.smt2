@@ -0,0 +1,30 @@
+; COMMAND-LINE: --incremental --sat-reduce-db=tiers --sat-reduce-interval=20 --sat-reduce-interval-inc=10
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+; Pigeons in holes as distinct integers: the conflicts are explained by the
+; theory, which adds its explanations to the local tier of removable clauses.
+(set-logic QF_IDL)
+(declare-fun x0 () Int)
+(declare-fun x1 () Int)
+(declare-fun x2 () Int)
+(declare-fun x3 () Int)
+(declare-fun x4 () Int)
+(declare-fun x5 () Int)
+(assert (and (<= 0 x0) (<= x0 4)))
+(assert (and (<= 0 x1) (<= x1 4)))
+(assert (and (<= 0 x2) (<= x2 4)))
+(assert (and (<= 0 x3) (<= x3 4)))
+(assert (and (<= 0 x4) (<= x4 4)))
+(assert (and (<= 0 x5) (<= x5 4)))
+(push 1)
+(assert (distinct x0 x1 x2 x3 x4 x5))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (distinct x0 x1 x2 x3 x4))
+(check-sat)
+(assert (< x0 1))
+(assert (< x1 1))
+(check-sat)
+(pop 1)
@@ -0,0 +1,138 @@
+/*********************                                                        */
+/*! \file node_manager_concurrent_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of concurrent term construction in a NodeManager.
+ **
+ ** Black box testing of concurrent term construction in a NodeManager
+ ** (requires a build with --threadsafe-nodes).  Also reports the time it
+ ** takes to construct the same terms with one and with several threads.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "util/rational.h"
+
+#ifndef CVC4_THREADSAFE_NODES
+#error "this test is only built with --threadsafe-nodes"
+#endif /* CVC4_THREADSAFE_NODES */
+
+using namespace CVC4;
+using namespace CVC4::kind;
+
+class NodeManagerConcurrentBlack : public CxxTest::TestSuite
+{
+  NodeManager* d_nodeManager;
+  NodeManagerScope* d_scope;
+  std::vector<Node> d_vars;
+
+  static constexpr size_t s_numThreads = 4;
+  static constexpr size_t s_numTerms = 20000;
+
+  /**
+   * Build s_numTerms terms over d_vars (starting at term first, such that
+   * different threads build the shared terms in a different order) and
+   * type-check them.
+   */
+  void buildTerms(size_t first, std::vector<Node>& terms)
+  {
+    NodeManagerConcurrentScope ncs(d_nodeManager);
+    terms.resize(s_numTerms);
+    for (size_t k = 0; k < s_numTerms; ++k)
+    {
+      size_t i = (first + k) % s_numTerms;
+      Node c = d_nodeManager->mkConst(Rational(i % 97));
+      Node x = d_vars[i % d_vars.size()];
+      Node y = d_vars[(i / d_vars.size()) % d_vars.size()];
+      Node t = d_nodeManager->mkNode(MULT, c, d_nodeManager->mkNode(PLUS, x, y));
+      terms[i] = d_nodeManager->mkNode(GEQ, t, c);
+      terms[i].getType(true);
+    }
+  }
+
+  /** Construct the terms with n threads and return the time in ms. */
+  double runThreads(size_t n, std::vector<std::vector<Node>>& terms)
+  {
+    terms.clear();
+    terms.resize(n);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < n; ++t)
+    {
+      threads.emplace_back(&NodeManagerConcurrentBlack::buildTerms,
+                           this,
+                           t * s_numTerms / n,
+                           std::ref(terms[t]));
+    }
+    for (std::thread& t : threads)
+    {
+      t.join();
+    }
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+  }
+
+ public:
+  void setUp() override
+  {
+    d_nodeManager = new NodeManager(NULL);
+    d_scope = new NodeManagerScope(d_nodeManager);
+    TypeNode intType = d_nodeManager->integerType();
+    for (size_t i = 0; i < 64; ++i)
+    {
+      d_vars.push_back(d_nodeManager->mkBoundVar(intType));
+    }
+  }
+
+  void tearDown() override
+  {
+    d_vars.clear();
+    delete d_scope;
+    delete d_nodeManager;
+  }
+
+  void testConcurrentHashConsing()
+  {
+    std::vector<std::vector<Node>> terms;
+    runThreads(s_numThreads, terms);
+    for (size_t t = 1; t < s_numThreads; ++t)
+    {
+      for (size_t i = 0; i < s_numTerms; ++i)
+      {
+        // equal terms are the same NodeValue, no matter who created them
+        TS_ASSERT_EQUALS(terms[0][i], terms[t][i]);
+        TS_ASSERT_EQUALS(terms[0][i].getId(), terms[t][i].getId());
+      }
+    }
+    terms.clear();
+    d_nodeManager->reclaimAllZombies();
+  }
+
+  void testConcurrentConstructionTime()
+  {
+    std::vector<std::vector<Node>> terms;
+    double single = runThreads(1, terms);
+    terms.clear();
+    d_nodeManager->reclaimAllZombies();
+    double multi = runThreads(s_numThreads, terms);
+    std::stringstream ss;
+    ss << "constructing " << s_numTerms << " terms: 1 thread " << single
+       << "ms, " << s_numThreads << " threads " << multi << "ms";
+    TS_TRACE(ss.str());
+  }
+};
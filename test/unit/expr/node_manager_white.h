@@ -91,4 +91,21 @@ class NodeManagerWhite : public CxxTest::TestSuite {
       TS_ASSERT_EQUALS(NodeManager::TopologicalSort(roots), result);
     }
   }
+
+  void testNodeValueAllocatorRecycles()
+  {
+    TypeNode boolType = d_nm->booleanType();
+    Node i = d_nm->mkSkolem("i", boolType);
+    Node j = d_nm->mkSkolem("j", boolType);
+    d_nm->reclaimAllZombies();
+    NodeValue* nv;
+    {
+      Node n = d_nm->mkNode(kind::AND, i, j);
+      nv = n.d_nv;
+    }
+    d_nm->reclaimAllZombies();
+    // the freed slot of the binary node is the first one to be reused
+    Node m = d_nm->mkNode(kind::OR, j, i);
+    TS_ASSERT_EQUALS(m.d_nv, nv);
+  }
 };
@@ -22,6 +22,7 @@
 #include "context/context.h"
 #include "expr/expr_manager.h"
 #include "expr/node_manager.h"
+#include "options/prop_options.h"
 #include "prop/cnf_stream.h"
 #include "prop/prop_engine.h"
 #include "prop/theory_proxy.h"
@@ -45,9 +46,12 @@ using namespace std;
 class FakeSatSolver : public SatSolver {
   SatVariable d_nextVar;
   bool d_addClauseCalled;
+  unsigned d_numClauses;
 
  public:
-  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false) {}
+  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false), d_numClauses(0)
+  {
+  }
 
   SatVariable newVar(bool theoryAtom, bool preRegister, bool canErase) override
   {
@@ -61,6 +65,7 @@ class FakeSatSolver : public SatSolver {
   ClauseId addClause(SatClause& c, bool lemma) override
   {
     d_addClauseCalled = true;
+    ++d_numClauses;
     return ClauseIdUndef;
   }
 
@@ -76,6 +81,8 @@ class FakeSatSolver : public SatSolver {
 
   unsigned int addClauseCalled() { return d_addClauseCalled; }
 
+  unsigned numClauses() const { return d_numClauses; }
+
   unsigned getAssertionLevel() const override { return 0; }
 
   bool isDecision(Node) const { return false; }
@@ -132,6 +139,9 @@ class CnfStreamWhite : public CxxTest::TestSuite {
   {
     d_exprManager = new ExprManager();
     d_smt = new SmtEngine(d_exprManager);
+    // both are disabled by default, and tested below
+    d_smt->setOption("cnf-strash", SExpr(true));
+    d_smt->setOption("cnf-dedup-clauses", SExpr(true));
     d_smt->d_logic.lock();
     d_nodeManager = NodeManager::fromExprManager(d_exprManager);
     d_scope = new SmtScope(d_smt);
@@ -282,4 +292,110 @@ class CnfStreamWhite : public CxxTest::TestSuite {
     TS_ASSERT(d_satSolver->addClauseCalled());
     TS_ASSERT(d_cnfStream->hasLiteral(a_and_b));
   }
+
+  void testStructuralHashing()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node a_and_b = d_nodeManager->mkNode(kind::AND, a, b);
+    d_cnfStream->ensureLiteral(a_and_b);
+    d_cnfStream->ensureLiteral(c);
+    unsigned numClauses = d_satSolver->numClauses();
+
+    // (or (not b) (not a)) is the negation of (and a b)
+    Node nb_or_na =
+        d_nodeManager->mkNode(kind::OR, b.notNode(), a.notNode());
+    d_cnfStream->ensureLiteral(nb_or_na);
+    TS_ASSERT_EQUALS(d_cnfStream->getLiteral(nb_or_na),
+                     ~d_cnfStream->getLiteral(a_and_b));
+
+    // (ite (not c) b a) is (ite c a b)
+    Node ite1 = d_nodeManager->mkNode(kind::ITE, c, a, b);
+    Node ite2 = d_nodeManager->mkNode(kind::ITE, c.notNode(), b, a);
+    d_cnfStream->ensureLiteral(ite1);
+    numClauses = d_satSolver->numClauses();
+    d_cnfStream->ensureLiteral(ite2);
+    TS_ASSERT_EQUALS(d_cnfStream->getLiteral(ite1),
+                     d_cnfStream->getLiteral(ite2));
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses);
+
+    // (= a b) is the negation of (xor a b)
+    Node a_xor_b = d_nodeManager->mkNode(kind::XOR, a, b);
+    Node a_iff_b = d_nodeManager->mkNode(kind::EQUAL, a, b);
+    d_cnfStream->ensureLiteral(a_xor_b);
+    numClauses = d_satSolver->numClauses();
+    d_cnfStream->ensureLiteral(a_iff_b);
+    TS_ASSERT_EQUALS(d_cnfStream->getLiteral(a_iff_b),
+                     ~d_cnfStream->getLiteral(a_xor_b));
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses);
+  }
+
+  void testDuplicateClauses()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    d_cnfStream->convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a, b), false, false);
+    unsigned numClauses = d_satSolver->numClauses();
+    d_cnfStream->convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, b, a), false, false);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses);
+
+    // removable clauses are not filtered
+    d_cnfStream->convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a, b), true, false);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 1);
+
+    // duplicates are only filtered in the context they were asserted in
+    d_cnfContext->push();
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    d_cnfStream->convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a, c), false, false);
+    d_cnfContext->pop();
+    numClauses = d_satSolver->numClauses();
+    d_cnfStream->convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a, c), false, false);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 1);
+  }
+
+  void testPolarityAware()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    options::cnfPolarityAware.set(true);
+    TseitinCnfStream cnfStream(d_satSolver,
+                               d_cnfRegistrar,
+                               d_cnfContext,
+                               &d_smt->getOutputManager(),
+                               d_smt->getResourceManager());
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node d = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node e = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node a_and_b = d_nodeManager->mkNode(kind::AND, a, b);
+    Node c_and_d = d_nodeManager->mkNode(kind::AND, c, d);
+
+    // the conjunctions occur positively only, hence (and a b) -> a and
+    // (and a b) -> b suffice to define them
+    unsigned numClauses = d_satSolver->numClauses();
+    cnfStream.convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a_and_b, c_and_d), false, false);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 5);
+
+    // the definition is completed if the literal is needed in both polarities
+    numClauses = d_satSolver->numClauses();
+    cnfStream.ensureLiteral(a_and_b);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 1);
+    cnfStream.ensureLiteral(a_and_b);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 1);
+
+    // ... or if it occurs negatively later on
+    numClauses = d_satSolver->numClauses();
+    cnfStream.convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, c_and_d.notNode(), e), false, false);
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), numClauses + 2);
+  }
 };
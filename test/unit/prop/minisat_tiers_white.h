@@ -0,0 +1,148 @@
+/*********************                                                        */
+/*! \file minisat_tiers_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of the tiers of removable clauses in MiniSat.
+ **
+ ** White box testing of the reduction of removable clauses by tiers
+ ** (--sat-reduce-db=tiers) in the MiniSat of the DPLL(T) search.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <memory>
+
+#include "context/context.h"
+#include "expr/expr_manager.h"
+#include "prop/minisat/core/Solver.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+
+using namespace CVC4;
+using namespace CVC4::smt;
+using namespace CVC4::Minisat;
+
+class MinisatTiersWhite : public CxxTest::TestSuite
+{
+ public:
+  void setUp() override
+  {
+    d_exprManager.reset(new ExprManager());
+    d_smt.reset(new SmtEngine(d_exprManager.get()));
+    d_smt->setOption("sat-reduce-db", SExpr("tiers"));
+    d_smt->setOption("sat-tier-core-lbd", SExpr(2));
+    d_smt->setOption("sat-tier2-lbd", SExpr(4));
+    d_scope.reset(new SmtScope(d_smt.get()));
+    d_context.reset(new context::Context());
+    // the clauses of these tests contain no theory atoms, which is why the
+    // solver does not need a theory proxy
+    d_solver.reset(new Solver(nullptr, d_context.get(), false));
+    // one variable per decision level, assigned false
+    for (int i = 0; i < 8; ++i)
+    {
+      Var v = d_solver->newVar();
+      d_solver->newDecisionLevel();
+      d_solver->uncheckedEnqueue(mkLit(v, true));
+      d_vars.push_back(v);
+    }
+  }
+
+  void tearDown() override
+  {
+    d_vars.clear();
+    d_solver.reset();
+    d_context.reset();
+    d_scope.reset();
+    d_smt.reset();
+    d_exprManager.reset();
+  }
+
+  void testTheoryClausesStartLocal()
+  {
+    // a clause over two decision levels belongs to the core tier by its LBD,
+    // but a theory clause only gets there once it is used in a conflict
+    CRef cr = addRemovable({0, 1});
+    d_solver->setTierLocal(d_solver->ca[cr]);
+    TS_ASSERT_EQUALS(d_solver->ca[cr].tier(), Solver::TIER_LOCAL);
+
+    // it is promoted once it is used in a conflict
+    d_solver->bumpTier(d_solver->ca[cr]);
+    TS_ASSERT_EQUALS(d_solver->ca[cr].tier(), Solver::TIER_CORE);
+    TS_ASSERT_EQUALS(d_solver->ca[cr].lbd(), 2);
+    TS_ASSERT_EQUALS(d_solver->tier_promotions, 1);
+  }
+
+  void testLearnedClausesByLbd()
+  {
+    CRef core = addRemovable({0, 1});
+    CRef tier2 = addRemovable({0, 1, 2, 3});
+    CRef local = addRemovable({0, 1, 2, 3, 4, 5});
+    Clause& cCore = d_solver->ca[core];
+    d_solver->setTier(cCore, d_solver->computeLbd(cCore));
+    Clause& cTier2 = d_solver->ca[tier2];
+    d_solver->setTier(cTier2, d_solver->computeLbd(cTier2));
+    Clause& cLocal = d_solver->ca[local];
+    d_solver->setTier(cLocal, d_solver->computeLbd(cLocal));
+    TS_ASSERT_EQUALS(d_solver->ca[core].tier(), Solver::TIER_CORE);
+    TS_ASSERT_EQUALS(d_solver->ca[tier2].tier(), Solver::TIER_2);
+    TS_ASSERT_EQUALS(d_solver->ca[local].tier(), Solver::TIER_LOCAL);
+  }
+
+  void testReduce()
+  {
+    CRef tier2 = addRemovable({0, 1, 2, 3});
+    Clause& cTier2 = d_solver->ca[tier2];
+    d_solver->setTier(cTier2, d_solver->computeLbd(cTier2));
+    for (int i = 0; i < 4; ++i)
+    {
+      d_solver->setTierLocal(d_solver->ca[addRemovable({0, 1, i + 2})]);
+    }
+    TS_ASSERT_EQUALS(d_solver->clauses_removable.size(), 5);
+
+    // the first reduction keeps the tier2 clause, which was used since it
+    // was added, and removes half of the local clauses
+    d_solver->reduceDBTiers();
+    TS_ASSERT_EQUALS(d_solver->reduce_dbs, 1);
+    TS_ASSERT_EQUALS(d_solver->tier2_demotions, 0);
+    TS_ASSERT_EQUALS(d_solver->clauses_removable.size(), 3);
+    TS_ASSERT_EQUALS(d_solver->learnts_tier2, 1);
+    TS_ASSERT_EQUALS(d_solver->learnts_local, 2);
+
+    // the second one demotes the unused tier2 clause to the local tier
+    d_solver->reduceDBTiers();
+    TS_ASSERT_EQUALS(d_solver->tier2_demotions, 1);
+    TS_ASSERT_EQUALS(d_solver->learnts_tier2, 0);
+  }
+
+ private:
+  /**
+   * Adds a removable clause with the (false) literals of the variables of the
+   * given decision levels (starting at 0 for level 1).
+   */
+  CRef addRemovable(std::initializer_list<int> levels)
+  {
+    vec<Lit> lits;
+    for (int l : levels)
+    {
+      lits.push(mkLit(d_vars[l], false));
+    }
+    CRef cr = d_solver->ca.alloc(0, lits, true);
+    d_solver->clauses_removable.push(cr);
+    d_solver->attachClause(cr);
+    return cr;
+  }
+
+  std::unique_ptr<ExprManager> d_exprManager;
+  std::unique_ptr<SmtEngine> d_smt;
+  std::unique_ptr<SmtScope> d_scope;
+  std::unique_ptr<context::Context> d_context;
+  std::unique_ptr<Solver> d_solver;
+  std::vector<Var> d_vars;
+};
@@ -0,0 +1,124 @@
+/*********************                                                        */
+/*! \file arith_constraint_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of the storage of the arithmetic constraints
+ **
+ ** White box testing of CVC4::theory::arith::SortedConstraintMap and
+ ** CVC4::theory::arith::ConstraintArena.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "theory/arith/constraint.h"
+#include "theory/arith/constraint_arena.h"
+#include "theory/arith/delta_rational.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::arith;
+
+using namespace std;
+
+class ArithConstraintWhite : public CxxTest::TestSuite
+{
+  ConstraintArena<Constraint> d_constraints;
+  ConstraintArena<ValueCollection> d_valueCollections;
+
+  /** Makes a ValueCollection with an upper bound of value v on x. */
+  ValueCollection* mkValueCollection(const DeltaRational& v)
+  {
+    ValueCollection* vc = d_valueCollections.make();
+    vc->add(d_constraints.make(0, UpperBound, v));
+    return vc;
+  }
+
+  /** Destroys vc and its upper bound. */
+  void destroy(ValueCollection* vc)
+  {
+    d_constraints.destroy(vc->getUpperBound());
+    d_valueCollections.destroy(vc);
+  }
+
+ public:
+  void testSortedConstraintMap()
+  {
+    SortedConstraintMap scm;
+    vector<ValueCollection*> vcs;
+    // values 0, 0+delta, 1, 1+delta, ..., inserted out of order
+    for (int k = 0; k < 20; ++k)
+    {
+      int i = (7 * k) % 20;
+      vcs.push_back(mkValueCollection(DeltaRational(i / 2, i % 2)));
+      scm.insert(vcs.back());
+    }
+    TS_ASSERT_EQUALS(scm.size(), 20u);
+    for (SortedConstraintMap::const_iterator i = scm.begin(),
+                                             j = scm.begin() + 1;
+         j != scm.end();
+         ++i, ++j)
+    {
+      TS_ASSERT((*i)->getValue() < (*j)->getValue());
+    }
+    for (ValueCollection* vc : vcs)
+    {
+      TS_ASSERT_EQUALS(*scm.find(vc), vc);
+      TS_ASSERT_EQUALS(scm.lookup(vc->getValue()), vc);
+    }
+
+    TS_ASSERT(scm.lookup(DeltaRational(3, -1)) == NULL);
+    TS_ASSERT_EQUALS((*scm.lower_bound(DeltaRational(3, -1)))->getValue(),
+                     DeltaRational(3, 0));
+    TS_ASSERT_EQUALS((*scm.lower_bound(DeltaRational(3, 0)))->getValue(),
+                     DeltaRational(3, 0));
+    TS_ASSERT(scm.lower_bound(DeltaRational(10, 0)) == scm.end());
+    TS_ASSERT(scm.lower_bound(DeltaRational(-1, 0)) == scm.begin());
+
+    for (ValueCollection* vc : vcs)
+    {
+      scm.erase(vc);
+      TS_ASSERT(scm.lookup(vc->getValue()) == NULL);
+      destroy(vc);
+    }
+    TS_ASSERT(scm.empty());
+    TS_ASSERT_EQUALS(d_constraints.getLive(), 0u);
+    TS_ASSERT_EQUALS(d_valueCollections.getLive(), 0u);
+  }
+
+  void testConstraintArenaReuse()
+  {
+    ConstraintArena<ValueCollection> arena;
+    TS_ASSERT_EQUALS(arena.getBytes(), 0u);
+    vector<ValueCollection*> vcs;
+    for (size_t i = 0; i < ConstraintArena<ValueCollection>::SLOTS_PER_SLAB;
+         ++i)
+    {
+      vcs.push_back(arena.make());
+    }
+    size_t bytes = arena.getBytes();
+    TS_ASSERT_LESS_THAN(0u, bytes);
+
+    // destroyed slots are reused before a new slab is allocated
+    ValueCollection* last = vcs.back();
+    arena.destroy(last);
+    TS_ASSERT_EQUALS(arena.make(), last);
+    TS_ASSERT_EQUALS(arena.getBytes(), bytes);
+    vcs.push_back(arena.make());
+    TS_ASSERT_LESS_THAN(bytes, arena.getBytes());
+
+    for (ValueCollection* vc : vcs)
+    {
+      TS_ASSERT(vc->empty());
+      arena.destroy(vc);
+    }
+    TS_ASSERT_EQUALS(arena.getLive(), 0u);
+  }
+};
@@ -0,0 +1,191 @@
+/*********************                                                        */
+/*! \file arith_tableau_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Andres Noetzli
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of the storage of CVC4::theory::arith::Tableau
+ **
+ ** White box testing of the storage of CVC4::theory::arith::Tableau.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <map>
+#include <vector>
+
+#include "theory/arith/tableau.h"
+#include "theory/arith/tableau_copy.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::arith;
+
+using namespace std;
+
+class ArithTableauWhite : public CxxTest::TestSuite
+{
+  static const ArithVar s_numNonbasic = 6;
+  static const ArithVar s_numBasic = 5;
+
+  /** Adds the same rows to the tableau t. */
+  void addRows(Tableau& t)
+  {
+    t.increaseSizeTo(s_numNonbasic + s_numBasic);
+    for (ArithVar b = 0; b < s_numBasic; ++b)
+    {
+      vector<Rational> coeffs;
+      vector<ArithVar> vars;
+      for (ArithVar x = 0; x < s_numNonbasic; ++x)
+      {
+        int c = static_cast<int>((3 * b + 5 * x) % 7) - 3;
+        if (c != 0)
+        {
+          coeffs.push_back(Rational(c, static_cast<int>(b) + 1));
+          vars.push_back(x);
+        }
+      }
+      t.addRow(s_numNonbasic + b, coeffs, vars);
+    }
+  }
+
+  /** Returns the row of basic as a map from variables to coefficients. */
+  map<ArithVar, Rational> getRow(const Tableau& t, ArithVar basic)
+  {
+    map<ArithVar, Rational> row;
+    for (Tableau::RowIterator i = t.basicRowIterator(basic); !i.atEnd(); ++i)
+    {
+      row[(*i).getColVar()] = (*i).getCoefficient();
+    }
+    return row;
+  }
+
+  /** Checks that the column lists match the rows. */
+  void checkColumns(const Tableau& t)
+  {
+    uint32_t entries = 0;
+    for (ArithVar x = 0; x < t.getNumColumns(); ++x)
+    {
+      uint32_t length = 0;
+      for (Tableau::ColIterator i = t.colIterator(x); !i.atEnd(); ++i)
+      {
+        const Tableau::Entry& entry = *i;
+        TS_ASSERT_EQUALS(entry.getColVar(), x);
+        ArithVar basic = t.rowIndexToBasic(entry.getRowIndex());
+        TS_ASSERT_EQUALS(getRow(t, basic)[x], entry.getCoefficient());
+        ++length;
+      }
+      TS_ASSERT_EQUALS(length, t.getColLength(x));
+      entries += length;
+    }
+    TS_ASSERT_EQUALS(entries, t.size());
+  }
+
+ public:
+  void testCompactRowsPivot()
+  {
+    Tableau linked, compact;
+    compact.setCompactRows(true);
+    addRows(linked);
+    addRows(compact);
+
+    NoEffectCCCB cb;
+    for (uint32_t round = 0; round < 20; ++round)
+    {
+      // pivot the smallest basic variable with the last variable of its row
+      ArithVar basic = *linked.beginBasic();
+      ArithVar nonbasic = ARITHVAR_SENTINEL;
+      for (Tableau::RowIterator i = linked.basicRowIterator(basic);
+           !i.atEnd();
+           ++i)
+      {
+        if ((*i).getColVar() != basic)
+        {
+          nonbasic = (*i).getColVar();
+        }
+      }
+      TS_ASSERT(nonbasic != ARITHVAR_SENTINEL);
+      linked.pivot(basic, nonbasic, cb);
+      compact.pivot(basic, nonbasic, cb);
+
+      for (Tableau::BasicIterator i = linked.beginBasic(),
+                                  i_end = linked.endBasic();
+           i != i_end;
+           ++i)
+      {
+        TS_ASSERT(compact.isBasic(*i));
+        TS_ASSERT(getRow(linked, *i) == getRow(compact, *i));
+      }
+      checkColumns(compact);
+    }
+    TS_ASSERT_EQUALS(linked.getCompactions(), 0u);
+    TS_ASSERT_LESS_THAN(0u, compact.getCompactions());
+  }
+
+  void testCompactRowsLayout()
+  {
+    Tableau t;
+    addRows(t);
+    t.compactRows();
+    checkColumns(t);
+    // the entries of each row are consecutive, in the order of the rows
+    EntryID next = 0;
+    for (RowIndex rid = 0; rid < t.getNumRows(); ++rid)
+    {
+      for (Tableau::RowIterator i = t.ridRowIterator(rid); !i.atEnd(); ++i)
+      {
+        TS_ASSERT_EQUALS(i.getID(), next);
+        ++next;
+      }
+    }
+    TS_ASSERT_EQUALS(next, t.size());
+  }
+
+  void testTableauCopyPivot()
+  {
+    // the copy reads the rows of orig, which must not change, and is pivoted
+    // along with t
+    Tableau orig, t;
+    addRows(orig);
+    addRows(t);
+    TableauCopy<Rational> copy(orig, orig.getNumColumns());
+    TS_ASSERT_EQUALS(copy.getRowsCopied(), 0u);
+    copy.getRow(s_numNonbasic);
+    TS_ASSERT_EQUALS(copy.getRowsCopied(), 1u);
+
+    NoEffectCCCB cb;
+    for (uint32_t round = 0; round < 20; ++round)
+    {
+      ArithVar basic = *t.beginBasic();
+      ArithVar nonbasic = ARITHVAR_SENTINEL;
+      for (Tableau::RowIterator i = t.basicRowIterator(basic); !i.atEnd();
+           ++i)
+      {
+        if ((*i).getColVar() != basic)
+        {
+          nonbasic = (*i).getColVar();
+        }
+      }
+      t.pivot(basic, nonbasic, cb);
+      copy.pivot(basic, nonbasic);
+
+      for (ArithVar x = 0; x < t.getNumColumns(); ++x)
+      {
+        TS_ASSERT_EQUALS(copy.isBasic(x), t.isBasic(x));
+        if (t.isBasic(x))
+        {
+          map<ArithVar, Rational> row = getRow(t, x);
+          row.erase(x);
+          const TableauCopy<Rational>::Row& copyRow = copy.getRow(x);
+          map<ArithVar, Rational> copied(copyRow.begin(), copyRow.end());
+          TS_ASSERT(row == copied);
+        }
+      }
+    }
+  }
+};
@@ -0,0 +1,279 @@
+/*********************                                                        */
+/*! \file equality_engine_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of CVC4::theory::eq::EqualityEngine
+ **
+ ** White box testing of CVC4::theory::eq::EqualityEngine.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include "context/context.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+#include "theory/uf/equality_engine.h"
+#include "theory/uf/node_id_map.h"
+
+using namespace CVC4;
+using namespace CVC4::context;
+using namespace CVC4::smt;
+using namespace CVC4::theory::eq;
+
+using namespace std;
+
+class EqualityEngineWhite : public CxxTest::TestSuite
+{
+  ExprManager* d_em;
+  NodeManager* d_nm;
+  SmtEngine* d_smt;
+  SmtScope* d_scope;
+  Context* d_ctxt;
+
+  /** The number of terms of the merge benchmark */
+  static const unsigned s_numTerms = 50000;
+
+  /** Returns true if the reasons are the given equalities, in any order. */
+  static bool sameReasons(vector<TNode> reasons, vector<TNode> expected)
+  {
+    sort(reasons.begin(), reasons.end());
+    sort(expected.begin(), expected.end());
+    return reasons == expected;
+  }
+
+ public:
+  void setUp() override
+  {
+    d_em = new ExprManager();
+    d_nm = NodeManager::fromExprManager(d_em);
+    d_smt = new SmtEngine(d_em);
+    d_scope = new SmtScope(d_smt);
+    d_smt->finishInit();
+    d_ctxt = new Context();
+  }
+
+  void tearDown() override
+  {
+    delete d_ctxt;
+    delete d_scope;
+    delete d_smt;
+    delete d_em;
+  }
+
+  void testExplanationCache()
+  {
+    TypeNode u = d_nm->mkSort("U");
+    Node f = d_nm->mkVar("f", d_nm->mkFunctionType(u, u));
+    vector<Node> x;
+    for (unsigned i = 0; i < 5; ++i)
+    {
+      x.push_back(d_nm->mkVar(u));
+    }
+    Node fx0 = d_nm->mkNode(kind::APPLY_UF, f, x[0]);
+    Node fx3 = d_nm->mkNode(kind::APPLY_UF, f, x[3]);
+    vector<Node> eqs;
+    for (unsigned i = 0; i + 1 < x.size(); ++i)
+    {
+      eqs.push_back(x[i].eqNode(x[i + 1]));
+    }
+
+    EqualityEngine* ee = new EqualityEngine(d_ctxt, "ee", false);
+    ee->addFunctionKind(kind::APPLY_UF);
+    ee->addTerm(fx0);
+    ee->addTerm(fx3);
+    ee->addTerm(x[4]);
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      ee->assertEquality(eqs[i], true, eqs[i]);
+    }
+    TS_ASSERT(ee->areEqual(fx0, fx3));
+
+    vector<TNode> reasons;
+    ee->explainEquality(x[0], x[3], true, reasons);
+    TS_ASSERT(sameReasons(reasons, {eqs[0], eqs[1], eqs[2]}));
+    TS_ASSERT_EQUALS(ee->d_stats.d_explanationCacheHits.getData(), 0);
+
+    // the explanations of the nodes on the path are cached as well
+    reasons.clear();
+    ee->explainEquality(x[3], x[1], true, reasons);
+    TS_ASSERT(sameReasons(reasons, {eqs[1], eqs[2]}));
+    TS_ASSERT_EQUALS(ee->d_stats.d_explanationCacheHits.getData(), 1);
+
+    // congruence looks up the explanation of its arguments
+    reasons.clear();
+    ee->explainEquality(fx0, fx3, true, reasons);
+    TS_ASSERT(sameReasons(reasons, {eqs[0], eqs[1], eqs[2]}));
+    TS_ASSERT_EQUALS(ee->d_stats.d_explanationCacheHits.getData(), 2);
+
+    size_t cached = ee->d_explanationCache.size();
+    d_ctxt->push();
+    ee->assertEquality(eqs[3], true, eqs[3]);
+    reasons.clear();
+    ee->explainEquality(x[4], x[0], true, reasons);
+    TS_ASSERT(sameReasons(reasons, {eqs[0], eqs[1], eqs[2], eqs[3]}));
+    TS_ASSERT_LESS_THAN(cached, ee->d_explanationCache.size());
+    d_ctxt->pop();
+
+    // the explanations using the popped equality are gone
+    TS_ASSERT_EQUALS(ee->d_explanationCache.size(), cached);
+    TS_ASSERT_EQUALS(ee->d_explanationReasons.size(),
+                     ee->d_explanationReasonsSize.get());
+    reasons.clear();
+    ee->explainEquality(x[0], x[2], true, reasons);
+    TS_ASSERT(sameReasons(reasons, {eqs[0], eqs[1]}));
+
+    delete ee;
+  }
+
+  void testNodeIdMap()
+  {
+    TypeNode u = d_nm->mkSort("U");
+    vector<Node> x;
+    for (unsigned i = 0; i < 3 * NodeIdMap::PAGE_SIZE; ++i)
+    {
+      x.push_back(d_nm->mkVar(u));
+    }
+    NodeIdMap ids;
+    TS_ASSERT_EQUALS(ids.find(x[0]), null_id);
+    // skip the middle page
+    for (unsigned i = 0; i < x.size(); i += 2)
+    {
+      if (i < NodeIdMap::PAGE_SIZE || i >= 2 * NodeIdMap::PAGE_SIZE)
+      {
+        ids.insert(x[i], i);
+      }
+    }
+    for (unsigned i = 0; i < x.size(); ++i)
+    {
+      bool inserted = i % 2 == 0
+                      && (i < NodeIdMap::PAGE_SIZE
+                          || i >= 2 * NodeIdMap::PAGE_SIZE);
+      TS_ASSERT_EQUALS(ids.find(x[i]), inserted ? i : null_id);
+    }
+    ids.erase(x[0]);
+    TS_ASSERT_EQUALS(ids.find(x[0]), null_id);
+    TS_ASSERT_EQUALS(ids.find(x[2]), 2u);
+  }
+
+  void testMergeTime()
+  {
+    TypeNode u = d_nm->mkSort("U");
+    Node f = d_nm->mkVar("f", d_nm->mkFunctionType(u, u));
+    vector<Node> x, fx, eqs;
+    for (unsigned i = 0; i < s_numTerms; ++i)
+    {
+      x.push_back(d_nm->mkVar(u));
+      fx.push_back(d_nm->mkNode(kind::APPLY_UF, f, x.back()));
+    }
+    // merge the terms in an order unrelated to their ids
+    for (unsigned i = 0; i + 1 < s_numTerms; ++i)
+    {
+      eqs.push_back(x[i * 7919 % s_numTerms].eqNode(
+          x[(i + 1) * 7919 % s_numTerms]));
+    }
+
+    EqualityEngine* ee = new EqualityEngine(d_ctxt, "ee", false);
+    ee->addFunctionKind(kind::APPLY_UF);
+    for (const Node& t : fx)
+    {
+      ee->addTerm(t);
+    }
+
+    d_ctxt->push();
+    auto start = std::chrono::steady_clock::now();
+    for (const Node& eq : eqs)
+    {
+      ee->assertEquality(eq, true, eq);
+    }
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    TS_ASSERT(ee->areEqual(fx[0], fx[s_numTerms - 1]));
+    TS_ASSERT(ee->areEqual(x[1], x[s_numTerms - 2]));
+    d_ctxt->pop();
+
+    TS_ASSERT(!ee->areEqual(fx[0], fx[s_numTerms - 1]));
+    TS_ASSERT(ee->hasTerm(x[s_numTerms - 1]));
+    TS_ASSERT(!ee->d_nodeRecords[ee->getNodeId(x[0])].isInternal());
+    TS_ASSERT(ee->d_nodeRecords[ee->getNodeId(f)].isInternal());
+
+    std::stringstream ss;
+    ss << "merging " << s_numTerms << " terms with " << s_numTerms
+       << " applications: " << elapsed.count() << "ms";
+    TS_TRACE(ss.str());
+
+    delete ee;
+  }
+
+  void testBatchedMerges()
+  {
+    TypeNode u = d_nm->mkSort("U");
+    Node f = d_nm->mkVar("f", d_nm->mkFunctionType(u, u));
+    vector<Node> x, ffx, eqs;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+      x.push_back(d_nm->mkVar(u));
+      ffx.push_back(d_nm->mkNode(
+          kind::APPLY_UF, f, d_nm->mkNode(kind::APPLY_UF, f, x.back())));
+    }
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      eqs.push_back(x[i].eqNode(x[i + 1]));
+    }
+    Node deq = ffx[0].eqNode(ffx[3]);
+
+    EqualityEngine* ee = new EqualityEngine(d_ctxt, "ee", false);
+    ee->addFunctionKind(kind::APPLY_UF);
+    for (const Node& t : ffx)
+    {
+      ee->addTerm(t);
+    }
+
+    d_ctxt->push();
+    ee->beginBatch();
+    for (const Node& eq : eqs)
+    {
+      ee->assertEquality(eq, true, eq);
+    }
+    // nothing is merged before the end of the batch
+    TS_ASSERT(!ee->areEqual(x[0], x[1]));
+    ee->endBatch();
+    TS_ASSERT(ee->areEqual(x[0], x[3]));
+    TS_ASSERT(ee->areEqual(ffx[0], ffx[3]));
+    // one sweep for the arguments and one for the inner applications
+    TS_ASSERT_EQUALS(ee->d_stats.d_batchedEqualitiesCount.getData(), 3);
+    TS_ASSERT_LESS_THAN_EQUALS(2, ee->d_stats.d_useListSweepsCount.getData());
+    d_ctxt->pop();
+    TS_ASSERT(!ee->areEqual(ffx[0], ffx[3]));
+
+    // a batch contradicting a disequality
+    d_ctxt->push();
+    ee->assertEquality(deq, false, deq.notNode());
+    TS_ASSERT(!ee->d_done);
+    ee->beginBatch();
+    for (const Node& eq : eqs)
+    {
+      ee->assertEquality(eq, true, eq);
+    }
+    ee->endBatch();
+    TS_ASSERT(ee->d_done);
+    TS_ASSERT(ee->d_deferredUseLists.empty());
+    d_ctxt->pop();
+    TS_ASSERT(!ee->d_done);
+
+    delete ee;
+  }
+};
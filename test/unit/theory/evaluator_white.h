@@ -122,6 +122,48 @@ class TheoryEvaluatorWhite : public CxxTest::TestSuite
                          args.begin(), args.end(), vals.begin(), vals.end())));
   }
 
+  void testBitVector()
+  {
+    TypeNode bv8Type = d_nm->mkBitVectorType(8);
+
+    Node x = d_nm->mkVar("x", bv8Type);
+    Node y = d_nm->mkVar("y", bv8Type);
+    Node p = d_nm->mkVar("p", d_nm->booleanType());
+
+    std::vector<Node> args = {x, y, p};
+    std::vector<Node> vals = {d_nm->mkConst(BitVector(8, 0xf3u)),
+                              d_nm->mkConst(BitVector(8, 0x05u)),
+                              d_nm->mkConst(true)};
+    std::vector<Node> terms = {
+        d_nm->mkNode(kind::BITVECTOR_SUB, x, y),
+        d_nm->mkNode(kind::BITVECTOR_SHL, x, y),
+        d_nm->mkNode(kind::BITVECTOR_LSHR, x, y),
+        d_nm->mkNode(kind::BITVECTOR_ASHR, x, y),
+        d_nm->mkNode(d_nm->mkConst(BitVectorZeroExtend(4)), x),
+        bv::utils::mkSignExtend(x, 4),
+        d_nm->mkNode(kind::BITVECTOR_ULT, x, y),
+        d_nm->mkNode(kind::BITVECTOR_ULE, x, y),
+        d_nm->mkNode(kind::BITVECTOR_UGT, x, y),
+        d_nm->mkNode(kind::BITVECTOR_UGE, x, y),
+        d_nm->mkNode(kind::BITVECTOR_SLT, x, y),
+        d_nm->mkNode(kind::BITVECTOR_SLE, x, y),
+        d_nm->mkNode(kind::BITVECTOR_SGT, x, y),
+        d_nm->mkNode(kind::BITVECTOR_SGE, x, y),
+        d_nm->mkNode(kind::XOR, p, d_nm->mkNode(kind::BITVECTOR_ULT, x, y)),
+        d_nm->mkNode(kind::IMPLIES, p, d_nm->mkNode(kind::EQUAL, x, y))};
+
+    // these kinds are evaluated without calling the rewriter
+    Evaluator eval;
+    for (const Node& t : terms)
+    {
+      Node r = eval.eval(t, args, vals, false);
+      TS_ASSERT(!r.isNull());
+      TS_ASSERT_EQUALS(r,
+                       Rewriter::rewrite(t.substitute(
+                           args.begin(), args.end(), vals.begin(), vals.end())));
+    }
+  }
+
   void testStrIdOf()
   {
     Node a = d_nm->mkConst(String("A"));
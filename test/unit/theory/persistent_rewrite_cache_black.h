@@ -0,0 +1,190 @@
+/*********************                                                        */
+/*! \file persistent_rewrite_cache_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of the persistent rewrite cache.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "api/cvc4cpp.h"
+#include "expr/expr_manager.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+#include "theory/persistent_rewrite_cache.h"
+#include "theory/rewriter.h"
+
+using namespace CVC4;
+using namespace CVC4::kind;
+using namespace CVC4::smt;
+using namespace CVC4::theory;
+
+class PersistentRewriteCacheBlack : public CxxTest::TestSuite
+{
+ public:
+  void setUp() override
+  {
+    std::remove(d_filename.c_str());
+    startSolver();
+  }
+
+  void tearDown() override
+  {
+    stopSolver();
+    std::remove(d_filename.c_str());
+  }
+
+  void testReloadInOtherSolver()
+  {
+    Node t = mkIntTerm();
+    Node rt = Rewriter::rewrite(t);
+    TS_ASSERT_DIFFERS(t, rt);
+    {
+      PersistentRewriteCache cache(d_filename, 42, 0);
+      TS_ASSERT(cache.lookup(t).isNull());
+      cache.store(t, rt);
+      // pending entries are found before they are flushed
+      TS_ASSERT_EQUALS(cache.lookup(t), rt);
+    }
+
+    // the terms of another solver have other ids, the cache is structural
+    stopSolver();
+    startSolver();
+    Node t2 = mkIntTerm();
+    PersistentRewriteCache cache(d_filename, 42, 0);
+    TS_ASSERT_EQUALS(cache.lookup(t2), Rewriter::rewrite(t2));
+  }
+
+  void testBitVectors()
+  {
+    Node t = mkBvTerm();
+    Node rt = Rewriter::rewrite(t);
+    {
+      PersistentRewriteCache cache(d_filename, 42, 0);
+      cache.store(t, rt);
+      cache.flush();
+    }
+    PersistentRewriteCache cache(d_filename, 42, 0);
+    TS_ASSERT_EQUALS(cache.lookup(t), rt);
+  }
+
+  void testAppend()
+  {
+    Node t = mkIntTerm();
+    Node u = mkBvTerm();
+    {
+      // the first entry is flushed by store()
+      PersistentRewriteCache cache(d_filename, 42, 0, 1);
+      cache.store(t, Rewriter::rewrite(t));
+      PersistentRewriteCache other(d_filename, 42, 0);
+      TS_ASSERT_EQUALS(other.lookup(t), Rewriter::rewrite(t));
+    }
+    {
+      PersistentRewriteCache cache(d_filename, 42, 0);
+      TS_ASSERT_EQUALS(cache.lookup(t), Rewriter::rewrite(t));
+      cache.store(u, Rewriter::rewrite(u));
+    }
+    PersistentRewriteCache cache(d_filename, 42, 0);
+    TS_ASSERT_EQUALS(cache.lookup(t), Rewriter::rewrite(t));
+    TS_ASSERT_EQUALS(cache.lookup(u), Rewriter::rewrite(u));
+  }
+
+  void testFingerprintMismatch()
+  {
+    Node t = mkIntTerm();
+    {
+      PersistentRewriteCache cache(d_filename, 42, 0);
+      cache.store(t, Rewriter::rewrite(t));
+    }
+    {
+      PersistentRewriteCache cache(d_filename, 43, 0);
+      TS_ASSERT(cache.lookup(t).isNull());
+      // replaces the file of the other configuration
+      cache.store(t, Rewriter::rewrite(t));
+    }
+    PersistentRewriteCache cache(d_filename, 43, 0);
+    TS_ASSERT_EQUALS(cache.lookup(t), Rewriter::rewrite(t));
+    PersistentRewriteCache old(d_filename, 42, 0);
+    TS_ASSERT(old.lookup(t).isNull());
+  }
+
+  void testUnkeyableTerms()
+  {
+    // distinct symbols with the same name cannot be told apart
+    Node x1 = mkVar("x", d_nm->integerType());
+    Node x2 = mkVar("x", d_nm->integerType());
+    Node t = d_nm->mkNode(PLUS, x1, x2);
+    {
+      PersistentRewriteCache cache(d_filename, 42, 0);
+      cache.store(t, Rewriter::rewrite(t));
+    }
+    PersistentRewriteCache cache(d_filename, 42, 0);
+    TS_ASSERT(cache.lookup(t).isNull());
+  }
+
+ private:
+  void startSolver()
+  {
+    d_slv.reset(new api::Solver());
+    d_scope.reset(new SmtScope(d_slv->getSmtEngine()));
+    // ensure that the SMT engine is fully initialized (required for the
+    // rewriter)
+    d_slv->getSmtEngine()->push();
+    d_nm = NodeManager::fromExprManager(d_slv->getExprManager());
+  }
+
+  void stopSolver()
+  {
+    d_scope.reset();
+    d_slv.reset();
+  }
+
+  /** Make a (user-declared) variable of the given type. */
+  Node mkVar(const std::string& name, TypeNode type)
+  {
+    ExprManager* em = d_slv->getExprManager();
+    return Node::fromExpr(em->mkVar(name, type.toType()));
+  }
+
+  /** (+ (* 2 x) 0 y x) */
+  Node mkIntTerm()
+  {
+    Node x = mkVar("x", d_nm->integerType());
+    Node y = mkVar("y", d_nm->integerType());
+    Node two = d_nm->mkConst(Rational(2));
+    Node zero = d_nm->mkConst(Rational(0));
+    std::vector<Node> children = {d_nm->mkNode(MULT, two, x), zero, y, x};
+    return d_nm->mkNode(PLUS, children);
+  }
+
+  /** ((_ extract 7 0) (bvadd z (concat #x00 #x01))) */
+  Node mkBvTerm()
+  {
+    Node z = mkVar("z", d_nm->mkBitVectorType(16));
+    Node c = d_nm->mkNode(BITVECTOR_CONCAT,
+                          d_nm->mkConst(BitVector(8, 0u)),
+                          d_nm->mkConst(BitVector(8, 1u)));
+    Node ext = d_nm->mkConst(BitVectorExtract(7, 0));
+    return d_nm->mkNode(
+        BITVECTOR_EXTRACT, ext, d_nm->mkNode(BITVECTOR_PLUS, z, c));
+  }
+
+  const std::string d_filename = "persistent_rewrite_cache.tmp";
+  std::unique_ptr<api::Solver> d_slv;
+  std::unique_ptr<SmtScope> d_scope;
+  NodeManager* d_nm;
+};
@@ -0,0 +1,92 @@
+/*********************                                                        */
+/*! \file rewrite_cache_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of the cache of the rewriter.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <memory>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "theory/rewrite_cache.h"
+
+using namespace CVC4;
+using namespace CVC4::theory;
+
+class RewriteCacheBlack : public CxxTest::TestSuite
+{
+ public:
+  void setUp() override
+  {
+    d_nm.reset(new NodeManager(nullptr));
+    d_scope.reset(new NodeManagerScope(d_nm.get()));
+  }
+
+  void tearDown() override
+  {
+    d_scope.reset();
+    d_nm.reset();
+  }
+
+  void testGetSet()
+  {
+    RewriteCache cache;
+    Node x = d_nm->mkSkolem("x", d_nm->booleanType());
+    Node y = d_nm->mkSkolem("y", d_nm->booleanType());
+    Node nx = d_nm->mkNode(kind::NOT, x);
+    Node nnx = d_nm->mkNode(kind::NOT, nx);
+    TS_ASSERT(cache.get(nnx).isNull());
+    cache.set(nnx, x);
+    cache.set(nx, nx);
+    TS_ASSERT_EQUALS(cache.get(nnx), x);
+    TS_ASSERT_EQUALS(cache.get(nx), nx);
+    TS_ASSERT(cache.get(y).isNull());
+    cache.set(nnx, y);
+    TS_ASSERT_EQUALS(cache.get(nnx), y);
+    TS_ASSERT_EQUALS(cache.size(), 2u);
+    cache.clear();
+    TS_ASSERT(cache.get(nnx).isNull());
+    TS_ASSERT_EQUALS(cache.size(), 0u);
+  }
+
+  void testGrowAndEvict()
+  {
+    std::vector<Node> vars;
+    for (size_t i = 0; i < 10000; ++i)
+    {
+      vars.push_back(d_nm->mkSkolem("x", d_nm->booleanType()));
+    }
+    RewriteCache unbounded;
+    RewriteCache bounded(1024);
+    size_t evictions = 0;
+    for (const Node& v : vars)
+    {
+      TS_ASSERT(!unbounded.set(v, v));
+      evictions += bounded.set(v, v) ? 1 : 0;
+    }
+    TS_ASSERT_EQUALS(unbounded.size(), vars.size());
+    TS_ASSERT_LESS_THAN_EQUALS(bounded.size(), 1024u);
+    TS_ASSERT_EQUALS(bounded.size() + evictions, vars.size());
+    for (const Node& v : vars)
+    {
+      TS_ASSERT_EQUALS(unbounded.get(v), v);
+    }
+    // the most recently inserted node is never evicted
+    TS_ASSERT_EQUALS(bounded.get(vars.back()), vars.back());
+  }
+
+ private:
+  std::unique_ptr<NodeManager> d_nm;
+  std::unique_ptr<NodeManagerScope> d_scope;
+};
@@ -329,4 +329,69 @@ public:
     TS_ASSERT_EQUALS(Rewriter::rewrite(Rewriter::rewrite(t)),
                      Rewriter::rewrite(t));
   }
+
+  /** Returns true if n was propagated or is a literal of a lemma. */
+  bool wasImplied(TNode n)
+  {
+    for (unsigned i = 0; i < d_outputChannel.getNumCalls(); ++i)
+    {
+      Node m = d_outputChannel.getIthNode(i);
+      if (m == n)
+      {
+        return true;
+      }
+      if (d_outputChannel.getIthCallType(i) == LEMMA && m.getKind() == OR)
+      {
+        for (const Node& lit : m)
+        {
+          if (lit == n)
+          {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  void testRowPropagation()
+  {
+    Node x = d_nm->mkVar(*d_realType);
+    Node y = d_nm->mkVar(*d_realType);
+    Node sum = d_nm->mkNode(PLUS, x, y);
+    Node c1 = d_nm->mkConst<Rational>(d_one);
+    Node c2 = d_nm->mkConst<Rational>(Rational(2));
+    Node c3 = d_nm->mkConst<Rational>(Rational(3));
+    Node c5 = d_nm->mkConst<Rational>(Rational(5));
+    Node c6 = d_nm->mkConst<Rational>(Rational(6));
+
+    Node xGeq1 = Rewriter::rewrite(d_nm->mkNode(GEQ, x, c1));
+    Node yGeq2 = Rewriter::rewrite(d_nm->mkNode(GEQ, y, c2));
+    Node yGeq5 = Rewriter::rewrite(d_nm->mkNode(GEQ, y, c5));
+    Node sumGeq3 = Rewriter::rewrite(d_nm->mkNode(GEQ, sum, c3));
+    Node sumGeq6 = Rewriter::rewrite(d_nm->mkNode(GEQ, sum, c6));
+
+    fakeTheoryEnginePreprocess(xGeq1);
+    fakeTheoryEnginePreprocess(yGeq2);
+    fakeTheoryEnginePreprocess(yGeq5);
+    fakeTheoryEnginePreprocess(sumGeq3);
+    fakeTheoryEnginePreprocess(sumGeq6);
+
+    d_arith->presolve();
+
+    // the bounds give x and y a lower bound, which queues the row of x + y
+    d_arith->assertFact(xGeq1, true);
+    d_arith->assertFact(yGeq2, true);
+    d_arith->check(d_level);
+    d_arith->propagate(d_level);
+    TS_ASSERT(wasImplied(sumGeq3));
+    TS_ASSERT(!wasImplied(sumGeq6));
+
+    // a stronger bound leaves the counts of the row unchanged
+    d_outputChannel.clear();
+    d_arith->assertFact(yGeq5, true);
+    d_arith->check(d_level);
+    d_arith->propagate(d_level);
+    TS_ASSERT(wasImplied(sumGeq6));
+  }
 };
@@ -0,0 +1,132 @@
+/*********************                                                        */
+/*! \file theory_bv_aig_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of the and-inverter graphs for bit-blasting
+ **
+ ** White box testing of CVC4::theory::bv::AigManager.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "theory/bv/bitblast/aig.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::bv;
+
+using namespace std;
+
+class TheoryBvAigWhite : public CxxTest::TestSuite
+{
+  /** Sets the inputs to the bits of assignment and evaluates aig. */
+  static void evaluate(const AigManager& aig,
+                       const vector<AigEdge>& inputs,
+                       unsigned assignment,
+                       vector<bool>& values)
+  {
+    values.assign(aig.getNumNodes(), false);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+      values[inputs[i].getNode()] = (assignment >> i) & 1;
+    }
+    aig.evaluate(values);
+  }
+
+ public:
+  void testConstantPropagation()
+  {
+    AigManager aig;
+    AigEdge x = aig.mkInput();
+    TS_ASSERT_EQUALS(aig.mkAnd(x, AigEdge::mkFalse()), AigEdge::mkFalse());
+    TS_ASSERT_EQUALS(aig.mkAnd(AigEdge::mkTrue(), x), x);
+    TS_ASSERT_EQUALS(aig.mkAnd(x, x), x);
+    TS_ASSERT_EQUALS(aig.mkAnd(x, ~x), AigEdge::mkFalse());
+    TS_ASSERT_EQUALS(aig.mkOr(x, ~x), AigEdge::mkTrue());
+    TS_ASSERT_EQUALS(aig.mkXor(x, x), AigEdge::mkFalse());
+    TS_ASSERT_EQUALS(aig.mkIte(AigEdge::mkTrue(), x, ~x), x);
+    TS_ASSERT_EQUALS(aig.getNumAnds(), 0u);
+  }
+
+  void testStructuralHashing()
+  {
+    AigManager aig;
+    AigEdge x = aig.mkInput();
+    AigEdge y = aig.mkInput();
+    AigEdge z = aig.mkInput();
+    AigEdge xy = aig.mkAnd(x, y);
+    TS_ASSERT_EQUALS(aig.mkAnd(y, x), xy);
+    TS_ASSERT_EQUALS(aig.getNumAnds(), 1u);
+    TS_ASSERT_EQUALS(aig.getNumHashHits(), 1u);
+
+    // building the same adder bit twice creates its gates once
+    AigEdge sum = aig.mkXor(aig.mkXor(x, y), z);
+    AigEdge carry = aig.mkOr(xy, aig.mkAnd(z, aig.mkXor(x, y)));
+    size_t ands = aig.getNumAnds();
+    TS_ASSERT_EQUALS(aig.mkXor(aig.mkXor(x, y), z), sum);
+    TS_ASSERT_EQUALS(aig.mkOr(aig.mkAnd(y, x), aig.mkAnd(aig.mkXor(y, x), z)),
+                     carry);
+    TS_ASSERT_EQUALS(aig.getNumAnds(), ands);
+  }
+
+  void testTwoLevelRewriting()
+  {
+    AigManager aig;
+    AigEdge x = aig.mkInput();
+    AigEdge y = aig.mkInput();
+    AigEdge z = aig.mkInput();
+    AigEdge xy = aig.mkAnd(x, y);
+    AigEdge notXz = aig.mkAnd(~x, z);
+
+    // contradiction
+    TS_ASSERT_EQUALS(aig.mkAnd(xy, ~x), AigEdge::mkFalse());
+    TS_ASSERT_EQUALS(aig.mkAnd(xy, notXz), AigEdge::mkFalse());
+    // idempotence
+    TS_ASSERT_EQUALS(aig.mkAnd(y, xy), xy);
+    // subsumption
+    TS_ASSERT_EQUALS(aig.mkAnd(~xy, ~x), ~x);
+    TS_ASSERT_EQUALS(aig.mkAnd(~xy, notXz), notXz);
+    // substitution
+    TS_ASSERT_EQUALS(aig.mkAnd(~xy, x), aig.mkAnd(x, ~y));
+    // resolution
+    TS_ASSERT_EQUALS(aig.mkAnd(~xy, ~aig.mkAnd(x, ~y)), ~x);
+    TS_ASSERT_LESS_THAN(0u, aig.getNumRewrites());
+  }
+
+  void testEvaluate()
+  {
+    AigManager aig;
+    vector<AigEdge> inputs;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      inputs.push_back(aig.mkInput());
+    }
+    AigEdge x = inputs[0], y = inputs[1], z = inputs[2];
+    AigEdge xorXy = aig.mkXor(x, y);
+    AigEdge ite = aig.mkIte(x, y, z);
+    AigEdge majority =
+        aig.mkOr(aig.mkAnd(x, y), aig.mkOr(aig.mkAnd(x, z), aig.mkAnd(y, z)));
+    AigEdge rewritten = aig.mkAnd(~aig.mkAnd(x, y), aig.mkOr(x, z));
+
+    vector<bool> values;
+    for (unsigned assignment = 0; assignment < 8; ++assignment)
+    {
+      evaluate(aig, inputs, assignment, values);
+      bool vx = assignment & 1, vy = assignment & 2, vz = assignment & 4;
+      TS_ASSERT_EQUALS(AigManager::getValue(values, xorXy), vx != vy);
+      TS_ASSERT_EQUALS(AigManager::getValue(values, ite), vx ? vy : vz);
+      TS_ASSERT_EQUALS(AigManager::getValue(values, majority),
+                       (vx && vy) || (vx && vz) || (vy && vz));
+      TS_ASSERT_EQUALS(AigManager::getValue(values, rewritten),
+                       !(vx && vy) && (vx || vz));
+    }
+  }
+};
@@ -0,0 +1,120 @@
+/*********************                                                        */
+/*! \file theory_bv_propagation_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2020 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of the domains of the bit-vector propagation
+ ** solver
+ **
+ ** White box testing of CVC4::theory::bv::PropagationDomain.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "theory/bv/bv_subtheory_propagation.h"
+#include "util/bitvector.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::bv;
+
+using namespace std;
+
+class TheoryBvPropagationWhite : public CxxTest::TestSuite
+{
+  static const unsigned d_size = 4;
+
+  static BitVector bv(unsigned value) { return BitVector(d_size, value); }
+
+ public:
+  void testFixedBits()
+  {
+    PropagationDomain d(d_size);
+    TS_ASSERT(d.fix(bv(0x5), bv(0x4)));
+    TS_ASSERT(d.contains(bv(0x4)));
+    TS_ASSERT(d.contains(bv(0xe)));
+    TS_ASSERT(!d.contains(bv(0x5)));
+    TS_ASSERT(!d.isFixed());
+    // conflicting bits empty the domain
+    PropagationDomain e = d;
+    TS_ASSERT(!e.fix(bv(0x4), bv(0x0)));
+    TS_ASSERT(d.fix(bv(0xa), bv(0x8)));
+    TS_ASSERT(d.isFixed());
+    BitVector value;
+    TS_ASSERT(d.project(bv(0), value));
+    TS_ASSERT_EQUALS(value, bv(0xc));
+  }
+
+  void testInterval()
+  {
+    PropagationDomain d(d_size);
+    TS_ASSERT(d.restrictInterval(bv(3), bv(9)));
+    TS_ASSERT(d.fix(bv(0x1), bv(0x0)));
+    BitVector value;
+    TS_ASSERT(d.project(bv(0), value));
+    TS_ASSERT_EQUALS(value, bv(4));
+    TS_ASSERT(d.project(bv(15), value));
+    TS_ASSERT_EQUALS(value, bv(8));
+    TS_ASSERT(d.project(bv(7), value));
+    TS_ASSERT_EQUALS(value, bv(6));
+    // no even value in [5, 5]
+    TS_ASSERT(!d.restrictInterval(bv(5), bv(5)));
+  }
+
+  /**
+   * Compares the smallest and largest values of all domains of 4 bits with a
+   * fixed bit pattern and an interval to the values found by enumeration.
+   */
+  void testExhaustive()
+  {
+    for (unsigned mask = 0; mask < 16; ++mask)
+    {
+      for (unsigned bits = 0; bits < 16; ++bits)
+      {
+        if ((bits & ~mask) != 0)
+        {
+          continue;
+        }
+        for (unsigned min = 0; min < 16; ++min)
+        {
+          for (unsigned max = min; max < 16; ++max)
+          {
+            vector<unsigned> values;
+            for (unsigned v = min; v <= max; ++v)
+            {
+              if ((v & mask) == bits)
+              {
+                values.push_back(v);
+              }
+            }
+            PropagationDomain d(d_size);
+            bool nonEmpty =
+                d.fix(bv(mask), bv(bits)) && d.restrictInterval(bv(min), bv(max));
+            TS_ASSERT_EQUALS(nonEmpty, !values.empty());
+            if (!nonEmpty)
+            {
+              continue;
+            }
+            BitVector value;
+            TS_ASSERT(d.project(bv(0), value));
+            TS_ASSERT_EQUALS(value, bv(values.front()));
+            TS_ASSERT(d.project(bv(15), value));
+            TS_ASSERT_EQUALS(value, bv(values.back()));
+            for (unsigned v = 0; v < 16; ++v)
+            {
+              TS_ASSERT(d.project(bv(v), value));
+              TS_ASSERT(d.contains(value));
+            }
+          }
+        }
+      }
+    }
+  }
+};
@@ -556,4 +556,36 @@ public:
       }
     }
   }
+
+  void testWordBoundary()
+  {
+    // operations crossing the range of 64-bit integers
+    Integer max("9223372036854775807");
+    Integer min("-9223372036854775808");
+    Integer two64("18446744073709551616");
+    TS_ASSERT_EQUALS(max + 1, -min);
+    TS_ASSERT_EQUALS((max + 1) - 1, max);
+    TS_ASSERT_EQUALS(min - 1 + 1, min);
+    TS_ASSERT_EQUALS(-(-min), min);
+    TS_ASSERT_EQUALS((max + 1) * 2, two64);
+    TS_ASSERT_EQUALS(two64.exactQuotient(Integer(4)),
+                     Integer(1).multiplyByPow2(62));
+    TS_ASSERT_EQUALS(max * max - max * max, Integer(0));
+    TS_ASSERT(max < max + 1);
+    TS_ASSERT(min - 1 < min);
+    TS_ASSERT(-two64 < min);
+    TS_ASSERT_EQUALS(Integer(-3).pow(41), Integer("-36472996377170786403"));
+    TS_ASSERT_EQUALS(min.abs(), max + 1);
+    TS_ASSERT_EQUALS(min.floorDivideQuotient(Integer(-1)), max + 1);
+    TS_ASSERT_EQUALS(two64.floorDivideRemainder(max), Integer(2));
+    TS_ASSERT_EQUALS(max.gcd(min), Integer(1));
+    TS_ASSERT_EQUALS(min.gcd(two64), max + 1);
+    TS_ASSERT_EQUALS((max + 1).length(), 64u);
+    TS_ASSERT_EQUALS(max.length(), 63u);
+    TS_ASSERT_EQUALS(min.isPow2(), 0u);
+    TS_ASSERT_EQUALS((max + 1).isPow2(), 64u);
+    TS_ASSERT_EQUALS(min.toString(), "-9223372036854775808");
+    TS_ASSERT_EQUALS((min * -1).toString(16), "8000000000000000");
+    TS_ASSERT_EQUALS(min.hash(), (max + 1).hash());
+  }
 };
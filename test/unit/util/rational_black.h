@@ -44,4 +44,31 @@ public:
     TS_ASSERT_THROWS( Rational::fromDecimal("Hello, world!");, const std::invalid_argument& );
   }
 
+  void testWordBoundary()
+  {
+    // operations crossing the range of 64-bit integers
+    Integer max("9223372036854775807");
+    Rational q(max, Integer(2));
+    Rational r(Integer(1), max);
+    TS_ASSERT_EQUALS(q + q, Rational(max));
+    TS_ASSERT_EQUALS(q * 2 - q, q);
+    TS_ASSERT_EQUALS((q + 1) - 1, q);
+    TS_ASSERT_EQUALS(q * r, Rational(1, 2));
+    TS_ASSERT_EQUALS(r + r - r, r);
+    TS_ASSERT_EQUALS((r * r).getDenominator(), max * max);
+    TS_ASSERT_EQUALS((r * r) / r, r);
+    TS_ASSERT_EQUALS(r.inverse(), Rational(max));
+    TS_ASSERT_EQUALS((q * q).floor(),
+                     Integer("21267647932558653961849226946058125312"));
+    TS_ASSERT_EQUALS(q.ceiling(), Integer("4611686018427387904"));
+    TS_ASSERT_EQUALS((-q).floor(), Integer("-4611686018427387904"));
+    TS_ASSERT(q < q + r);
+    TS_ASSERT(r * r < r);
+    TS_ASSERT(-q < -(q * r));
+    TS_ASSERT(q.cmp(Rational(Integer(max - 1), Integer(2))) > 0);
+    TS_ASSERT_EQUALS((q * q).toString(),
+                     "85070591730234615847396907784232501249/4");
+    TS_ASSERT_EQUALS(Rational(-6, -4).toString(), "3/2");
+  }
+
 };